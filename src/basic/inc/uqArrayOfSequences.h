@@ -141,6 +141,16 @@ public:
                                      unsigned int             numPos,
                                      unsigned int             numSum,
                                      V&                       autoCorrsSumVec) const;
+
+  //! Estimates, per component, the integrated autocorrelation time and the effective sample size.
+  /*! The autocovariances of all components are computed in one FFT call, with lags up to \c numPos-1,
+   * and then truncated with Geyer's or Sokal's rule, as in uqSequenceOfVectorsClass. */
+  void         effectiveSampleSize  (unsigned int             initialPos,
+                                     unsigned int             numPos,
+                                     const std::string&       iactMethod,
+                                     double                   sokalWindowFactor,
+                                     V&                       iactVec,
+                                     V&                       essVec) const;
    //! Given an initial position \c initialPos, finds the minimum and the maximum values of the sequence.
   void         minMax               (unsigned int             initialPos,
                                      V&                       minVec,
@@ -213,6 +223,12 @@ public:
                                      unsigned int                   paramId,
                                      uqScalarSequenceClass<double>& scalarSeq) const;
 
+  //! Estimates, for each sequence of the array, the cdf at \c evalPositionsVecs and its statistical accuracy.
+  void         subCdfStacc          (unsigned int                   initialPos,
+                                     const std::vector<V*>&         evalPositionsVecs,
+                                     std::vector<V*>&               cdfVecs,
+                                     std::vector<V*>&               cdfStaccVecs) const;
+
 #ifdef UQ_ALSO_COMPUTE_MDFS_WITHOUT_KDE
   void         uniformlySampledMdf  (const V&                       numEvaluationPointsVec,
                                      uqArrayOfOneDGridsClass <V,M>& mdfGrids,
@@ -681,6 +697,60 @@ uqArrayOfSequencesClass<V,M>::autoCorrViaFft(
 // --------------------------------------------------
 template <class V, class M>
 void
+uqArrayOfSequencesClass<V,M>::effectiveSampleSize(
+  unsigned int       initialPos,
+  unsigned int       numPos,
+  const std::string& iactMethod,
+  double             sokalWindowFactor,
+  V&                 iactVec,
+  V&                 essVec) const
+{
+  bool bRC = ((initialPos              <  this->subSequenceSize()) &&
+              (1                       <  numPos                 ) &&
+              ((initialPos+numPos)     <= this->subSequenceSize()) &&
+              (iactVec.sizeLocal()     == this->vectorSizeLocal()) &&
+              (essVec.sizeLocal()      == this->vectorSizeLocal()) &&
+              ((iactMethod == UQ_IACT_GEYER_METHOD) || (iactMethod == UQ_IACT_SOKAL_METHOD)));
+  UQ_FATAL_TEST_MACRO(bRC == false,
+                      m_env.worldRank(),
+                      "uqArrayOfSequencesClass<V,M>::effectiveSampleSize()",
+                      "invalid input data");
+
+  // One contiguous, centered block per component
+  unsigned int numParams = this->vectorSizeLocal();
+  std::vector<double> rawData(numParams*numPos,0.);
+  for (unsigned int i = 0; i < numParams; ++i) {
+    const uqScalarSequenceClass<double>& seq = *(m_scalarSequences(i,0));
+    double meanValue = seq.subMeanExtra(initialPos,
+                                        numPos);
+    for (unsigned int j = 0; j < numPos; ++j) {
+      rawData[i*numPos+j] = seq[initialPos+j] - meanValue; // IMPORTANT
+    }
+  }
+
+  unsigned int maxLag = numPos-1;
+  std::vector<double> autoCovs(0,0.);
+  m_fftObj->autoCorrelations(rawData,
+                             numParams,
+                             maxLag,
+                             autoCovs);
+
+  for (unsigned int i = 0; i < numParams; ++i) {
+    const double* paramAutoCovs = &autoCovs[i*(maxLag+1)];
+    if (iactMethod == UQ_IACT_GEYER_METHOD) {
+      iactVec[i] = uqMiscGeyerIntegratedAutoCorrTime(paramAutoCovs,maxLag+1);
+    }
+    else {
+      iactVec[i] = uqMiscSokalIntegratedAutoCorrTime(paramAutoCovs,maxLag+1,sokalWindowFactor);
+    }
+    essVec[i] = ((double) numPos)/iactVec[i];
+  }
+
+  return;
+}
+// --------------------------------------------------
+template <class V, class M>
+void
 uqArrayOfSequencesClass<V,M>::minMax(
   unsigned int initialPos,
   V&           minVec,
@@ -957,6 +1027,54 @@ uqArrayOfSequencesClass<V,M>::extractScalarSeq(
   return;
 }
 // --------------------------------------------------
+template <class V, class M>
+void
+uqArrayOfSequencesClass<V,M>::subCdfStacc(
+  unsigned int           initialPos,
+  const std::vector<V*>& evalPositionsVecs,
+  std::vector<V*>&       cdfVecs,
+  std::vector<V*>&       cdfStaccVecs) const
+{
+  bool bRC = ((initialPos               <  this->subSequenceSize() ) &&
+              (0                        <  evalPositionsVecs.size()) &&
+              (evalPositionsVecs.size() == cdfVecs.size()          ) &&
+              (evalPositionsVecs.size() == cdfStaccVecs.size()     ));
+  UQ_FATAL_TEST_MACRO(bRC == false,
+                      m_env.worldRank(),
+                      "uqArrayOfSequencesClass<V,M>::subCdfStacc()",
+                      "invalid input data");
+
+  uqArrayOfSequencesClass<V,M>* tmp = const_cast<uqArrayOfSequencesClass<V,M>*>(this);
+
+  unsigned int numEvals = evalPositionsVecs.size();
+  for (unsigned int j = 0; j < numEvals; ++j) {
+    cdfVecs     [j] = new V(m_vectorSpace.zeroVector());
+    cdfStaccVecs[j] = new V(m_vectorSpace.zeroVector());
+  }
+  std::vector<double> evalPositions(numEvals,0.);
+  std::vector<double> cdfs         (numEvals,0.);
+  std::vector<double> cdfStaccs    (numEvals,0.);
+
+  for (unsigned int i = 0; i < (unsigned int) m_scalarSequences.MyLength(); ++i) {
+    const uqScalarSequenceClass<double>& seq = *(tmp->m_scalarSequences(i,0));
+    for (unsigned int j = 0; j < numEvals; ++j) {
+      evalPositions[j] = (*evalPositionsVecs[j])[i];
+    }
+
+    seq.subCdfStacc(initialPos,
+                    evalPositions,
+                    cdfs,
+                    cdfStaccs);
+
+    for (unsigned int j = 0; j < numEvals; ++j) {
+      (*cdfVecs     [j])[i] = cdfs     [j];
+      (*cdfStaccVecs[j])[i] = cdfStaccs[j];
+    }
+  }
+
+  return;
+}
+// --------------------------------------------------
 // Private method -----------------------------------
 template <class V, class M>
 void
@@ -0,0 +1,83 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+// 
+// QUESO - a library to support the Quantification of Uncertainty
+// for Estimation, Simulation and Optimization
+//
+// Copyright (C) 2008,2009,2010,2011,2012,2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor, 
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+// 
+// $Id$
+//
+//--------------------------------------------------------------------------
+
+#ifndef __UQ_FIXED_VECTOR_SPACE_H__
+#define __UQ_FIXED_VECTOR_SPACE_H__
+
+#include <uqVectorSpace.h>
+#include <uqFixedMatrix.h>
+
+/*! \file uqFixedVectorSpace.h
+    \brief Vector space specializations for the fixed dimension backend.
+    
+    The specializations of uqVectorSpaceClass<uqFixedVectorClass<N>,uqFixedMatrixClass<N> >
+    for N = 1, ..., UQ_FIXED_VECTOR_SPACE_MAX_DIM are compiled into the library. Applications
+    needing a larger N expand UQ_FIXED_VECTOR_SPACE_SPECIALIZATIONS(N) in one of their own
+    source files. Components are replicated in all processors of the subenvironment, as
+    with uqGslVectorClass.
+*/
+
+#define UQ_FIXED_VECTOR_SPACE_MAX_DIM 20
+
+#define UQ_FIXED_VECTOR_SPACE_SPECIALIZATIONS(N)                                                    \
+template <>                                                                                         \
+uqMapClass*                                                                                         \
+uqVectorSpaceClass<uqFixedVectorClass<N>,uqFixedMatrixClass<N> >::newMap()                          \
+{                                                                                                   \
+  return new uqMapClass(m_dimGlobal,0,m_env.selfComm());                                            \
+}                                                                                                   \
+                                                                                                    \
+template<>                                                                                          \
+uqFixedVectorClass<N>*                                                                              \
+uqVectorSpaceClass<uqFixedVectorClass<N>,uqFixedMatrixClass<N> >::newVector() const                 \
+{                                                                                                   \
+  return new uqFixedVectorClass<N>(m_env,*m_map);                                                   \
+}                                                                                                   \
+                                                                                                    \
+template<>                                                                                          \
+uqFixedVectorClass<N>*                                                                              \
+uqVectorSpaceClass<uqFixedVectorClass<N>,uqFixedMatrixClass<N> >::newVector(double value) const     \
+{                                                                                                   \
+  return new uqFixedVectorClass<N>(m_env,*m_map,value);                                             \
+}                                                                                                   \
+                                                                                                    \
+template<>                                                                                          \
+uqFixedMatrixClass<N>*                                                                              \
+uqVectorSpaceClass<uqFixedVectorClass<N>,uqFixedMatrixClass<N> >::newMatrix() const                 \
+{                                                                                                   \
+  return new uqFixedMatrixClass<N>(m_env,*m_map,this->dimGlobal());                                 \
+}                                                                                                   \
+                                                                                                    \
+template<>                                                                                          \
+uqFixedMatrixClass<N>*                                                                              \
+uqVectorSpaceClass<uqFixedVectorClass<N>,uqFixedMatrixClass<N> >::newDiagMatrix(double diagValue) const \
+{                                                                                                   \
+  return new uqFixedMatrixClass<N>(m_env,*m_map,diagValue);                                         \
+}
+
+#endif // __UQ_FIXED_VECTOR_SPACE_H__
@@ -33,6 +33,11 @@
 #include <uqVectorSubset.h>
 #include <uqEnvironment.h>
 #include <uqDefines.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <vector>
 
 //*****************************************************
 // Base class
@@ -300,4 +305,316 @@ uqConstantScalarFunctionClass<V,M>::lnValue(const V& domainVector, const V* doma
 {
   return 0.;
 }
+//*****************************************************
+// Finite difference class
+//*****************************************************
+
+/*!\class uqFiniteDifferenceScalarFunctionClass
+ * \brief A class that supplies finite difference derivatives of a black-box scalar function.
+ *
+ * This class wraps a scalar function that only returns values (e.g. a likelihood computed by a
+ * simulator) and answers requests for gradients, Hessians and Hessian effects in lnValue() with
+ * central differences of the wrapped lnValue(). It can therefore be passed wherever derivatives
+ * are expected, e.g. as the likelihood of a statistical inverse problem solved with local
+ * Hessians ('uqHessianCovMatricesTKGroupClass') or with uqHamiltonianMCSGClass.
+ *
+ * Steps are relative to the magnitude of each component, of order eps^{1/3} for gradients and
+ * eps^{1/4} when a Hessian is requested (eps being the machine precision), and are halved until
+ * the stencil fits in the domain. The center value and the 2d axis points are shared between the
+ * gradient and the diagonal of the Hessian, and results at the last point are cached, so that a
+ * value request following a derivative request at the same point costs nothing.
+ *
+ * If 'evaluateStencilInParallel' is true, the stencil points are split among the processors of the
+ * sub environment, which then exchange the values. This requires lnValue() to be called by all
+ * processors of the sub environment at the same point, which is what
+ * uqScalarFunctionSynchronizerClass does, and requires the wrapped function to be evaluable by each
+ * processor on its own (i.e., it must not communicate over the sub environment itself). */
+
+template<class V,class M>
+class uqFiniteDifferenceScalarFunctionClass : public uqBaseScalarFunctionClass<V,M> {
+public:
+  //! @name Constructor/Destructor methods
+  //@{
+  //! Default constructor.
+  /*! Instantiates a finite difference wrapper of 'lnFunction', with the same domain set.*/
+  uqFiniteDifferenceScalarFunctionClass(const char*                           prefix,
+                                        const uqBaseScalarFunctionClass<V,M>& lnFunction,
+                                        bool                                  evaluateStencilInParallel);
+  //! Virtual destructor
+  virtual ~uqFiniteDifferenceScalarFunctionClass();
+  //@}
+
+  //! @name Mathematical methods
+  //@{
+  //! Calculates the actual value of this scalar function, and its derivatives if requested.
+  double       actualValue     (const V& domainVector, const V* domainDirection, V* gradVector, M* hessianMatrix, V* hessianEffect) const;
+
+  //! Calculates the logarithm of the value of this scalar function, and its derivatives if requested.
+  double       lnValue         (const V& domainVector, const V* domainDirection, V* gradVector, M* hessianMatrix, V* hessianEffect) const;
+
+  //! Number of calls to the wrapped function made by this processor so far.
+  unsigned int numFunctionCalls() const;
+  //@}
+protected:
+  //! Updates the cached value at 'domainVector', if it is not the last point evaluated.
+  void         setPoint          (const V& domainVector) const;
+
+  //! Computes the cached gradient and, if 'computeHessian' is true, the cached Hessian at the last point.
+  void         computeDerivatives(bool computeHessian) const;
+
+  //! Evaluates the wrapped function at the points of the stencil, eventually in parallel.
+  void         evaluateStencil   (const std::vector<int>& offsetsI, const std::vector<int>& offsetsJ, std::vector<double>& values) const;
+
+  using uqBaseScalarFunctionClass<V,M>::m_env;
+  using uqBaseScalarFunctionClass<V,M>::m_prefix;
+  using uqBaseScalarFunctionClass<V,M>::m_domainSet;
+
+  const uqBaseScalarFunctionClass<V,M>& m_lnFunction;
+        bool                            m_evaluateStencilInParallel;
+
+  mutable V*                            m_lastPoint;
+  mutable double                        m_lastLnValue;
+  mutable V*                            m_lastGrad;
+  mutable bool                          m_lastGradIsValid;
+  mutable M*                            m_lastHessian;
+  mutable bool                          m_lastHessianIsValid;
+  mutable std::vector<double>           m_steps;
+  mutable unsigned int                  m_numFunctionCalls;
+};
+// Default constructor -----------------------------
+template<class V,class M>
+uqFiniteDifferenceScalarFunctionClass<V,M>::uqFiniteDifferenceScalarFunctionClass(
+  const char*                           prefix,
+  const uqBaseScalarFunctionClass<V,M>& lnFunction,
+  bool                                  evaluateStencilInParallel)
+  :
+  uqBaseScalarFunctionClass<V,M>(((std::string)(prefix)+"fd").c_str(), lnFunction.domainSet()),
+  m_lnFunction               (lnFunction),
+  m_evaluateStencilInParallel(evaluateStencilInParallel),
+  m_lastPoint                (NULL),
+  m_lastLnValue              (0.),
+  m_lastGrad                 (NULL),
+  m_lastGradIsValid          (false),
+  m_lastHessian              (NULL),
+  m_lastHessianIsValid       (false),
+  m_steps                    (0),
+  m_numFunctionCalls         (0)
+{
+}
+// Destructor ---------------------------------------
+template<class V,class M>
+uqFiniteDifferenceScalarFunctionClass<V,M>::~uqFiniteDifferenceScalarFunctionClass()
+{
+  if (m_lastHessian) delete m_lastHessian;
+  if (m_lastGrad   ) delete m_lastGrad;
+  if (m_lastPoint  ) delete m_lastPoint;
+}
+// Math methods -------------------------------------
+template<class V,class M>
+double
+uqFiniteDifferenceScalarFunctionClass<V,M>::actualValue(const V& domainVector, const V* domainDirection, V* gradVector, M* hessianMatrix, V* hessianEffect) const
+{
+  V* lnGrad = gradVector;
+  if ((lnGrad == NULL) && (hessianMatrix || hessianEffect)) lnGrad = m_domainSet.vectorSpace().newVector();
+  M* lnHessian = hessianMatrix;
+  if ((lnHessian == NULL) && hessianEffect) lnHessian = m_domainSet.vectorSpace().newMatrix();
+
+  double value = std::exp(this->lnValue(domainVector,NULL,lnGrad,lnHessian,NULL));
+
+  // d2(exp f) = exp(f) * (d2f + df df^T)
+  if (lnHessian) {
+    *lnHessian += matrixProduct(*lnGrad,*lnGrad);
+    *lnHessian *= value;
+  }
+  if (hessianEffect) {
+    UQ_FATAL_TEST_MACRO(domainDirection == NULL,
+                        m_env.worldRank(),
+                        "uqFiniteDifferenceScalarFunctionClass<V,M>::actualValue()",
+                        "hessianEffect requires domainDirection");
+    *hessianEffect = (*lnHessian) * (*domainDirection);
+  }
+  if (gradVector) *gradVector *= value;
+
+  if (lnHessian != hessianMatrix) delete lnHessian;
+  if (lnGrad    != gradVector   ) delete lnGrad;
+
+  return value;
+}
+//--------------------------------------------------
+template<class V,class M>
+double
+uqFiniteDifferenceScalarFunctionClass<V,M>::lnValue(const V& domainVector, const V* domainDirection, V* gradVector, M* hessianMatrix, V* hessianEffect) const
+{
+  this->setPoint(domainVector);
+
+  bool needHessian = (hessianMatrix != NULL) || (hessianEffect != NULL);
+  if (((gradVector != NULL) && (m_lastGradIsValid    == false)) ||
+      ((needHessian       ) && (m_lastHessianIsValid == false))) {
+    this->computeDerivatives(needHessian);
+  }
+
+  if (gradVector   ) *gradVector    = *m_lastGrad;
+  if (hessianMatrix) *hessianMatrix = *m_lastHessian;
+  if (hessianEffect) {
+    UQ_FATAL_TEST_MACRO(domainDirection == NULL,
+                        m_env.worldRank(),
+                        "uqFiniteDifferenceScalarFunctionClass<V,M>::lnValue()",
+                        "hessianEffect requires domainDirection");
+    *hessianEffect = (*m_lastHessian) * (*domainDirection);
+  }
+
+  return m_lastLnValue;
+}
+//--------------------------------------------------
+template<class V,class M>
+unsigned int
+uqFiniteDifferenceScalarFunctionClass<V,M>::numFunctionCalls() const
+{
+  return m_numFunctionCalls;
+}
+//--------------------------------------------------
+template<class V,class M>
+void
+uqFiniteDifferenceScalarFunctionClass<V,M>::setPoint(const V& domainVector) const
+{
+  if (m_lastPoint == NULL) {
+    m_lastPoint   = m_domainSet.vectorSpace().newVector();
+    m_lastGrad    = m_domainSet.vectorSpace().newVector();
+    m_lastHessian = m_domainSet.vectorSpace().newMatrix();
+  }
+  else if (*m_lastPoint == domainVector) {
+    return;
+  }
+
+  *m_lastPoint         = domainVector;
+  m_lastLnValue        = m_lnFunction.lnValue(domainVector,NULL,NULL,NULL,NULL);
+  m_lastGradIsValid    = false;
+  m_lastHessianIsValid = false;
+  m_numFunctionCalls++;
+
+  return;
+}
+//--------------------------------------------------
+template<class V,class M>
+void
+uqFiniteDifferenceScalarFunctionClass<V,M>::computeDerivatives(bool computeHessian) const
+{
+  const V&     x = *m_lastPoint;
+  unsigned int n = x.sizeLocal();
+
+  m_lastGrad->cwSet(0.);
+  m_lastHessian->cwSet(0.);
+  m_lastGradIsValid    = true;
+  m_lastHessianIsValid = computeHessian;
+  if ((m_domainSet.contains(x) == false) ||
+      (m_lastLnValue           == -INFINITY)) {
+    return;
+  }
+
+  // Relative steps, exactly representable, shrunk until the axis points fit in the domain
+  double relativeStep = std::pow(std::numeric_limits<double>::epsilon(),computeHessian ? 0.25 : 1./3.);
+  m_steps.resize(n,0.);
+  V trialPoint(x);
+  for (unsigned int i = 0; i < n; ++i) {
+    double h = relativeStep * std::max(std::fabs(x[i]),1.);
+    bool   fits = false;
+    for (unsigned int k = 0; (k < 30) && (fits == false); ++k, h *= 0.5) {
+      volatile double xPlusH = x[i] + h;
+      m_steps[i]    = xPlusH - x[i];
+      trialPoint[i] = x[i] + m_steps[i];
+      fits          = m_domainSet.contains(trialPoint);
+      trialPoint[i] = x[i] - m_steps[i];
+      fits          = fits && m_domainSet.contains(trialPoint);
+    }
+    trialPoint[i] = x[i];
+    UQ_FATAL_TEST_MACRO(fits == false,
+                        m_env.worldRank(),
+                        "uqFiniteDifferenceScalarFunctionClass<V,M>::computeDerivatives()",
+                        "central difference stencil does not fit in the domain");
+  }
+
+  // Stencil: offsets are +(i+1) or -(i+1) along axis i, 0 meaning no offset
+  std::vector<int> offsetsI(0);
+  std::vector<int> offsetsJ(0);
+  for (unsigned int i = 0; i < n; ++i) {
+    offsetsI.push_back( (int) (i+1)); offsetsJ.push_back(0);
+    offsetsI.push_back(-(int) (i+1)); offsetsJ.push_back(0);
+  }
+  if (computeHessian) {
+    for (unsigned int i = 0; i < n; ++i) {
+      for (unsigned int j = i+1; j < n; ++j) {
+        offsetsI.push_back( (int) (i+1)); offsetsJ.push_back( (int) (j+1));
+        offsetsI.push_back( (int) (i+1)); offsetsJ.push_back(-(int) (j+1));
+        offsetsI.push_back(-(int) (i+1)); offsetsJ.push_back( (int) (j+1));
+        offsetsI.push_back(-(int) (i+1)); offsetsJ.push_back(-(int) (j+1));
+      }
+    }
+  }
+
+  std::vector<double> values(0);
+  this->evaluateStencil(offsetsI,offsetsJ,values);
+
+  for (unsigned int i = 0; i < n; ++i) {
+    double fPlus  = values[2*i  ];
+    double fMinus = values[2*i+1];
+    (*m_lastGrad)[i] = (fPlus - fMinus)/(2.*m_steps[i]);
+    if (computeHessian) {
+      (*m_lastHessian)(i,i) = (fPlus - 2.*m_lastLnValue + fMinus)/(m_steps[i]*m_steps[i]);
+    }
+  }
+  if (computeHessian) {
+    unsigned int k = 2*n;
+    for (unsigned int i = 0; i < n; ++i) {
+      for (unsigned int j = i+1; j < n; ++j, k += 4) {
+        double hij = (values[k] - values[k+1] - values[k+2] + values[k+3])/(4.*m_steps[i]*m_steps[j]);
+        (*m_lastHessian)(i,j) = hij;
+        (*m_lastHessian)(j,i) = hij;
+      }
+    }
+  }
+
+  return;
+}
+//--------------------------------------------------
+template<class V,class M>
+void
+uqFiniteDifferenceScalarFunctionClass<V,M>::evaluateStencil(
+  const std::vector<int>&    offsetsI,
+  const std::vector<int>&    offsetsJ,
+        std::vector<double>& values) const
+{
+  unsigned int numPoints = offsetsI.size();
+  unsigned int numProcs  = 1;
+  unsigned int myProc    = 0;
+  if (m_evaluateStencilInParallel) {
+    numProcs = (unsigned int) m_env.subComm().NumProc();
+    myProc   = (unsigned int) m_env.subComm().MyPID();
+  }
+
+  std::vector<double> localValues(numPoints,0.);
+  V point(*m_lastPoint);
+  for (unsigned int k = myProc; k < numPoints; k += numProcs) {
+    unsigned int i = std::abs(offsetsI[k]) - 1;
+    point[i] += (offsetsI[k] > 0 ? 1. : -1.) * m_steps[i];
+    if (offsetsJ[k] != 0) {
+      unsigned int j = std::abs(offsetsJ[k]) - 1;
+      point[j] += (offsetsJ[k] > 0 ? 1. : -1.) * m_steps[j];
+    }
+    localValues[k] = m_lnFunction.lnValue(point,NULL,NULL,NULL,NULL);
+    m_numFunctionCalls++;
+    point = *m_lastPoint;
+  }
+
+  if (numProcs > 1) {
+    values.resize(numPoints,0.);
+    m_env.subComm().Allreduce((void *) &localValues[0], (void *) &values[0], (int) numPoints, uqRawValue_MPI_DOUBLE, uqRawValue_MPI_SUM,
+                              "uqFiniteDifferenceScalarFunctionClass<V,M>::evaluateStencil()",
+                              "failed MPI.Allreduce() for stencil values");
+  }
+  else {
+    values = localValues;
+  }
+
+  return;
+}
 #endif // __UQ_SCALAR_FUNCTION_H__
@@ -127,6 +127,7 @@ uqScalarFunctionSynchronizerClass<V,M>::callFunction(
             V* internalGrad      = NULL;
             M* internalHessian   = NULL;
             V* internalEffect    = NULL;
+      unsigned long long traceBcast = 0;
 
       /////////////////////////////////////////////////
       // Broadcast 1 of 3
@@ -156,9 +157,11 @@ uqScalarFunctionSynchronizerClass<V,M>::callFunction(
       //if (m_env.subId() != 0) while (true) sleep(1);
 
       int count = (int) bufferChar.size();
+      traceBcast = m_env.tracer().start();
       m_env.subComm().Bcast((void *) &bufferChar[0], count, uqRawValue_MPI_CHAR, 0,
                             "uqScalarFunctionSynchronizerClass<V,M>::callFunction()",
                             "failed broadcast 1 of 3");
+      m_env.tracer().stop(UQ_TRACE_SYNC_BCAST_ID,traceBcast);
 
       m_env.subComm().syncPrintDebugMsg("In uqScalarFunctionSynchronizerClass<V,M>::callFunction(), just after char Bcast()",3,3000000);
       //std::cout << "char contents = " << bufferChar[0] << " " << bufferChar[1] << " " << bufferChar[2] << " " << bufferChar[3] << " " << bufferChar[4]
@@ -203,9 +206,11 @@ uqScalarFunctionSynchronizerClass<V,M>::callFunction(
         //sleep(3);
 
         count = (int) bufferDouble.size();
+        traceBcast = m_env.tracer().start();
         m_env.subComm().Bcast((void *) &bufferDouble[0], count, uqRawValue_MPI_DOUBLE, 0,
                               "uqScalarFunctionSynchronizerClass<V,M>::callFunction()",
                               "failed broadcast 2 of 3");
+        m_env.tracer().stop(UQ_TRACE_SYNC_BCAST_ID,traceBcast);
 
         if (m_env.subRank() != 0) {
           V tmpVec(m_auxVec);
@@ -229,9 +234,11 @@ uqScalarFunctionSynchronizerClass<V,M>::callFunction(
           }
 
           count = (int) bufferDouble.size();
+          traceBcast = m_env.tracer().start();
           m_env.subComm().Bcast((void *) &bufferDouble[0], count, uqRawValue_MPI_DOUBLE, 0,
                                 "uqScalarFunctionSynchronizerClass<V,M>::callFunction()",
                                 "failed broadcast 3 of 3");
+          m_env.tracer().stop(UQ_TRACE_SYNC_BCAST_ID,traceBcast);
 
           if (m_env.subRank() != 0) {
             V tmpVec(m_auxVec);
@@ -36,11 +36,17 @@
 #include <uqDefines.h>
 #include <vector>
 #include <complex>
+#include <algorithm>
 #include <sys/time.h>
 
-#define SCALAR_SEQUENCE_INIT_MPI_MSG 1
-#define SCALAR_SEQUENCE_SIZE_MPI_MSG 1
-#define SCALAR_SEQUENCE_DATA_MPI_MSG 1
+//! Number of regularly spaced order statistics each processor contributes to approximate unified quantiles.
+#define UQ_SCALAR_SEQUENCE_NUM_QUANTILE_SAMPLES 1000
+
+//! Number of indicator series whose auto-correlations are computed in one blocked FFT pass by subCdfIndicatorIacts().
+#define UQ_SCALAR_SEQUENCE_CDF_STACC_BLOCK_SIZE 8
+
+//! Number of cdf levels at which subCdfStacc() estimates integrated auto-correlation times when computing bands at all points.
+#define UQ_SCALAR_SEQUENCE_CDF_STACC_NUM_LEVELS 19
 
 /*! \file uqScalarSequence.h
  * \brief A templated class for handling scalar samples.
@@ -67,6 +73,9 @@ public:
   uqScalarSequenceClass(const uqBaseEnvironmentClass& env,
                         unsigned int subSequenceSize,
                         const std::string& name);
+  //! Copy constructor.
+  /*! Copies the positions of \c src; cached statistics and the FFT object are not shared.*/
+  uqScalarSequenceClass(const uqScalarSequenceClass<T>& src);
   //! Destructor.
   ~uqScalarSequenceClass();
   //@}
@@ -341,9 +350,61 @@ public:
   void         subSort                      (unsigned int                    initialPos,
                                              uqScalarSequenceClass<T>&       sortedSequence) const;
   //! Sorts the unified sequence of scalars.
+  /*! The unified sorted sequence is replicated on every processor of 'inter0Comm'. It is
+   * obtained by gathering the partitions computed by unifiedSampleSort(). */
   void         unifiedSort                  (bool                            useOnlyInter0Comm,
                                              unsigned int                    initialPos,
                                              uqScalarSequenceClass<T>&       unifiedSortedSequence) const;
+  //! Sorts the unified sequence of scalars, leaving it partitioned among the processors of 'inter0Comm'.
+  /*! Parallel sorting by regular sampling: each processor sorts its \c numPos positions starting at
+   * \c initialPos, the gathered regular samples give one splitter per processor, and one all-to-all
+   * exchange moves every value to the processor owning its range. On output, \c localSortedPartition
+   * holds the positions [\c unifiedOffset, \c unifiedOffset + size) of the unified sorted sequence,
+   * which has \c unifiedDataSize positions. No processor ever holds the whole unified sequence.*/
+  void         unifiedSampleSort            (bool                            useOnlyInter0Comm,
+                                             unsigned int                    initialPos,
+                                             unsigned int                    numPos,
+                                             uqScalarSequenceClass<T>&       localSortedPartition,
+                                             unsigned int&                   unifiedOffset,
+                                             unsigned int&                   unifiedDataSize) const;
+  //! Returns regularly spaced samples of the sorted sub-sequence, from which unifiedSampleSort() chooses its splitters.
+  /*! There are min(\c numSamples, size) samples, the i-th one being the value at position i*size/min(\c numSamples, size).*/
+  void         subSortedRegularSamples      (unsigned int                    numSamples,
+                                             std::vector<T>&                 samples) const;
+  //! Sorts the \c samples gathered from all processors and chooses the \c numParts-1 splitters of unifiedSampleSort().
+  /*! Splitter r is the sample at position (r+1)*numSamples/numParts. There are no splitters if there are no samples.*/
+  static void  sampleSortSplitters          (unsigned int                    numParts,
+                                             std::vector<T>&                 samples,
+                                             std::vector<T>&                 splitters);
+  //! Splits the sorted sub-sequence into \c numParts contiguous pieces, piece r holding the values in (splitters[r-1],splitters[r]].
+  /*! The last piece, or the first one if there are no splitters, holds all remaining values.*/
+  void         subSortedPartition           (const std::vector<T>&           splitters,
+                                             unsigned int                    numParts,
+                                             std::vector<int>&               cnts,
+                                             std::vector<int>&               displs) const;
+  //! Merges in place the sorted pieces [displs[r], displs[r]+cnts[r]) of \c data, which must be contiguous, pairwise in log2(pieces) rounds.
+  static void  mergeSortedPieces            (const std::vector<int>&         cnts,
+                                             const std::vector<int>&         displs,
+                                             std::vector<T>&                 data);
+  //! Returns, on every processor of 'inter0Comm', the values at \c unifiedPositions of a unified sorted sequence partitioned by unifiedSampleSort().
+  /*! Collective: every processor contributes the positions it owns, and one reduction completes \c values.*/
+  void         unifiedSortedValues          (bool                            useOnlyInter0Comm,
+                                             const uqScalarSequenceClass<T>& localSortedPartition,
+                                             unsigned int                    unifiedOffset,
+                                             const std::vector<unsigned int>& unifiedPositions,
+                                             std::vector<T>&                 values) const;
+  //! Returns the quantiles of the unified sequence at the given \c probabilities.
+  /*! The quantile at probability p interpolates the unified sorted sequence at position (N+1)p-1,
+   * as in unifiedInterQuantileRange(). If \c approximate is true, the unified sequence is not sorted:
+   * each processor contributes UQ_SCALAR_SEQUENCE_NUM_QUANTILE_SAMPLES regularly spaced order statistics
+   * of its own data, gathered in one collective call, and the rank error of each quantile is at most
+   * about N/UQ_SCALAR_SEQUENCE_NUM_QUANTILE_SAMPLES positions.*/
+  void         unifiedQuantiles             (bool                            useOnlyInter0Comm,
+                                             unsigned int                    initialPos,
+                                             unsigned int                    numPos,
+                                             const std::vector<double>&      probabilities,
+                                             bool                            approximate,
+                                             std::vector<T>&                 quantileValues) const;
   //! Returns the interquartile range of the values in the sub-sequence. 
   /*! The IQR is a robust estimate of the spread of the data, since changes in the upper and
   * lower 25% of the data do not affect it. If there are outliers in the data, then the IQR 
@@ -353,8 +414,11 @@ public:
   T            subInterQuantileRange        (unsigned int                    initialPos) const;
   
   //! Returns the interquartile range of the values in the unified sequence.
+  /*! The quartiles are computed collectively by unifiedQuantiles(), exactly or, if \c approximate
+   * is true, from regularly spaced samples of each processor's data.*/
   T            unifiedInterQuantileRange    (bool                            useOnlyInter0Comm,
-                                             unsigned int                    initialPos) const;
+                                             unsigned int                    initialPos,
+                                             bool                            approximate) const;
 					     
   //! Selects the scales (output value) for the kernel density estimation, considering only the sub-sequence.
   /*! The bandwidth of the kernel is a free parameter which exhibits a strong influence on 
@@ -462,14 +526,6 @@ public:
                                              T&                              lowerValue,
                                              T&                              upperValue) const;
 
-  void         subCdfStacc                  (unsigned int                    initialPos,
-                                             std::vector<double>&            cdfStaccValues,
-                                             std::vector<double>&            cdfStaccValuesup,
-                                             std::vector<double>&            cdfStaccValueslow,
-                                             const uqScalarSequenceClass<T>& sortedDataValues) const;
-  void         subCdfStacc                  (unsigned int                    initialPos,
-                                             const std::vector<T>&           evaluationPositions,
-                                             std::vector<double>&            cdfStaccValues) const;
   void         subUniformlySampledMdf       (unsigned int                    numIntervals,
                                              T&                              minDomainValue,
                                              T&                              maxDomainValue,
@@ -482,6 +538,37 @@ public:
                                              unsigned int                    localNumPos,
                                              const T&                        unifiedMeanValue) const;
 #endif
+  //! Integrated auto-correlation times of the indicator series 1{x_t <= evaluationPositions[j]}.
+  /*! The empirical cdf at each evaluation position is found by binary search in a sorted copy of
+   * the sub-sequence, and the auto-covariances of the centered indicator series are computed with
+   * blocked FFTs, so the cost is O(numEvals n log n) instead of O(numEvals n^2). The evaluation
+   * positions are spread over the processors of the sub-environment, which all work on the data
+   * of subRank 0: all of them must call this method, and all of them get the results. A position
+   * below all values, or not below any value, gets an auto-correlation time of 1. Returns the
+   * number of positions n used.*/
+  unsigned int subCdfIndicatorIacts         (unsigned int                    initialPos,
+                                             const std::vector<T>&           evaluationPositions,
+                                             std::vector<double>&            cdfValues,
+                                             std::vector<double>&            iacts) const;
+
+  //! Empirical cdf and its 95% confidence band at every sorted position of the sub-sequence.
+  /*! The band is p +/- 1.96 sqrt(p(1-p) tau(p)/n), where the auto-correlation time tau(p) of the
+   * indicator series is computed by subCdfIndicatorIacts() at UQ_SCALAR_SEQUENCE_CDF_STACC_NUM_LEVELS
+   * cdf levels and linearly interpolated in between. \c sortedDataValues must hold the sorted
+   * sub-sequence, from position \c initialPos on.*/
+  void         subCdfStacc                  (unsigned int                    initialPos,
+                                             std::vector<double>&            cdfStaccValues,
+                                             std::vector<double>&            cdfStaccValuesup,
+                                             std::vector<double>&            cdfStaccValueslow,
+                                             const uqScalarSequenceClass<T>& sortedDataValues) const;
+
+  //! Empirical cdf, and its statistical accuracy (standard error), at each evaluation position.
+  /*! The standard error at a position where the empirical cdf is p is sqrt(p(1-p) tau/n), tau being
+   * the auto-correlation time of the indicator series (see subCdfIndicatorIacts()).*/
+  void         subCdfStacc                  (unsigned int                    initialPos,
+                                             const std::vector<T>&           evaluationPositions,
+                                             std::vector<double>&            cdfValues,
+                                             std::vector<double>&            cdfStaccValues) const;
 //@}
 private:
   //! Copies the scalar sequence \c src to \c this.
@@ -509,11 +596,9 @@ private:
   
   //! Sorts the sequence of scalars in the private attribute \c m_seq.
   void         subSort                      ();
-  
-  //! Sorts/merges data in parallel using MPI.
-  void         parallelMerge                (std::vector<T>&                 sortedBuffer,
-					     const std::vector<T>&           leafData,
-					     unsigned int                    treeLevel) const;
+
+  //! FFT object shared by the auto-correlation and spectral methods, created on first use.
+  uqFftClass<T>& fftObj                     () const;
 					     
   const uqBaseEnvironmentClass& m_env;
   std::string                   m_name;
@@ -529,6 +614,7 @@ private:
   mutable T*                    m_unifiedMedianPlain;
   mutable T*                    m_subSampleVariancePlain;
   mutable T*                    m_unifiedSampleVariancePlain;
+  mutable uqFftClass<T>*        m_fftObj;
 };
 // Default constructor -----------------------------
 template <class T>
@@ -549,14 +635,37 @@ uqScalarSequenceClass<T>::uqScalarSequenceClass(
   m_subMedianPlain            (NULL),
   m_unifiedMedianPlain        (NULL),
   m_subSampleVariancePlain    (NULL),
-  m_unifiedSampleVariancePlain(NULL)
+  m_unifiedSampleVariancePlain(NULL),
+  m_fftObj                    (NULL)
 {
 }
+// Copy constructor --------------------------------
+template <class T>
+uqScalarSequenceClass<T>::uqScalarSequenceClass(const uqScalarSequenceClass<T>& src)
+  :
+  m_env                       (src.m_env),
+  m_name                      (src.m_name),
+  m_seq                       (0),
+  m_subMinPlain               (NULL),
+  m_unifiedMinPlain           (NULL),
+  m_subMaxPlain               (NULL),
+  m_unifiedMaxPlain           (NULL),
+  m_subMeanPlain              (NULL),
+  m_unifiedMeanPlain          (NULL),
+  m_subMedianPlain            (NULL),
+  m_unifiedMedianPlain        (NULL),
+  m_subSampleVariancePlain    (NULL),
+  m_unifiedSampleVariancePlain(NULL),
+  m_fftObj                    (NULL)
+{
+  this->copy(src);
+}
 // Destructor ---------------------------------------
 template <class T>
 uqScalarSequenceClass<T>::~uqScalarSequenceClass()
 {
   deleteStoredScalars();
+  if (m_fftObj != NULL) delete m_fftObj;
 }
 // Set methods --------------------------------------
 template <class T>
@@ -1557,10 +1666,26 @@ uqScalarSequenceClass<T>::unifiedMedianExtra( // rr0
                           "uqScalarSequenceClass<T>::unifiedMedianExtra()",
                           "invalid input data");
 
-      uqScalarSequenceClass unifiedSortedSequence(m_env,0,"");
-      this->unifiedSort(useOnlyInter0Comm,
-                        initialPos,
-                        unifiedSortedSequence);
+      uqScalarSequenceClass localSortedPartition(m_env,0,"");
+      unsigned int unifiedOffset   = 0;
+      unsigned int unifiedDataSize = 0;
+      this->unifiedSampleSort(useOnlyInter0Comm,
+                              initialPos,
+                              numPos,
+                              localSortedPartition,
+                              unifiedOffset,
+                              unifiedDataSize);
+
+      // Same position as in subMedianExtra()
+      std::vector<unsigned int> unifiedPositions(1,(unsigned int) (0.5 * (double) unifiedDataSize));
+      std::vector<T> values(1,0.);
+      this->unifiedSortedValues(useOnlyInter0Comm,
+                                localSortedPartition,
+                                unifiedOffset,
+                                unifiedPositions,
+                                values);
+      unifiedMedianValue = values[0];
+
       if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 10)) {
         *m_env.subDisplayFile() << "In uqScalarSequenceClass<T>::unifiedMedianExtra()"
                                 << ", unifiedMedianValue = " << unifiedMedianValue
@@ -1569,8 +1694,8 @@ uqScalarSequenceClass<T>::unifiedMedianExtra( // rr0
     }
     else {
       // Node not in the 'inter0' communicator
-      this->subMedianExtra(initialPos,
-                           numPos);
+      unifiedMedianValue = this->subMedianExtra(initialPos,
+                                                numPos);
     }
   }
   else {
@@ -1945,27 +2070,9 @@ uqScalarSequenceClass<T>::autoCorrViaFft(
   unsigned int    maxLag,
   std::vector<T>& autoCorrs) const
 {
-  unsigned int fftSize = 0;
-  {
-    double tmp = log((double) maxLag)/log(2.);
-    double fractionalPart = tmp - ((double) ((unsigned int) tmp));
-    if (fractionalPart > 0.) tmp += (1. - fractionalPart);
-    unsigned int fftSize1 = (unsigned int) std::pow(2.,tmp+1.); // Yes, tmp+1
-    fftSize1 = fftSize1; // To remove warning
-
-    tmp = log((double) numPos)/log(2.);
-    fractionalPart = tmp - ((double) ((unsigned int) tmp));
-    if (fractionalPart > 0.) tmp += (1. - fractionalPart);
-    unsigned int fftSize2 = (unsigned int) std::pow(2.,tmp+1);
-
-    fftSize = fftSize2;
-  }
-
   std::vector<double> rawDataVec(numPos,0.);
-  std::vector<std::complex<double> > resultData(0,std::complex<double>(0.,0.));
-  uqFftClass<T> fftObj(m_env);
+  std::vector<double> autoCovs(0,0.);
 
-  // Forward FFT
   this->extractRawData(initialPos,
                        1, // spacing
                        numPos,
@@ -1976,42 +2083,18 @@ uqScalarSequenceClass<T>::autoCorrViaFft(
     rawDataVec[j] -= meanValue; // IMPORTANT
   }
 
-  rawDataVec.resize(fftSize,0.);
-
-  //if (m_env.subDisplayFile()) {
-  //  *m_env.subDisplayFile() << "In uqScalarSequenceClass<T>::autoCorrViaFft()"
-  //                          << ": about to call fftObj.forward()"
-  //                          << " with rawDataVec.size() = " << rawDataVec.size()
-  //                          << ", fftSize = "            << fftSize
-  //                          << ", resultData.size() = "  << resultData.size()
-  //                          << std::endl;
-  //}
-  fftObj.forward(rawDataVec,fftSize,resultData);
-
-  // Inverse FFT
-  for (unsigned int j = 0; j < fftSize; ++j) {
-    rawDataVec[j] = std::norm(resultData[j]);
-  }
-  //if (m_env.subDisplayFile()) {
-  //  *m_env.subDisplayFile() << "In uqScalarSequenceClass<T>::autoCorrViaFft()"
-  //                          << ": about to call fftObj.inverse()"
-  //                          << " with rawDataVec.size() = " << rawDataVec.size()
-  //                          << ", fftSize = "            << fftSize
-  //                          << ", resultData.size() = "  << resultData.size()
-  //                          << std::endl;
-  //}
-  fftObj.inverse(rawDataVec,fftSize,resultData);
-  //if (m_env.subDisplayFile()) {
-  //  *m_env.subDisplayFile() << "In uqScalarSequenceClass<T>::autoCorrViaFft()"
-  //                          << ": returned succesfully from fftObj.inverse()"
-  //                          << std::endl;
-  //}
+  // Real forward FFT, power spectrum and halfcomplex inverse FFT, zero padded to a
+  // mixed-radix size just large enough to avoid wrap-around up to 'maxLag'
+  this->fftObj().autoCorrelations(rawDataVec,
+                                   1, // numSeqs
+                                   maxLag,
+                                   autoCovs);
 
   // Prepare return data
   autoCorrs.resize(maxLag+1,0.); // Yes, +1
   for (unsigned int j = 0; j < autoCorrs.size(); ++j) {
     double ratio = ((double) j)/((double) (numPos-1));
-    autoCorrs[j] = ( resultData[j].real()/resultData[0].real() )*(1.-ratio);
+    autoCorrs[j] = ( autoCovs[j]/autoCovs[0] )*(1.-ratio);
   }
 
   return;
@@ -2025,23 +2108,12 @@ uqScalarSequenceClass<T>::autoCorrViaFft(
   unsigned int numSum,
   T&           autoCorrsSum) const
 {
-  //if (m_env.subDisplayFile()) {
-  //  *m_env.subDisplayFile() << "Entering uqScalarSequenceClass<T>::autoCorrViaFft(), for sum"
-  //                          << ": initialPos = " << initialPos
-  //                          << ", numPos = "     << numPos
-  //                          << std::endl;
-  //}
-
-  double tmp = log((double) numPos)/log(2.);
-  double fractionalPart = tmp - ((double) ((unsigned int) tmp));
-  if (fractionalPart > 0.) tmp += (1. - fractionalPart);
-  unsigned int fftSize = (unsigned int) std::pow(2.,tmp+1);
+  autoCorrsSum = 0.;
+  if (numSum == 0) return;
 
   std::vector<double> rawDataVec(numPos,0.);
-  std::vector<std::complex<double> > resultData(0,std::complex<double>(0.,0.));
-  uqFftClass<T> fftObj(m_env);
+  std::vector<double> autoCovs(0,0.);
 
-  // Forward FFT
   this->extractRawData(initialPos,
                        1, // spacing
                        numPos,
@@ -2051,36 +2123,16 @@ uqScalarSequenceClass<T>::autoCorrViaFft(
   for (unsigned int j = 0; j < numPos; ++j) {
     rawDataVec[j] -= meanValue; // IMPORTANT
   }
-  rawDataVec.resize(fftSize,0.);
-
-  //if (m_env.subDisplayFile()) {
-  //  *m_env.subDisplayFile() << "In uqScalarSequenceClass<T>::autoCorrViaFft(), for sum"
-  //                          << ": about to call fftObj.forward()"
-  //                          << " with rawDataVec.size() = " << rawDataVec.size()
-  //                          << ", fftSize = "            << fftSize
-  //                          << ", resultData.size() = "  << resultData.size()
-  //                          << std::endl;
-  //}
-  fftObj.forward(rawDataVec,fftSize,resultData);
 
-  // Inverse FFT
-  for (unsigned int j = 0; j < fftSize; ++j) {
-    rawDataVec[j] = std::norm(resultData[j]);
-  }
-  fftObj.inverse(rawDataVec,fftSize,resultData);
-
-  //if (m_env.subDisplayFile()) {
-  //  *m_env.subDisplayFile() << "In uqScalarSequenceClass<T>::autoCorrViaFft(), for sum"
-  //                          << ": computed auto covariance for lag 0 = " << resultData[0].real()/((double) (numPos))
-  //                          << ", computed resultData[0].imag() = "      << resultData[0].imag()
-  //                          << std::endl;
-  //}
+  this->fftObj().autoCorrelations(rawDataVec,
+                                   1,        // numSeqs
+                                   numSum-1, // maxLag
+                                   autoCovs);
 
   // Prepare return data
-  autoCorrsSum = 0.;
   for (unsigned int j = 0; j < numSum; ++j) { // Yes, begin at lag '0'
     double ratio = ((double) j)/((double) (numPos-1));
-    autoCorrsSum += ( resultData[j].real()/resultData[0].real() )*(1.-ratio);
+    autoCorrsSum += ( autoCovs[j]/autoCovs[0] )*(1.-ratio);
   }
 
   return;
@@ -2520,87 +2572,52 @@ uqScalarSequenceClass<T>::unifiedSort(
     return this->subSort(initialPos,unifiedSortedSequence);
   }
 
-  // As of 14/Nov/2009, this routine needs to be checked if it requires sub sequences to have equal size. Good.
-
   if (useOnlyInter0Comm) {
     if (m_env.inter0Rank() >= 0) {
-      //m_env.syncPrintDebugMsg("In uqScalarSequenceClass<T>::unifiedSort(), beginning logic",3,3000000,m_env.inter0Comm()); // Dangerous to barrier on inter0Comm ... // KAUST
-
       unsigned int localNumPos = this->subSequenceSize() - initialPos;
 
-      std::vector<T> leafData(localNumPos,0.);
-      this->extractRawData(0,
-                           1,
-                           localNumPos,
-                           leafData);
-
-      if (m_env.inter0Rank() == 0) {
-        int minus1NumTreeLevels = 0;
-        int power2NumTreeNodes  = 1;
-
-        while (power2NumTreeNodes < m_env.inter0Comm().NumProc()) {
-          power2NumTreeNodes += power2NumTreeNodes;
-          minus1NumTreeLevels++;
-        }
-
-        if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 10)) {
-          *m_env.subDisplayFile() << "In uqScalarSequenceClass<T>::unifiedSort()"
-                                  << ": sorting tree has " << m_env.inter0Comm().NumProc()
-                                  << " nodes and "         << minus1NumTreeLevels+1
-                                  << " levels"
-                                  << std::endl;
-        }
-
-        this->parallelMerge(unifiedSortedSequence.rawData(),
-                            leafData,
-                            minus1NumTreeLevels);
-      }
-      else if (m_env.inter0Rank() > 0) { // KAUST
-        unsigned int uintBuffer[1];
-        uqRawType_MPI_Status status;
-        m_env.inter0Comm().Recv((void *) uintBuffer, 1, uqRawValue_MPI_UNSIGNED, uqRawValue_MPI_ANY_SOURCE, SCALAR_SEQUENCE_INIT_MPI_MSG, &status,
-                                "uqScalarSequenceClass<T>::unifiedSort()",
-                                "failed MPI.Recv() for init");
-	//if (status) {}; // just to remove compiler warning
-
-        unsigned int treeLevel = uintBuffer[0];
-        this->parallelMerge(unifiedSortedSequence.rawData(),
-                            leafData,
-                            treeLevel);
-      }
-
-      //m_env.syncPrintDebugMsg("In uqScalarSequenceClass<T>::unifiedSort(), returned from parallelMerge()",3,3000000,m_env.inter0Comm()); // Dangerous to barrier on inter0Comm ... // KAUST
-
-      // Broadcast
-      unsigned int unifiedDataSize = unifiedSortedSequence.subSequenceSize();
-      m_env.inter0Comm().Bcast((void *) &unifiedDataSize, (int) 1, uqRawValue_MPI_UNSIGNED, 0,
-                               "uqScalarSequenceClass<T>::unifiedSort()",
-                               "failed MPI.Bcast() for unified data size");
-
-      unsigned int sumOfNumPos = 0;
-      m_env.inter0Comm().Allreduce((void *) &localNumPos, (void *) &sumOfNumPos, (int) 1, uqRawValue_MPI_UNSIGNED, uqRawValue_MPI_SUM,
+      uqScalarSequenceClass<T> localSortedPartition(m_env,0,"");
+      unsigned int unifiedOffset   = 0;
+      unsigned int unifiedDataSize = 0;
+      this->unifiedSampleSort(useOnlyInter0Comm,
+                              initialPos,
+                              localNumPos,
+                              localSortedPartition,
+                              unifiedOffset,
+                              unifiedDataSize);
+
+      // The partitions are ordered by 'inter0' rank, so gathering them yields the unified sorted sequence
+      int numProcs      = m_env.inter0Comm().NumProc();
+      int partitionSize = (int) localSortedPartition.subSequenceSize();
+      std::vector<int> recvCnts(numProcs,0);
+      m_env.inter0Comm().Allgather((void *) &partitionSize, 1, uqRawValue_MPI_INT, (void *) &recvCnts[0], 1, uqRawValue_MPI_INT,
                                    "uqScalarSequenceClass<T>::unifiedSort()",
-                                   "failed MPI.Allreduce() for data size");
+                                   "failed MPI.Allgather() for partition sizes");
 
-      UQ_FATAL_TEST_MACRO(sumOfNumPos != unifiedDataSize,
+      std::vector<int> recvDispls(numProcs,0);
+      for (int r = 1; r < numProcs; ++r) {
+        recvDispls[r] = recvDispls[r-1] + recvCnts[r-1];
+      }
+      UQ_FATAL_TEST_MACRO((unsigned int) (recvDispls[numProcs-1] + recvCnts[numProcs-1]) != unifiedDataSize,
                           m_env.worldRank(),
                           "uqScalarSequenceClass<T>::unifiedSort()",
                           "incompatible unified sizes");
 
+      T dummyValue = 0.;
+      std::vector<T>& partitionData = localSortedPartition.rawData();
       unifiedSortedSequence.resizeSequence(unifiedDataSize);
-      m_env.inter0Comm().Bcast((void *) &unifiedSortedSequence.rawData()[0], (int) unifiedDataSize, uqRawValue_MPI_DOUBLE, 0,
-                               "uqScalarSequenceClass<T>::unifiedSort()",
-                               "failed MPI.Bcast() for unified data");
-
-      if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 0)) {
-        *m_env.subDisplayFile() << "In uqScalarSequenceClass<T>::parallelMerge()"
-                                << ": tree node "                                                                    << m_env.inter0Rank()
+      m_env.inter0Comm().Allgatherv((void *) (partitionSize > 0 ? &partitionData[0] : &dummyValue), partitionSize, uqRawValue_MPI_DOUBLE,
+                                    (void *) (unifiedDataSize > 0 ? &unifiedSortedSequence.rawData()[0] : &dummyValue), &recvCnts[0], &recvDispls[0], uqRawValue_MPI_DOUBLE,
+                                    "uqScalarSequenceClass<T>::unifiedSort()",
+                                    "failed MPI.Allgatherv() for unified data");
+
+      if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 10) && (unifiedDataSize > 0)) {
+        *m_env.subDisplayFile() << "In uqScalarSequenceClass<T>::unifiedSort()"
+                                << ": inter0 rank "                                                                  << m_env.inter0Rank()
                                 << ", unifiedSortedSequence[0] = "                                                   << unifiedSortedSequence[0]
                                 << ", unifiedSortedSequence[" << unifiedSortedSequence.subSequenceSize()-1 << "] = " << unifiedSortedSequence[unifiedSortedSequence.subSequenceSize()-1]
                                 << std::endl;
       }
-
-      //m_env.syncPrintDebugMsg("In uqScalarSequenceClass<T>::unifiedSort(), ending logic",3,3000000,m_env.inter0Comm()); // Dangerous to barrier on inter0Comm ... // KAUST
     }
     else {
       // Node not in the 'inter0' communicator
@@ -2614,7 +2631,355 @@ uqScalarSequenceClass<T>::unifiedSort(
                         "parallel vectors not supported yet");
   }
 
-  //m_env.fullComm().Barrier();
+  return;
+}
+// --------------------------------------------------
+template <class T>
+void
+uqScalarSequenceClass<T>::unifiedSampleSort(
+  bool                      useOnlyInter0Comm,
+  unsigned int              initialPos,
+  unsigned int              numPos,
+  uqScalarSequenceClass<T>& localSortedPartition,
+  unsigned int&             unifiedOffset,
+  unsigned int&             unifiedDataSize) const
+{
+  UQ_FATAL_TEST_MACRO((initialPos+numPos) > this->subSequenceSize(),
+                      m_env.worldRank(),
+                      "uqScalarSequenceClass<T>::unifiedSampleSort()",
+                      "invalid input data");
+
+  this->extractScalarSeq(initialPos,
+                         1,
+                         numPos,
+                         localSortedPartition);
+  localSortedPartition.subSort();
+  unifiedOffset   = 0;
+  unifiedDataSize = numPos;
+
+  if (m_env.numSubEnvironments() == 1) {
+    return;
+  }
+
+  UQ_FATAL_TEST_MACRO(useOnlyInter0Comm == false,
+                      m_env.worldRank(),
+                      "uqScalarSequenceClass<T>::unifiedSampleSort()",
+                      "parallel vectors not supported yet");
+
+  if (m_env.inter0Rank() < 0) {
+    // Node not in the 'inter0' communicator: its partition is its own sorted data
+    return;
+  }
+
+  int numProcs = m_env.inter0Comm().NumProc();
+  std::vector<T>& localData = localSortedPartition.rawData();
+
+  // Each processor contributes up to 'numProcs' regularly spaced samples of its sorted data
+  std::vector<T> localSamples(0);
+  localSortedPartition.subSortedRegularSamples((unsigned int) numProcs,localSamples);
+  int numLocalSamples = (int) localSamples.size();
+  localSamples.resize(numLocalSamples+1,0.);
+
+  std::vector<int> sampleCnts(numProcs,0);
+  m_env.inter0Comm().Allgather((void *) &numLocalSamples, 1, uqRawValue_MPI_INT, (void *) &sampleCnts[0], 1, uqRawValue_MPI_INT,
+                               "uqScalarSequenceClass<T>::unifiedSampleSort()",
+                               "failed MPI.Allgather() for number of samples");
+  std::vector<int> sampleDispls(numProcs,0);
+  for (int r = 1; r < numProcs; ++r) {
+    sampleDispls[r] = sampleDispls[r-1] + sampleCnts[r-1];
+  }
+  int numSamples = sampleDispls[numProcs-1] + sampleCnts[numProcs-1];
+
+  std::vector<T> samples(numSamples+1,0.);
+  m_env.inter0Comm().Allgatherv((void *) &localSamples[0], numLocalSamples, uqRawValue_MPI_DOUBLE,
+                                (void *) &samples[0], &sampleCnts[0], &sampleDispls[0], uqRawValue_MPI_DOUBLE,
+                                "uqScalarSequenceClass<T>::unifiedSampleSort()",
+                                "failed MPI.Allgatherv() for samples");
+  samples.resize(numSamples);
+
+  // Processor 'r' receives the values in (splitter[r-1],splitter[r]]
+  std::vector<T> splitters(0);
+  uqScalarSequenceClass<T>::sampleSortSplitters((unsigned int) numProcs,samples,splitters);
+  std::vector<int> sendCnts  (0);
+  std::vector<int> sendDispls(0);
+  localSortedPartition.subSortedPartition(splitters,(unsigned int) numProcs,sendCnts,sendDispls);
+
+  std::vector<int> recvCnts(numProcs,0);
+  m_env.inter0Comm().Alltoall((void *) &sendCnts[0], 1, uqRawValue_MPI_INT, (void *) &recvCnts[0], 1, uqRawValue_MPI_INT,
+                              "uqScalarSequenceClass<T>::unifiedSampleSort()",
+                              "failed MPI.Alltoall() for partition sizes");
+  std::vector<int> recvDispls(numProcs,0);
+  for (int r = 1; r < numProcs; ++r) {
+    recvDispls[r] = recvDispls[r-1] + recvCnts[r-1];
+  }
+  unsigned int partitionSize = recvDispls[numProcs-1] + recvCnts[numProcs-1];
+
+  std::vector<T> partitionData(partitionSize+1,0.);
+  m_env.inter0Comm().Alltoallv((void *) (numPos > 0 ? &localData[0] : &localSamples[0]), &sendCnts[0], &sendDispls[0], uqRawValue_MPI_DOUBLE,
+                               (void *) &partitionData[0], &recvCnts[0], &recvDispls[0], uqRawValue_MPI_DOUBLE,
+                               "uqScalarSequenceClass<T>::unifiedSampleSort()",
+                               "failed MPI.Alltoallv() for data");
+
+  partitionData.resize(partitionSize);
+  uqScalarSequenceClass<T>::mergeSortedPieces(recvCnts,recvDispls,partitionData);
+  localData.swap(partitionData);
+  localSortedPartition.deleteStoredScalars();
+
+  std::vector<unsigned int> partitionSizes(numProcs,0);
+  m_env.inter0Comm().Allgather((void *) &partitionSize, 1, uqRawValue_MPI_UNSIGNED, (void *) &partitionSizes[0], 1, uqRawValue_MPI_UNSIGNED,
+                               "uqScalarSequenceClass<T>::unifiedSampleSort()",
+                               "failed MPI.Allgather() for partition sizes");
+  unifiedOffset   = 0;
+  unifiedDataSize = 0;
+  for (int r = 0; r < numProcs; ++r) {
+    if (r < m_env.inter0Rank()) unifiedOffset += partitionSizes[r];
+    unifiedDataSize += partitionSizes[r];
+  }
+
+  if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 10)) {
+    *m_env.subDisplayFile() << "In uqScalarSequenceClass<T>::unifiedSampleSort()"
+                            << ": inter0 rank "      << m_env.inter0Rank()
+                            << " holds "             << partitionSize
+                            << " positions, from "   << unifiedOffset
+                            << ", out of "           << unifiedDataSize
+                            << std::endl;
+  }
+
+  return;
+}
+// --------------------------------------------------
+template <class T>
+void
+uqScalarSequenceClass<T>::subSortedRegularSamples(
+  unsigned int    numSamples,
+  std::vector<T>& samples) const
+{
+  unsigned int dataSize = this->subSequenceSize();
+  unsigned int numLocalSamples = std::min(numSamples,dataSize);
+  samples.clear();
+  samples.resize(numLocalSamples,0.);
+  for (unsigned int i = 0; i < numLocalSamples; ++i) {
+    samples[i] = m_seq[(i*dataSize)/numLocalSamples];
+  }
+
+  return;
+}
+// --------------------------------------------------
+template <class T>
+void
+uqScalarSequenceClass<T>::sampleSortSplitters(
+  unsigned int    numParts,
+  std::vector<T>& samples,
+  std::vector<T>& splitters)
+{
+  unsigned int numSamples = samples.size();
+  std::sort(samples.begin(), samples.end());
+
+  splitters.clear();
+  if ((numSamples == 0) || (numParts == 0)) return;
+  splitters.resize(numParts-1,0.);
+  for (unsigned int r = 0; r < (numParts-1); ++r) {
+    splitters[r] = samples[((r+1)*numSamples)/numParts];
+  }
+
+  return;
+}
+// --------------------------------------------------
+template <class T>
+void
+uqScalarSequenceClass<T>::subSortedPartition(
+  const std::vector<T>& splitters,
+  unsigned int          numParts,
+  std::vector<int>&     cnts,
+  std::vector<int>&     displs) const
+{
+  cnts.clear();
+  cnts.resize(numParts,0);
+  displs.clear();
+  displs.resize(numParts,0);
+
+  typename std::vector<T>::const_iterator lowerIt = m_seq.begin();
+  for (unsigned int r = 0; r < numParts; ++r) {
+    typename std::vector<T>::const_iterator upperIt = m_seq.end();
+    if ((r < (numParts-1)) && (r < splitters.size())) {
+      upperIt = std::upper_bound(lowerIt, m_seq.end(), splitters[r]);
+    }
+    displs[r] = lowerIt - m_seq.begin();
+    cnts  [r] = upperIt - lowerIt;
+    lowerIt = upperIt;
+  }
+
+  return;
+}
+// --------------------------------------------------
+template <class T>
+void
+uqScalarSequenceClass<T>::mergeSortedPieces(
+  const std::vector<int>& cnts,
+  const std::vector<int>& displs,
+  std::vector<T>&         data)
+{
+  int numPieces = (int) cnts.size();
+  for (int width = 1; width < numPieces; width *= 2) {
+    for (int r = 0; (r+width) < numPieces; r += 2*width) {
+      int last = std::min(r+2*width,numPieces) - 1;
+      std::inplace_merge(data.begin()+displs[r],
+                         data.begin()+displs[r+width],
+                         data.begin()+displs[last]+cnts[last]);
+    }
+  }
+
+  return;
+}
+// --------------------------------------------------
+template <class T>
+void
+uqScalarSequenceClass<T>::unifiedSortedValues(
+  bool                             useOnlyInter0Comm,
+  const uqScalarSequenceClass<T>&  localSortedPartition,
+  unsigned int                     unifiedOffset,
+  const std::vector<unsigned int>& unifiedPositions,
+  std::vector<T>&                  values) const
+{
+  unsigned int numValues     = unifiedPositions.size();
+  unsigned int partitionSize = localSortedPartition.subSequenceSize();
+
+  // Exactly one processor owns each position, all others contribute zero
+  std::vector<T> localValues(numValues+1,0.);
+  for (unsigned int i = 0; i < numValues; ++i) {
+    if ((unifiedOffset <= unifiedPositions[i]) && (unifiedPositions[i] < (unifiedOffset+partitionSize))) {
+      localValues[i] = localSortedPartition[unifiedPositions[i]-unifiedOffset];
+    }
+  }
+
+  values.resize(numValues+1,0.);
+  if ((m_env.numSubEnvironments() > 1) && (m_env.inter0Rank() >= 0)) {
+    UQ_FATAL_TEST_MACRO(useOnlyInter0Comm == false,
+                        m_env.worldRank(),
+                        "uqScalarSequenceClass<T>::unifiedSortedValues()",
+                        "parallel vectors not supported yet");
+
+    m_env.inter0Comm().Allreduce((void *) &localValues[0], (void *) &values[0], (int) numValues, uqRawValue_MPI_DOUBLE, uqRawValue_MPI_SUM,
+                                 "uqScalarSequenceClass<T>::unifiedSortedValues()",
+                                 "failed MPI.Allreduce() for values");
+  }
+  else {
+    values = localValues;
+  }
+  values.resize(numValues);
+
+  return;
+}
+// --------------------------------------------------
+template <class T>
+void
+uqScalarSequenceClass<T>::unifiedQuantiles(
+  bool                       useOnlyInter0Comm,
+  unsigned int               initialPos,
+  unsigned int               numPos,
+  const std::vector<double>& probabilities,
+  bool                       approximate,
+  std::vector<T>&            quantileValues) const
+{
+  UQ_FATAL_TEST_MACRO((initialPos+numPos) > this->subSequenceSize(),
+                      m_env.worldRank(),
+                      "uqScalarSequenceClass<T>::unifiedQuantiles()",
+                      "invalid input data");
+
+  unsigned int numProbs = probabilities.size();
+  quantileValues.clear();
+  quantileValues.resize(numProbs,0.);
+
+  bool useUnifiedData = ((m_env.numSubEnvironments() > 1) && (m_env.inter0Rank() >= 0));
+  if (useUnifiedData) {
+    UQ_FATAL_TEST_MACRO(useOnlyInter0Comm == false,
+                        m_env.worldRank(),
+                        "uqScalarSequenceClass<T>::unifiedQuantiles()",
+                        "parallel vectors not supported yet");
+  }
+
+  if (approximate && useUnifiedData) {
+    uqScalarSequenceClass<T> localSortedSequence(m_env,0,"");
+    this->extractScalarSeq(initialPos,
+                           1,
+                           numPos,
+                           localSortedSequence);
+    localSortedSequence.subSort();
+
+    // Each sample stands for numPos/UQ_SCALAR_SEQUENCE_NUM_QUANTILE_SAMPLES positions of its processor
+    unsigned int numLocalSamples = UQ_SCALAR_SEQUENCE_NUM_QUANTILE_SAMPLES;
+    std::vector<T> localSamples(numLocalSamples,0.);
+    for (unsigned int i = 0; (i < numLocalSamples) && (numPos > 0); ++i) {
+      localSamples[i] = localSortedSequence[(unsigned int) ((((double) i) + .5)*((double) numPos)/((double) numLocalSamples))];
+    }
+
+    int numProcs = m_env.inter0Comm().NumProc();
+    std::vector<unsigned int> localSizes(numProcs,0);
+    m_env.inter0Comm().Allgather((void *) &numPos, 1, uqRawValue_MPI_UNSIGNED, (void *) &localSizes[0], 1, uqRawValue_MPI_UNSIGNED,
+                                 "uqScalarSequenceClass<T>::unifiedQuantiles()",
+                                 "failed MPI.Allgather() for data sizes");
+    std::vector<T> samples(numProcs*numLocalSamples,0.);
+    m_env.inter0Comm().Allgather((void *) &localSamples[0], (int) numLocalSamples, uqRawValue_MPI_DOUBLE, (void *) &samples[0], (int) numLocalSamples, uqRawValue_MPI_DOUBLE,
+                                 "uqScalarSequenceClass<T>::unifiedQuantiles()",
+                                 "failed MPI.Allgather() for samples");
+
+    std::vector<std::pair<T,double> > weightedSamples(0);
+    double unifiedDataSize = 0.;
+    for (int r = 0; r < numProcs; ++r) {
+      unifiedDataSize += (double) localSizes[r];
+      if (localSizes[r] == 0) continue;
+      for (unsigned int i = 0; i < numLocalSamples; ++i) {
+        weightedSamples.push_back(std::make_pair(samples[r*numLocalSamples+i],((double) localSizes[r])/((double) numLocalSamples)));
+      }
+    }
+    std::sort(weightedSamples.begin(), weightedSamples.end());
+
+    for (unsigned int j = 0; (j < numProbs) && (weightedSamples.size() > 0); ++j) {
+      double position = (unifiedDataSize + 1.)*probabilities[j] - 1.;
+      double cumulativeWeight = 0.;
+      unsigned int i = 0;
+      while (i < (weightedSamples.size()-1)) {
+        cumulativeWeight += weightedSamples[i].second;
+        if (position + .5 < cumulativeWeight) break;
+        ++i;
+      }
+      quantileValues[j] = weightedSamples[i].first;
+    }
+  }
+  else {
+    uqScalarSequenceClass<T> localSortedPartition(m_env,0,"");
+    unsigned int unifiedOffset   = 0;
+    unsigned int unifiedDataSize = 0;
+    this->unifiedSampleSort(useOnlyInter0Comm,
+                            initialPos,
+                            numPos,
+                            localSortedPartition,
+                            unifiedOffset,
+                            unifiedDataSize);
+    if (unifiedDataSize == 0) return;
+
+    // Linear interpolation between the two order statistics around (N+1)p-1
+    std::vector<unsigned int> unifiedPositions(2*numProbs,0);
+    std::vector<double>       fractions(numProbs,0.);
+    for (unsigned int j = 0; j < numProbs; ++j) {
+      double position = (((double) unifiedDataSize) + 1.)*probabilities[j] - 1.;
+      if (position < 0.) position = 0.;
+      if (position > (double) (unifiedDataSize-1)) position = (double) (unifiedDataSize-1);
+      unifiedPositions[2*j  ] = (unsigned int) position;
+      unifiedPositions[2*j+1] = std::min(unifiedPositions[2*j]+1,unifiedDataSize-1);
+      fractions[j] = position - ((double) unifiedPositions[2*j]);
+    }
+
+    std::vector<T> values(2*numProbs,0.);
+    this->unifiedSortedValues(useOnlyInter0Comm,
+                              localSortedPartition,
+                              unifiedOffset,
+                              unifiedPositions,
+                              values);
+    for (unsigned int j = 0; j < numProbs; ++j) {
+      quantileValues[j] = (1.-fractions[j]) * values[2*j] + fractions[j] * values[2*j+1];
+    }
+  }
 
   return;
 }
@@ -2742,7 +3107,8 @@ template <class T>
 T
 uqScalarSequenceClass<T>::unifiedInterQuantileRange(
   bool         useOnlyInter0Comm,
-  unsigned int initialPos) const
+  unsigned int initialPos,
+  bool         approximate) const
 {
   T unifiedIqrValue = 0.;
 
@@ -2750,73 +3116,27 @@ uqScalarSequenceClass<T>::unifiedInterQuantileRange(
     return this->subInterQuantileRange(initialPos);
   }
 
-  // As of 14/Nov/2009, this routine needs to be checked if it requires sub sequences to have equal size. Good.
-
   if (useOnlyInter0Comm) {
     if (m_env.inter0Rank() >= 0) {
-      //m_env.syncPrintDebugMsg("In uqScalarSequenceClass<T>::unifiedInterQuantileRange(), beginning logic",3,3000000,m_env.inter0Comm()); // Dangerous to barrier on inter0Comm ... // KAUST
-
-      uqScalarSequenceClass unifiedSortedSequence(m_env,0,"");
-      this->unifiedSort(useOnlyInter0Comm,
-                        initialPos,
-                        unifiedSortedSequence);
-      unsigned int unifiedDataSize = unifiedSortedSequence.subSequenceSize();
-    
-      unsigned int localDataSize = this->subSequenceSize() - initialPos;
-      unsigned int sumOfLocalSizes = 0;
-      m_env.inter0Comm().Allreduce((void *) &localDataSize, (void *) &sumOfLocalSizes, (int) 1, uqRawValue_MPI_UNSIGNED, uqRawValue_MPI_SUM,
-                                   "uqScalarSequenceClass<T>::unifiedInterQuantileRange()",
-                                   "failed MPI.Allreduce() for data size");
-
-      UQ_FATAL_TEST_MACRO(sumOfLocalSizes != unifiedDataSize,
-                          m_env.worldRank(),
-                          "uqScalarSequenceClass<T>::unifiedInterQuantileRange()",
-                          "incompatible unified sizes");
-
-      unsigned int pos1 = (unsigned int) ( (((double) unifiedDataSize) + 1.)*1./4. - 1. );
-      unsigned int pos3 = (unsigned int) ( (((double) unifiedDataSize) + 1.)*3./4. - 1. );
-
-      double fraction1 = (((double) unifiedDataSize) + 1.)*1./4. - 1. - ((double) pos1);
-      double fraction3 = (((double) unifiedDataSize) + 1.)*3./4. - 1. - ((double) pos3);
-
-      T value1 = (1.-fraction1) * unifiedSortedSequence[pos1] + fraction1 * unifiedSortedSequence[pos1+1];
-      T value3 = (1.-fraction3) * unifiedSortedSequence[pos3] + fraction3 * unifiedSortedSequence[pos3+1];
-      unifiedIqrValue = value3 - value1;
+      std::vector<double> probabilities(2,.25);
+      probabilities[1] = .75;
+      std::vector<T> quartiles(2,0.);
+      this->unifiedQuantiles(useOnlyInter0Comm,
+                             initialPos,
+                             this->subSequenceSize() - initialPos,
+                             probabilities,
+                             approximate,
+                             quartiles);
+      unifiedIqrValue = quartiles[1] - quartiles[0];
 
       if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 0)) {
         *m_env.subDisplayFile() << "In uqScalarSequenceClass<T>::unifiedInterQuantileRange()"
                                 << ": unifiedIqrValue = " << unifiedIqrValue
-                                << ", localDataSize = "   << localDataSize
-                                << ", unifiedDataSize = " << unifiedDataSize
-                                << ", pos1 = "            << pos1
-                                << ", pos3 = "            << pos3
-                                << ", value1 = "          << value1
-                                << ", value3 = "          << value3
+                                << ", approximate = "     << approximate
+                                << ", value1 = "          << quartiles[0]
+                                << ", value3 = "          << quartiles[1]
                                 << std::endl;
-
-        // Save data only once into a separate file
-	//std::ofstream* ofsvar = new std::ofstream(("unif_sort_sub"+m_env.subIdString()+".m").c_str(), std::ofstream::out | std::ofstream::in | std::ofstream::ate);
-        //if ((ofsvar            == NULL ) ||
-        //    (ofsvar->is_open() == false)) {
-        //  delete ofsvar;
-        //  ofsvar = new std::ofstream(("unif_sort_sub"+m_env.subIdString()+".m").c_str(), std::ofstream::out | std::ofstream::trunc);
-
-        //  *ofsvar << "var_unif_sort_sub" << m_env.subIdString() << " = zeros(" << 1
-        //          << ","                                                       << unifiedDataSize
-        //          << ");"
-        //          << std::endl;
-        //  for (unsigned int j = 0; j < unifiedDataSize; ++j) {
-        //    *ofsvar << "var_unif_sort_sub" << m_env.subIdString() << "(" << 1
-        //            << ","                                               << j+1
-        //            << ") = "                                            << unifiedSortedSequence[j]
-        //            << ";"
-        //            << std::endl;
-        //  }
-        //}
-        //delete ofsvar;
       }
-
-      //m_env.syncPrintDebugMsg("In uqScalarSequenceClass<T>::unifiedInterQuantileRange(), ending logic",3,3000000,m_env.inter0Comm()); // Dangerous to barrier on inter0Comm ... // KAUST
     }
     else {
       // Node not in the 'inter0' communicator
@@ -2830,8 +3150,6 @@ uqScalarSequenceClass<T>::unifiedInterQuantileRange(
                         "parallel vectors not supported yet");
   }
 
-  //m_env.fullComm().Barrier();
-
   return unifiedIqrValue;
 }
 // --------------------------------------------------
@@ -3304,6 +3622,7 @@ uqScalarSequenceClass<T>::unifiedWriteContents(
   const std::string& fileName,
   const std::string& inputFileType) const
 {
+  unsigned long long traceStart = m_env.tracer().start();
   std::string fileType(inputFileType);
 #ifdef QUESO_HAS_HDF5
   // Do nothing
@@ -3494,6 +3813,8 @@ uqScalarSequenceClass<T>::unifiedWriteContents(
     }
   } // if (m_env.inter0Rank() >= 0)
 
+  m_env.tracer().stop(UQ_TRACE_IO_WRITE_ID,traceStart);
+
   if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 10)) {
     *m_env.subDisplayFile() << "Leaving uqScalarSequenceClass<T>::unifiedWriteContents()"
                             << ", fileName = " << fileName
@@ -3904,132 +4225,16 @@ uqScalarSequenceClass<T>::subSort()
   std::sort(m_seq.begin(), m_seq.end());
   return;
 }
+
 // --------------------------------------------------
-// Acknowledgement: the tree idea in this routine was taken from
-// 'http://penguin.ewu.edu/~trolfe/ParallelMerge/ParallelMerge.html', as of March 08, 2009
 template <class T>
-void
-uqScalarSequenceClass<T>::parallelMerge(
-  std::vector<T>&       sortedBuffer,
-  const std::vector<T>& leafData,
-  unsigned int          currentTreeLevel) const
+uqFftClass<T>&
+uqScalarSequenceClass<T>::fftObj() const
 {
-  int parentNode = m_env.inter0Rank() & ~(1 << currentTreeLevel);
-
-  if (m_env.inter0Rank() >= 0) { // KAUST
-  if (currentTreeLevel == 0) {
-    // Leaf node: sort own local data.
-    unsigned int leafDataSize = leafData.size();
-    sortedBuffer.resize(leafDataSize,0.);
-    for (unsigned int i = 0; i < leafDataSize; ++i) {
-      sortedBuffer[i] = leafData[i];
-    }
-    std::sort(sortedBuffer.begin(), sortedBuffer.end());
-    if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 0)) {
-      *m_env.subDisplayFile() << "In uqScalarSequenceClass<T>::parallelMerge()"
-                              << ": tree node "                                            << m_env.inter0Rank()
-                              << ", leaf sortedBuffer[0] = "                               << sortedBuffer[0]
-                              << ", leaf sortedBuffer[" << sortedBuffer.size()-1 << "] = " << sortedBuffer[sortedBuffer.size()-1]
-                              << std::endl;
-    }
-  }
-  else {
-    int nextTreeLevel  = currentTreeLevel - 1;
-    int rightChildNode = m_env.inter0Rank() | (1 << nextTreeLevel);
-
-    if (rightChildNode >= m_env.inter0Comm().NumProc()) { // No right child. Move down one level.
-      this->parallelMerge(sortedBuffer,
-                          leafData,
-                          nextTreeLevel);
-    }
-    else {
-      unsigned int uintBuffer[1];
-      uintBuffer[0] = nextTreeLevel;
-      m_env.inter0Comm().Send((void *) uintBuffer, 1, uqRawValue_MPI_UNSIGNED, rightChildNode, SCALAR_SEQUENCE_INIT_MPI_MSG,
-                              "uqScalarSequenceClass<T>::parallelMerge()",
-                              "failed MPI.Send() for init");
-
-      this->parallelMerge(sortedBuffer,
-                          leafData,
-                          nextTreeLevel);
-
-      // Prepare variable 'leftSortedBuffer': just copy own current sorted data.
-      unsigned int leftSize = sortedBuffer.size();
-      std::vector<T> leftSortedBuffer(leftSize,0.);
-      for (unsigned int i = 0; i < leftSize; ++i) {
-        leftSortedBuffer[i] = sortedBuffer[i];
-      }
-
-      // Prepare variable 'rightSortedBuffer': receive data from right child node.
-      uqRawType_MPI_Status status;
-      m_env.inter0Comm().Recv((void *) uintBuffer, 1, uqRawValue_MPI_UNSIGNED, rightChildNode, SCALAR_SEQUENCE_SIZE_MPI_MSG, &status,
-                              "uqScalarSequenceClass<T>::parallelMerge()",
-                              "failed MPI.Recv() for size");
-      //if (status) {}; // just to remove compiler warning
-
-      unsigned int rightSize = uintBuffer[0];
-      std::vector<T> rightSortedBuffer(rightSize,0.);
-      m_env.inter0Comm().Recv((void *) &rightSortedBuffer[0], (int) rightSize, uqRawValue_MPI_DOUBLE, rightChildNode, SCALAR_SEQUENCE_DATA_MPI_MSG, &status,
-                              "uqScalarSequenceClass<T>::parallelMerge()",
-                              "failed MPI.Recv() for data");
-
-      // Merge the two results into 'sortedBuffer'.
-      if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 0)) {
-        *m_env.subDisplayFile() << "In uqScalarSequenceClass<T>::parallelMerge()"
-                                << ": tree node "        << m_env.inter0Rank()
-                                << " is combining "      << leftSortedBuffer.size()
-                                << " left doubles with " << rightSortedBuffer.size()
-                                << " right doubles"
-                                << std::endl;
-      }
-
-      sortedBuffer.clear();
-      sortedBuffer.resize(leftSortedBuffer.size()+rightSortedBuffer.size(),0.);
-      unsigned int i = 0;
-      unsigned int j = 0;
-      unsigned int k = 0;
-      while ((i < leftSize ) &&
-             (j < rightSize)) {
-        if (leftSortedBuffer[i] > rightSortedBuffer[j]) sortedBuffer[k++] = rightSortedBuffer[j++];
-        else                                            sortedBuffer[k++] = leftSortedBuffer [i++];
-      }
-      while (i < leftSize ) sortedBuffer[k++] = leftSortedBuffer [i++];
-      while (j < rightSize) sortedBuffer[k++] = rightSortedBuffer[j++];
-      if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 0)) {
-        *m_env.subDisplayFile() << "In uqScalarSequenceClass<T>::parallelMerge()"
-                                << ": tree node "                                              << m_env.inter0Rank()
-                                << ", merged sortedBuffer[0] = "                               << sortedBuffer[0]
-                                << ", merged sortedBuffer[" << sortedBuffer.size()-1 << "] = " << sortedBuffer[sortedBuffer.size()-1]
-                                << std::endl;
-      }
-    }
+  if (m_fftObj == NULL) {
+    m_fftObj = new uqFftClass<T>(m_env);
   }
-
-  if (parentNode != m_env.inter0Rank()) {
-    // Transmit data to parent node.
-    unsigned int uintBuffer[1];
-    uintBuffer[0] = sortedBuffer.size();
-    m_env.inter0Comm().Send((void *) uintBuffer, 1, uqRawValue_MPI_UNSIGNED, parentNode, SCALAR_SEQUENCE_SIZE_MPI_MSG,
-                            "uqScalarSequenceClass<T>::parallelMerge()",
-                            "failed MPI.Send() for size");
-
-    if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 10)) {
-      *m_env.subDisplayFile() << "In uqScalarSequenceClass<T>::parallelMerge()"
-                              << ": tree node "                                          << m_env.inter0Rank()
-                              << " is sending "                                          << sortedBuffer.size()
-                              << " doubles to tree node "                                << parentNode 
-                              << ", with sortedBuffer[0] = "                             << sortedBuffer[0]
-                              << " and sortedBuffer[" << sortedBuffer.size()-1 << "] = " << sortedBuffer[sortedBuffer.size()-1]
-                              << std::endl;
-    }
-
-    m_env.inter0Comm().Send((void *) &sortedBuffer[0], (int) sortedBuffer.size(), uqRawValue_MPI_DOUBLE, parentNode, SCALAR_SEQUENCE_DATA_MPI_MSG,
-                            "uqScalarSequenceClass<T>::parallelMerge()",
-                            "failed MPI.Send() for data");
-  }
-  } // KAUST
-
-  return;
+  return *m_fftObj;
 }
 
 // --------------------------------------------------
@@ -4303,7 +4508,6 @@ uqScalarSequenceClass<T>::psd(
   modificationScale = 1./modificationScale;
 
   std::vector<double> blockData(blockSize,0.);
-  uqFftClass<T> fftObj(m_env);
   std::vector<std::complex<double> > fftResult(0,std::complex<double>(0.,0.));
 
 #if 0
@@ -4329,7 +4533,7 @@ uqScalarSequenceClass<T>::psd(
       blockData[j] = uqMiscHammingWindow(blockSize-1,j) * ( m_seq[dataPos] - meanValue ); // IMPORTANT
     }
 
-    fftObj.forward(blockData,fftSize,fftResult);
+    this->fftObj().forward(blockData,fftSize,fftResult);
 
     //if (m_env.subDisplayFile()) {
     //  *m_env.subDisplayFile() << "blockData.size() = "   << blockData.size()
@@ -4529,6 +4733,109 @@ uqScalarSequenceClass<T>::unifiedCdfPercentageRange(
 
   return;
 }
+#endif // #ifdef QUESO_COMPUTES_EXTRA_POST_PROCESSING_STATISTICS
+//---------------------------------------------------
+template <class T>
+unsigned int
+uqScalarSequenceClass<T>::subCdfIndicatorIacts(
+  unsigned int          initialPos,
+  const std::vector<T>& evaluationPositions,
+  std::vector<double>&  cdfValues,
+  std::vector<double>&  iacts) const
+{
+  bool bRC = ((initialPos < this->subSequenceSize()   ) &&
+              (0          < evaluationPositions.size()));
+  UQ_FATAL_TEST_MACRO(bRC == false,
+                      m_env.worldRank(),
+                      "uqScalarSequenceClass<T>::subCdfIndicatorIacts()",
+                      "invalid input data");
+
+  unsigned int dataSize = this->subSequenceSize() - initialPos;
+  unsigned int numEvals = evaluationPositions.size();
+  std::vector<double> rawData(0);
+  this->extractRawData(initialPos,
+                       1, // spacing
+                       dataSize,
+                       rawData);
+  std::vector<double> evalPositions(numEvals,0.);
+  for (unsigned int j = 0; j < numEvals; ++j) {
+    evalPositions[j] = evaluationPositions[j];
+  }
+
+  // All processors of the sub-environment work on the data of subRank 0
+  unsigned int numProcs = (unsigned int) m_env.subComm().NumProc();
+  unsigned int myRank   = (unsigned int) m_env.subRank();
+  if (numProcs > 1) {
+    unsigned int sizes[2];
+    sizes[0] = dataSize;
+    sizes[1] = numEvals;
+    m_env.subComm().Bcast((void *) sizes, (int) 2, uqRawValue_MPI_UNSIGNED, 0,
+                          "uqScalarSequenceClass<T>::subCdfIndicatorIacts()",
+                          "failed MPI.Bcast() for sizes");
+    dataSize = sizes[0];
+    numEvals = sizes[1];
+    rawData.resize(dataSize,0.);
+    evalPositions.resize(numEvals,0.);
+    m_env.subComm().Bcast((void *) &rawData[0], (int) dataSize, uqRawValue_MPI_DOUBLE, 0,
+                          "uqScalarSequenceClass<T>::subCdfIndicatorIacts()",
+                          "failed MPI.Bcast() for data");
+    m_env.subComm().Bcast((void *) &evalPositions[0], (int) numEvals, uqRawValue_MPI_DOUBLE, 0,
+                          "uqScalarSequenceClass<T>::subCdfIndicatorIacts()",
+                          "failed MPI.Bcast() for evaluation positions");
+  }
+
+  // Empirical cdf values through the ranks of the evaluation positions in the sorted data
+  std::vector<double> sortedData(rawData);
+  std::sort(sortedData.begin(),sortedData.end());
+
+  cdfValues.assign(numEvals,0.);
+  iacts.assign    (numEvals,0.);
+  std::vector<unsigned int> myEvalIds(0);
+  for (unsigned int j = 0; j < numEvals; ++j) {
+    unsigned int rank = std::upper_bound(sortedData.begin(),sortedData.end(),evalPositions[j]) - sortedData.begin();
+    cdfValues[j] = ((double) rank)/((double) dataSize);
+    if ((j % numProcs) != myRank) continue;
+    if ((rank == 0) || (rank == dataSize)) {
+      iacts[j] = 1.; // Constant indicator series
+    }
+    else {
+      myEvalIds.push_back(j);
+    }
+  }
+
+  // Auto-covariances of the centered indicator series, a block of them per FFT pass
+  std::vector<double> indicators(0);
+  std::vector<double> autoCovs(0);
+  for (unsigned int firstId = 0; firstId < myEvalIds.size(); firstId += UQ_SCALAR_SEQUENCE_CDF_STACC_BLOCK_SIZE) {
+    unsigned int numSeqs = std::min((unsigned int) UQ_SCALAR_SEQUENCE_CDF_STACC_BLOCK_SIZE,(unsigned int) (myEvalIds.size() - firstId));
+    indicators.resize(numSeqs*dataSize);
+    for (unsigned int s = 0; s < numSeqs; ++s) {
+      unsigned int j = myEvalIds[firstId+s];
+      double* indicator = &indicators[s*dataSize];
+      for (unsigned int t = 0; t < dataSize; ++t) {
+        indicator[t] = ((rawData[t] <= evalPositions[j]) ? 1. : 0.) - cdfValues[j];
+      }
+    }
+
+    this->fftObj().autoCorrelations(indicators,
+                                     numSeqs,
+                                     dataSize-1, // maxLag
+                                     autoCovs);
+
+    for (unsigned int s = 0; s < numSeqs; ++s) {
+      iacts[myEvalIds[firstId+s]] = uqMiscGeyerIntegratedAutoCorrTime(&autoCovs[s*dataSize],dataSize);
+    }
+  }
+
+  if (numProcs > 1) {
+    std::vector<double> myIacts(iacts);
+    m_env.subComm().Allreduce((void *) &myIacts[0], (void *) &iacts[0], (int) numEvals, uqRawValue_MPI_DOUBLE, uqRawValue_MPI_SUM,
+                              "uqScalarSequenceClass<T>::subCdfIndicatorIacts()",
+                              "failed MPI.Allreduce() for iacts");
+  }
+
+  return dataSize;
+}
 //---------------------------------------------------
 template <class T>
 void
@@ -4539,80 +4846,58 @@ uqScalarSequenceClass<T>::subCdfStacc(
   std::vector<double>&            cdfStaccValuesLow,
   const uqScalarSequenceClass<T>& sortedDataValues) const
 {
-  UQ_FATAL_TEST_MACRO(false,
-                      m_env.worldRank(),
-                      "uqScalarSequenceClass<T>::subCdfStacc()",
-                      "not implemented yet"); // Joseph
-  bool bRC = (initialPos                 <  this->subSequenceSize()  );
+  bool bRC = ((initialPos                          <  this->subSequenceSize()             ) &&
+              (sortedDataValues.subSequenceSize() == (this->subSequenceSize() - initialPos)));
   UQ_FATAL_TEST_MACRO(bRC == false,
                       m_env.worldRank(),
-                      "uqScalarSequenceClass<V>::subGaussianKDE()",
+                      "uqScalarSequenceClass<T>::subCdfStacc()",
                       "invalid input data");
 
-  unsigned int numPoints = subSequenceSize()-initialPos;
-  double       auxNumPoints = numPoints;
-  double       maxLamb = 0.;
-  std::vector<double> ro      (numPoints,0.);
-  std::vector<double> Isam_mat(numPoints,0.);
-
+  // Auto-correlation times of the indicator series at a few cdf levels only
+  unsigned int numPoints = this->subSequenceSize() - initialPos;
+  unsigned int numLevels = UQ_SCALAR_SEQUENCE_CDF_STACC_NUM_LEVELS;
+  std::vector<T> levelPositions(numLevels,0.);
+  for (unsigned int k = 0; k < numLevels; ++k) {
+    double level = ((double) (k+1))/((double) (numLevels+1));
+    unsigned int pointId = (unsigned int) std::ceil(level*((double) numPoints));
+    if (pointId > 0) pointId--;
+    levelPositions[k] = sortedDataValues[pointId];
+  }
+  std::vector<double> levelCdfs (0);
+  std::vector<double> levelIacts(0);
+  double auxNumPoints = (double) this->subCdfIndicatorIacts(initialPos,
+                                                            levelPositions,
+                                                            levelCdfs,
+                                                            levelIacts);
+
+  cdfStaccValues.resize   (numPoints,0.);
+  cdfStaccValuesUp.resize (numPoints,0.);
+  cdfStaccValuesLow.resize(numPoints,0.);
+  unsigned int k = 0;
   for (unsigned int pointId = 0; pointId < numPoints; pointId++) {
-    double p = ( ((double) pointId) + 1.0 )/auxNumPoints;
-    double ro0 = p*(1.0-p);
+    double p = ( ((double) pointId) + 1.0 )/((double) numPoints);
     cdfStaccValues[pointId] = p;
-       
-    //std::cout << "x-data" << data[pointId]
-    //          << std::endl;       
-       
-    for (unsigned int k = 0; k < numPoints; k++) {
-      if (m_seq[k] <= sortedDataValues[pointId]) {
-        Isam_mat[k] = 1;
+
+    // Linear interpolation of the auto-correlation time between cdf levels
+    double tau = levelIacts[0];
+    if (p > levelCdfs[0]) {
+      while (((k+1) < numLevels) && (levelCdfs[k+1] <= p)) k++;
+      if ((k+1) < numLevels) {
+        double w = (p - levelCdfs[k])/(levelCdfs[k+1] - levelCdfs[k]);
+        tau = (1.-w)*levelIacts[k] + w*levelIacts[k+1];
       }
       else {
-        Isam_mat[k] = 0;
-      }
-    }  
-
-    for (unsigned int tau = 0; tau < (numPoints-1); tau++) {
-      ro[tau] = 0.;
-      for (unsigned int kk = 0; kk < numPoints-(tau+1); kk++) {
-        ro[tau] += (Isam_mat[kk+tau+1]-p)*(Isam_mat[kk]-p);
+        tau = levelIacts[numLevels-1];
       }
-      ro[tau] *= 1.0/auxNumPoints;
     }
-    double lamb = 0.;
-    for (unsigned int tau = 0; tau < (numPoints-1); tau++) {
-      double auxTau = tau;
-      lamb += (1.-(auxTau+1.)/auxNumPoints)*ro[tau]/ro0;
-      if (lamb > maxLamb) maxLamb = lamb;
-    }
-    lamb = 2.*maxLamb;
 
-    //double ll=gsl_cdf_gaussian_Pinv(-0.05);
-    cdfStaccValuesUp [pointId] = cdfStaccValues[pointId]+1.96*sqrt(ro0/auxNumPoints*(1.+lamb));
-    cdfStaccValuesLow[pointId] = cdfStaccValues[pointId]-1.96*sqrt(ro0/auxNumPoints*(1.+lamb));
+    double halfWidth = 1.96*std::sqrt(p*(1.-p)*tau/auxNumPoints);
+    cdfStaccValuesUp [pointId] = p + halfWidth;
+    cdfStaccValuesLow[pointId] = p - halfWidth;
     if (cdfStaccValuesLow[pointId] < 0.) cdfStaccValuesLow[pointId] = 0.;
     if (cdfStaccValuesUp [pointId] > 1.) cdfStaccValuesUp [pointId] = 1.;
-    //if (pointId==1 | pointId==100 | pointId==900) {
-    //  std::cout<<lamb<<ll<<std::endl;
-    //  std::cout<<lamb<<std::endl;
-    //}
   }
 
-#if 0
-  unsigned int dataSize = this->subSequenceSize() - initialPos;
-  unsigned int numEvals = evaluationPositions.size();
-
-  for (unsigned int j = 0; j < numEvals; ++j) {
-    double x = evaluationPositions[j];
-    double value = 0.;
-    for (unsigned int k = 0; k < dataSize; ++k) {
-      double xk = m_seq[initialPos+k];
-      value += 0.;//uqMiscGaussianDensity((x-xk)*scaleInv,0.,1.);
-    }
-    cdfStaccValues[j] = value/(double) dataSize;
-  }
-#endif
-
   return;
 }
 //---------------------------------------------------
@@ -4621,45 +4906,23 @@ void
 uqScalarSequenceClass<T>::subCdfStacc(
   unsigned int          initialPos,
   const std::vector<T>& evaluationPositions,
+  std::vector<double>&  cdfValues,
   std::vector<double>&  cdfStaccValues) const
 {
-  UQ_FATAL_TEST_MACRO(true,
-                      m_env.worldRank(),
-                      "uqScalarSequenceClass<T>::subCdfStacc()",
-                      "not implemented yet");
-
-  bool bRC = ((initialPos                 <  this->subSequenceSize()   ) &&
-              (0                          <  evaluationPositions.size()) &&
-              (evaluationPositions.size() == cdfStaccValues.size()     ));
-  UQ_FATAL_TEST_MACRO(bRC == false,
-                      m_env.worldRank(),
-                      "uqScalarSequenceClass<V>::subCdfStacc()",
-                      "invalid input data");
-
-  // For Joseph: 
-  // Maybe sort first
-  // For each of the evaluation positions:
-  // --> 1) form temporary scalar seq that contains only 0 and 1
-  // --> 2) call "temporary scalar seq"->meanStacc()
+  std::vector<double> iacts(0);
+  double dataSize = (double) this->subCdfIndicatorIacts(initialPos,
+                                                        evaluationPositions,
+                                                        cdfValues,
+                                                        iacts);
 
-#if 0
-  unsigned int dataSize = this->subSequenceSize() - initialPos;
-  unsigned int numEvals = evaluationPositions.size();
-
-  for (unsigned int j = 0; j < numEvals; ++j) {
-    //double x = evaluationPositions[j];
-    double value = 0.;
-    for (unsigned int k = 0; k < dataSize; ++k) {
-      //double xk = m_seq[initialPos+k];
-      value += 0.;//uqMiscGaussianDensity((x-xk)*scaleInv,0.,1.);
-    }
-    cdfStaccValues[j] = value/(double) dataSize;
+  cdfStaccValues.resize(cdfValues.size(),0.);
+  for (unsigned int j = 0; j < cdfValues.size(); ++j) {
+    double p = cdfValues[j];
+    cdfStaccValues[j] = std::sqrt(p*(1.-p)*iacts[j]/dataSize);
   }
-#endif
 
   return;
 }
-#endif // #ifdef QUESO_COMPUTES_EXTRA_POST_PROCESSING_STATISTICS
 
 // --------------------------------------------------
 // Additional methods -------------------------------
@@ -209,6 +209,16 @@ public:
                                            unsigned int                         numPos,
                                            unsigned int                         numSum,
                                            V&                                   autoCorrsSumVec) const;
+
+  //! Estimates, per component, the integrated autocorrelation time and the effective sample size.
+  /*! All components are handled in one blocked FFT pass (see blockedAutoCorrsViaFft()), with lags
+   * up to \c numPos-1, and then truncated with Geyer's or Sokal's rule. */
+  void         effectiveSampleSize        (unsigned int                         initialPos,
+                                           unsigned int                         numPos,
+                                           const std::string&                   iactMethod,
+                                           double                               sokalWindowFactor,
+                                           V&                                   iactVec,
+                                           V&                                   essVec) const;
   //! Finds the minimum and the maximum values of the sub-sequence, considering \c numPos positions starting at position \c initialPos. 
   void         subMinMaxExtra             (unsigned int                         initialPos,
                                            unsigned int                         numPos,
@@ -245,7 +255,10 @@ public:
                                            V&                                   iqrVec) const;
   
   //! Returns the interquartile range of the values in the unified sequence. 
+  /*! If \c approximate is true, the quartiles are estimated from regular samples of each processor's
+   * data, see uqScalarSequenceClass<T>::unifiedQuantiles(). */
   void         unifiedInterQuantileRange  (unsigned int                         initialPos,
+                                           bool                                 approximate,
                                            V&                                   unifiedIqrVec) const;
   
   //! Selects the scales (bandwidth, \c scaleVec) for the kernel density estimation, considering only the sub-sequence.
@@ -392,10 +405,14 @@ public:
                                            std::vector<V*>&                     cdfStaccVecsUp,
                                            std::vector<V*>&                     cdfStaccVecsLow,												 
                                            std::vector<V*>&                     sortedDataVecs) const;
+#endif
+  //! Estimates, for each component, the cdf at \c evalPositionsVecs and its statistical accuracy.
+  /*! It applies uqScalarSequenceClass<T>::subCdfStacc() to each component of the sub-sequence, starting at
+   * \c initialPos. The vectors in \c cdfVecs and \c cdfStaccVecs are allocated here and owned by the caller. */
   void         subCdfStacc                (unsigned int                         initialPos,
                                            const std::vector<V*>&               evalPositionsVecs,
+                                           std::vector<V*>&                     cdfVecs,
                                            std::vector<V*>&                     cdfStaccVecs) const;
-#endif
 //@}
 private:
   //! Copies vector sequence \c src to \c this.
@@ -411,6 +428,16 @@ private:
                                            unsigned int                         paramId,
                                            std::vector<double>&                 rawData) const;
 
+  //! Computes the linear auto-correlations of all components in one blocked pass.
+  /*! The sub-sequence of \c numPos positions starting at \c initialPos is copied, component
+   * after component and centered on its mean, into a single buffer that is handed to the
+   * (plan cached) FFT object. On output, \c autoCovs holds one block of \c maxLag+1 values
+   * per component. */
+  void         blockedAutoCorrsViaFft     (unsigned int                         initialPos,
+                                           unsigned int                         numPos,
+                                           unsigned int                         maxLag,
+                                           std::vector<double>&                 autoCovs) const;
+
   using uqBaseVectorSequenceClass<V,M>::m_env;
   using uqBaseVectorSequenceClass<V,M>::m_vectorSpace;
   using uqBaseVectorSequenceClass<V,M>::m_name;
@@ -1327,33 +1354,19 @@ uqSequenceOfVectorsClass<V,M>::autoCorrViaFft(
     if (corrVecs[j] == NULL) corrVecs[j] = new V(m_vectorSpace.zeroVector());
   }
 
-  uqScalarSequenceClass<double> data(m_env,0,"");
   unsigned int maxLag = lags[lags.size()-1];
-  std::vector<double> autoCorrs(maxLag+1,0.); // Yes, +1
+  std::vector<double> autoCovs(0,0.);
+  this->blockedAutoCorrsViaFft(initialPos,
+                               numPos,
+                               maxLag,
+                               autoCovs);
 
   unsigned int numParams = this->vectorSizeLocal();
   for (unsigned int i = 0; i < numParams; ++i) {
-    this->extractScalarSeq(initialPos,
-                           1, // spacing
-                           numPos,
-                           i,
-                           data);
-
-    //if (m_env.subDisplayFile()) {
-    //  *m_env.subDisplayFile() << "In uqSequenceOfVectorsClass<V,M>::autoCorrViaFft()"
-    //                         << ": about to call data.autoCorrViaFft() for paramId = " << i
-    //                         << ", with numPos = "      << numPos
-    //                         << ", maxLag = "           << maxLag
-    //                         << ", autoCorrs.size() = " << autoCorrs.size()
-    //                         << std::endl;
-    //}
-    data.autoCorrViaFft(0,
-                        numPos,
-                        maxLag,
-                        autoCorrs);
-
+    const double* paramAutoCovs = &autoCovs[i*(maxLag+1)];
     for (unsigned int j = 0; j < lags.size(); ++j) {
-      (*(corrVecs[j]))[i] = autoCorrs[lags[j]];
+      double ratio = ((double) lags[j])/((double) (numPos-1));
+      (*(corrVecs[j]))[i] = ( paramAutoCovs[lags[j]]/paramAutoCovs[0] )*(1.-ratio);
     }
   }
 
@@ -1379,20 +1392,63 @@ uqSequenceOfVectorsClass<V,M>::autoCorrViaFft(
                       "uqSequenceOfVectorsClass<V,M>::autoCorrViaFft(), for sum",
                       "invalid input data");
 
-  uqScalarSequenceClass<double> data(m_env,0,"");
+  std::vector<double> autoCovs(0,0.);
+  this->blockedAutoCorrsViaFft(initialPos,
+                               numPos,
+                               numSum-1, // maxLag
+                               autoCovs);
 
   unsigned int numParams = this->vectorSizeLocal();
   for (unsigned int i = 0; i < numParams; ++i) {
-    this->extractScalarSeq(initialPos,
-                           1, // spacing
-                           numPos,
-                           i,
-                           data);
+    const double* paramAutoCovs = &autoCovs[i*numSum];
+    autoCorrsSumVec[i] = 0.;
+    for (unsigned int j = 0; j < numSum; ++j) { // Yes, begin at lag '0'
+      double ratio = ((double) j)/((double) (numPos-1));
+      autoCorrsSumVec[i] += ( paramAutoCovs[j]/paramAutoCovs[0] )*(1.-ratio);
+    }
+  }
 
-    data.autoCorrViaFft(0,
-                        numPos,
-                        numSum,
-                        autoCorrsSumVec[i]);
+  return;
+}
+//---------------------------------------------------
+template <class V, class M>
+void
+uqSequenceOfVectorsClass<V,M>::effectiveSampleSize(
+  unsigned int       initialPos,
+  unsigned int       numPos,
+  const std::string& iactMethod,
+  double             sokalWindowFactor,
+  V&                 iactVec,
+  V&                 essVec) const
+{
+  bool bRC = ((initialPos              <  this->subSequenceSize()) &&
+              (1                       <  numPos                 ) &&
+              ((initialPos+numPos)     <= this->subSequenceSize()) &&
+              (iactVec.sizeLocal()     == this->vectorSizeLocal()) &&
+              (essVec.sizeLocal()      == this->vectorSizeLocal()) &&
+              ((iactMethod == UQ_IACT_GEYER_METHOD) || (iactMethod == UQ_IACT_SOKAL_METHOD)));
+  UQ_FATAL_TEST_MACRO(bRC == false,
+                      m_env.worldRank(),
+                      "uqSequenceOfVectorsClass<V,M>::effectiveSampleSize()",
+                      "invalid input data");
+
+  unsigned int maxLag = numPos-1;
+  std::vector<double> autoCovs(0,0.);
+  this->blockedAutoCorrsViaFft(initialPos,
+                               numPos,
+                               maxLag,
+                               autoCovs);
+
+  unsigned int numParams = this->vectorSizeLocal();
+  for (unsigned int i = 0; i < numParams; ++i) {
+    const double* paramAutoCovs = &autoCovs[i*(maxLag+1)];
+    if (iactMethod == UQ_IACT_GEYER_METHOD) {
+      iactVec[i] = uqMiscGeyerIntegratedAutoCorrTime(paramAutoCovs,maxLag+1);
+    }
+    else {
+      iactVec[i] = uqMiscSokalIntegratedAutoCorrTime(paramAutoCovs,maxLag+1,sokalWindowFactor);
+    }
+    essVec[i] = ((double) numPos)/iactVec[i];
   }
 
   return;
@@ -1400,6 +1456,41 @@ uqSequenceOfVectorsClass<V,M>::autoCorrViaFft(
 //---------------------------------------------------
 template <class V, class M>
 void
+uqSequenceOfVectorsClass<V,M>::blockedAutoCorrsViaFft(
+  unsigned int         initialPos,
+  unsigned int         numPos,
+  unsigned int         maxLag,
+  std::vector<double>& autoCovs) const
+{
+  unsigned int numParams = this->vectorSizeLocal();
+  std::vector<double> rawData(numParams*numPos,0.);
+  std::vector<double> meanValues(numParams,0.);
+
+  // Single pass over the chain, transposing it into one contiguous block per component
+  for (unsigned int j = 0; j < numPos; ++j) {
+    const V& vec = *(m_seq[initialPos+j]);
+    for (unsigned int i = 0; i < numParams; ++i) {
+      rawData[i*numPos+j] = vec[i];
+      meanValues[i]      += vec[i];
+    }
+  }
+  for (unsigned int i = 0; i < numParams; ++i) {
+    double meanValue = meanValues[i]/((double) numPos);
+    for (unsigned int j = 0; j < numPos; ++j) {
+      rawData[i*numPos+j] -= meanValue; // IMPORTANT
+    }
+  }
+
+  m_fftObj->autoCorrelations(rawData,
+                             numParams,
+                             maxLag,
+                             autoCovs);
+
+  return;
+}
+//---------------------------------------------------
+template <class V, class M>
+void
 uqSequenceOfVectorsClass<V,M>::subMinMaxExtra(
   unsigned int initialPos,
   unsigned int numPos,
@@ -1600,6 +1691,7 @@ template <class V, class M>
 void
 uqSequenceOfVectorsClass<V,M>::unifiedInterQuantileRange(
   unsigned int initialPos,
+  bool         approximate,
   V&           unifiedIqrVec) const
 {
   bool bRC = ((initialPos              <  this->subSequenceSize()  ) &&
@@ -1620,7 +1712,8 @@ uqSequenceOfVectorsClass<V,M>::unifiedInterQuantileRange(
                            i,
                            data);
     unifiedIqrVec[i] = data.unifiedInterQuantileRange(m_vectorSpace.numOfProcsForStorage() == 1,
-                                                      0);
+                                                      0,
+                                                      approximate);
   }
 
   return;
@@ -1934,6 +2027,7 @@ uqSequenceOfVectorsClass<V,M>::unifiedWriteContents(
   const std::string& fileName,
   const std::string& inputFileType) const
 { 
+  unsigned long long traceStart = m_env.tracer().start();
   std::string fileType(inputFileType);
 #ifdef QUESO_HAS_HDF5
   // Do nothing
@@ -2193,6 +2287,8 @@ uqSequenceOfVectorsClass<V,M>::unifiedWriteContents(
     }
   } // if (m_env.inter0Rank() >= 0)
 
+  m_env.tracer().stop(UQ_TRACE_IO_WRITE_ID,traceStart);
+
   if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 10)) {
     *m_env.subDisplayFile() << "Leaving uqSequenceOfVectorsClass<V,M>::unifiedWriteContents()"
                             << ", fileName = " << fileName
@@ -3209,8 +3305,8 @@ uqSequenceOfVectorsClass<V,M>::subCdfStacc(
                            i,
                            data);
     //std::cout << "x-data" << data<< std::endl;
-    data.subSort(initialPos,sortedData);
-    data.subCdfStacc(initialPos,
+    data.subSort(0,sortedData);
+    data.subCdfStacc(0,
                      cdfStaccs,
                      cdfStaccsup,
                      cdfStaccslow,
@@ -3226,16 +3322,20 @@ uqSequenceOfVectorsClass<V,M>::subCdfStacc(
 
   return;
 }
-//---------------------------------------------------
+#endif // #ifdef QUESO_COMPUTES_EXTRA_POST_PROCESSING_STATISTICS
+
+// --------------------------------------------------
 template <class V, class M>
 void
 uqSequenceOfVectorsClass<V,M>::subCdfStacc(
   unsigned int           initialPos,
   const std::vector<V*>& evalPositionsVecs,
+  std::vector<V*>&       cdfVecs,
   std::vector<V*>&       cdfStaccVecs) const
 {
   bool bRC = ((initialPos               <  this->subSequenceSize() ) &&
               (0                        <  evalPositionsVecs.size()) &&
+              (evalPositionsVecs.size() == cdfVecs.size()          ) &&
               (evalPositionsVecs.size() == cdfStaccVecs.size()     ));
   UQ_FATAL_TEST_MACRO(bRC == false,
                       m_env.worldRank(),
@@ -3247,9 +3347,11 @@ uqSequenceOfVectorsClass<V,M>::subCdfStacc(
 
   unsigned int numEvals = evalPositionsVecs.size();
   for (unsigned int j = 0; j < numEvals; ++j) {
+    cdfVecs     [j] = new V(m_vectorSpace.zeroVector());
     cdfStaccVecs[j] = new V(m_vectorSpace.zeroVector());
   }
   std::vector<double> evalPositions(numEvals,0.);
+  std::vector<double> cdfs         (numEvals,0.);
   std::vector<double> cdfStaccs    (numEvals,0.);
 
   unsigned int numParams = this->vectorSizeLocal();
@@ -3266,16 +3368,17 @@ uqSequenceOfVectorsClass<V,M>::subCdfStacc(
 
     data.subCdfStacc(0,
                      evalPositions,
+                     cdfs,
                      cdfStaccs);
 
     for (unsigned int j = 0; j < numEvals; ++j) {
+      (*cdfVecs     [j])[i] = cdfs     [j];
       (*cdfStaccVecs[j])[i] = cdfStaccs[j];
     }
   }
 
   return;
 }
-#endif // #ifdef QUESO_COMPUTES_EXTRA_POST_PROCESSING_STATISTICS
 
 // --------------------------------------------------
 // --------------------------------------------------
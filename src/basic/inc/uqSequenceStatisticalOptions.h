@@ -34,6 +34,7 @@
 #ifdef QUESO_USES_SEQUENCE_STATISTICAL_OPTIONS
 
 #include <uqEnvironment.h>
+#include <uqMiscellaneous.h>
 
 #define UQ_SEQUENCE_INITIAL_DISCARDED_PORTIONS_ODV   "0."
 #ifdef QUESO_COMPUTES_EXTRA_POST_PROCESSING_STATISTICS
@@ -65,9 +66,9 @@
 #define UQ_SEQUENCE_MEAN_STACC_COMPUTE_ODV           0
 #define UQ_SEQUENCE_HIST_COMPUTE_ODV                 0
 #define UQ_SEQUENCE_HIST_NUM_INTERNAL_BINS_ODV       100
+#endif
 #define UQ_SEQUENCE_CDF_STACC_COMPUTE_ODV            0
 #define UQ_SEQUENCE_CDF_STACC_NUM_EVAL_POSITIONS_ODV 50
-#endif
 #define UQ_SEQUENCE_AUTO_CORR_COMPUTE_VIA_DEF_ODV    0
 #define UQ_SEQUENCE_AUTO_CORR_COMPUTE_VIA_FFT_ODV    0
 #define UQ_SEQUENCE_AUTO_CORR_SECOND_LAG_ODV         0
@@ -75,8 +76,14 @@
 #define UQ_SEQUENCE_AUTO_CORR_NUM_LAGS_ODV           0
 #define UQ_SEQUENCE_AUTO_CORR_DISPLAY_ODV            0
 #define UQ_SEQUENCE_AUTO_CORR_WRITE_ODV              0
+#define UQ_SEQUENCE_ESS_COMPUTE_ODV                  0
+#define UQ_SEQUENCE_ESS_METHOD_ODV                   UQ_IACT_GEYER_METHOD
+#define UQ_SEQUENCE_ESS_SOKAL_WINDOW_FACTOR_ODV      UQ_IACT_SOKAL_WINDOW_FACTOR
+#define UQ_SEQUENCE_ESS_DISPLAY_ODV                  0
+#define UQ_SEQUENCE_ESS_WRITE_ODV                    0
 #define UQ_SEQUENCE_KDE_COMPUTE_ODV                  0
 #define UQ_SEQUENCE_KDE_NUM_EVAL_POSITIONS_ODV       100
+#define UQ_SEQUENCE_KDE_APPROX_UNIFIED_IQR_ODV       0
 #define UQ_SEQUENCE_COV_MATRIX_COMPUTE_ODV           0
 #define UQ_SEQUENCE_CORR_MATRIX_COMPUTE_ODV          0
 
@@ -140,12 +147,30 @@ public:
   //! Whether or not write autocorrelation to file.
   bool                      m_autoCorrWrite;
 
+  //! Whether or not compute integrated autocorrelation times and effective sample sizes (ESS).
+  bool                      m_essCompute;
+
+  //! Method for the integrated autocorrelation time: UQ_IACT_GEYER_METHOD or UQ_IACT_SOKAL_METHOD.
+  std::string               m_essMethod;
+
+  //! Window factor of Sokal's automatic windowing.
+  double                    m_essSokalWindowFactor;
+
+  //! Whether or not display ESS.
+  bool                      m_essDisplay;
+
+  //! Whether or not write ESS to file.
+  bool                      m_essWrite;
+
   //! Whether or not compute kernel density estimate (kde).
   bool                      m_kdeCompute;
   
   //! Number of positions to evaluate kde.
   unsigned int              m_kdeNumEvalPositions;
 
+  //! Whether or not approximate the unified IQR (used for the unified kde bandwidth) from regular samples of each processor, instead of sorting the unified sequence.
+  bool                      m_kdeApproxUnifiedIqr;
+
   //! Whether or not compute covariance matrix.
   bool                      m_covMatrixCompute;
   
@@ -189,9 +214,9 @@ public:
   bool                      m_histCompute;
   unsigned int              m_histNumInternalBins;
 
+#endif
   bool                      m_cdfStaccCompute;
   unsigned int              m_cdfStaccNumEvalPositions;
-#endif
   //@} 
   // end public attributes
 private:
@@ -256,12 +281,30 @@ public:
   
   //! Writes autocorrelation. Access to private attribute m_autoCorrWrite
   bool                       autoCorrWrite        () const;
+
+  //! Computes ESS. Access to private attribute m_essCompute
+        bool                 essCompute          () const;
+
+  //! Returns the method for the integrated autocorrelation time. Access to private attribute m_essMethod
+  const std::string&         essMethod           () const;
+
+  //! Returns the window factor of Sokal's method. Access to private attribute m_essSokalWindowFactor
+        double               essSokalWindowFactor() const;
+
+  //! Displays ESS. Access to private attribute m_essDisplay
+        bool                 essDisplay          () const;
+
+  //! Writes ESS. Access to private attribute m_essWrite
+        bool                 essWrite            () const;
   
   //! Computes KDE. Access to private attribute m_kdeCompute
   bool                       kdeCompute         () const;
   
   //! Returns number of evaluation positions for KDE. Access to private attribute m_kdeNumEvalPositions
   unsigned int               kdeNumEvalPositions() const;
+
+  //! Approximates the unified IQR for the unified KDE. Access to private attribute m_kdeApproxUnifiedIqr
+  bool                       kdeApproxUnifiedIqr() const;
   
   //! Finds the covariance matrix. Access to private attribute m_covMatrixCompute
   bool                       covMatrixCompute () const;
@@ -319,9 +362,9 @@ public:
         bool                       histCompute        () const;
         unsigned int               histNumInternalBins() const;
 
+#endif
         bool                       cdfStaccCompute         () const;
         unsigned int               cdfStaccNumEvalPositions() const;
-#endif
        
 private:
   //! Defines the options for the chain
@@ -344,8 +387,14 @@ private:
   std::string                   m_option_autoCorr_numLags;
   std::string                   m_option_autoCorr_display;
   std::string                   m_option_autoCorr_write;
+  std::string                   m_option_ess_compute;
+  std::string                   m_option_ess_method;
+  std::string                   m_option_ess_sokalWindowFactor;
+  std::string                   m_option_ess_display;
+  std::string                   m_option_ess_write;
   std::string                   m_option_kde_compute;
   std::string                   m_option_kde_numEvalPositions;
+  std::string                   m_option_kde_approxUnifiedIqr;
   std::string                   m_option_covMatrix_compute;
   std::string                   m_option_corrMatrix_compute;
   
@@ -378,9 +427,9 @@ private:
   std::string                   m_option_meanStacc_compute;
   std::string                   m_option_hist_compute;
   std::string                   m_option_hist_numInternalBins;
+#endif  
   std::string                   m_option_cdfStacc_compute;
   std::string                   m_option_cdfStacc_numEvalPositions;
-#endif  
   
 };
 
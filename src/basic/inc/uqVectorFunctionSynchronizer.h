@@ -124,6 +124,7 @@ uqVectorFunctionSynchronizerClass<P_V,P_M,Q_V,Q_M>::callFunction(
             uqDistArrayClass<P_V*>* internalGrads     = NULL; // Yes, 'P_V'
             uqDistArrayClass<P_M*>* internalHessians  = NULL; // Yes, 'P_M'
             uqDistArrayClass<P_V*>* internalEffects   = NULL;
+      unsigned long long traceBcast = 0;
 
       /////////////////////////////////////////////////
       // Broadcast 1 of 3
@@ -160,9 +161,11 @@ uqVectorFunctionSynchronizerClass<P_V,P_M,Q_V,Q_M>::callFunction(
       //if (m_env.subId() != 0) while (true) sleep(1);
 
       int count = (int) bufferChar.size();
+      traceBcast = m_env.tracer().start();
       m_env.subComm().Bcast((void *) &bufferChar[0], count, uqRawValue_MPI_CHAR, 0,
                             "uqVectorFunctionSynchronizerClass<P_V,P_M,Q_V,Q_M>::callFunction()",
                             "failed broadcast 1 of 3");
+      m_env.tracer().stop(UQ_TRACE_SYNC_BCAST_ID,traceBcast);
 
       if (bufferChar[0] == '1') {
         ///////////////////////////////////////////////
@@ -179,9 +182,11 @@ uqVectorFunctionSynchronizerClass<P_V,P_M,Q_V,Q_M>::callFunction(
         }
 
         count = (int) bufferDouble.size();
+        traceBcast = m_env.tracer().start();
         m_env.subComm().Bcast((void *) &bufferDouble[0], count, uqRawValue_MPI_DOUBLE, 0,
                               "uqVectorFunctionSynchronizerClass<P_V,P_M,Q_V,Q_M>::callFunction()",
                               "failed broadcast 2 of 3");
+        m_env.tracer().stop(UQ_TRACE_SYNC_BCAST_ID,traceBcast);
 
         if (m_env.subRank() != 0) {
           P_V tmpPVec(m_auxPVec);
@@ -204,9 +209,11 @@ uqVectorFunctionSynchronizerClass<P_V,P_M,Q_V,Q_M>::callFunction(
           }
 
           count = (int) bufferDouble.size();
+          traceBcast = m_env.tracer().start();
           m_env.subComm().Bcast((void *) &bufferDouble[0], count, uqRawValue_MPI_DOUBLE, 0,
                                 "uqVectorFunctionSynchronizerClass<P_V,P_M,Q_V,Q_M>::callFunction()",
                                 "failed broadcast 3 of 3");
+          m_env.tracer().stop(UQ_TRACE_SYNC_BCAST_ID,traceBcast);
 
           if (m_env.subRank() != 0) {
             P_V tmpPVec(m_auxPVec);
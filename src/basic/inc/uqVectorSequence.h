@@ -242,6 +242,18 @@ public:
 						       unsigned int                             numPos,
 						       unsigned int                             numSum,
 						       V&                                       autoCorrsSumVec) const = 0;
+  //! Estimates, per component, the integrated autocorrelation time and the effective sample size. See template specialization.
+  /*! The integrated autocorrelation time \f$ \tau = 1 + 2 \sum_{k \ge 1} \rho_k \f$ is estimated from
+   * the FFT autocorrelations of \c numPos positions starting at \c initialPos, with either Geyer's
+   * initial monotone sequence (\c iactMethod = UQ_IACT_GEYER_METHOD) or Sokal's automatic windowing
+   * (UQ_IACT_SOKAL_METHOD, window \f$ M \ge \c sokalWindowFactor \cdot \tau(M) \f$). The effective
+   * sample size is \f$ \c numPos / \tau \f$. */
+  virtual  void           effectiveSampleSize         (unsigned int                             initialPos,
+						       unsigned int                             numPos,
+						       const std::string&                       iactMethod,
+						       double                                   sokalWindowFactor,
+						       V&                                       iactVec,
+						       V&                                       essVec) const = 0;
 
 						       
   //! Finds the minimum and the maximum values of the sub-sequence, considering \c numPos positions starting at position \c initialPos. See template specialization. 
@@ -275,8 +287,9 @@ public:
  //! Returns the interquartile range of the values in the sub-sequence. See template specialization.
   virtual  void           subInterQuantileRange       (unsigned int                             initialPos,
 						       V&                                       iqrVec) const = 0;
- //! Returns the interquartile range of the values in the unified sequence. See template specialization.
+ //! Returns the interquartile range of the values in the unified sequence, exactly or approximately. See template specialization.
   virtual  void           unifiedInterQuantileRange   (unsigned int                             initialPos,
+						       bool                                     approximate,
 						       V&                                       unifiedIqrVec) const = 0;
 
  //! Selects the scales (bandwidth, \c scaleVec) for the kernel density estimation, considering only the sub-sequence. See template specialization.
@@ -379,9 +392,12 @@ public:
 						       V&                                       gewVec) const = 0;
   virtual  void           meanStacc                   (unsigned int                             initialPos,
 						       V&                                       meanStaccVec) const = 0;
-  virtual  void           subCdfStacc                 (unsigned int                             initialPos,
-						       const std::vector<V*>&                   evalPositionsVecs,                                                                 std::vector<V*>&                         cdfStaccVecs) const = 0;
 #endif //QUESO_COMPUTES_EXTRA_POST_PROCESSING_STATISTICS
+  //! Estimates the cdf of each component at \c evalPositionsVecs, and the statistical accuracy (StACC) of each estimate. See template specialization.
+  virtual  void           subCdfStacc                 (unsigned int                             initialPos,
+						       const std::vector<V*>&                   evalPositionsVecs,
+						       std::vector<V*>&                         cdfVecs,
+						       std::vector<V*>&                         cdfStaccVecs) const = 0;
 						       
 #ifdef QUESO_USES_SEQUENCE_STATISTICAL_OPTIONS
   void                    computeHistCdfstaccKde      (const uqSequenceStatisticalOptionsClass& statisticalOptions,
@@ -512,6 +528,9 @@ protected:
                                                        const std::vector<unsigned int>&         initialPosForStatistics,
                                                        const std::vector<unsigned int>&         lagsForCorrs,
                                                        std::ofstream*                           passedOfs);
+           void           computeESS                  (const uqSequenceStatisticalOptionsClass& statisticalOptions,
+                                                       const std::vector<unsigned int>&         initialPosForStatistics,
+                                                       std::ofstream*                           passedOfs);
            void           computeCovCorrMatrices      (const uqSequenceStatisticalOptionsClass& statisticalOptions,
                                                        std::ofstream*                           passedOfs);
 #endif
@@ -1320,16 +1339,25 @@ uqBaseVectorSequenceClass<V,M>::computeStatistics(
                                 passedOfs);
   }
 
+  //****************************************************
+  // Compute integrated autocorrelation times and effective sample sizes
+  //****************************************************
+  if ((statisticalOptions.essCompute()) &&
+      (initialPosForStatistics.size() > 0)) {
+    this->computeESS(statisticalOptions,
+                     initialPosForStatistics,
+                     passedOfs);
+  }
+
   //****************************************************
   // Compute histogram and/or cdf stacc and/or Kde
   //****************************************************
+  if (
 #ifdef QUESO_COMPUTES_EXTRA_POST_PROCESSING_STATISTICS
-  if ((statisticalOptions.histCompute    ()) ||
+      (statisticalOptions.histCompute    ()) ||
+#endif
       (statisticalOptions.cdfStaccCompute()) ||
       (statisticalOptions.kdeCompute     ())) {
-#else
-    if (statisticalOptions.kdeCompute()) //kemelli deleted single '{' on 5/28/13 - compare to queso-0.45.2
-#endif
     this->computeHistCdfstaccKde(statisticalOptions,
                                  passedOfs);
   }
@@ -1857,6 +1885,104 @@ uqBaseVectorSequenceClass<V,M>::computeAutoCorrViaFFT(
 // --------------------------------------------------
 template<class V, class M>
 void
+uqBaseVectorSequenceClass<V,M>::computeESS(
+  const uqSequenceStatisticalOptionsClass& statisticalOptions,
+  const std::vector<unsigned int>&         initialPosForStatistics,
+  std::ofstream*                           passedOfs)
+{
+  int iRC = UQ_OK_RC;
+  struct timeval timevalTmp;
+  iRC = gettimeofday(&timevalTmp, NULL);
+  double tmpRunTime = 0.;
+
+  if (m_env.subDisplayFile()) {
+    *m_env.subDisplayFile() << "\n-----------------------------------------------------"
+                            << "\nComputing integrated autocorrelation times and effective sample sizes"
+                            << ", with method '" << statisticalOptions.essMethod()
+                            << "'"
+                            << std::endl;
+  }
+
+  std::vector<V*> vectorOfIacts(initialPosForStatistics.size(),NULL);
+  std::vector<V*> vectorOfEss  (initialPosForStatistics.size(),NULL);
+  for (unsigned int initialPosId = 0; initialPosId < initialPosForStatistics.size(); initialPosId++) {
+    unsigned int initialPos = initialPosForStatistics[initialPosId];
+    vectorOfIacts[initialPosId] = new V(m_vectorSpace.zeroVector());
+    vectorOfEss  [initialPosId] = new V(m_vectorSpace.zeroVector());
+    this->effectiveSampleSize(initialPos,
+                              this->subSequenceSize()-initialPos, // Use all possible data positions
+                              statisticalOptions.essMethod(),
+                              statisticalOptions.essSokalWindowFactor(),
+                              *(vectorOfIacts[initialPosId]),
+                              *(vectorOfEss  [initialPosId]));
+  }
+
+  if (statisticalOptions.essDisplay() && (m_env.subDisplayFile())) {
+    *m_env.subDisplayFile() << "\nComputed integrated autocorrelation times and (in parentheses) effective sample sizes"
+                            << " (each column corresponds to a different initial position on the full chain)"
+                            << std::endl;
+
+    char line[512];
+    sprintf(line,"%s",
+            "Parameter");
+    *m_env.subDisplayFile() << line;
+    for (unsigned int initialPosId = 0; initialPosId < initialPosForStatistics.size(); initialPosId++) {
+      sprintf(line,"%23s%3d",
+              " ",
+              initialPosForStatistics[initialPosId]);
+      *m_env.subDisplayFile() << line;
+    }
+
+    for (unsigned int i = 0; i < this->vectorSizeLocal() /*.*/; ++i) {
+      sprintf(line,"\n%9.9s",
+              m_vectorSpace.localComponentName(i).c_str() /*.*/);
+      *m_env.subDisplayFile() << line;
+      for (unsigned int initialPosId = 0; initialPosId < initialPosForStatistics.size(); initialPosId++) {
+        sprintf(line,"%2s%11.4e (%11.4e)",
+                " ",
+                (*(vectorOfIacts[initialPosId]))[i],
+                (*(vectorOfEss  [initialPosId]))[i]);
+        *m_env.subDisplayFile() << line;
+      }
+    }
+    *m_env.subDisplayFile() << std::endl;
+  }
+
+  tmpRunTime += uqMiscGetEllapsedSeconds(&timevalTmp);
+  if (m_env.subDisplayFile()) {
+    *m_env.subDisplayFile() << "Chain ESS took " << tmpRunTime
+                            << " seconds"
+                            << std::endl;
+  }
+
+  // Write integrated autocorrelation times and effective sample sizes
+  if (statisticalOptions.essWrite() && passedOfs) {
+    std::ofstream& ofsvar = *passedOfs;
+    for (unsigned int initialPosId = 0; initialPosId < initialPosForStatistics.size(); initialPosId++) {
+      ofsvar << m_name << "_iactInitPos" << initialPosForStatistics[initialPosId] << "_sub" << m_env.subIdString() << " = zeros(" << this->vectorSizeLocal() /*.*/
+             << ","                                                                                                               << 2
+             << ");"
+             << std::endl;
+      for (unsigned int i = 0; i < this->vectorSizeLocal() /*.*/; ++i) {
+        ofsvar << m_name << "_iactInitPos" << initialPosForStatistics[initialPosId] << "_sub" << m_env.subIdString() << "(" << i+1
+               << ",:) = [ "                                                                                                << (*(vectorOfIacts[initialPosId]))[i]
+               << " "                                                                                                       << (*(vectorOfEss  [initialPosId]))[i]
+               << " ];"
+               << std::endl;
+      }
+    }
+  }
+
+  for (unsigned int initialPosId = 0; initialPosId < initialPosForStatistics.size(); initialPosId++) {
+    if (vectorOfIacts[initialPosId] != NULL) delete vectorOfIacts[initialPosId];
+    if (vectorOfEss  [initialPosId] != NULL) delete vectorOfEss  [initialPosId];
+  }
+
+  return;
+}
+// --------------------------------------------------
+template<class V, class M>
+void
 uqBaseVectorSequenceClass<V,M>::computeHistCdfstaccKde( // Use the whole chain
   const uqSequenceStatisticalOptionsClass& statisticalOptions,
   std::ofstream*                           passedOfs)
@@ -2125,7 +2251,7 @@ uqBaseVectorSequenceClass<V,M>::computeHistCdfstaccKde( // Use the whole chain
     }
   }
 #endif
-#ifdef QUESO_COMPUTES_EXTRA_POST_PROCESSING_STATISTICS
+
   //****************************************************
   // Compute cdf statistical accuracy
   //****************************************************
@@ -2144,11 +2270,63 @@ uqBaseVectorSequenceClass<V,M>::computeHistCdfstaccKde( // Use the whole chain
                                         statsMaxPositions,
                                         cdfStaccEvalPositions);
 
+    std::vector<V*> cdfValues     (statisticalOptions.cdfStaccNumEvalPositions(),NULL);
     std::vector<V*> cdfStaccValues(statisticalOptions.cdfStaccNumEvalPositions(),NULL);
     this->subCdfStacc(0, // Use the whole chain
                       cdfStaccEvalPositions,
+                      cdfValues,
                       cdfStaccValues);
 
+    // Write cdf values and their statistical accuracies
+    if (passedOfs) {
+      std::string subCoreName_cdfStaccPositions((std::string)("_cdfStaccPosits_sub")+m_env.subIdString());
+      std::string subCoreName_cdfValues        ((std::string)("_cdfValues_sub"     )+m_env.subIdString());
+      std::string subCoreName_cdfStaccValues   ((std::string)("_cdfStaccValues_sub")+m_env.subIdString());
+
+      std::ofstream& ofsvar = *passedOfs;
+      ofsvar << m_name << subCoreName_cdfStaccPositions << " = zeros(" << this->vectorSizeLocal() /*.*/
+             << ","                                                    << cdfStaccEvalPositions.size()
+             << ");"
+             << std::endl;
+      ofsvar << m_name << subCoreName_cdfValues         << " = zeros(" << this->vectorSizeLocal() /*.*/
+             << ","                                                    << cdfValues.size()
+             << ");"
+             << std::endl;
+      ofsvar << m_name << subCoreName_cdfStaccValues    << " = zeros(" << this->vectorSizeLocal() /*.*/
+             << ","                                                    << cdfStaccValues.size()
+             << ");"
+             << std::endl;
+      for (unsigned int i = 0; i < this->vectorSizeLocal() /*.*/; ++i) {
+        for (unsigned int j = 0; j < cdfStaccEvalPositions.size(); ++j) {
+          ofsvar << m_name << subCoreName_cdfStaccPositions << "(" << i+1
+                 << ","                                            << j+1
+                 << ") = "                                         << (*(cdfStaccEvalPositions[j]))[i]
+                 << ";"
+                 << std::endl;
+          ofsvar << m_name << subCoreName_cdfValues         << "(" << i+1
+                 << ","                                            << j+1
+                 << ") = "                                         << (*(cdfValues[j]))[i]
+                 << ";"
+                 << std::endl;
+          ofsvar << m_name << subCoreName_cdfStaccValues    << "(" << i+1
+                 << ","                                            << j+1
+                 << ") = "                                         << (*(cdfStaccValues[j]))[i]
+                 << ";"
+                 << std::endl;
+        }
+      }
+    }
+
+    for (unsigned int i = 0; i < cdfStaccValues.size(); ++i) {
+      if (cdfStaccValues[i] != NULL) delete cdfStaccValues[i];
+    }
+    for (unsigned int i = 0; i < cdfValues.size(); ++i) {
+      if (cdfValues[i] != NULL) delete cdfValues[i];
+    }
+    for (unsigned int i = 0; i < cdfStaccEvalPositions.size(); ++i) {
+      if (cdfStaccEvalPositions[i] != NULL) delete cdfStaccEvalPositions[i];
+    }
+
     //m_env.fullComm().Barrier(); // Dangerous to barrier on fullComm ...
     tmpRunTime += uqMiscGetEllapsedSeconds(&timevalTmp);
     if (m_env.subDisplayFile()) {
@@ -2157,7 +2335,7 @@ uqBaseVectorSequenceClass<V,M>::computeHistCdfstaccKde( // Use the whole chain
                               << std::endl;
     }
   }
-#endif
+
   //****************************************************
   // Compute estimations of probability densities
   //****************************************************
@@ -2291,6 +2469,7 @@ uqBaseVectorSequenceClass<V,M>::computeHistCdfstaccKde( // Use the whole chain
       // Compute unified Kde
       V unifiedIqrVec(m_vectorSpace.zeroVector());
       this->unifiedInterQuantileRange(0, // Use the whole chain
+                                      statisticalOptions.kdeApproxUnifiedIqr(),
                                       unifiedIqrVec);
       //m_env.fullComm().Barrier(); // Dangerous to barrier on fullComm ...
 
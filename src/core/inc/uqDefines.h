@@ -173,6 +173,12 @@ public:
   
   //! Debug parameters
   std::vector<double>    m_debugParams;
+
+  //! Prefix of the per rank trace files; "." disables tracing.
+  std::string            m_traceFileName;
+
+  //! Maximum number of events buffered by the tracer of each rank.
+  unsigned int           m_traceMaxEvents;
   //@}
   
 private:
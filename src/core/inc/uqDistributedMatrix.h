@@ -0,0 +1,237 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+// 
+// QUESO - a library to support the Quantification of Uncertainty
+// for Estimation, Simulation and Optimization
+//
+// Copyright (C) 2008,2009,2010,2011,2012,2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor, 
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+// 
+// $Id$
+//
+//--------------------------------------------------------------------------
+
+#ifndef __UQ_DISTRIBUTED_MATRIX_H__
+#define __UQ_DISTRIBUTED_MATRIX_H__
+
+/*! \file uqDistributedMatrix.h
+    \brief Diagonal plus low-rank matrix class with rows partitioned across processors
+*/
+
+#include <uqDefines.h>
+#include <uqMatrix.h>
+#include <uqDistributedVector.h>
+#include <vector>
+
+/*! \class uqDistributedMatrixClass
+    \brief Class for square matrices of the form D + A * B^T, with rows partitioned across processors.
+    
+    D is a diagonal matrix and A, B are n-by-r matrices, with r (the low rank dimension) small.
+    Each processor stores only the rows of D, A and B that correspond to the components it owns
+    in a uqDistributedVectorClass with the same map, so the storage per processor is
+    O((r+1) n / numProcs) instead of the O(n^2) replicated storage of uqGslMatrixClass. This is
+    the structure of the covariance matrices used with high dimensional parameters (diagonal
+    noise plus a few dominant modes), and all the operations needed by the Gaussian joint pdf and
+    by the Gaussian realizer are available with O(r) or O(r^2) values exchanged among processors:
+    matrix-vector products, solves (Woodbury formula), log-determinants (matrix determinant lemma)
+    and a square root factor L such that L * L^T equals \c this.
+    
+    The factor computed by chol() is not triangular: it is again a diagonal plus low-rank matrix,
+    and zeroUpper()/zeroLower() without the diagonal leave it unchanged.
+*/
+
+class uqDistributedMatrixClass : public uqMatrixClass
+{
+public:
+  //! @name Constructor/Destructor methods.
+  //@{ 
+  //! Default Constructor
+  /*! Should not be used by user.*/
+  uqDistributedMatrixClass();
+
+  //! Constructor: creates the null square matrix; \c numCols must be equal to the global number of rows of \c map.
+  uqDistributedMatrixClass(const uqBaseEnvironmentClass& env,
+                           const uqMapClass&             map,
+                                 unsigned int            numCols);
+
+  //! Constructor: creates a diagonal matrix with all diagonal elements equal to \c diagValue.
+  uqDistributedMatrixClass(const uqBaseEnvironmentClass& env,
+                           const uqMapClass&             map,
+                                 double                  diagValue);
+
+  //! Constructor: creates a diagonal matrix with the elements of \c v as its diagonal.
+  uqDistributedMatrixClass(const uqDistributedVectorClass& v);
+
+  //! Copy constructor.
+  uqDistributedMatrixClass(const uqDistributedMatrixClass& B);
+
+  //! Destructor
+  ~uqDistributedMatrixClass();
+  //@}
+
+  //! @name Set methods.
+  //@{ 
+  //! Copies values from matrix \c rhs to \c this.
+  uqDistributedMatrixClass& operator= (const uqDistributedMatrixClass& rhs);
+
+  //! Stores in \c this the coordinate-wise multiplication of \c this and a.
+  uqDistributedMatrixClass& operator*=(double a);
+
+  //! Stores in \c this the coordinate-wise division of \c this by a.
+  uqDistributedMatrixClass& operator/=(double a);
+
+  //! Stores in \c this the addition of \c this and rhs; low rank terms are concatenated.
+  uqDistributedMatrixClass& operator+=(const uqDistributedMatrixClass& rhs);
+
+  //! Stores in \c this the subtraction of \c this by rhs; low rank terms are concatenated.
+  uqDistributedMatrixClass& operator-=(const uqDistributedMatrixClass& rhs);
+
+  //! Adds the symmetric rank one term a * a^T to \c this.
+  void         addLowRankTerm   (const uqDistributedVectorClass& a);
+
+  //! Adds the rank one term a * b^T to \c this.
+  void         addLowRankTerm   (const uqDistributedVectorClass& a, const uqDistributedVectorClass& b);
+
+  //! Sets all elements of \c this to \c value; only \c value = 0 can be represented.
+  void         cwSet            (double value);
+  //@}
+
+  //! @name Accessor methods.
+  //@{
+  //! Element access method (non-const), restricted to the diagonal of a matrix without low rank terms; \c i is a local row index.
+  double&      operator()       (unsigned int i, unsigned int j);
+
+  //! Element access method (const); \c i is a local row index.
+  /*! Off diagonal elements are only available when \c this is stored in a single processor.*/
+  const double& operator()      (unsigned int i, unsigned int j) const;
+  //@}
+
+  //! @name Attribute methods.
+  //@{ 
+  //! Returns the number of rows owned by the calling processor.
+  unsigned int numRowsLocal     () const;
+
+  //! Returns the global number of rows.
+  unsigned int numRowsGlobal    () const;
+
+  //! Returns the number of columns (equal to the global number of rows).
+  unsigned int numCols          () const;
+
+  //! Returns the number r of rank one terms currently stored.
+  unsigned int lowRankDim       () const;
+
+  //! Stores the diagonal D of \c this in \c diagVec.
+  void         getDiagonal      (uqDistributedVectorClass& diagVec) const;
+  //@}
+
+  //! @name Mathematical methods.
+  //@{ 
+  //! Computes a factor L, stored in \c this, such that L * L^T is the original matrix.
+  /*! Only symmetric positive definite matrices built with addLowRankTerm(a) are supported.
+   * With G = A^T D^{-1} A = W diag(lambda) W^T, the factor is
+   * L = D^{1/2} + A W diag(1/(sqrt(1+lambda)+1)) W^T A^T D^{-1/2}.
+   * Returns a nonzero value, and leaves \c this unchanged, if the factorization fails.*/
+  int          chol             ();
+
+  //! Returns the logarithm of the absolute value of the determinant of \c this.
+  double       lnDeterminant    () const;
+
+  //! Returns x = \c this^{-1} * b.
+  uqDistributedVectorClass invertMultiply(const uqDistributedVectorClass& b) const;
+
+  //! Stores in \c x the result of \c this^{-1} * b.
+  /*! Uses the Woodbury formula: the r-by-r matrix I + B^T D^{-1} A is factored once and cached.*/
+  void         invertMultiply   (const uqDistributedVectorClass& b, uqDistributedVectorClass& x) const;
+
+  //! Stores in \c y the result of \c this * x.
+  void         multiply         (const uqDistributedVectorClass& x, uqDistributedVectorClass& y) const;
+
+  //! Singular value decomposition; not available for distributed matrices.
+  int          svd              (uqDistributedMatrixClass& matU, uqDistributedVectorClass& vecS, uqDistributedMatrixClass& matVt) const;
+
+  //! Accepted without effect if \c this is diagonal or is a factor computed by chol() and \c includeDiagonal is false.
+  void         zeroLower        (bool includeDiagonal = false);
+
+  //! Accepted without effect if \c this is diagonal or is a factor computed by chol() and \c includeDiagonal is false.
+  void         zeroUpper        (bool includeDiagonal = false);
+  //@}
+
+  //! @name I/O methods.
+  //@{ 
+  //! Print method, for the rows owned by the calling processor: diagonal element followed by the rows of A and B.
+  void         print            (std::ostream& os) const;
+  //@}
+
+private:
+  //! Copies matrix \c src to \c this.
+  void         copy             (const uqDistributedMatrixClass& src);
+
+  //! Builds and LU-factors the r-by-r matrix I + B^T D^{-1} A, if not cached yet.
+  void         setCoreMatrix    () const;
+
+  //! Marks the cached core matrix as invalid.
+  void         resetCoreMatrix  ();
+
+  //! Sums \c values component-wise over all processors of the map, in place.
+  void         sumOverProcessors(std::vector<double>& values) const;
+
+  //! Appends the rank one term a * b^T.
+  void         appendLowRankTerm(const uqDistributedVectorClass& a, const uqDistributedVectorClass& b);
+
+  //! Local rows of the diagonal matrix D.
+  std::vector<double>          m_diag;
+
+  //! Local rows of A, stored by columns: column k occupies positions [k*numRowsLocal, (k+1)*numRowsLocal).
+  std::vector<double>          m_lowRankA;
+
+  //! Local rows of B, stored like m_lowRankA.
+  std::vector<double>          m_lowRankB;
+
+  //! Number of rank one terms.
+  unsigned int                 m_lowRankDim;
+
+  //! True if B equals A (all rank one terms added with addLowRankTerm(a)).
+  bool                         m_isSymmetric;
+
+  //! True if \c this was computed by chol().
+  bool                         m_isCholFactor;
+
+  //! LU factors of I + B^T D^{-1} A, stored by rows.
+  mutable std::vector<double>       m_coreLU;
+
+  //! Row permutation of the LU factorization.
+  mutable std::vector<unsigned int> m_corePerm;
+
+  //! Logarithm of the absolute value of the determinant of I + B^T D^{-1} A.
+  mutable double                    m_coreLnDeterminant;
+
+  //! True if m_coreLU is up to date.
+  mutable bool                      m_coreIsValid;
+
+  //! Element returned by the const element access method.
+  mutable double                    m_element;
+};
+
+// Comments in this part of file don't appear in the doxygen docs.
+uqDistributedMatrixClass operator*    (double a,                            const uqDistributedMatrixClass& mat);
+uqDistributedVectorClass operator*    (const uqDistributedMatrixClass& mat, const uqDistributedVectorClass& vec);
+uqDistributedMatrixClass operator+    (const uqDistributedMatrixClass& m1,  const uqDistributedMatrixClass& m2 );
+uqDistributedMatrixClass operator-    (const uqDistributedMatrixClass& m1,  const uqDistributedMatrixClass& m2 );
+std::ostream&            operator<<   (std::ostream& os,                    const uqDistributedMatrixClass& obj);
+
+#endif // __UQ_DISTRIBUTED_MATRIX_H__
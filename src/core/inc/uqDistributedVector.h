@@ -0,0 +1,231 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+// 
+// QUESO - a library to support the Quantification of Uncertainty
+// for Estimation, Simulation and Optimization
+//
+// Copyright (C) 2008,2009,2010,2011,2012,2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor, 
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+// 
+// $Id$
+//
+//--------------------------------------------------------------------------
+
+#ifndef __UQ_DISTRIBUTED_VECTOR_H__
+#define __UQ_DISTRIBUTED_VECTOR_H__
+
+/*! \file uqDistributedVector.h
+    \brief Vector class with storage partitioned across the processors of a map
+*/
+
+#include <uqDefines.h>
+#include <uqVector.h>
+#include <vector>
+
+/*! \class uqDistributedVectorClass
+    \brief Class for vectors whose entries are partitioned across processors.
+    
+    Unlike uqGslVectorClass, which replicates every entry on every processor of its map,
+    this class stores only the map.NumMyElements() entries owned by the calling processor,
+    starting at global index map.MinMyGID(). Element access through operator[] uses local
+    indices. Reductions (scalar products, norms, sums, extrema and component comparisons)
+    are computed over the whole map communicator, so all processors of the map must call
+    them collectively and all of them obtain the same result.
+*/
+
+class uqDistributedVectorClass : public uqVectorClass
+{
+public:
+  //! @name Constructor/Destructor methods.
+  //@{ 
+  //! Default Constructor
+  /*! Should not be used by user.*/
+  uqDistributedVectorClass();
+
+  //! Constructor: creates a vector of zeros, partitioned according to \c map.
+  uqDistributedVectorClass(const uqBaseEnvironmentClass& env, const uqMapClass& map);
+
+  //! Constructor: creates a vector partitioned according to \c map, with all components set to \c value.
+  uqDistributedVectorClass(const uqBaseEnvironmentClass& env, const uqMapClass& map, double value);
+
+  //! Copy constructor.
+  uqDistributedVectorClass(const uqDistributedVectorClass& y);
+
+  //! Destructor
+  ~uqDistributedVectorClass();
+  //@}
+
+  //! @name Set methods.
+  //@{ 
+  //! Copies values from vector rhs to \c this. 
+  uqDistributedVectorClass& operator= (const uqDistributedVectorClass& rhs);
+
+  //! Stores in \c this the coordinate-wise multiplication of \c this and a.
+  uqDistributedVectorClass& operator*=(double a);
+
+  //! Stores in \c this the coordinate-wise division of \c this by a.
+  uqDistributedVectorClass& operator/=(double a);
+
+  //! Stores in \c this the coordinate-wise multiplication of \c this with rhs.
+  uqDistributedVectorClass& operator*=(const uqDistributedVectorClass& rhs);
+
+  //! Stores in \c this the coordinate-wise division of \c this by rhs.
+  uqDistributedVectorClass& operator/=(const uqDistributedVectorClass& rhs);
+
+  //! Stores in \c this the coordinate-wise addition of \c this and rhs.
+  uqDistributedVectorClass& operator+=(const uqDistributedVectorClass& rhs);
+
+  //! Stores in \c this the coordinate-wise subtraction of \c this by rhs.
+  uqDistributedVectorClass& operator-=(const uqDistributedVectorClass& rhs);
+
+  //! Stores in \c this the result of \c this + a * x, without temporaries.
+  void                      axpy      (double a, const uqDistributedVectorClass& x);
+  //@}
+
+  //! @name Accessor methods.
+  //@{
+  //! Element access method (non-const), with local index \c i.
+            double& operator[](unsigned int i);
+
+  //! Element access method (const), with local index \c i.
+      const double& operator[](unsigned int i) const;
+  //@}
+
+  //! @name Attribute methods.
+  //@{ 
+  //! Returns the number of components owned by the calling processor.
+  unsigned int sizeLocal        () const;
+
+  //! Returns the global length of this vector.
+  unsigned int sizeGlobal       () const;
+
+  //! Returns the global index of the first component owned by the calling processor.
+  unsigned int globalIdOfFirstComponent() const;
+  //@}
+
+  //! @name Mathematical methods.
+  //@{ 
+  //! Returns the square of the 2-norm of the vector.
+  double       norm2Sq          () const;
+
+  //! Returns the 2-norm (Euclidean norm) of the vector.
+  double       norm2            () const;
+
+  //! Returns the 1-norm of the vector.
+  double       norm1            () const;
+
+  //! Returns the infinity-norm (maximum norm) of the vector.
+  double       normInf          () const;
+
+  //! Returns the sum of the components of the vector.
+  double       sumOfComponents  () const;
+  //@}
+
+  //! @name Set methods.
+  //@{ 
+  //! Component-wise sets all values to \c this with value.
+  void         cwSet            (double value);
+
+  //! Sets component-wise Gaussian random variates, with mean \c mean and standard deviation \c stdDev.
+  /*! Every processor draws all sizeGlobal() variates and keeps its own components, so that
+   * the random number generators of the processors of a subenvironment stay synchronized.
+   * The same holds for the other cwSet methods with random variates.*/
+  void         cwSetGaussian    (double mean, double stdDev);
+
+  //! Sets component-wise Gaussian random variates, with vectors for mean and standard deviation.
+  void         cwSetGaussian    (const uqDistributedVectorClass& meanVec, const uqDistributedVectorClass& stdDevVec);
+
+  //! Sets component-wise a number uniformly distributed in the range of elements of [aVec,bVec].
+  void         cwSetUniform     (const uqDistributedVectorClass& aVec, const uqDistributedVectorClass& bVec);
+
+  //! Inverts component-wise the element values of \c this.  
+  void         cwInvert         ();
+
+  //! Sets component-wise the square-root of \c this.  
+  void         cwSqrt           ();
+
+  //! Sets component-wise \c this to a*x + b*y in a single pass over the local components; \c x or \c y may be \c this.
+  void         cwSetLinearCombination(double a, const uqDistributedVectorClass& x, double b, const uqDistributedVectorClass& y);
+  //@}
+
+  //! @name I/O methods.
+  //@{ 
+  //! Print method, for the components owned by the calling processor.
+  void         print            (std::ostream& os) const;
+  //@}
+
+  //! Sorts the elements of the vector \c this in ascending numerical order. 
+  /*! Only available when the vector is stored in a single processor.*/
+  void         sort             ();
+
+  //! @name Comparison methods.
+  //@{ 
+  //! Returns true if at least one component of \c this is smaller than the respective component of rhs.
+  bool         atLeastOneComponentSmallerThan       (const uqDistributedVectorClass& rhs) const;
+
+  //! Returns true if at least one component of \c this is bigger than the respective component of rhs. 
+  bool         atLeastOneComponentBiggerThan        (const uqDistributedVectorClass& rhs) const;
+
+  //! Returns true if at least one component of \c this is smaller than or equal to the respective component of rhs.
+  bool         atLeastOneComponentSmallerOrEqualThan(const uqDistributedVectorClass& rhs) const;
+
+  //! Returns true if at least one component of \c this is bigger than or equal to the respective component of rhs. 
+  bool         atLeastOneComponentBiggerOrEqualThan (const uqDistributedVectorClass& rhs) const;
+  //@}
+
+  //! @name Attribute methods.
+  //@{ 
+  //! Returns the maximum value in the vector \c this.
+  double       getMaxValue      () const;
+
+  //! Returns minimum value in the vector \c this.
+  double       getMinValue      () const;
+  //@}
+
+  //! @name Reduction methods.
+  //@{ 
+  //! Returns the sum of \c localValue over all processors of the map.
+  double       sumOverProcessors(double localValue) const;
+
+  //! Sums \c values component-wise over all processors of the map, in place.
+  void         sumOverProcessors(std::vector<double>& values) const;
+  //@}
+
+private:
+  //! Copies the elements of the vector src into \c this.
+  void         copy             (const uqDistributedVectorClass& src);
+
+  //! Returns true in all processors if \c localFlag is true in at least one of them.
+  bool         anyOverProcessors(bool localFlag) const;
+
+  //! Components owned by the calling processor.
+  std::vector<double> m_values;
+};
+
+// Comments in this part of file don't appear in the doxygen docs.
+uqDistributedVectorClass operator/    (      double a,                      const uqDistributedVectorClass& x  );
+uqDistributedVectorClass operator/    (const uqDistributedVectorClass& x,   const uqDistributedVectorClass& y  );
+uqDistributedVectorClass operator*    (      double a,                      const uqDistributedVectorClass& x  );
+uqDistributedVectorClass operator*    (const uqDistributedVectorClass& x,   const uqDistributedVectorClass& y  );
+double                   scalarProduct(const uqDistributedVectorClass& x,   const uqDistributedVectorClass& y  );
+uqDistributedVectorClass operator+    (const uqDistributedVectorClass& x,   const uqDistributedVectorClass& y  );
+uqDistributedVectorClass operator-    (const uqDistributedVectorClass& x,   const uqDistributedVectorClass& y  );
+bool                     operator==   (const uqDistributedVectorClass& lhs, const uqDistributedVectorClass& rhs);
+std::ostream&            operator<<   (std::ostream& os,                    const uqDistributedVectorClass& obj);
+
+#endif // __UQ_DISTRIBUTED_VECTOR_H__
@@ -42,9 +42,11 @@ class uqEnvironmentOptionsClass;
 namespace po = boost::program_options;
 #include <iostream>
 #include <fstream>
+#include <map>
 
 #include <uqRngBase.h>
 #include <uqBasicPdfsBase.h>
+#include <uqTracer.h>
 
 
 /*! \struct uqFilePtrSetStruct
@@ -267,7 +269,9 @@ public:
   
   //! This method scans the input file provided by the user to QUESO.
   /*! It checks if no input file is passed and updates the private attribute m_allOptionsDesc, which
-   * keeps all the options.*/
+   * keeps all the options. The input file itself is not reopened: its contents are read once by
+   * the full rank 0, broadcast to all other ranks and cached in memory (see readOptionsInputFile()),
+   * so only the cached entries named in 'optionsDesc' are stored into m_allOptionsMap.*/
   void    scanInputFileForMyOptions(const po::options_description& optionsDesc) const;
   
   //! Access function to private attribute m_displayVerbosity. It manages how much information will be
@@ -280,6 +284,9 @@ public:
   //! Access function to private attribute m_checkingLevel.
   unsigned int    checkingLevel    () const;
   
+  //! Access to the tracer of this process (see options 'env_traceFileName' and 'env_traceMaxEvents').
+  uqTracerClass&        tracer     () const;
+
   //! Access to the RNG object.
   const uqRngBaseClass* rngObject  () const;
   
@@ -355,6 +362,8 @@ protected:
   mutable bool       	     m_optionsInputFileAccessState; // Yes, 'mutable'
   po::options_description*   m_allOptionsDesc;
   po::variables_map* 	     m_allOptionsMap;
+  std::vector<po::option>    m_inputFileOptions;   // all 'name = value' entries of the input file, read only once
+  std::map<std::string,std::vector<unsigned int> > m_inputFileOptionIds; // option name -> positions in m_inputFileOptions
 
   unsigned int               m_subId;
   std::string 		     m_subIdString;
@@ -373,6 +382,7 @@ protected:
   mutable std::ofstream*     m_subDisplayFile;
   uqRngBaseClass*    	     m_rngObject;
   uqBasicPdfsBaseClass*      m_basicPdfs;
+  uqTracerClass*             m_tracer;
   struct timeval             m_timevalBegin;
   mutable bool       	     m_exceptionalCircumstance;
 
@@ -431,6 +441,8 @@ public:
 
 private:
   //! Checks the options input file and reads the options.
+  /*! Only the full rank 0 opens the file. Its contents are broadcast to all ranks of the full
+   *  communicator as a single buffer, parsed once and cached in m_inputFileOptions. */
 void	readOptionsInputFile();
 };
 
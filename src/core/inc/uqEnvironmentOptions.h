@@ -49,6 +49,8 @@
 #define UQ_ENV_PLATFORM_NAME_ODV            ""
 #define UQ_ENV_NUM_DEBUG_PARAMS_ODV         0
 #define UQ_ENV_DEBUG_PARAM_ODV              0.
+#define UQ_ENV_TRACE_FILE_NAME_ODV          UQ_ENV_FILENAME_FOR_NO_OUTPUT_FILE
+#define UQ_ENV_TRACE_MAX_EVENTS_ODV         1000000
 
 
 /*! \file uqEnvironmentOptions.h
@@ -148,6 +150,12 @@ private:
   
   //! Identifying string.
   std::string              m_option_identifyingString;
+
+  //! Prefix of the per rank trace files.
+  std::string              m_option_traceFileName;
+
+  //! Maximum number of events buffered by the tracer of each rank.
+  std::string              m_option_traceMaxEvents;
 };
 
 //! Print values of the options chosen.
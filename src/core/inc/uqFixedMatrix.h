@@ -0,0 +1,2302 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+// 
+// QUESO - a library to support the Quantification of Uncertainty
+// for Estimation, Simulation and Optimization
+//
+// Copyright (C) 2008,2009,2010,2011,2012,2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor, 
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+// 
+// $Id$
+//
+//--------------------------------------------------------------------------
+
+#ifndef __UQ_FIXED_MATRIX_H__
+#define __UQ_FIXED_MATRIX_H__
+
+/*! \file uqFixedMatrix.h
+    \brief Matrix class with a compile time number of rows and in-object storage
+*/
+
+#include <uqDefines.h>
+#include <uqMatrix.h>
+#include <uqFixedVector.h>
+#include <vector>
+#include <cmath>
+#include <cfloat>
+#include <cstdlib>
+
+/*! \class uqFixedMatrixClass
+    \brief Class for matrices whose number of rows N is known at compile time.
+    
+    This class is the matrix companion of uqFixedVectorClass<N>, and provides the same
+    interface as uqGslMatrixClass. Entries are stored inside the object, element access
+    through operator() is not bounds checked, and the factorizations are computed by
+    small dense kernels written for the compile time dimension:
+    - the LU factorization with partial pivoting (used by invertMultiply(), inverse(),
+      determinant() and lnDeterminant()) is kept inside the object and reused until the
+      matrix changes;
+    - chol() follows uqGslMatrixClass, storing L in the lower triangle and L^T in the
+      upper one;
+    - svd() uses one-sided Jacobi rotations, like uqGslMatrixClass;
+    - eigen() uses cyclic Jacobi rotations and returns eigenvalues in ascending order.
+    
+    The number of columns is chosen at run time, but may not exceed N. Factorizations,
+    products with vectors and the other operations that involve uqFixedVectorClass<N>
+    require a square matrix.
+*/
+
+template <unsigned int N>
+class uqFixedMatrixClass : public uqMatrixClass
+{
+public:
+  //! @name Constructor/Destructor methods
+  //@{ 
+  //! Default Constructor
+  /*! Should not be used by user.*/
+  uqFixedMatrixClass();
+
+  //! Shaped Constructor: creates a N x numCols matrix of zeros; \c map must have N global elements.
+  uqFixedMatrixClass(const uqBaseEnvironmentClass& env,
+                     const uqMapClass&             map,
+                     unsigned int                  numCols);
+
+  //! Shaped Constructor: creates a square matrix with \c diagValue on the diagonal (MATLAB eye).
+  uqFixedMatrixClass(const uqBaseEnvironmentClass& env,
+                     const uqMapClass&             map,
+                     double                        diagValue);
+
+  //! Shaped Constructor: creates a square matrix with the environment and map of \c v, and \c diagValue on the diagonal.
+  uqFixedMatrixClass(const uqFixedVectorClass<N>& v,
+                     double                       diagValue);
+
+  //! Shaped Constructor: creates a square diagonal matrix with the values of \c v (MATLAB diag).
+  uqFixedMatrixClass(const uqFixedVectorClass<N>& v);
+
+  //! Copy constructor.
+  uqFixedMatrixClass(const uqFixedMatrixClass<N>& B);
+
+  //! Destructor
+  ~uqFixedMatrixClass();
+  //@}
+
+  //! @name Set methods
+  //@{ 
+  //! Copies values from matrix \c rhs to \c this. 
+  uqFixedMatrixClass<N>& operator= (const uqFixedMatrixClass<N>& rhs);
+
+  //! Stores in \c this the coordinate-wise multiplication of \c this and \c a.
+  uqFixedMatrixClass<N>& operator*=(double a);
+
+  //! Stores in \c this the coordinate-wise division of \c this by \c a.
+  uqFixedMatrixClass<N>& operator/=(double a);
+
+  //! Stores in \c this the coordinate-wise addition of \c this and \c rhs.
+  uqFixedMatrixClass<N>& operator+=(const uqFixedMatrixClass<N>& rhs);
+
+  //! Stores in \c this the coordinate-wise subtraction of \c this by \c rhs.
+  uqFixedMatrixClass<N>& operator-=(const uqFixedMatrixClass<N>& rhs);
+  //@}
+
+  //! @name Accessor methods
+  //@{
+  //! Element access method (non-const), without bounds checking; invalidates the cached factorizations.
+  double& operator()(unsigned int i, unsigned int j) { this->resetLU(); return m_mat[i][j]; }
+
+  //! Element access method (const), without bounds checking.
+  const double& operator()(unsigned int i, unsigned int j) const { return m_mat[i][j]; }
+  //@}
+
+  //! @name Attribute methods
+  //@{ 
+  //! Returns N.
+  unsigned int      numRowsLocal              () const { return N; }
+
+  //! Returns N.
+  unsigned int      numRowsGlobal             () const { return N; }
+
+  //! Returns the column dimension of the matrix.
+  unsigned int      numCols                   () const { return m_numCols; }
+
+  //! Returns the maximum element value of the matrix.
+  double            max                       () const;
+
+  //! This function returns the number of singular values of \c this matrix (rank).
+  unsigned int      rank                      (double absoluteZeroThreshold, double relativeZeroThreshold) const;
+
+  //! This function calculates the transpose of \c this matrix (square matrices only).
+  uqFixedMatrixClass<N> transpose             () const;
+
+  //! This function calculates the inverse of \c this matrix (square matrices only).
+  uqFixedMatrixClass<N> inverse               () const;
+
+  //! Calculates the determinant of \c this matrix.
+  double            determinant               () const;
+
+  //! Calculates the ln(determinant) of \c this matrix.
+  double            lnDeterminant             () const;
+  //@}
+
+  //! @name Norm methods
+  //@{ 
+  //! Returns the Frobenius norm of \c this matrix.
+  double            normFrob                  () const;
+
+  //! Returns the Frobenius norm of \c this matrix.
+  double            normMax                   () const;
+  //@}
+
+  //! @name Mathematical methods
+  //@{ 
+  //! Computes Cholesky factorization of a real symmetric positive definite matrix \c this.
+  /*! In case \c this fails to be symmetric and positive definite, an error will be returned. */
+  int               chol                      ();
+
+  //! Checks for the dimension of \c this matrix, \c matU, \c VecS and \c matVt, and calls the protected routine \c internalSvd to compute the singular values of \c this.
+  int               svd                       (uqFixedMatrixClass<N>& matU, uqFixedVectorClass<N>& vecS, uqFixedMatrixClass<N>& matVt) const;
+
+  //! This function calls private member  uqFixedMatrixClass<N>::internalSvd() to set a M-by-N orthogonal matrix U of the singular value decomposition (svd) of a general rectangular M-by-N matrix A. 
+  const uqFixedMatrixClass<N>& svdMatU        () const;
+
+  //! This function calls private member  uqFixedMatrixClass<N>::internalSvd() to set a N-by-N orthogonal square matrix V of the singular value decomposition (svd) of a general rectangular M-by-N matrix A. 
+  const uqFixedMatrixClass<N>& svdMatV        () const;
+
+  //! This function solves the system A x = b using the singular value decomposition (U, S, V) of A which must have been computed previously with uqFixedMatrixClass<N>::svd (x=solVec, b=rhsVec). 
+  int               svdSolve                  (const uqFixedVectorClass<N>& rhsVec, uqFixedVectorClass<N>& solVec) const;
+
+  //! This function solves the system A x = b using the singular value decomposition (U, S, V) of A which must have been computed previously with uqFixedMatrixClass<N>::svd (x=solMat, b=rhsMat). 
+  int               svdSolve                  (const uqFixedMatrixClass<N>& rhsMat, uqFixedMatrixClass<N>& solMat) const;
+
+  //! This function multiplies \c this matrix by vector \c x and returns the resulting vector.
+  uqFixedVectorClass<N> multiply              (const uqFixedVectorClass<N>& x) const;
+
+  //! This function multiplies \c this matrix by vector \c x and stores the resulting vector in \c y.
+  void              multiply                  (const uqFixedVectorClass<N>& x, uqFixedVectorClass<N>& y) const;
+
+  //! This function sets \c this matrix to scale * \c this + alpha * x y^T, without temporary matrices.
+  void              rankOneUpdate             (double scale, double alpha, const uqFixedVectorClass<N>& x, const uqFixedVectorClass<N>& y);
+
+  //! This function calculates the inverse of \c this matrix and multiplies it with vector \c b.
+  uqFixedVectorClass<N> invertMultiply        (const uqFixedVectorClass<N>& b) const;
+
+  //! This function calculates the inverse of \c this matrix, multiplies it with vector \c b and stores the result in vector \c x.
+  /*! The LU factorization is computed on the first call and reused until \c this changes. */
+  void              invertMultiply            (const uqFixedVectorClass<N>& b, uqFixedVectorClass<N>& x) const;
+
+  //! This function calculates the inverse of \c this matrix and multiplies it with matrix \c B.
+  uqFixedMatrixClass<N> invertMultiply        (const uqFixedMatrixClass<N>& B) const;
+
+  //! This function calculates the inverse of \c this matrix, multiplies it with matrix \c B and stores the result in matrix \c X.
+  void              invertMultiply            (const uqFixedMatrixClass<N>& B, uqFixedMatrixClass<N>& X) const;
+
+  //! This function calculates the inverse of \c this matrix and multiplies it with vector \c b, recomputing the LU factorization.
+  uqFixedVectorClass<N> invertMultiplyForceLU (const uqFixedVectorClass<N>& b) const;
+
+  //! This function calculates the inverse of \c this matrix and multiplies it with vector \c b, recomputing the LU factorization.
+  void              invertMultiplyForceLU     (const uqFixedVectorClass<N>& b, uqFixedVectorClass<N>& x) const;
+
+  //! This function gets the column_num-th column of \c this matrix and stores it into vector \c column.
+  void              getColumn                 (const unsigned int column_num, uqFixedVectorClass<N>& column) const;
+
+  //! This function gets the column_num-th column of \c this matrix.
+  uqFixedVectorClass<N> getColumn             (const unsigned int column_num) const;
+
+  //! This function copies vector \c column into the column_num-th column of \c this matrix.
+  void              setColumn                 (const unsigned int column_num, const uqFixedVectorClass<N>& column);
+
+  //! This function gets the row_num-th row of \c this matrix and stores it into vector \c row.
+  void              getRow                    (const unsigned int row_num, uqFixedVectorClass<N>& row) const;
+
+  //! This function gets the row_num-th row of \c this matrix.
+  uqFixedVectorClass<N> getRow                (const unsigned int row_num) const;
+
+  //! This function copies vector \c row into the row_num-th row of \c this matrix.
+  void              setRow                    (const unsigned int row_num, const uqFixedVectorClass<N>& row);
+
+  //! This function computes the eigenvalues of a real symmetric matrix, in ascending order, and optionally the respective eigenvectors.
+  void              eigen                     (uqFixedVectorClass<N>& eigenValues, uqFixedMatrixClass<N>* eigenVectors) const;
+
+  //! This function finds largest eigenvalue, namely \c eigenValue, of \c this matrix and its corresponding eigenvector, namely \c eigenVector.
+  void              largestEigen              (double& eigenValue, uqFixedVectorClass<N>& eigenVector) const;
+
+  //! This function finds smallest eigenvalue, namely \c eigenValue, of \c this matrix and its corresponding eigenvector, namely \c eigenVector.
+  void              smallestEigen             (double& eigenValue, uqFixedVectorClass<N>& eigenVector) const;
+  //@}
+
+  //! @name Get/Set methods
+  //@{ 
+  //! Component-wise set all values to \c this with value.
+  void              cwSet                     (double value);
+
+  //! Set the components of \c which positions are greater than (rowId,colId) with the value of mat(rowId,colId).
+  void              cwSet                     (unsigned int rowId, unsigned int colId, const uqFixedMatrixClass<N>& mat);
+
+  //! Extracts into \c mat the block of \c this starting at (rowId,colId).
+  void              cwExtract                 (unsigned int rowId, unsigned int colId, uqFixedMatrixClass<N>& mat) const;
+
+  //! This function sets all the entries bellow the main diagonal of \c this matrix to zero.
+  /*! If \c includeDiagonal = false, then only the entries bellow the main diagonal are set to zero;
+  if \c includeDiagonal = true, then the elements of the matrix diagonal are also set to zero.*/
+  void              zeroLower                 (bool includeDiagonal = false);
+
+  //! This function sets all the entries above the main diagonal of \c this matrix to zero.
+  /*! If \c includeDiagonal = false, then only the entries above the main diagonal are set to zero;
+  if \c includeDiagonal = true, then the elements of the matrix diagonal are also set to zero.*/
+  void              zeroUpper                 (bool includeDiagonal = false);
+
+  //! This function sets to zero (filters) all entries of \c this matrix which are smaller than \c thresholdValue.
+  void              filterSmallValues         (double thresholdValue);
+
+  //! This function sets to zero (filters) all entries of \c this matrix which are greater than \c thresholdValue.
+  void              filterLargeValues         (double thresholdValue);
+
+  //! This function stores the transpose of \c this matrix into \c this matrix.
+  void              fillWithTranspose         (unsigned int                 rowId,
+                                               unsigned int                 colId,
+                                               const uqFixedMatrixClass<N>& mat,
+                                               bool                         checkForExactNumRowsMatching,
+                                               bool                         checkForExactNumColsMatching);
+
+  //! This function fills \c this matrix diagonally with const block  matrices.
+  void              fillWithBlocksDiagonally  (unsigned int                                      rowId,
+                                               unsigned int                                      colId,
+                                               const std::vector<const uqFixedMatrixClass<N>* >& matrices,
+                                               bool                                              checkForExactNumRowsMatching,
+                                               bool                                              checkForExactNumColsMatching);
+
+  //! This function fills \c this matrix diagonally with block matrices.
+  void              fillWithBlocksDiagonally  (unsigned int                                      rowId,
+                                               unsigned int                                      colId,
+                                               const std::vector<      uqFixedMatrixClass<N>* >& matrices,
+                                               bool                                              checkForExactNumRowsMatching,
+                                               bool                                              checkForExactNumColsMatching);
+
+  //! This function fills \c this matrix horizontally with const block matrices.
+  void              fillWithBlocksHorizontally(unsigned int                                      rowId,
+                                               unsigned int                                      colId,
+                                               const std::vector<const uqFixedMatrixClass<N>* >& matrices,
+                                               bool                                              checkForExactNumRowsMatching,
+                                               bool                                              checkForExactNumColsMatching);
+
+  //! This function fills \c this matrix horizontally with block matrices.
+  void              fillWithBlocksHorizontally(unsigned int                                      rowId,
+                                               unsigned int                                      colId,
+                                               const std::vector<      uqFixedMatrixClass<N>* >& matrices,
+                                               bool                                              checkForExactNumRowsMatching,
+                                               bool                                              checkForExactNumColsMatching);
+
+  //! This function fills \c this matrix vertically with const block matrices.
+  void              fillWithBlocksVertically  (unsigned int                                      rowId,
+                                               unsigned int                                      colId,
+                                               const std::vector<const uqFixedMatrixClass<N>* >& matrices,
+                                               bool                                              checkForExactNumRowsMatching,
+                                               bool                                              checkForExactNumColsMatching);
+
+  //! This function fills \c this matrix vertically with block matrices.
+  void              fillWithBlocksVertically  (unsigned int                                      rowId,
+                                               unsigned int                                      colId,
+                                               const std::vector<      uqFixedMatrixClass<N>* >& matrices,
+                                               bool                                              checkForExactNumRowsMatching,
+                                               bool                                              checkForExactNumColsMatching);
+
+  //! This function calculates the tensor product of matrices \c mat1 and \c mat2 and stores it in \c this matrix.
+  void              fillWithTensorProduct     (unsigned int                 rowId,
+                                               unsigned int                 colId,
+                                               const uqFixedMatrixClass<N>& mat1,
+                                               const uqFixedMatrixClass<N>& mat2,
+                                               bool                         checkForExactNumRowsMatching,
+                                               bool                         checkForExactNumColsMatching);
+
+  //! This function calculates the tensor product of matrix \c mat1 and  vector \c vec2 and stores it in \c this matrix.
+  void              fillWithTensorProduct     (unsigned int                 rowId,
+                                               unsigned int                 colId,
+                                               const uqFixedMatrixClass<N>& mat1,
+                                               const uqFixedVectorClass<N>& vec2,
+                                               bool                         checkForExactNumRowsMatching,
+                                               bool                         checkForExactNumColsMatching);
+  //@}
+
+  //! @name Miscellaneous methods
+  //@{ 
+  //! Sums \c this matrix over the processors of \c comm, storing the result in \c M_global.
+  void              mpiSum                    (const uqMpiCommClass& comm, uqFixedMatrixClass<N>& M_global) const;
+
+  //! Reproduces MATLAB linear inter/extra-polation, column by column.
+  void              matlabLinearInterpExtrap  (const uqFixedVectorClass<N>& x1Vec, const uqFixedMatrixClass<N>& y1Mat, const uqFixedVectorClass<N>& x2Vec);
+  //@}
+
+  //! @name I/O methods
+  //@{ 
+  //! Print method. Defines the behavior of the ostream << operator inherited from the Object class.
+  void              print                     (std::ostream& os) const;
+
+  //! Writes the matrix to \c fileName, in the same format as uqGslMatrixClass.
+  void              subWriteContents          (const std::string&            varNamePrefix,
+                                               const std::string&            fileName,
+                                               const std::string&            fileType,
+                                               const std::set<unsigned int>& allowedSubEnvIds) const;
+
+  //! Reads the matrix from \c fileName, in the same format as uqGslMatrixClass.
+  void              subReadContents           (const std::string&            fileName,
+                                               const std::string&            fileType,
+                                               const std::set<unsigned int>& allowedSubEnvIds);
+  //@}
+
+private:
+  //! This function copies the elements of the matrix \c src into \c this.
+  void              copy                      (const uqFixedMatrixClass<N>& src);
+
+  //! Marks the cached factorizations and determinants as out of date.
+  void              resetLU                   ()
+  {
+    m_luIsValid     = false;
+    m_svdIsValid    = false;
+    m_determinant   = -INFINITY;
+    m_lnDeterminant = -INFINITY;
+  }
+
+  //! Checks that \c map has N global elements and that \c nCols does not exceed N.
+  void              checkShape                (const uqMapClass& map, unsigned int nCols, const char* where) const;
+
+  //! Computes, if needed, the LU factorization of \c this with partial pivoting.
+  void              internalLU                () const;
+
+  //! Solves LU x = P b in place, with the factorization computed by internalLU().
+  bool              internalLUSolve           (double* x) const;
+
+  //! This function factorizes the M-by-N matrix A into the singular value decomposition A = U S V^T for M >= N.
+  int               internalSvd               () const;
+
+          double                 m_mat[N][N];
+          unsigned int           m_numCols;
+  mutable double                 m_LU[N][N];
+  mutable unsigned int           m_permutation[N];
+  mutable int                    m_signum;
+  mutable bool                   m_luIsValid;
+  mutable bool                   m_isSingular;
+  mutable double                 m_determinant;
+  mutable double                 m_lnDeterminant;
+  mutable bool                   m_svdIsValid;
+  mutable uqFixedMatrixClass<N>* m_svdUmat;
+  mutable uqFixedVectorClass<N>* m_svdSvec;
+  mutable uqFixedMatrixClass<N>* m_svdVmat;
+  mutable uqFixedMatrixClass<N>* m_svdVTmat;
+};
+
+template <unsigned int N>
+uqFixedMatrixClass<N>::uqFixedMatrixClass()
+  :
+  uqMatrixClass()
+{
+  UQ_FATAL_TEST_MACRO(true,
+                      m_env.worldRank(),
+                      "uqFixedMatrixClass<N>::constructor(), default",
+                      "should not be used by user");
+}
+
+template <unsigned int N>
+uqFixedMatrixClass<N>::uqFixedMatrixClass( // can be a rectangular matrix
+  const uqBaseEnvironmentClass& env,
+  const uqMapClass&             map,
+  unsigned int                  nCols)
+  :
+  uqMatrixClass  (env,map),
+  m_numCols      (nCols),
+  m_signum       (0),
+  m_luIsValid    (false),
+  m_isSingular   (false),
+  m_determinant  (-INFINITY),
+  m_lnDeterminant(-INFINITY),
+  m_svdIsValid   (false),
+  m_svdUmat      (NULL),
+  m_svdSvec      (NULL),
+  m_svdVmat      (NULL),
+  m_svdVTmat     (NULL)
+{
+  this->checkShape(map,nCols,"uqFixedMatrixClass<N>::constructor()");
+  this->cwSet(0.);
+}
+
+template <unsigned int N>
+uqFixedMatrixClass<N>::uqFixedMatrixClass( // square matrix
+  const uqBaseEnvironmentClass& env,
+  const uqMapClass&             map,
+  double                        diagValue)
+  :
+  uqMatrixClass  (env,map),
+  m_numCols      (N),
+  m_signum       (0),
+  m_luIsValid    (false),
+  m_isSingular   (false),
+  m_determinant  (-INFINITY),
+  m_lnDeterminant(-INFINITY),
+  m_svdIsValid   (false),
+  m_svdUmat      (NULL),
+  m_svdSvec      (NULL),
+  m_svdVmat      (NULL),
+  m_svdVTmat     (NULL)
+{
+  this->checkShape(map,N,"uqFixedMatrixClass<N>::constructor(), eye");
+  this->cwSet(0.);
+  for (unsigned int i = 0; i < N; ++i) {
+    m_mat[i][i] = diagValue;
+  }
+}
+
+template <unsigned int N>
+uqFixedMatrixClass<N>::uqFixedMatrixClass( // square matrix
+  const uqFixedVectorClass<N>& v,
+  double                       diagValue)
+  :
+  uqMatrixClass  (v.env(),v.map()),
+  m_numCols      (N),
+  m_signum       (0),
+  m_luIsValid    (false),
+  m_isSingular   (false),
+  m_determinant  (-INFINITY),
+  m_lnDeterminant(-INFINITY),
+  m_svdIsValid   (false),
+  m_svdUmat      (NULL),
+  m_svdSvec      (NULL),
+  m_svdVmat      (NULL),
+  m_svdVTmat     (NULL)
+{
+  this->cwSet(0.);
+  for (unsigned int i = 0; i < N; ++i) {
+    m_mat[i][i] = diagValue;
+  }
+}
+
+template <unsigned int N>
+uqFixedMatrixClass<N>::uqFixedMatrixClass(const uqFixedVectorClass<N>& v) // square matrix
+  :
+  uqMatrixClass  (v.env(),v.map()),
+  m_numCols      (N),
+  m_signum       (0),
+  m_luIsValid    (false),
+  m_isSingular   (false),
+  m_determinant  (-INFINITY),
+  m_lnDeterminant(-INFINITY),
+  m_svdIsValid   (false),
+  m_svdUmat      (NULL),
+  m_svdSvec      (NULL),
+  m_svdVmat      (NULL),
+  m_svdVTmat     (NULL)
+{
+  this->cwSet(0.);
+  for (unsigned int i = 0; i < N; ++i) {
+    m_mat[i][i] = v[i];
+  }
+}
+
+template <unsigned int N>
+uqFixedMatrixClass<N>::uqFixedMatrixClass(const uqFixedMatrixClass<N>& B) // can be a rectangular matrix
+  :
+  uqMatrixClass  (B.env(),B.map()),
+  m_numCols      (B.m_numCols),
+  m_signum       (0),
+  m_luIsValid    (false),
+  m_isSingular   (false),
+  m_determinant  (-INFINITY),
+  m_lnDeterminant(-INFINITY),
+  m_svdIsValid   (false),
+  m_svdUmat      (NULL),
+  m_svdSvec      (NULL),
+  m_svdVmat      (NULL),
+  m_svdVTmat     (NULL)
+{
+  this->uqMatrixClass::copy(B);
+  this->copy(B);
+}
+
+template <unsigned int N>
+uqFixedMatrixClass<N>::~uqFixedMatrixClass()
+{
+  delete m_svdUmat;
+  delete m_svdSvec;
+  delete m_svdVmat;
+  delete m_svdVTmat;
+}
+
+template <unsigned int N>
+void
+uqFixedMatrixClass<N>::checkShape(const uqMapClass& map, unsigned int nCols, const char* where) const
+{
+  UQ_FATAL_TEST_MACRO((unsigned int) map.NumGlobalElements() != N,
+                      m_env.worldRank(),
+                      where,
+                      "map size differs from the compile time number of rows");
+  UQ_FATAL_TEST_MACRO(nCols > N,
+                      m_env.worldRank(),
+                      where,
+                      "number of columns exceeds the compile time number of rows");
+  return;
+}
+
+template <unsigned int N>
+void
+uqFixedMatrixClass<N>::copy(const uqFixedMatrixClass<N>& src)
+{
+  this->resetLU();
+  m_numCols = src.m_numCols;
+  for (unsigned int i = 0; i < N; ++i) {
+    for (unsigned int j = 0; j < N; ++j) {
+      m_mat[i][j] = src.m_mat[i][j];
+    }
+  }
+  return;
+}
+
+template <unsigned int N>
+uqFixedMatrixClass<N>&
+uqFixedMatrixClass<N>::operator=(const uqFixedMatrixClass<N>& obj)
+{
+  if (this != &obj) this->copy(obj);
+  return *this;
+}
+
+template <unsigned int N>
+uqFixedMatrixClass<N>&
+uqFixedMatrixClass<N>::operator*=(double a)
+{
+  this->resetLU();
+  for (unsigned int i = 0; i < N; ++i) {
+    for (unsigned int j = 0; j < m_numCols; ++j) {
+      m_mat[i][j] *= a;
+    }
+  }
+  return *this;
+}
+
+template <unsigned int N>
+uqFixedMatrixClass<N>&
+uqFixedMatrixClass<N>::operator/=(double a)
+{
+  this->resetLU();
+  for (unsigned int i = 0; i < N; ++i) {
+    for (unsigned int j = 0; j < m_numCols; ++j) {
+      m_mat[i][j] /= a;
+    }
+  }
+  return *this;
+}
+
+template <unsigned int N>
+uqFixedMatrixClass<N>&
+uqFixedMatrixClass<N>::operator+=(const uqFixedMatrixClass<N>& rhs)
+{
+  UQ_FATAL_TEST_MACRO(m_numCols != rhs.m_numCols,
+                      m_env.worldRank(),
+                      "uqFixedMatrixClass<N>::operator+=()",
+                      "different numbers of columns");
+  this->resetLU();
+  for (unsigned int i = 0; i < N; ++i) {
+    for (unsigned int j = 0; j < m_numCols; ++j) {
+      m_mat[i][j] += rhs.m_mat[i][j];
+    }
+  }
+  return *this;
+}
+
+template <unsigned int N>
+uqFixedMatrixClass<N>&
+uqFixedMatrixClass<N>::operator-=(const uqFixedMatrixClass<N>& rhs)
+{
+  UQ_FATAL_TEST_MACRO(m_numCols != rhs.m_numCols,
+                      m_env.worldRank(),
+                      "uqFixedMatrixClass<N>::operator-=()",
+                      "different numbers of columns");
+  this->resetLU();
+  for (unsigned int i = 0; i < N; ++i) {
+    for (unsigned int j = 0; j < m_numCols; ++j) {
+      m_mat[i][j] -= rhs.m_mat[i][j];
+    }
+  }
+  return *this;
+}
+
+template <unsigned int N>
+double
+uqFixedMatrixClass<N>::normFrob() const
+{
+  double value = 0.;
+  for (unsigned int i = 0; i < N; ++i) {
+    for (unsigned int j = 0; j < m_numCols; ++j) {
+      value += m_mat[i][j]*m_mat[i][j];
+    }
+  }
+  return std::sqrt(value);
+}
+
+template <unsigned int N>
+double
+uqFixedMatrixClass<N>::normMax() const
+{
+  double value = 0.;
+  for (unsigned int i = 0; i < N; ++i) {
+    for (unsigned int j = 0; j < m_numCols; ++j) {
+      double aux = std::fabs(m_mat[i][j]);
+      if (aux > value) value = aux;
+    }
+  }
+  return value;
+}
+
+template <unsigned int N>
+double
+uqFixedMatrixClass<N>::max() const
+{
+  double value = -INFINITY;
+  for (unsigned int i = 0; i < N; ++i) {
+    for (unsigned int j = 0; j < m_numCols; ++j) {
+      if (m_mat[i][j] > value) value = m_mat[i][j];
+    }
+  }
+  return value;
+}
+
+template <unsigned int N>
+void
+uqFixedMatrixClass<N>::cwSet(double value)
+{
+  this->resetLU();
+  for (unsigned int i = 0; i < N; ++i) {
+    for (unsigned int j = 0; j < N; ++j) {
+      m_mat[i][j] = value;
+    }
+  }
+  return;
+}
+
+template <unsigned int N>
+void
+uqFixedMatrixClass<N>::cwSet(
+  unsigned int                 initialTargetRowId,
+  unsigned int                 initialTargetColId,
+  const uqFixedMatrixClass<N>& mat)
+{
+  UQ_FATAL_TEST_MACRO(initialTargetRowId != 0,
+                      m_env.worldRank(),
+                      "uqFixedMatrixClass<N>::cwSet()",
+                      "invalid initialTargetRowId");
+  UQ_FATAL_TEST_MACRO((initialTargetColId + mat.numCols()) > m_numCols,
+                      m_env.worldRank(),
+                      "uqFixedMatrixClass<N>::cwSet()",
+                      "invalid mat.numCols()");
+  this->resetLU();
+  for (unsigned int i = 0; i < N; ++i) {
+    for (unsigned int j = 0; j < mat.numCols(); ++j) {
+      m_mat[i][initialTargetColId+j] = mat(i,j);
+    }
+  }
+  return;
+}
+
+template <unsigned int N>
+void
+uqFixedMatrixClass<N>::cwExtract(
+  unsigned int           initialTargetRowId,
+  unsigned int           initialTargetColId,
+  uqFixedMatrixClass<N>& mat) const
+{
+  UQ_FATAL_TEST_MACRO(initialTargetRowId != 0,
+                      m_env.worldRank(),
+                      "uqFixedMatrixClass<N>::cwExtract()",
+                      "invalid initialTargetRowId");
+  UQ_FATAL_TEST_MACRO((initialTargetColId + mat.numCols()) > m_numCols,
+                      m_env.worldRank(),
+                      "uqFixedMatrixClass<N>::cwExtract()",
+                      "invalid mat.numCols()");
+  for (unsigned int i = 0; i < N; ++i) {
+    for (unsigned int j = 0; j < mat.numCols(); ++j) {
+      mat(i,j) = m_mat[i][initialTargetColId+j];
+    }
+  }
+  return;
+}
+
+template <unsigned int N>
+int
+uqFixedMatrixClass<N>::chol()
+{
+  UQ_FATAL_TEST_MACRO(m_numCols != N,
+                      m_env.worldRank(),
+                      "uqFixedMatrixClass<N>::chol()",
+                      "matrix is not square");
+  this->resetLU();
+
+  // Column oriented Cholesky on the lower triangle; the upper one receives L^T at the end
+  int iRC = 0;
+  for (unsigned int j = 0; (j < N) && (iRC == 0); ++j) {
+    double diag = m_mat[j][j];
+    for (unsigned int k = 0; k < j; ++k) {
+      diag -= m_mat[j][k]*m_mat[j][k];
+    }
+    if (!(diag > 0.)) {
+      iRC = UQ_MATRIX_IS_NOT_POS_DEFINITE_RC;
+      break;
+    }
+    diag = std::sqrt(diag);
+    m_mat[j][j] = diag;
+    for (unsigned int i = j+1; i < N; ++i) {
+      double value = m_mat[i][j];
+      for (unsigned int k = 0; k < j; ++k) {
+        value -= m_mat[i][k]*m_mat[j][k];
+      }
+      m_mat[i][j] = value/diag;
+    }
+  }
+  if (iRC == 0) {
+    for (unsigned int i = 0; i < N; ++i) {
+      for (unsigned int j = i+1; j < N; ++j) {
+        m_mat[i][j] = m_mat[j][i];
+      }
+    }
+  }
+
+  UQ_RC_MACRO(iRC, // Yes, *not* a fatal check on RC
+              m_env.worldRank(),
+              "uqFixedMatrixClass<N>::chol()",
+              "matrix is not positive definite",
+              UQ_MATRIX_IS_NOT_POS_DEFINITE_RC);
+
+  return iRC;
+}
+
+template <unsigned int N>
+int
+uqFixedMatrixClass<N>::svd(uqFixedMatrixClass<N>& matU, uqFixedVectorClass<N>& vecS, uqFixedMatrixClass<N>& matVt) const
+{
+  UQ_FATAL_TEST_MACRO((matU.numCols() != m_numCols) || (matVt.numCols() != m_numCols),
+                      m_env.worldRank(),
+                      "uqFixedMatrixClass<N>::svd()",
+                      "invalid matU or matVt");
+
+  int iRC = internalSvd();
+
+  matU  = *m_svdUmat;
+  vecS  = *m_svdSvec;
+  matVt = *m_svdVTmat;
+
+  return iRC;
+}
+
+template <unsigned int N>
+int
+uqFixedMatrixClass<N>::svdSolve(const uqFixedVectorClass<N>& rhsVec, uqFixedVectorClass<N>& solVec) const
+{
+  int iRC = internalSvd();
+  if (iRC == 0) {
+    // x = V S^{-1} U^T b, skipping zero singular values like gsl_linalg_SV_solve()
+    double tmp[N];
+    for (unsigned int j = 0; j < N; ++j) {
+      double value = 0.;
+      double sigma = (*m_svdSvec)[j];
+      if (sigma != 0.) {
+        for (unsigned int i = 0; i < N; ++i) {
+          value += (*m_svdUmat)(i,j)*rhsVec[i];
+        }
+        value /= sigma;
+      }
+      tmp[j] = value;
+    }
+    for (unsigned int i = 0; i < N; ++i) {
+      double value = 0.;
+      for (unsigned int j = 0; j < N; ++j) {
+        value += (*m_svdVmat)(i,j)*tmp[j];
+      }
+      solVec[i] = value;
+    }
+  }
+
+  return iRC;
+}
+
+template <unsigned int N>
+int
+uqFixedMatrixClass<N>::svdSolve(const uqFixedMatrixClass<N>& rhsMat, uqFixedMatrixClass<N>& solMat) const
+{
+  UQ_FATAL_TEST_MACRO((rhsMat.numCols() != solMat.numCols()),
+                      m_env.worldRank(),
+                      "uqFixedMatrixClass<N>::svdSolve()",
+                      "rhsMat and solMat are not compatible");
+
+  uqFixedVectorClass<N> rhsVec(m_env,m_map);
+  uqFixedVectorClass<N> solVec(m_env,m_map);
+  int iRC = 0;
+  for (unsigned int j = 0; j < rhsMat.numCols(); ++j) {
+    rhsMat.getColumn(j,rhsVec);
+    iRC = this->svdSolve(rhsVec, solVec);
+    if (iRC) break;
+    solMat.setColumn(j,solVec);
+  }
+
+  return iRC;
+}
+
+template <unsigned int N>
+const uqFixedMatrixClass<N>&
+uqFixedMatrixClass<N>::svdMatU() const
+{
+  int iRC = 0;
+  iRC = internalSvd();
+  if (iRC) {}; // just to remove compiler warning
+
+  return *m_svdUmat;
+}
+
+template <unsigned int N>
+const uqFixedMatrixClass<N>&
+uqFixedMatrixClass<N>::svdMatV() const
+{
+  int iRC = 0;
+  iRC = internalSvd();
+  if (iRC) {}; // just to remove compiler warning
+
+  return *m_svdVmat;
+}
+
+template <unsigned int N>
+int
+uqFixedMatrixClass<N>::internalSvd() const
+{
+  int iRC = 0;
+
+  if (m_svdIsValid == false) {
+    UQ_FATAL_TEST_MACRO(m_numCols != N,
+                        m_env.worldRank(),
+                        "uqFixedMatrixClass<N>::internalSvd()",
+                        "only square matrices are supported");
+
+    if (m_svdUmat == NULL) {
+      m_svdUmat  = new uqFixedMatrixClass<N>(m_env,m_map,N);
+      m_svdSvec  = new uqFixedVectorClass<N>(m_env,m_map);
+      m_svdVmat  = new uqFixedMatrixClass<N>(m_env,m_map,1.);
+      m_svdVTmat = new uqFixedMatrixClass<N>(m_env,m_map,N);
+    }
+
+    // One-sided Jacobi: rotate pairs of columns of U = A until they are orthogonal,
+    // accumulating the rotations in V; the singular values are the column norms of U
+    double u[N][N];
+    double v[N][N];
+    for (unsigned int i = 0; i < N; ++i) {
+      for (unsigned int j = 0; j < N; ++j) {
+        u[i][j] = m_mat[i][j];
+        v[i][j] = (i == j) ? 1. : 0.;
+      }
+    }
+
+    const double tolerance = 10.*DBL_EPSILON;
+    const unsigned int maxNumSweeps = (5*N > 12) ? 5*N : 12;
+    bool converged = false;
+    for (unsigned int sweep = 0; (sweep < maxNumSweeps) && (converged == false); ++sweep) {
+      converged = true;
+      for (unsigned int j = 0; j + 1 < N; ++j) {
+        for (unsigned int k = j+1; k < N; ++k) {
+          double alpha = 0.;
+          double beta  = 0.;
+          double gamma = 0.;
+          for (unsigned int i = 0; i < N; ++i) {
+            alpha += u[i][j]*u[i][j];
+            beta  += u[i][k]*u[i][k];
+            gamma += u[i][j]*u[i][k];
+          }
+          if (std::fabs(gamma) <= tolerance*std::sqrt(alpha*beta)) continue;
+          converged = false;
+
+          double zeta = (beta - alpha)/(2.*gamma);
+          double t    = ((zeta >= 0.) ? 1. : -1.)/(std::fabs(zeta) + std::sqrt(1. + zeta*zeta));
+          double c    = 1./std::sqrt(1. + t*t);
+          double s    = c*t;
+          for (unsigned int i = 0; i < N; ++i) {
+            double tmp = u[i][j];
+            u[i][j] = c*tmp - s*u[i][k];
+            u[i][k] = s*tmp + c*u[i][k];
+            tmp     = v[i][j];
+            v[i][j] = c*tmp - s*v[i][k];
+            v[i][k] = s*tmp + c*v[i][k];
+          }
+        }
+      }
+    }
+    if (converged == false) iRC = UQ_MATRIX_SVD_FAILED_RC;
+
+    double sigma[N];
+    for (unsigned int j = 0; j < N; ++j) {
+      double value = 0.;
+      for (unsigned int i = 0; i < N; ++i) {
+        value += u[i][j]*u[i][j];
+      }
+      sigma[j] = std::sqrt(value);
+      if (sigma[j] > 0.) {
+        for (unsigned int i = 0; i < N; ++i) {
+          u[i][j] /= sigma[j];
+        }
+      }
+    }
+
+    // Singular values in descending order, as returned by GSL
+    unsigned int order[N];
+    for (unsigned int j = 0; j < N; ++j) {
+      order[j] = j;
+    }
+    for (unsigned int j = 0; j < N; ++j) {
+      unsigned int jMax = j;
+      for (unsigned int k = j+1; k < N; ++k) {
+        if (sigma[order[k]] > sigma[order[jMax]]) jMax = k;
+      }
+      unsigned int tmp = order[j];
+      order[j]    = order[jMax];
+      order[jMax] = tmp;
+    }
+    for (unsigned int j = 0; j < N; ++j) {
+      (*m_svdSvec)[j] = sigma[order[j]];
+      for (unsigned int i = 0; i < N; ++i) {
+        (*m_svdUmat) (i,j) = u[i][order[j]];
+        (*m_svdVmat) (i,j) = v[i][order[j]];
+        (*m_svdVTmat)(j,i) = v[i][order[j]];
+      }
+    }
+    m_svdIsValid = true;
+
+    UQ_RC_MACRO(iRC, // Yes, *not* a fatal check on RC
+                m_env.worldRank(),
+                "uqFixedMatrixClass<N>::internalSvd()",
+                "matrix svd failed",
+                UQ_MATRIX_SVD_FAILED_RC);
+  }
+
+  return iRC;
+}
+
+template <unsigned int N>
+void
+uqFixedMatrixClass<N>::zeroLower(bool includeDiagonal)
+{
+  UQ_FATAL_TEST_MACRO(m_numCols != N,
+                      m_env.worldRank(),
+                      "uqFixedMatrixClass<N>::zeroLower()",
+                      "routine works only for square matrices");
+  this->resetLU();
+
+  for (unsigned int i = 0; i < N; i++) {
+    unsigned int jEnd = includeDiagonal ? i+1 : i;
+    for (unsigned int j = 0; j < jEnd; j++) {
+      m_mat[i][j] = 0.;
+    }
+  }
+
+  return;
+}
+
+template <unsigned int N>
+void
+uqFixedMatrixClass<N>::zeroUpper(bool includeDiagonal)
+{
+  UQ_FATAL_TEST_MACRO(m_numCols != N,
+                      m_env.worldRank(),
+                      "uqFixedMatrixClass<N>::zeroUpper()",
+                      "routine works only for square matrices");
+  this->resetLU();
+
+  for (unsigned int i = 0; i < N; i++) {
+    unsigned int jBegin = includeDiagonal ? i : i+1;
+    for (unsigned int j = jBegin; j < N; j++) {
+      m_mat[i][j] = 0.;
+    }
+  }
+
+  return;
+}
+
+template <unsigned int N>
+void
+uqFixedMatrixClass<N>::filterSmallValues(double thresholdValue)
+{
+  this->resetLU();
+  for (unsigned int i = 0; i < N; ++i) {
+    for (unsigned int j = 0; j < m_numCols; ++j) {
+      double aux = m_mat[i][j];
+      // If 'thresholdValue' is negative, no values will be filtered
+      if (((aux < 0.) && (-thresholdValue < aux)) ||
+          ((aux > 0.) && ( thresholdValue > aux))) {
+        m_mat[i][j] = 0.;
+      }
+    }
+  }
+  return;
+}
+
+template <unsigned int N>
+void
+uqFixedMatrixClass<N>::filterLargeValues(double thresholdValue)
+{
+  this->resetLU();
+  for (unsigned int i = 0; i < N; ++i) {
+    for (unsigned int j = 0; j < m_numCols; ++j) {
+      double aux = m_mat[i][j];
+      // If 'thresholdValue' is negative, all values will be filtered
+      if (((aux < 0.) && (-thresholdValue > aux)) ||
+          ((aux > 0.) && ( thresholdValue < aux))) {
+        m_mat[i][j] = 0.;
+      }
+    }
+  }
+  return;
+}
+
+template <unsigned int N>
+uqFixedMatrixClass<N>
+uqFixedMatrixClass<N>::transpose() const
+{
+  UQ_FATAL_TEST_MACRO(m_numCols != N,
+                      m_env.worldRank(),
+                      "uqFixedMatrixClass<N>::transpose()",
+                      "routine works only for square matrices");
+
+  uqFixedMatrixClass<N> mat(m_env,m_map,N);
+  for (unsigned int row = 0; row < N; ++row) {
+    for (unsigned int col = 0; col < N; ++col) {
+      mat.m_mat[row][col] = m_mat[col][row];
+    }
+  }
+
+  return mat;
+}
+
+template <unsigned int N>
+uqFixedMatrixClass<N>
+uqFixedMatrixClass<N>::inverse() const
+{
+  uqFixedMatrixClass<N> unitMatrix(m_env,m_map,1.);
+  uqFixedMatrixClass<N> mat(m_env,m_map,N);
+  this->invertMultiply(unitMatrix,mat);
+
+  if (m_env.checkingLevel() >= 1) {
+    *m_env.subDisplayFile() << "CHECKING In uqFixedMatrixClass<N>::inverse()"
+                            << ": M.lnDet = "      << this->lnDeterminant()
+                            << ", M^{-1}.lnDet = " << mat.lnDeterminant()
+                            << std::endl;
+  }
+
+  return mat;
+}
+
+template <unsigned int N>
+void
+uqFixedMatrixClass<N>::fillWithBlocksDiagonally(
+  unsigned int                                      initialTargetRowId,
+  unsigned int                                      initialTargetColId,
+  const std::vector<const uqFixedMatrixClass<N>* >& matrices,
+  bool                                              checkForExactNumRowsMatching,
+  bool                                              checkForExactNumColsMatching)
+{
+  unsigned int sumNumRowsLocals = 0;
+  unsigned int sumNumCols       = 0;
+  for (unsigned int i = 0; i < matrices.size(); ++i) {
+    sumNumRowsLocals += matrices[i]->numRowsLocal();
+    sumNumCols       += matrices[i]->numCols();
+  }
+  UQ_FATAL_TEST_MACRO(N < (initialTargetRowId + sumNumRowsLocals),
+                      m_env.worldRank(),
+                      "uqFixedMatrixClass<N>::fillWithBlocksDiagonally(const)",
+                      "too big number of rows");
+  UQ_FATAL_TEST_MACRO(checkForExactNumRowsMatching && (N != (initialTargetRowId + sumNumRowsLocals)),
+                      m_env.worldRank(),
+                      "uqFixedMatrixClass<N>::fillWithBlocksDiagonally(const)",
+                      "inconsistent number of rows");
+  UQ_FATAL_TEST_MACRO(m_numCols < (initialTargetColId + sumNumCols),
+                      m_env.worldRank(),
+                      "uqFixedMatrixClass<N>::fillWithBlocksDiagonally(const)",
+                      "too big number of cols");
+  UQ_FATAL_TEST_MACRO(checkForExactNumColsMatching && (m_numCols != (initialTargetColId + sumNumCols)),
+                      m_env.worldRank(),
+                      "uqFixedMatrixClass<N>::fillWithBlocksDiagonally(const)",
+                      "inconsistent number of cols");
+
+  this->resetLU();
+  unsigned int cumulativeRowId = 0;
+  unsigned int cumulativeColId = 0;
+  for (unsigned int i = 0; i < matrices.size(); ++i) {
+    unsigned int nRows = matrices[i]->numRowsLocal();
+    unsigned int nCols = matrices[i]->numCols();
+    for (unsigned int rowId = 0; rowId < nRows; ++rowId) {
+      for (unsigned int colId = 0; colId < nCols; ++colId) {
+        m_mat[initialTargetRowId + cumulativeRowId + rowId][initialTargetColId + cumulativeColId + colId] = (*(matrices[i]))(rowId,colId);
+      }
+    }
+    cumulativeRowId += nRows;
+    cumulativeColId += nCols;
+  }
+
+  return;
+}
+
+template <unsigned int N>
+void
+uqFixedMatrixClass<N>::fillWithBlocksDiagonally(
+  unsigned int                                      initialTargetRowId,
+  unsigned int                                      initialTargetColId,
+  const std::vector<      uqFixedMatrixClass<N>* >& matrices,
+  bool                                              checkForExactNumRowsMatching,
+  bool                                              checkForExactNumColsMatching)
+{
+  std::vector<const uqFixedMatrixClass<N>* > constMatrices(matrices.begin(),matrices.end());
+  this->fillWithBlocksDiagonally(initialTargetRowId,initialTargetColId,constMatrices,checkForExactNumRowsMatching,checkForExactNumColsMatching);
+  return;
+}
+
+template <unsigned int N>
+void
+uqFixedMatrixClass<N>::fillWithBlocksHorizontally(
+  unsigned int                                      initialTargetRowId,
+  unsigned int                                      initialTargetColId,
+  const std::vector<const uqFixedMatrixClass<N>* >& matrices,
+  bool                                              checkForExactNumRowsMatching,
+  bool                                              checkForExactNumColsMatching)
+{
+  unsigned int sumNumCols = 0;
+  for (unsigned int i = 0; i < matrices.size(); ++i) {
+    UQ_FATAL_TEST_MACRO(N < (initialTargetRowId + matrices[i]->numRowsLocal()),
+                        m_env.worldRank(),
+                        "uqFixedMatrixClass<N>::fillWithBlocksHorizontally(const)",
+                        "too big number of rows");
+    UQ_FATAL_TEST_MACRO(checkForExactNumRowsMatching && (N != (initialTargetRowId + matrices[i]->numRowsLocal())),
+                        m_env.worldRank(),
+                        "uqFixedMatrixClass<N>::fillWithBlocksHorizontally(const)",
+                        "inconsistent number of rows");
+    sumNumCols += matrices[i]->numCols();
+  }
+  UQ_FATAL_TEST_MACRO(m_numCols < (initialTargetColId + sumNumCols),
+                      m_env.worldRank(),
+                      "uqFixedMatrixClass<N>::fillWithBlocksHorizontally(const)",
+                      "too big number of cols");
+  UQ_FATAL_TEST_MACRO(checkForExactNumColsMatching && (m_numCols != (initialTargetColId + sumNumCols)),
+                      m_env.worldRank(),
+                      "uqFixedMatrixClass<N>::fillWithBlocksHorizontally(const)",
+                      "inconsistent number of cols");
+
+  this->resetLU();
+  unsigned int cumulativeColId = 0;
+  for (unsigned int i = 0; i < matrices.size(); ++i) {
+    unsigned int nRows = matrices[i]->numRowsLocal();
+    unsigned int nCols = matrices[i]->numCols();
+    for (unsigned int rowId = 0; rowId < nRows; ++rowId) {
+      for (unsigned int colId = 0; colId < nCols; ++colId) {
+        m_mat[initialTargetRowId + rowId][initialTargetColId + cumulativeColId + colId] = (*(matrices[i]))(rowId,colId);
+      }
+    }
+    cumulativeColId += nCols;
+  }
+
+  return;
+}
+
+template <unsigned int N>
+void
+uqFixedMatrixClass<N>::fillWithBlocksHorizontally(
+  unsigned int                                      initialTargetRowId,
+  unsigned int                                      initialTargetColId,
+  const std::vector<      uqFixedMatrixClass<N>* >& matrices,
+  bool                                              checkForExactNumRowsMatching,
+  bool                                              checkForExactNumColsMatching)
+{
+  std::vector<const uqFixedMatrixClass<N>* > constMatrices(matrices.begin(),matrices.end());
+  this->fillWithBlocksHorizontally(initialTargetRowId,initialTargetColId,constMatrices,checkForExactNumRowsMatching,checkForExactNumColsMatching);
+  return;
+}
+
+template <unsigned int N>
+void
+uqFixedMatrixClass<N>::fillWithBlocksVertically(
+  unsigned int                                      initialTargetRowId,
+  unsigned int                                      initialTargetColId,
+  const std::vector<const uqFixedMatrixClass<N>* >& matrices,
+  bool                                              checkForExactNumRowsMatching,
+  bool                                              checkForExactNumColsMatching)
+{
+  unsigned int sumNumRows = 0;
+  for (unsigned int i = 0; i < matrices.size(); ++i) {
+    UQ_FATAL_TEST_MACRO(m_numCols < (initialTargetColId + matrices[i]->numCols()),
+                        m_env.worldRank(),
+                        "uqFixedMatrixClass<N>::fillWithBlocksVertically(const)",
+                        "too big number of cols");
+    UQ_FATAL_TEST_MACRO(checkForExactNumColsMatching && (m_numCols != (initialTargetColId + matrices[i]->numCols())),
+                        m_env.worldRank(),
+                        "uqFixedMatrixClass<N>::fillWithBlocksVertically(const)",
+                        "inconsistent number of cols");
+    sumNumRows += matrices[i]->numRowsLocal();
+  }
+  UQ_FATAL_TEST_MACRO(N < (initialTargetRowId + sumNumRows),
+                      m_env.worldRank(),
+                      "uqFixedMatrixClass<N>::fillWithBlocksVertically(const)",
+                      "too big number of rows");
+  UQ_FATAL_TEST_MACRO(checkForExactNumRowsMatching && (N != (initialTargetRowId + sumNumRows)),
+                      m_env.worldRank(),
+                      "uqFixedMatrixClass<N>::fillWithBlocksVertically(const)",
+                      "inconsistent number of rows");
+
+  this->resetLU();
+  unsigned int cumulativeRowId = 0;
+  for (unsigned int i = 0; i < matrices.size(); ++i) {
+    unsigned int nRows = matrices[i]->numRowsLocal();
+    unsigned int nCols = matrices[i]->numCols();
+    for (unsigned int rowId = 0; rowId < nRows; ++rowId) {
+      for (unsigned int colId = 0; colId < nCols; ++colId) {
+        m_mat[initialTargetRowId + cumulativeRowId + rowId][initialTargetColId + colId] = (*(matrices[i]))(rowId,colId);
+      }
+    }
+    cumulativeRowId += nRows;
+  }
+
+  return;
+}
+
+template <unsigned int N>
+void
+uqFixedMatrixClass<N>::fillWithBlocksVertically(
+  unsigned int                                      initialTargetRowId,
+  unsigned int                                      initialTargetColId,
+  const std::vector<      uqFixedMatrixClass<N>* >& matrices,
+  bool                                              checkForExactNumRowsMatching,
+  bool                                              checkForExactNumColsMatching)
+{
+  std::vector<const uqFixedMatrixClass<N>* > constMatrices(matrices.begin(),matrices.end());
+  this->fillWithBlocksVertically(initialTargetRowId,initialTargetColId,constMatrices,checkForExactNumRowsMatching,checkForExactNumColsMatching);
+  return;
+}
+
+template <unsigned int N>
+void
+uqFixedMatrixClass<N>::fillWithTensorProduct(
+  unsigned int                 initialTargetRowId,
+  unsigned int                 initialTargetColId,
+  const uqFixedMatrixClass<N>& mat1,
+  const uqFixedMatrixClass<N>& mat2,
+  bool                         checkForExactNumRowsMatching,
+  bool                         checkForExactNumColsMatching)
+{
+  UQ_FATAL_TEST_MACRO(N < (initialTargetRowId + (N * N)),
+                      m_env.worldRank(),
+                      "uqFixedMatrixClass<N>::fillTensorProduct(mat and mat)",
+                      "too big number of rows");
+  UQ_FATAL_TEST_MACRO(checkForExactNumRowsMatching && (N != (initialTargetRowId + (N * N))),
+                      m_env.worldRank(),
+                      "uqFixedMatrixClass<N>::fillTensorProduct(mat and mat)",
+                      "inconsistent number of rows");
+  UQ_FATAL_TEST_MACRO(m_numCols < (initialTargetColId + (mat1.numCols() * mat2.numCols())),
+                      m_env.worldRank(),
+                      "uqFixedMatrixClass<N>::fillTensorProduct(mat and mat)",
+                      "too big number of columns");
+  UQ_FATAL_TEST_MACRO(checkForExactNumColsMatching && (m_numCols != (initialTargetColId + (mat1.numCols() * mat2.numCols()))),
+                      m_env.worldRank(),
+                      "uqFixedMatrixClass<N>::fillTensorProduct(mat and mat)",
+                      "inconsistent number of columns");
+
+  // Only reachable for N = 1
+  this->resetLU();
+  for (unsigned int colId1 = 0; colId1 < mat1.numCols(); ++colId1) {
+    for (unsigned int colId2 = 0; colId2 < mat2.numCols(); ++colId2) {
+      m_mat[initialTargetRowId][initialTargetColId + colId1*mat2.numCols() + colId2] = mat1(0,colId1)*mat2(0,colId2);
+    }
+  }
+
+  return;
+}
+
+template <unsigned int N>
+void
+uqFixedMatrixClass<N>::fillWithTensorProduct(
+  unsigned int                 initialTargetRowId,
+  unsigned int                 initialTargetColId,
+  const uqFixedMatrixClass<N>& mat1,
+  const uqFixedVectorClass<N>& vec2,
+  bool                         checkForExactNumRowsMatching,
+  bool                         checkForExactNumColsMatching)
+{
+  UQ_FATAL_TEST_MACRO(N < (initialTargetRowId + (N * N)),
+                      m_env.worldRank(),
+                      "uqFixedMatrixClass<N>::fillTensorProduct(mat and vec)",
+                      "too big number of rows");
+  UQ_FATAL_TEST_MACRO(checkForExactNumRowsMatching && (N != (initialTargetRowId + (N * N))),
+                      m_env.worldRank(),
+                      "uqFixedMatrixClass<N>::fillTensorProduct(mat and vec)",
+                      "inconsistent number of rows");
+  UQ_FATAL_TEST_MACRO(m_numCols < (initialTargetColId + mat1.numCols()),
+                      m_env.worldRank(),
+                      "uqFixedMatrixClass<N>::fillTensorProduct(mat and vec)",
+                      "too big number of columns");
+  UQ_FATAL_TEST_MACRO(checkForExactNumColsMatching && (m_numCols != (initialTargetColId + mat1.numCols())),
+                      m_env.worldRank(),
+                      "uqFixedMatrixClass<N>::fillTensorProduct(mat and vec)",
+                      "inconsistent number of columns");
+
+  // Only reachable for N = 1
+  this->resetLU();
+  for (unsigned int colId1 = 0; colId1 < mat1.numCols(); ++colId1) {
+    m_mat[initialTargetRowId][initialTargetColId + colId1] = mat1(0,colId1)*vec2[0];
+  }
+
+  return;
+}
+
+template <unsigned int N>
+void
+uqFixedMatrixClass<N>::fillWithTranspose(
+  unsigned int                 initialTargetRowId,
+  unsigned int                 initialTargetColId,
+  const uqFixedMatrixClass<N>& mat,
+  bool                         checkForExactNumRowsMatching,
+  bool                         checkForExactNumColsMatching)
+{
+  unsigned int nCols = mat.numCols();
+  UQ_FATAL_TEST_MACRO(N < (initialTargetRowId + nCols),
+                      m_env.worldRank(),
+                      "uqFixedMatrixClass<N>::fillWithTranspose()",
+                      "too big number of rows");
+  UQ_FATAL_TEST_MACRO(checkForExactNumRowsMatching && (N != (initialTargetRowId + nCols)),
+                      m_env.worldRank(),
+                      "uqFixedMatrixClass<N>::fillWithTranspose()",
+                      "inconsistent number of rows");
+  UQ_FATAL_TEST_MACRO(m_numCols < (initialTargetColId + N),
+                      m_env.worldRank(),
+                      "uqFixedMatrixClass<N>::fillWithTranspose()",
+                      "too big number of cols");
+  UQ_FATAL_TEST_MACRO(checkForExactNumColsMatching && (m_numCols != (initialTargetColId + N)),
+                      m_env.worldRank(),
+                      "uqFixedMatrixClass<N>::fillWithTranspose()",
+                      "inconsistent number of cols");
+
+  this->resetLU();
+  for (unsigned int row = 0; row < N; ++row) {
+    for (unsigned int col = 0; col < nCols; ++col) {
+      m_mat[initialTargetRowId + col][initialTargetColId + row] = mat(row,col);
+    }
+  }
+
+  return;
+}
+
+template <unsigned int N>
+void
+uqFixedMatrixClass<N>::internalLU() const
+{
+  if (m_luIsValid) return;
+
+  UQ_FATAL_TEST_MACRO(m_numCols != N,
+                      m_env.worldRank(),
+                      "uqFixedMatrixClass<N>::internalLU()",
+                      "matrix is not square");
+
+  // Doolittle elimination with partial pivoting, same convention as gsl_linalg_LU_decomp()
+  for (unsigned int i = 0; i < N; ++i) {
+    m_permutation[i] = i;
+    for (unsigned int j = 0; j < N; ++j) {
+      m_LU[i][j] = m_mat[i][j];
+    }
+  }
+  m_signum     = 1;
+  m_isSingular = false;
+  for (unsigned int j = 0; j < N; ++j) {
+    unsigned int pivotRow = j;
+    double       pivotAbs = std::fabs(m_LU[j][j]);
+    for (unsigned int i = j+1; i < N; ++i) {
+      if (std::fabs(m_LU[i][j]) > pivotAbs) {
+        pivotRow = i;
+        pivotAbs = std::fabs(m_LU[i][j]);
+      }
+    }
+    if (pivotRow != j) {
+      for (unsigned int k = 0; k < N; ++k) {
+        double tmp = m_LU[j][k];
+        m_LU[j][k]        = m_LU[pivotRow][k];
+        m_LU[pivotRow][k] = tmp;
+      }
+      unsigned int tmp = m_permutation[j];
+      m_permutation[j]        = m_permutation[pivotRow];
+      m_permutation[pivotRow] = tmp;
+      m_signum = -m_signum;
+    }
+    double pivot = m_LU[j][j];
+    if (pivot == 0.) {
+      m_isSingular = true;
+      continue;
+    }
+    for (unsigned int i = j+1; i < N; ++i) {
+      double factor = m_LU[i][j]/pivot;
+      m_LU[i][j] = factor;
+      for (unsigned int k = j+1; k < N; ++k) {
+        m_LU[i][k] -= factor*m_LU[j][k];
+      }
+    }
+  }
+  m_luIsValid = true;
+
+  return;
+}
+
+template <unsigned int N>
+bool
+uqFixedMatrixClass<N>::internalLUSolve(double* x) const
+{
+  if (m_isSingular) return false;
+
+  double y[N];
+  for (unsigned int i = 0; i < N; ++i) {
+    y[i] = x[m_permutation[i]];
+  }
+  for (unsigned int i = 0; i < N; ++i) {
+    double value = y[i];
+    for (unsigned int k = 0; k < i; ++k) {
+      value -= m_LU[i][k]*y[k];
+    }
+    y[i] = value;
+  }
+  for (unsigned int i = N; i-- > 0; ) {
+    double value = y[i];
+    for (unsigned int k = i+1; k < N; ++k) {
+      value -= m_LU[i][k]*y[k];
+    }
+    y[i] = value/m_LU[i][i];
+  }
+  for (unsigned int i = 0; i < N; ++i) {
+    x[i] = y[i];
+  }
+
+  return true;
+}
+
+template <unsigned int N>
+double
+uqFixedMatrixClass<N>::determinant() const
+{
+  if (m_determinant == -INFINITY) {
+    this->internalLU();
+    double det   = (double) m_signum;
+    double lnDet = 0.;
+    for (unsigned int i = 0; i < N; ++i) {
+      det   *= m_LU[i][i];
+      lnDet += std::log(std::fabs(m_LU[i][i]));
+    }
+    m_determinant   = det;
+    m_lnDeterminant = lnDet;
+  }
+
+  return m_determinant;
+}
+
+template <unsigned int N>
+double
+uqFixedMatrixClass<N>::lnDeterminant() const
+{
+  if (m_lnDeterminant == -INFINITY) {
+    this->determinant();
+  }
+
+  return m_lnDeterminant;
+}
+
+template <unsigned int N>
+unsigned int
+uqFixedMatrixClass<N>::rank(double absoluteZeroThreshold, double relativeZeroThreshold) const
+{
+  int iRC = 0;
+  iRC = internalSvd();
+  if (iRC) {}; // just to remove compiler warning
+
+  double largest = (*m_svdSvec)[0];
+  unsigned int rankValue = 0;
+  for (unsigned int i = 0; i < N; ++i) {
+    double absolute = (*m_svdSvec)[i];
+    double relative = (largest > 0.) ? absolute/largest : absolute;
+    if (( absolute >= absoluteZeroThreshold ) &&
+        ( relative >= relativeZeroThreshold )) {
+       rankValue += 1;
+    }
+  }
+
+  if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 3)) {
+    *m_env.subDisplayFile() << "In uqFixedMatrixClass<N>::rank()"
+                            << ": this->numRowsLocal() = "  << N
+                            << ", this->numCols() = "       << m_numCols
+                            << ", absoluteZeroThreshold = " << absoluteZeroThreshold
+                            << ", relativeZeroThreshold = " << relativeZeroThreshold
+                            << ", rankValue = "             << rankValue
+                            << ", m_svdSvec = "             << *m_svdSvec
+                            << std::endl;
+  }
+
+  return rankValue;
+}
+
+template <unsigned int N>
+uqFixedVectorClass<N>
+uqFixedMatrixClass<N>::multiply(const uqFixedVectorClass<N>& x) const
+{
+  uqFixedVectorClass<N> y(m_env,m_map);
+  this->multiply(x,y);
+
+  return y;
+}
+
+template <unsigned int N>
+void
+uqFixedMatrixClass<N>::multiply(const uqFixedVectorClass<N>& x, uqFixedVectorClass<N>& y) const
+{
+  UQ_FATAL_TEST_MACRO(m_numCols != N,
+                      m_env.worldRank(),
+                      "uqFixedMatrixClass<N>::multiply()",
+                      "matrix and x have incompatible sizes");
+
+  for (unsigned int i = 0; i < N; ++i) {
+    double value = 0.;
+    for (unsigned int j = 0; j < N; ++j) {
+      value += m_mat[i][j]*x[j];
+    }
+    y[i] = value;
+  }
+
+  return;
+}
+
+template <unsigned int N>
+void
+uqFixedMatrixClass<N>::rankOneUpdate(double scale, double alpha, const uqFixedVectorClass<N>& x, const uqFixedVectorClass<N>& y)
+{
+  UQ_FATAL_TEST_MACRO(m_numCols != N,
+                      m_env.worldRank(),
+                      "uqFixedMatrixClass<N>::rankOneUpdate()",
+                      "matrix and vectors have incompatible sizes");
+
+  this->resetLU();
+
+  for (unsigned int i = 0; i < N; ++i) {
+    double alphaXi = alpha*x[i];
+    for (unsigned int j = 0; j < N; ++j) {
+      m_mat[i][j] = scale*m_mat[i][j] + alphaXi*y[j];
+    }
+  }
+
+  return;
+}
+
+template <unsigned int N>
+uqFixedVectorClass<N>
+uqFixedMatrixClass<N>::invertMultiply(const uqFixedVectorClass<N>& b) const
+{
+  uqFixedVectorClass<N> x(m_env,m_map);
+  this->invertMultiply(b,x);
+
+  return x;
+}
+
+template <unsigned int N>
+void
+uqFixedMatrixClass<N>::invertMultiply(const uqFixedVectorClass<N>& b, uqFixedVectorClass<N>& x) const
+{
+  this->internalLU();
+
+  double values[N];
+  for (unsigned int i = 0; i < N; ++i) {
+    values[i] = b[i];
+  }
+  if (this->internalLUSolve(values)) {
+    for (unsigned int i = 0; i < N; ++i) {
+      x[i] = values[i];
+    }
+  }
+  else {
+    std::cerr << "In uqFixedMatrixClass<N>::invertMultiply()"
+              << ": matrix is singular"
+              << std::endl;
+  }
+
+  return;
+}
+
+template <unsigned int N>
+uqFixedMatrixClass<N>
+uqFixedMatrixClass<N>::invertMultiply(const uqFixedMatrixClass<N>& B) const
+{
+  uqFixedMatrixClass<N> X(m_env,m_map,B.numCols());
+  this->invertMultiply(B,X);
+
+  return X;
+}
+
+template <unsigned int N>
+void
+uqFixedMatrixClass<N>::invertMultiply(const uqFixedMatrixClass<N>& B, uqFixedMatrixClass<N>& X) const
+{
+  UQ_FATAL_RC_MACRO((B.numCols() != X.numCols()),
+                    m_env.worldRank(),
+                    "uqFixedMatrixClass<N>::invertMultiply()",
+                    "Matrices B and X are incompatible");
+
+  this->internalLU();
+
+  // One factorization, all right hand sides
+  double values[N];
+  for (unsigned int j = 0; j < B.numCols(); ++j) {
+    for (unsigned int i = 0; i < N; ++i) {
+      values[i] = B(i,j);
+    }
+    if (this->internalLUSolve(values) == false) {
+      std::cerr << "In uqFixedMatrixClass<N>::invertMultiply()"
+                << ": matrix is singular"
+                << std::endl;
+      break;
+    }
+    for (unsigned int i = 0; i < N; ++i) {
+      X(i,j) = values[i];
+    }
+  }
+
+  return;
+}
+
+template <unsigned int N>
+uqFixedVectorClass<N>
+uqFixedMatrixClass<N>::invertMultiplyForceLU(const uqFixedVectorClass<N>& b) const
+{
+  uqFixedVectorClass<N> x(m_env,m_map);
+  this->invertMultiplyForceLU(b,x);
+
+  return x;
+}
+
+template <unsigned int N>
+void
+uqFixedMatrixClass<N>::invertMultiplyForceLU(const uqFixedVectorClass<N>& b, uqFixedVectorClass<N>& x) const
+{
+  m_luIsValid = false;
+  this->internalLU();
+
+  double values[N];
+  for (unsigned int i = 0; i < N; ++i) {
+    values[i] = b[i];
+  }
+  int iRC = (this->internalLUSolve(values) ? 0 : 1);
+  UQ_FATAL_RC_MACRO(iRC,
+                    m_env.worldRank(),
+                    "uqFixedMatrixClass<N>::invertMultiplyForceLU()",
+                    "LU solve failed");
+  for (unsigned int i = 0; i < N; ++i) {
+    x[i] = values[i];
+  }
+
+  return;
+}
+
+template <unsigned int N>
+void
+uqFixedMatrixClass<N>::eigen(uqFixedVectorClass<N>& eigenValues, uqFixedMatrixClass<N>* eigenVectors) const
+{
+  UQ_FATAL_TEST_MACRO(m_numCols != N,
+                      m_env.worldRank(),
+                      "uqFixedMatrixClass<N>::eigen()",
+                      "matrix is not square");
+
+  // Cyclic Jacobi: annihilate off diagonal entries of a copy, accumulating the rotations
+  double a[N][N];
+  double v[N][N];
+  for (unsigned int i = 0; i < N; ++i) {
+    for (unsigned int j = 0; j < N; ++j) {
+      a[i][j] = m_mat[i][j];
+      v[i][j] = (i == j) ? 1. : 0.;
+    }
+  }
+
+  const unsigned int maxNumSweeps = 50;
+  for (unsigned int sweep = 0; sweep < maxNumSweeps; ++sweep) {
+    double offDiag = 0.;
+    double diag    = 0.;
+    for (unsigned int p = 0; p < N; ++p) {
+      diag += a[p][p]*a[p][p];
+      for (unsigned int q = p+1; q < N; ++q) {
+        offDiag += a[p][q]*a[p][q];
+      }
+    }
+    if (offDiag <= DBL_EPSILON*DBL_EPSILON*diag) break;
+
+    for (unsigned int p = 0; p + 1 < N; ++p) {
+      for (unsigned int q = p+1; q < N; ++q) {
+        if (a[p][q] == 0.) continue;
+        double theta = (a[q][q] - a[p][p])/(2.*a[p][q]);
+        double t     = ((theta >= 0.) ? 1. : -1.)/(std::fabs(theta) + std::sqrt(theta*theta + 1.));
+        double c     = 1./std::sqrt(t*t + 1.);
+        double s     = t*c;
+        for (unsigned int k = 0; k < N; ++k) {
+          double akp = a[k][p];
+          double akq = a[k][q];
+          a[k][p] = c*akp - s*akq;
+          a[k][q] = s*akp + c*akq;
+        }
+        for (unsigned int k = 0; k < N; ++k) {
+          double apk = a[p][k];
+          double aqk = a[q][k];
+          a[p][k] = c*apk - s*aqk;
+          a[q][k] = s*apk + c*aqk;
+        }
+        for (unsigned int k = 0; k < N; ++k) {
+          double vkp = v[k][p];
+          double vkq = v[k][q];
+          v[k][p] = c*vkp - s*vkq;
+          v[k][q] = s*vkp + c*vkq;
+        }
+      }
+    }
+  }
+
+  // Eigenvalues in ascending order, as returned by GSL_EIGEN_SORT_VAL_ASC
+  unsigned int order[N];
+  for (unsigned int j = 0; j < N; ++j) {
+    order[j] = j;
+  }
+  for (unsigned int j = 0; j < N; ++j) {
+    unsigned int jMin = j;
+    for (unsigned int k = j+1; k < N; ++k) {
+      if (a[order[k]][order[k]] < a[order[jMin]][order[jMin]]) jMin = k;
+    }
+    unsigned int tmp = order[j];
+    order[j]    = order[jMin];
+    order[jMin] = tmp;
+  }
+  for (unsigned int j = 0; j < N; ++j) {
+    eigenValues[j] = a[order[j]][order[j]];
+  }
+  if (eigenVectors) {
+    for (unsigned int i = 0; i < N; ++i) {
+      for (unsigned int j = 0; j < N; ++j) {
+        (*eigenVectors)(i,j) = v[i][order[j]];
+      }
+    }
+  }
+
+  return;
+}
+
+template <unsigned int N>
+void
+uqFixedMatrixClass<N>::largestEigen(double& eigenValue, uqFixedVectorClass<N>& eigenVector) const
+{
+  /* The following notation is used:
+     z = vector used in iteration that ends up being the eigenvector corresponding to the
+         largest eigenvalue
+     w = vector used in iteration that we extract the largest eigenvalue from.  */
+
+  // Some parameters associated with the algorithm
+  // TODO: Do we want to add the ability to have these set by the user?
+  const unsigned int max_num_iterations = 10000;
+  const double tolerance = 1.0e-13;
+
+  // Create temporary working vectors.
+  uqFixedVectorClass<N> z(m_env, m_map, 1.0 ); // Needs to be initialized to 1.0
+  uqFixedVectorClass<N> w(m_env, m_map);
+
+  double residual = 0.;
+  for( unsigned int k = 0; k < max_num_iterations; ++k )
+    {
+      this->multiply(z, w);
+
+      // For this algorithm, it's crucial to get the maximum in
+      // absolute value, but then to normalize by the actual value
+      // and *not* the absolute value.
+      int index = (w.abs()).getMaxValueIndex();
+      double lambda = w[index];
+
+      z = w;
+      z *= 1.0/lambda;
+
+      // Here we use the norm of the residual as our convergence check:
+      // norm( A*x - \lambda*x )
+      this->multiply(z, w);
+      w -= lambda*z;
+      residual = w.norm2();
+
+      if( residual < tolerance )
+	{
+	  eigenValue = lambda;
+	  eigenVector = z;
+	  return;
+	}
+    }
+
+  // If we reach this point, then we didn't converge. Print error if we don't converge.
+  UQ_FATAL_TEST_MACRO((residual >= tolerance),
+                      env().fullRank(),
+                      "uqFixedMatrixClass<N>::largestEigen()",
+                      "Maximum num iterations exceeded");
+
+  return;
+}
+
+template <unsigned int N>
+void
+uqFixedMatrixClass<N>::smallestEigen(double& eigenValue, uqFixedVectorClass<N>& eigenVector) const
+{
+  /* The following notation is used:
+     z = vector used in iteration that ends up being the eigenvector corresponding to the
+         smallest eigenvalue
+     w = vector used in iteration that we extract the smallest eigenvalue from.  */
+
+  // Some parameters associated with the algorithm
+  // TODO: Do we want to add the ability to have these set by the user?
+  const unsigned int max_num_iterations = 1000;
+  const double tolerance = 1.0e-13;
+
+  // Create temporary working vectors.
+  uqFixedVectorClass<N> z(m_env, m_map, 1.0 ); // Needs to be initialized to 1.0
+  uqFixedVectorClass<N> w(m_env, m_map);
+
+  double residual = 0.;
+  for( unsigned int k = 0; k < max_num_iterations; ++k )
+    {
+      this->invertMultiplyForceLU(z, w);
+
+      // For this algorithm, it's crucial to get the maximum in
+      // absolute value, but then to normalize by the actual value
+      // and *not* the absolute value.
+      int index = (w.abs()).getMaxValueIndex();
+
+      // Take the inverse since we are looking for the minimum.
+      double lambda = 1.0/w[index];
+
+      z = w;
+      z *= lambda;
+
+      // Here we use the norm of the residual as our convergence check:
+      // norm( A*x - \lambda*x )
+      this->multiply(z, w);
+      w -= lambda*z;
+      residual = w.norm2();
+
+      if( residual < tolerance )
+	{
+	  eigenValue = lambda;
+	  eigenVector = z;
+	  return;
+	}
+    }
+
+  // If we reach this point, then we didn't converge. Print error if we don't converge.
+  UQ_FATAL_TEST_MACRO((residual >= tolerance),
+                      env().fullRank(),
+                      "uqFixedMatrixClass<N>::smallestEigen()",
+                      "Maximum num iterations exceeded");
+
+  return;
+}
+
+template <unsigned int N>
+void
+uqFixedMatrixClass<N>::getColumn(unsigned int column_num, uqFixedVectorClass<N>& column) const
+{
+  UQ_FATAL_TEST_MACRO(column_num >= m_numCols,
+                      env().fullRank(),
+                      "uqFixedMatrixClass<N>::getColumn",
+                      "Specified column number not within range");
+
+  for (unsigned int i = 0; i < N; ++i) {
+    column[i] = m_mat[i][column_num];
+  }
+
+  return;
+}
+
+template <unsigned int N>
+uqFixedVectorClass<N>
+uqFixedMatrixClass<N>::getColumn(unsigned int column_num) const
+{
+  uqFixedVectorClass<N> column(m_env, m_map);
+  this->getColumn( column_num, column );
+
+  return column;
+}
+
+template <unsigned int N>
+void
+uqFixedMatrixClass<N>::setColumn(unsigned int column_num, const uqFixedVectorClass<N>& column)
+{
+  UQ_FATAL_TEST_MACRO(column_num >= m_numCols,
+                      env().fullRank(),
+                      "uqFixedMatrixClass<N>::setColumn",
+                      "Specified column number not within range");
+
+  this->resetLU();
+  for (unsigned int i = 0; i < N; ++i) {
+    m_mat[i][column_num] = column[i];
+  }
+
+  return;
+}
+
+template <unsigned int N>
+void
+uqFixedMatrixClass<N>::getRow(unsigned int row_num, uqFixedVectorClass<N>& row) const
+{
+  UQ_FATAL_TEST_MACRO(row_num >= N,
+                      env().fullRank(),
+                      "uqFixedMatrixClass<N>::getRow",
+                      "Specified row number not within range");
+  UQ_FATAL_TEST_MACRO(m_numCols != N,
+                      env().fullRank(),
+                      "uqFixedMatrixClass<N>::getRow",
+                      "row vector not same size as this matrix");
+
+  for (unsigned int j = 0; j < N; ++j) {
+    row[j] = m_mat[row_num][j];
+  }
+
+  return;
+}
+
+template <unsigned int N>
+uqFixedVectorClass<N>
+uqFixedMatrixClass<N>::getRow(unsigned int row_num) const
+{
+  uqFixedVectorClass<N> row(m_env, m_map);
+  this->getRow( row_num, row );
+
+  return row;
+}
+
+template <unsigned int N>
+void
+uqFixedMatrixClass<N>::setRow(unsigned int row_num, const uqFixedVectorClass<N>& row)
+{
+  UQ_FATAL_TEST_MACRO(row_num >= N,
+                      env().fullRank(),
+                      "uqFixedMatrixClass<N>::setRow",
+                      "Specified row number not within range");
+  UQ_FATAL_TEST_MACRO(m_numCols != N,
+                      env().fullRank(),
+                      "uqFixedMatrixClass<N>::setRow",
+                      "row vector not same size as this matrix");
+
+  this->resetLU();
+  for (unsigned int j = 0; j < N; ++j) {
+    m_mat[row_num][j] = row[j];
+  }
+
+  return;
+}
+
+template <unsigned int N>
+void
+uqFixedMatrixClass<N>::mpiSum( const uqMpiCommClass& comm, uqFixedMatrixClass<N>& M_global ) const
+{
+  UQ_FATAL_RC_MACRO((m_numCols != M_global.numCols()),
+		    env().fullRank(),
+		    "uqFixedMatrixClass<N>::mpiSum()",
+		    "local and global matrices incompatible");
+
+  double local [N*N];
+  double global[N*N];
+  for (unsigned int i = 0; i < N; ++i) {
+    for (unsigned int j = 0; j < N; ++j) {
+      local[i*N+j] = m_mat[i][j];
+    }
+  }
+
+  comm.Allreduce((void*) local, (void*) global, (int) (N*N), uqRawValue_MPI_DOUBLE, uqRawValue_MPI_SUM,
+                 "uqFixedMatrixClass<N>::mpiSum()",
+                 "failed MPI.Allreduce()");
+
+  M_global.resetLU();
+  for (unsigned int i = 0; i < N; ++i) {
+    for (unsigned int j = 0; j < N; ++j) {
+      M_global.m_mat[i][j] = global[i*N+j];
+    }
+  }
+
+  return;
+}
+
+template <unsigned int N>
+void
+uqFixedMatrixClass<N>::matlabLinearInterpExtrap(
+  const uqFixedVectorClass<N>& x1Vec,
+  const uqFixedMatrixClass<N>& y1Mat,
+  const uqFixedVectorClass<N>& x2Vec)
+{
+  UQ_FATAL_TEST_MACRO(y1Mat.numCols() != m_numCols,
+                      m_env.worldRank(),
+                      "uqFixedMatrixClass<N>::matlabLinearInterpExtrap()",
+                      "invalid 'y1' and 'this' sizes");
+
+  uqFixedVectorClass<N> y1Vec(x1Vec);
+  uqFixedVectorClass<N> y2Vec(x2Vec);
+  for (unsigned int colId = 0; colId < m_numCols; ++colId) {
+    y1Mat.getColumn(colId,y1Vec);
+    y2Vec.matlabLinearInterpExtrap(x1Vec,y1Vec,x2Vec);
+    this->setColumn(colId,y2Vec);
+  }
+
+  return;
+}
+
+template <unsigned int N>
+void
+uqFixedMatrixClass<N>::print(std::ostream& os) const
+{
+  if (m_printHorizontally) {
+    for (unsigned int i = 0; i < N; ++i) {
+      for (unsigned int j = 0; j < m_numCols; ++j) {
+        os << m_mat[i][j]
+           << " ";
+      }
+      if (i != (N-1)) os << "; ";
+    }
+  }
+  else {
+    for (unsigned int i = 0; i < N; ++i) {
+      for (unsigned int j = 0; j < m_numCols; ++j) {
+        os << m_mat[i][j]
+           << " ";
+      }
+      os << std::endl;
+    }
+  }
+
+  return;
+}
+
+template <unsigned int N>
+void
+uqFixedMatrixClass<N>::subWriteContents(
+  const std::string&            varNamePrefix,
+  const std::string&            fileName,
+  const std::string&            fileType,
+  const std::set<unsigned int>& allowedSubEnvIds) const
+{
+  UQ_FATAL_TEST_MACRO(m_env.subRank() < 0,
+                      m_env.worldRank(),
+                      "uqFixedMatrixClass<N>::subWriteContents()",
+                      "unexpected subRank");
+
+  uqFilePtrSetStruct filePtrSet;
+  if (m_env.openOutputFile(fileName,
+                           fileType, // "m or hdf"
+                           allowedSubEnvIds,
+                           false,
+                           filePtrSet)) {
+    *filePtrSet.ofsVar << varNamePrefix << "_sub" << m_env.subIdString() << " = zeros(" << N
+                       << ","                                                           << m_numCols
+                       << ");"
+                       << std::endl;
+    *filePtrSet.ofsVar << varNamePrefix << "_sub" << m_env.subIdString() << " = [";
+
+    for (unsigned int i = 0; i < N; ++i) {
+      for (unsigned int j = 0; j < m_numCols; ++j) {
+        *filePtrSet.ofsVar << m_mat[i][j]
+                << " ";
+      }
+      *filePtrSet.ofsVar << "\n";
+    }
+    *filePtrSet.ofsVar << "];\n";
+
+    m_env.closeFile(filePtrSet,fileType);
+  }
+
+  return;
+}
+
+template <unsigned int N>
+void
+uqFixedMatrixClass<N>::subReadContents(
+  const std::string&            fileName,
+  const std::string&            fileType,
+  const std::set<unsigned int>& allowedSubEnvIds)
+{
+  UQ_FATAL_TEST_MACRO(m_env.subRank() < 0,
+                      m_env.worldRank(),
+                      "uqFixedMatrixClass<N>::subReadContents()",
+                      "unexpected subRank");
+
+  uqFilePtrSetStruct filePtrSet;
+  if (m_env.openInputFile(fileName,
+                          fileType, // "m or hdf"
+                          allowedSubEnvIds,
+                          filePtrSet)) {
+    // Read the 'prefix_subN = zeros(n,m);' line and check its sizes
+    std::string tmpString;
+    *filePtrSet.ifsVar >> tmpString;
+    *filePtrSet.ifsVar >> tmpString;
+    UQ_FATAL_TEST_MACRO(tmpString != "=",
+                        m_env.worldRank(),
+                        "uqFixedMatrixClass<N>::subReadContents()",
+                        "string should be the '=' sign");
+    *filePtrSet.ifsVar >> tmpString;
+    std::string::size_type posOfOpen  = tmpString.find('(');
+    std::string::size_type posOfComma = tmpString.find(',');
+    std::string::size_type posOfClose = tmpString.find(')');
+    UQ_FATAL_TEST_MACRO((posOfOpen  == std::string::npos) ||
+                        (posOfComma == std::string::npos) ||
+                        (posOfClose == std::string::npos),
+                        m_env.worldRank(),
+                        "uqFixedMatrixClass<N>::subReadContents()",
+                        "sizes not found in first line of file");
+    unsigned int numRowsInFile = (unsigned int) strtod(tmpString.substr(posOfOpen +1,posOfComma-posOfOpen -1).c_str(),NULL);
+    unsigned int numColsInFile = (unsigned int) strtod(tmpString.substr(posOfComma+1,posOfClose-posOfComma-1).c_str(),NULL);
+    UQ_FATAL_TEST_MACRO(numRowsInFile != N,
+                        m_env.worldRank(),
+                        "uqFixedMatrixClass<N>::subReadContents()",
+                        "number of rows in file is different than number of rows in this matrix");
+    UQ_FATAL_TEST_MACRO(numColsInFile != m_numCols,
+                        m_env.worldRank(),
+                        "uqFixedMatrixClass<N>::subReadContents()",
+                        "number of columns in file is different than number of columns in this matrix");
+
+    // Read the 'prefix_subN = [' tokens, then the values
+    *filePtrSet.ifsVar >> tmpString;
+    *filePtrSet.ifsVar >> tmpString;
+    UQ_FATAL_TEST_MACRO(tmpString != "=",
+                        m_env.worldRank(),
+                        "uqFixedMatrixClass<N>::subReadContents()",
+                        "in core 0, string should be the '=' sign");
+    std::streampos tmpPos = filePtrSet.ifsVar->tellg();
+    filePtrSet.ifsVar->seekg(tmpPos+(std::streampos)2);
+    this->resetLU();
+    for (unsigned int i = 0; i < N; ++i) {
+      for (unsigned int j = 0; j < m_numCols; ++j) {
+        *filePtrSet.ifsVar >> m_mat[i][j];
+      }
+    }
+
+    m_env.closeFile(filePtrSet,fileType);
+  }
+
+  return;
+}
+
+template <unsigned int N>
+std::ostream&
+operator<<(std::ostream& os, const uqFixedMatrixClass<N>& obj)
+{
+  obj.print(os);
+
+  return os;
+}
+
+template <unsigned int N>
+uqFixedMatrixClass<N> operator*(double a, const uqFixedMatrixClass<N>& mat)
+{
+  uqFixedMatrixClass<N> answer(mat);
+  answer *= a;
+  return answer;
+}
+
+template <unsigned int N>
+uqFixedVectorClass<N> operator*(const uqFixedMatrixClass<N>& mat, const uqFixedVectorClass<N>& vec)
+{
+  return mat.multiply(vec);
+}
+
+template <unsigned int N>
+uqFixedMatrixClass<N> operator*(const uqFixedMatrixClass<N>& m1, const uqFixedMatrixClass<N>& m2)
+{
+  UQ_FATAL_TEST_MACRO((m1.numCols() != N),
+                      m1.env().worldRank(),
+                      "uqFixedMatrixClass<N> operator*(matrix,matrix)",
+                      "different sizes m1Cols and m2Rows");
+
+  unsigned int m2Cols = m2.numCols();
+  uqFixedMatrixClass<N> mat(m1.env(),m1.map(),m2Cols);
+  for (unsigned int row1 = 0; row1 < N; ++row1) {
+    for (unsigned int col2 = 0; col2 < m2Cols; ++col2) {
+      double result = 0.;
+      for (unsigned int k = 0; k < N; ++k) {
+        result += m1(row1,k)*m2(k,col2);
+      }
+      mat(row1,col2) = result;
+    }
+  }
+
+  return mat;
+}
+
+template <unsigned int N>
+uqFixedMatrixClass<N> operator+(const uqFixedMatrixClass<N>& m1, const uqFixedMatrixClass<N>& m2)
+{
+  uqFixedMatrixClass<N> answer(m1);
+  answer += m2;
+  return answer;
+}
+
+template <unsigned int N>
+uqFixedMatrixClass<N> operator-(const uqFixedMatrixClass<N>& m1, const uqFixedMatrixClass<N>& m2)
+{
+  uqFixedMatrixClass<N> answer(m1);
+  answer -= m2;
+  return answer;
+}
+
+template <unsigned int N>
+uqFixedMatrixClass<N> matrixProduct(const uqFixedVectorClass<N>& v1, const uqFixedVectorClass<N>& v2)
+{
+  uqFixedMatrixClass<N> answer(v1.env(),v1.map(),N);
+  for (unsigned int i = 0; i < N; ++i) {
+    double value1 = v1[i];
+    for (unsigned int j = 0; j < N; ++j) {
+      answer(i,j) = value1*v2[j];
+    }
+  }
+
+  return answer;
+}
+
+template <unsigned int N>
+uqFixedMatrixClass<N> leftDiagScaling(const uqFixedVectorClass<N>& vec, const uqFixedMatrixClass<N>& mat)
+{
+  UQ_FATAL_TEST_MACRO((mat.numCols() != N),
+                      mat.env().worldRank(),
+                      "uqFixedMatrixClass<N> leftDiagScaling(vector,matrix)",
+                      "routine currently works for square matrices only");
+
+  uqFixedMatrixClass<N> answer(mat);
+  for (unsigned int i = 0; i < N; ++i) {
+    double vecValue = vec[i];
+    for (unsigned int j = 0; j < N; ++j) {
+      answer(i,j) *= vecValue;
+    }
+  }
+
+  return answer;
+}
+
+template <unsigned int N>
+uqFixedMatrixClass<N> rightDiagScaling(const uqFixedMatrixClass<N>& mat, const uqFixedVectorClass<N>& vec)
+{
+  UQ_FATAL_TEST_MACRO((mat.numCols() != N),
+                      mat.env().worldRank(),
+                      "uqFixedMatrixClass<N> rightDiagScaling(matrix,vector)",
+                      "routine currently works for square matrices only");
+
+  uqFixedMatrixClass<N> answer(mat);
+  for (unsigned int j = 0; j < N; ++j) {
+    double vecValue = vec[j];
+    for (unsigned int i = 0; i < N; ++i) {
+      answer(i,j) *= vecValue;
+    }
+  }
+
+  return answer;
+}
+
+#endif // __UQ_FIXED_MATRIX_H__
@@ -0,0 +1,1137 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+// 
+// QUESO - a library to support the Quantification of Uncertainty
+// for Estimation, Simulation and Optimization
+//
+// Copyright (C) 2008,2009,2010,2011,2012,2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor, 
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+// 
+// $Id$
+//
+//--------------------------------------------------------------------------
+
+#ifndef __UQ_FIXED_VECTOR_H__
+#define __UQ_FIXED_VECTOR_H__
+
+/*! \file uqFixedVector.h
+    \brief Vector class with a compile time dimension and in-object storage
+*/
+
+#include <uqDefines.h>
+#include <uqVector.h>
+#include <algorithm>
+#include <vector>
+#include <cmath>
+#include <cstdlib>
+
+/*! \class uqFixedVectorClass
+    \brief Class for vectors whose dimension N is known at compile time.
+    
+    This class provides the same interface as uqGslVectorClass, but its N components
+    live inside the object itself, so creating, copying and destroying a vector never
+    touches the heap. Element access through operator[] is not bounds checked, and all
+    loops run over the compile time dimension N, so the compiler is free to unroll them.
+    It is meant for low dimensional problems (a handful of parameters and quantities of
+    interest), where allocation and indirection dominate the cost of the arithmetic.
+    Like uqGslVectorClass, every processor of the map holds all N components; the map
+    given to the constructors must have exactly N global elements.
+*/
+
+template <unsigned int N>
+class uqFixedVectorClass : public uqVectorClass
+{
+public:
+  //! @name Constructor/Destructor methods.
+  //@{ 
+  //! Default Constructor
+  /*! Should not be used by user.*/
+  uqFixedVectorClass();
+
+  //! Constructor: creates a vector of zeros; \c map must have N global elements.
+  uqFixedVectorClass(const uqBaseEnvironmentClass& env, const uqMapClass& map);
+
+  //! Constructor: creates a vector with all components set to \c value.
+  uqFixedVectorClass(const uqBaseEnvironmentClass& env, const uqMapClass& map, double value);
+
+  //! Constructor: creates a vector with N equally spaced values from \c d1 to \c d2 (MATLAB linspace).
+  uqFixedVectorClass(const uqBaseEnvironmentClass& env, double d1, double d2, const uqMapClass& map);
+
+  //! Constructor: creates a vector like \c v, with N equally spaced values from \c start to \c end.
+  uqFixedVectorClass(const uqFixedVectorClass<N>& v, double start, double end);
+
+  //! Copy constructor.
+  uqFixedVectorClass(const uqFixedVectorClass<N>& y);
+
+  //! Destructor
+  ~uqFixedVectorClass();
+  //@}
+
+  //! @name Set methods.
+  //@{ 
+  //! Copies values from vector rhs to \c this. 
+  uqFixedVectorClass<N>& operator= (const uqFixedVectorClass<N>& rhs);
+
+  //! Stores in \c this the coordinate-wise multiplication of \c this and a.
+  uqFixedVectorClass<N>& operator*=(double a);
+
+  //! Stores in \c this the coordinate-wise division of \c this by a.
+  uqFixedVectorClass<N>& operator/=(double a);
+
+  //! Stores in \c this the coordinate-wise multiplication of \c this with rhs.
+  uqFixedVectorClass<N>& operator*=(const uqFixedVectorClass<N>& rhs);
+
+  //! Stores in \c this the coordinate-wise division of \c this by rhs.
+  uqFixedVectorClass<N>& operator/=(const uqFixedVectorClass<N>& rhs);
+
+  //! Stores in \c this the coordinate-wise addition of \c this and rhs.
+  uqFixedVectorClass<N>& operator+=(const uqFixedVectorClass<N>& rhs);
+
+  //! Stores in \c this the coordinate-wise subtraction of \c this by rhs.
+  uqFixedVectorClass<N>& operator-=(const uqFixedVectorClass<N>& rhs);
+  //@}
+
+  //! @name Accessor methods.
+  //@{
+  //! Element access method (non-const), without bounds checking.
+            double& operator[](unsigned int i) { return m_values[i]; }
+
+  //! Element access method (const), without bounds checking.
+      const double& operator[](unsigned int i) const { return m_values[i]; }
+  //@}
+
+  //! @name Attribute methods.
+  //@{ 
+  //! Returns N.
+  unsigned int sizeLocal        () const { return N; }
+
+  //! Returns N.
+  unsigned int sizeGlobal       () const { return N; }
+  //@}
+
+  //! @name Mathematical methods.
+  //@{ 
+  //! Returns the square of the 2-norm of the vector.
+  double       norm2Sq          () const;
+
+  //! Returns the 2-norm (Euclidean norm) of the vector.
+  double       norm2            () const;
+
+  //! Returns the 1-norm of the vector.
+  double       norm1            () const;
+
+  //! Returns the infinity-norm (maximum norm) of the vector.
+  double       normInf          () const;
+
+  //! Returns the sum of the components of the vector.
+  double       sumOfComponents  () const;
+  //@}
+
+  //! @name Set methods.
+  //@{
+  //! Component-wise sets all values to \c this with value.
+  void         cwSet            (double value);
+
+  //! Component-wise sets all values of \c this with Gaussian samples of mean \c mean and standard deviation \c stdDev.
+  void         cwSetGaussian    (double mean, double stdDev);
+
+  //! Component-wise sets all values of \c this with Gaussian samples of mean \c meanVec and standard deviation \c stdDevVec.
+  void         cwSetGaussian    (const uqFixedVectorClass<N>& meanVec, const uqFixedVectorClass<N>& stdDevVec);
+
+  //! Component-wise sets all values of \c this with uniform samples in [aVec,bVec].
+  void         cwSetUniform     (const uqFixedVectorClass<N>& aVec, const uqFixedVectorClass<N>& bVec);
+
+  //! Component-wise sets all values of \c this with Beta samples.
+  void         cwSetBeta        (const uqFixedVectorClass<N>& alpha, const uqFixedVectorClass<N>& beta);
+
+  //! Component-wise sets all values of \c this with Gamma samples.
+  void         cwSetGamma       (const uqFixedVectorClass<N>& a, const uqFixedVectorClass<N>& b);
+
+  //! Component-wise sets all values of \c this with Inverse Gamma samples.
+  void         cwSetInverseGamma(const uqFixedVectorClass<N>& alpha, const uqFixedVectorClass<N>& beta);
+
+  //! Sets \c this with the concatenation of \c v1 and \c v2.
+  /*! With a compile time dimension, both pieces must have the type of \c this, so the
+      concatenation only fits when one of them has size zero; kept for interface compatibility.*/
+  void         cwSetConcatenated(const uqFixedVectorClass<N>& v1, const uqFixedVectorClass<N>& v2);
+
+  //! Sets \c this with the concatenation of the vectors in \c vecs.
+  void         cwSetConcatenated(const std::vector<const uqFixedVectorClass<N>* >& vecs);
+
+  //! Sets the values of \c this starting at position \c initialPos with the values of \c vec.
+  void         cwSet            (unsigned int initialPos, const uqFixedVectorClass<N>& vec);
+
+  //! Sets the values of \c vec with the values of \c this starting at position \c initialPos.
+  void         cwExtract        (unsigned int initialPos, uqFixedVectorClass<N>& vec) const;
+
+  //! Component-wise inverts all values of \c this.
+  void         cwInvert         ();
+
+  //! Component-wise sets all values of \c this to their square roots.
+  void         cwSqrt           ();
+
+  //! Component-wise sets \c this to a*x + b*y; \c x or \c y may be \c this.
+  void         cwSetLinearCombination(double a, const uqFixedVectorClass<N>& x, double b, const uqFixedVectorClass<N>& y);
+
+  //! Reproduces MATLAB linear inter/extra-polation.
+  void         matlabDiff       (unsigned int firstPositionToStoreDiff, double valueForRemainderPosition, uqFixedVectorClass<N>& outputVec) const;
+
+  //! Reproduces MATLAB linear inter/extra-polation.
+  void         matlabLinearInterpExtrap(const uqFixedVectorClass<N>& x1Vec, const uqFixedVectorClass<N>& y1Vec, const uqFixedVectorClass<N>& x2Vec);
+
+  //! This function sorts the elements of the vector in ascending numerical order.
+  void         sort             ();
+  //@}
+
+  //! @name MPI methods.
+  //@{
+  //! Broadcasts the components of \c this from processor \c srcRank to all processors of \c bcastComm.
+  void         mpiBcast         (int srcRank, const uqMpiCommClass& bcastComm);
+
+  //! Performs the MPI operation \c mpiOperation over the processors of \c opComm, storing the result in \c resultVec.
+  void         mpiAllReduce     (uqRawType_MPI_Op mpiOperation, const uqMpiCommClass& opComm, uqFixedVectorClass<N>& resultVec) const;
+
+  //! Computes, component-wise, the \c probability quantile over the processors of \c opComm.
+  void         mpiAllQuantile   (double probability, const uqMpiCommClass& opComm, uqFixedVectorClass<N>& resultVec) const;
+  //@}
+
+  //! @name I/O methods.
+  //@{
+  //! Prints the vector.
+  void         print            (std::ostream& os) const;
+
+  //! Writes the vector to \c fileName, in the same format as uqGslVectorClass.
+  void         subWriteContents (const std::string&            varNamePrefix,
+                                 const std::string&            fileName,
+                                 const std::string&            fileType,
+                                 const std::set<unsigned int>& allowedSubEnvIds) const;
+
+  //! Reads the vector from \c fileName, in the same format as uqGslVectorClass.
+  void         subReadContents  (const std::string&            fileName,
+                                 const std::string&            fileType,
+                                 const std::set<unsigned int>& allowedSubEnvIds);
+  //@}
+
+  //! @name Comparison methods.
+  //@{
+  //! Returns true if at least one component of \c this is smaller than the respective component of rhs.
+  bool         atLeastOneComponentSmallerThan       (const uqFixedVectorClass<N>& rhs) const;
+
+  //! Returns true if at least one component of \c this is bigger than the respective component of rhs.
+  bool         atLeastOneComponentBiggerThan        (const uqFixedVectorClass<N>& rhs) const;
+
+  //! Returns true if at least one component of \c this is smaller than or equal to the respective component of rhs.
+  bool         atLeastOneComponentSmallerOrEqualThan(const uqFixedVectorClass<N>& rhs) const;
+
+  //! Returns true if at least one component of \c this is bigger than or equal to the respective component of rhs.
+  bool         atLeastOneComponentBiggerOrEqualThan (const uqFixedVectorClass<N>& rhs) const;
+  //@}
+
+  //! @name Attribute methods.
+  //@{
+  //! Returns a pointer to the N contiguous components of \c this.
+  const double* data            () const { return m_values; }
+
+  //! Returns the maximum value in the vector \c this.
+  double       getMaxValue      () const;
+
+  //! Returns minimum value in the vector \c this.
+  double       getMinValue      () const;
+
+  //! This function returns the index of the maximum value in the vector \c this.
+  int          getMaxValueIndex () const;
+
+  //! This function returns the index of the minimum value in the vector \c this.
+  int          getMinValueIndex () const;
+
+  //! This function returns maximum value in the vector \c this and its the index.
+  void         getMaxValueAndIndex( double& value, int& index );
+
+  //! This function returns minimum value in the vector \c this and its the index.
+  void         getMinValueAndIndex( double& value, int& index );
+
+  //! This function returns absolute value of elements in \c this.
+  uqFixedVectorClass<N> abs() const;
+  //@}
+
+private:
+  //! This function copies the elements of the vector \c src into \c this.
+  void         copy             (const uqFixedVectorClass<N>& src);
+
+  //! Checks that \c map has N global elements.
+  void         checkMap         (const uqMapClass& map, const char* where) const;
+
+  //! The N components of the vector.
+  double m_values[N];
+};
+
+template <unsigned int N>
+uqFixedVectorClass<N>::uqFixedVectorClass()
+  :
+  uqVectorClass()
+{
+  UQ_FATAL_TEST_MACRO(true,
+                      m_env.worldRank(),
+                      "uqFixedVectorClass<N>::constructor(), default",
+                      "should not be used by user");
+}
+
+template <unsigned int N>
+uqFixedVectorClass<N>::uqFixedVectorClass(const uqBaseEnvironmentClass& env, const uqMapClass& map)
+  :
+  uqVectorClass(env,map)
+{
+  this->checkMap(map,"uqFixedVectorClass<N>::constructor(1)");
+  this->cwSet(0.);
+}
+
+template <unsigned int N>
+uqFixedVectorClass<N>::uqFixedVectorClass(const uqBaseEnvironmentClass& env, const uqMapClass& map, double value)
+  :
+  uqVectorClass(env,map)
+{
+  this->checkMap(map,"uqFixedVectorClass<N>::constructor(2)");
+  this->cwSet(value);
+}
+
+template <unsigned int N>
+uqFixedVectorClass<N>::uqFixedVectorClass(const uqBaseEnvironmentClass& env, double d1, double d2, const uqMapClass& map)
+  :
+  uqVectorClass(env,map)
+{
+  this->checkMap(map,"uqFixedVectorClass<N>::constructor(3), linspace");
+  for (unsigned int i = 0; i < N; ++i) {
+    double alpha = (double) i / ((double) N - 1.);
+    m_values[i] = (1.-alpha)*d1 + alpha*d2;
+  }
+}
+
+template <unsigned int N>
+uqFixedVectorClass<N>::uqFixedVectorClass(const uqFixedVectorClass<N>& v, double start, double end)
+  :
+  uqVectorClass(v.env(),v.map())
+{
+  for (unsigned int i = 0; i < N; ++i) {
+    double alpha = (double) i / ((double) N - 1.);
+    m_values[i] = (1.-alpha)*start + alpha*end;
+  }
+}
+
+template <unsigned int N>
+uqFixedVectorClass<N>::uqFixedVectorClass(const uqFixedVectorClass<N>& v)
+  :
+  uqVectorClass(v.env(),v.map())
+{
+  this->copy(v);
+}
+
+template <unsigned int N>
+uqFixedVectorClass<N>::~uqFixedVectorClass()
+{
+}
+
+template <unsigned int N>
+void
+uqFixedVectorClass<N>::checkMap(const uqMapClass& map, const char* where) const
+{
+  UQ_FATAL_TEST_MACRO((unsigned int) map.NumGlobalElements() != N,
+                      m_env.worldRank(),
+                      where,
+                      "map size differs from the compile time dimension");
+  UQ_FATAL_TEST_MACRO((unsigned int) map.NumMyElements() != N,
+                      m_env.worldRank(),
+                      where,
+                      "incompatible local vec size");
+  return;
+}
+
+template <unsigned int N>
+void
+uqFixedVectorClass<N>::copy(const uqFixedVectorClass<N>& src)
+{
+  this->uqVectorClass::copy(src);
+  for (unsigned int i = 0; i < N; ++i) {
+    m_values[i] = src.m_values[i];
+  }
+  return;
+}
+
+template <unsigned int N>
+uqFixedVectorClass<N>&
+uqFixedVectorClass<N>::operator=(const uqFixedVectorClass<N>& rhs)
+{
+  if (this != &rhs) this->copy(rhs);
+  return *this;
+}
+
+template <unsigned int N>
+uqFixedVectorClass<N>&
+uqFixedVectorClass<N>::operator*=(double a)
+{
+  for (unsigned int i = 0; i < N; ++i) {
+    m_values[i] *= a;
+  }
+  return *this;
+}
+
+template <unsigned int N>
+uqFixedVectorClass<N>&
+uqFixedVectorClass<N>::operator/=(double a)
+{
+  for (unsigned int i = 0; i < N; ++i) {
+    m_values[i] /= a;
+  }
+  return *this;
+}
+
+template <unsigned int N>
+uqFixedVectorClass<N>&
+uqFixedVectorClass<N>::operator*=(const uqFixedVectorClass<N>& rhs)
+{
+  for (unsigned int i = 0; i < N; ++i) {
+    m_values[i] *= rhs.m_values[i];
+  }
+  return *this;
+}
+
+template <unsigned int N>
+uqFixedVectorClass<N>&
+uqFixedVectorClass<N>::operator/=(const uqFixedVectorClass<N>& rhs)
+{
+  for (unsigned int i = 0; i < N; ++i) {
+    m_values[i] /= rhs.m_values[i];
+  }
+  return *this;
+}
+
+template <unsigned int N>
+uqFixedVectorClass<N>&
+uqFixedVectorClass<N>::operator+=(const uqFixedVectorClass<N>& rhs)
+{
+  for (unsigned int i = 0; i < N; ++i) {
+    m_values[i] += rhs.m_values[i];
+  }
+  return *this;
+}
+
+template <unsigned int N>
+uqFixedVectorClass<N>&
+uqFixedVectorClass<N>::operator-=(const uqFixedVectorClass<N>& rhs)
+{
+  for (unsigned int i = 0; i < N; ++i) {
+    m_values[i] -= rhs.m_values[i];
+  }
+  return *this;
+}
+
+template <unsigned int N>
+double
+uqFixedVectorClass<N>::norm2Sq() const
+{
+  double result = 0.;
+  for (unsigned int i = 0; i < N; ++i) {
+    result += m_values[i]*m_values[i];
+  }
+  return result;
+}
+
+template <unsigned int N>
+double
+uqFixedVectorClass<N>::norm2() const
+{
+  return std::sqrt(this->norm2Sq());
+}
+
+template <unsigned int N>
+double
+uqFixedVectorClass<N>::norm1() const
+{
+  double result = 0.;
+  for (unsigned int i = 0; i < N; ++i) {
+    result += std::fabs(m_values[i]);
+  }
+  return result;
+}
+
+template <unsigned int N>
+double
+uqFixedVectorClass<N>::normInf() const
+{
+  double result = 0.;
+  for (unsigned int i = 0; i < N; ++i) {
+    double aux = std::fabs(m_values[i]);
+    if (aux > result) result = aux;
+  }
+  return result;
+}
+
+template <unsigned int N>
+double
+uqFixedVectorClass<N>::sumOfComponents() const
+{
+  double result = 0.;
+  for (unsigned int i = 0; i < N; ++i) {
+    result += m_values[i];
+  }
+  return result;
+}
+
+template <unsigned int N>
+void
+uqFixedVectorClass<N>::cwSet(double value)
+{
+  for (unsigned int i = 0; i < N; ++i) {
+    m_values[i] = value;
+  }
+  return;
+}
+
+template <unsigned int N>
+void
+uqFixedVectorClass<N>::cwSetGaussian(double mean, double stdDev)
+{
+  for (unsigned int i = 0; i < N; ++i) {
+    m_values[i] = mean + m_env.rngObject()->gaussianSample(stdDev);
+  }
+  return;
+}
+
+template <unsigned int N>
+void
+uqFixedVectorClass<N>::cwSetGaussian(const uqFixedVectorClass<N>& meanVec, const uqFixedVectorClass<N>& stdDevVec)
+{
+  for (unsigned int i = 0; i < N; ++i) {
+    m_values[i] = meanVec[i] + m_env.rngObject()->gaussianSample(stdDevVec[i]);
+  }
+  return;
+}
+
+template <unsigned int N>
+void
+uqFixedVectorClass<N>::cwSetUniform(const uqFixedVectorClass<N>& aVec, const uqFixedVectorClass<N>& bVec)
+{
+  for (unsigned int i = 0; i < N; ++i) {
+    m_values[i] = aVec[i] + (bVec[i]-aVec[i])*m_env.rngObject()->uniformSample();
+  }
+  return;
+}
+
+template <unsigned int N>
+void
+uqFixedVectorClass<N>::cwSetBeta(const uqFixedVectorClass<N>& alpha, const uqFixedVectorClass<N>& beta)
+{
+  for (unsigned int i = 0; i < N; ++i) {
+    double tmpSample = m_env.rngObject()->betaSample(alpha[i],beta[i]);
+    if ((alpha[i] == 1. ) &&
+        (beta [i] == 0.1)) {
+      // Same workaround as in uqGslVectorClass::cwSetBeta()
+      while (tmpSample == 1.) {
+        tmpSample = m_env.rngObject()->betaSample(alpha[i],beta[i]);
+      }
+    }
+    m_values[i] = tmpSample;
+  }
+  return;
+}
+
+template <unsigned int N>
+void
+uqFixedVectorClass<N>::cwSetGamma(const uqFixedVectorClass<N>& a, const uqFixedVectorClass<N>& b)
+{
+  for (unsigned int i = 0; i < N; ++i) {
+    m_values[i] = m_env.rngObject()->gammaSample(a[i],b[i]);
+  }
+  return;
+}
+
+template <unsigned int N>
+void
+uqFixedVectorClass<N>::cwSetInverseGamma(const uqFixedVectorClass<N>& alpha, const uqFixedVectorClass<N>& beta)
+{
+  for (unsigned int i = 0; i < N; ++i) {
+    m_values[i] = 1./m_env.rngObject()->gammaSample(alpha[i],1./beta[i]);
+  }
+  return;
+}
+
+template <unsigned int N>
+void
+uqFixedVectorClass<N>::cwSetConcatenated(const uqFixedVectorClass<N>& v1, const uqFixedVectorClass<N>& v2)
+{
+  UQ_FATAL_TEST_MACRO(N != v1.sizeLocal() + v2.sizeLocal(),
+                      m_env.worldRank(),
+                      "uqFixedVectorClass<N>::cwSetConcatenated(1)",
+                      "incompatible vector sizes");
+  return;
+}
+
+template <unsigned int N>
+void
+uqFixedVectorClass<N>::cwSetConcatenated(const std::vector<const uqFixedVectorClass<N>* >& vecs)
+{
+  UQ_FATAL_TEST_MACRO(N != vecs.size()*N,
+                      m_env.worldRank(),
+                      "uqFixedVectorClass<N>::cwSetConcatenated(2)",
+                      "incompatible vector sizes");
+  if (vecs.size() == 1) this->copy(*(vecs[0]));
+  return;
+}
+
+template <unsigned int N>
+void
+uqFixedVectorClass<N>::cwSet(unsigned int initialPos, const uqFixedVectorClass<N>& vec)
+{
+  UQ_FATAL_TEST_MACRO(initialPos != 0,
+                      m_env.worldRank(),
+                      "uqFixedVectorClass<N>::cwSet()",
+                      "invalid initialPos");
+  this->copy(vec);
+  return;
+}
+
+template <unsigned int N>
+void
+uqFixedVectorClass<N>::cwExtract(unsigned int initialPos, uqFixedVectorClass<N>& vec) const
+{
+  UQ_FATAL_TEST_MACRO(initialPos != 0,
+                      m_env.worldRank(),
+                      "uqFixedVectorClass<N>::cwExtract()",
+                      "invalid initialPos");
+  vec.copy(*this);
+  return;
+}
+
+template <unsigned int N>
+void
+uqFixedVectorClass<N>::cwInvert()
+{
+  for (unsigned int i = 0; i < N; ++i) {
+    m_values[i] = 1./m_values[i];
+  }
+  return;
+}
+
+template <unsigned int N>
+void
+uqFixedVectorClass<N>::cwSqrt()
+{
+  for (unsigned int i = 0; i < N; ++i) {
+    m_values[i] = std::sqrt(m_values[i]);
+  }
+  return;
+}
+
+template <unsigned int N>
+void
+uqFixedVectorClass<N>::cwSetLinearCombination(double a, const uqFixedVectorClass<N>& x, double b, const uqFixedVectorClass<N>& y)
+{
+  for (unsigned int i = 0; i < N; ++i) {
+    m_values[i] = a*x.m_values[i] + b*y.m_values[i];
+  }
+  return;
+}
+
+template <unsigned int N>
+void
+uqFixedVectorClass<N>::matlabDiff(
+  unsigned int           firstPositionToStoreDiff,
+  double                 valueForRemainderPosition,
+  uqFixedVectorClass<N>& outputVec) const
+{
+  UQ_FATAL_TEST_MACRO(firstPositionToStoreDiff > 1,
+                      m_env.worldRank(),
+                      "uqFixedVectorClass<N>::matlabDiff()",
+                      "invalid firstPositionToStoreDiff");
+
+  for (unsigned int i = 0; i < (N-1); ++i) {
+    outputVec[firstPositionToStoreDiff+i] = m_values[i+1]-m_values[i];
+  }
+  if (firstPositionToStoreDiff == 0) {
+    outputVec[N-1] = valueForRemainderPosition;
+  }
+  else {
+    outputVec[0] = valueForRemainderPosition;
+  }
+
+  return;
+}
+
+template <unsigned int N>
+void
+uqFixedVectorClass<N>::matlabLinearInterpExtrap(
+  const uqFixedVectorClass<N>& x1Vec,
+  const uqFixedVectorClass<N>& y1Vec,
+  const uqFixedVectorClass<N>& x2Vec)
+{
+  UQ_FATAL_TEST_MACRO(N <= 1,
+                      m_env.worldRank(),
+                      "uqFixedVectorClass<N>::matlabLinearInterpExtrap()",
+                      "invalid 'x1' size");
+
+  for (unsigned int i = 1; i < N; ++i) { // Yes, '1'
+    UQ_FATAL_TEST_MACRO(x1Vec[i] <= x1Vec[i-1],
+                        m_env.worldRank(),
+                        "uqFixedVectorClass<N>::matlabLinearInterpExtrap()",
+                        "invalid 'x1' values");
+  }
+
+  for (unsigned int id2 = 0; id2 < N; ++id2) {
+    double x2 = x2Vec[id2];
+    unsigned int id1 = 0;
+    bool found1 = false;
+    for (id1 = 0; id1 < N; ++id1) {
+      if (x2 <= x1Vec[id1]) {
+        found1 = true;
+        break;
+      }
+    }
+    bool makeLinearModel = false;
+    double xa = 0.;
+    double xb = 0.;
+    double ya = 0.;
+    double yb = 0.;
+    if (found1 && (x2 == x1Vec[id1])) {
+      m_values[id2] = y1Vec[id1];
+    }
+    else if (x2 < x1Vec[0]) {
+      makeLinearModel = true;
+      xa = x1Vec[0];
+      xb = x1Vec[1];
+      ya = y1Vec[0];
+      yb = y1Vec[1];
+    }
+    else if (found1 == true) {
+      makeLinearModel = true;
+      xa = x1Vec[id1-1];
+      xb = x1Vec[id1];
+      ya = y1Vec[id1-1];
+      yb = y1Vec[id1];
+    }
+    else {
+      makeLinearModel = true;
+      xa = x1Vec[N-2];
+      xb = x1Vec[N-1];
+      ya = y1Vec[N-2];
+      yb = y1Vec[N-1];
+    }
+
+    if (makeLinearModel) {
+      double rate = (yb-ya)/(xb-xa);
+      m_values[id2] = ya + (x2-xa)*rate;
+    }
+  }
+
+  return;
+}
+
+template <unsigned int N>
+void
+uqFixedVectorClass<N>::sort()
+{
+  std::sort(m_values, m_values + N);
+  return;
+}
+
+template <unsigned int N>
+void
+uqFixedVectorClass<N>::mpiBcast(int srcRank, const uqMpiCommClass& bcastComm)
+{
+  // Filter out those nodes that should not participate
+  if (bcastComm.MyPID() < 0) return;
+
+  UQ_FATAL_TEST_MACRO((srcRank < 0) || (srcRank >= bcastComm.NumProc()),
+                      m_env.worldRank(),
+                      "uqFixedVectorClass<N>::mpiBcast()",
+                      "invalid srcRank");
+
+  // Every processor holds N components, so no size agreement needs to be checked
+  bcastComm.Bcast((void *) m_values, (int) N, uqRawValue_MPI_DOUBLE, srcRank,
+                  "uqFixedVectorClass<N>::mpiBcast()",
+                  "failed MPI.Bcast()");
+
+  return;
+}
+
+template <unsigned int N>
+void
+uqFixedVectorClass<N>::mpiAllReduce(uqRawType_MPI_Op mpiOperation, const uqMpiCommClass& opComm, uqFixedVectorClass<N>& resultVec) const
+{
+  // Filter out those nodes that should not participate
+  if (opComm.MyPID() < 0) return;
+
+  double srcValues[N];
+  for (unsigned int i = 0; i < N; ++i) {
+    srcValues[i] = m_values[i];
+  }
+  opComm.Allreduce((void *) srcValues, (void *) resultVec.m_values, (int) N, uqRawValue_MPI_DOUBLE, mpiOperation,
+                   "uqFixedVectorClass<N>::mpiAllReduce()",
+                   "failed MPI.Allreduce()");
+
+  return;
+}
+
+template <unsigned int N>
+void
+uqFixedVectorClass<N>::mpiAllQuantile(double probability, const uqMpiCommClass& opComm, uqFixedVectorClass<N>& resultVec) const
+{
+  // Filter out those nodes that should not participate
+  if (opComm.MyPID() < 0) return;
+
+  UQ_FATAL_TEST_MACRO((probability < 0.) || (1. < probability),
+                      m_env.worldRank(),
+                      "uqFixedVectorClass<N>::mpiAllQuantile()",
+                      "invalid input");
+
+  std::vector<double> vecOfDoubles(opComm.NumProc(),0.);
+  for (unsigned int i = 0; i < N; ++i) {
+    double auxDouble = m_values[i];
+    opComm.Gather((void *) &auxDouble, 1, uqRawValue_MPI_DOUBLE, (void *) &vecOfDoubles[0], (int) 1, uqRawValue_MPI_DOUBLE, 0,
+                  "uqFixedVectorClass<N>::mpiAllQuantile()",
+                  "failed MPI.Gather()");
+
+    std::sort(vecOfDoubles.begin(), vecOfDoubles.end());
+    double result = vecOfDoubles[(unsigned int)( probability*((double)(vecOfDoubles.size()-1)) )];
+
+    opComm.Bcast((void *) &result, (int) 1, uqRawValue_MPI_DOUBLE, 0,
+                 "uqFixedVectorClass<N>::mpiAllQuantile()",
+                 "failed MPI.Bcast()");
+
+    resultVec[i] = result;
+  }
+
+  return;
+}
+
+template <unsigned int N>
+void
+uqFixedVectorClass<N>::print(std::ostream& os) const
+{
+  std::ostream::fmtflags curr_fmt = os.flags();
+
+  if (m_printScientific) {
+    unsigned int savedPrecision = os.precision();
+    os.precision(16);
+    for (unsigned int i = 0; i < N; ++i) {
+      os << std::scientific << m_values[i];
+      if (m_printHorizontally) os << " ";
+      else                     os << std::endl;
+    }
+    os.precision(savedPrecision);
+  }
+  else {
+    for (unsigned int i = 0; i < N; ++i) {
+      os << std::dec << m_values[i];
+      if (m_printHorizontally) os << " ";
+      else                     os << std::endl;
+    }
+  }
+
+  os.flags(curr_fmt);
+  return;
+}
+
+template <unsigned int N>
+void
+uqFixedVectorClass<N>::subWriteContents(
+  const std::string&            varNamePrefix,
+  const std::string&            fileName,
+  const std::string&            fileType,
+  const std::set<unsigned int>& allowedSubEnvIds) const
+{
+  UQ_FATAL_TEST_MACRO(m_env.subRank() < 0,
+                      m_env.worldRank(),
+                      "uqFixedVectorClass<N>::subWriteContents()",
+                      "unexpected subRank");
+
+  uqFilePtrSetStruct filePtrSet;
+  if (m_env.openOutputFile(fileName,
+                           fileType, // "m or hdf"
+                           allowedSubEnvIds,
+                           false,
+                           filePtrSet)) {
+    *filePtrSet.ofsVar << varNamePrefix << "_sub" << m_env.subIdString() << " = zeros(" << N
+                       << ","                                                           << 1
+                       << ");"
+                       << std::endl;
+    *filePtrSet.ofsVar << varNamePrefix << "_sub" << m_env.subIdString() << " = [";
+
+    bool savedVectorPrintScientific   = this->getPrintScientific();
+    bool savedVectorPrintHorizontally = this->getPrintHorizontally();
+    this->setPrintScientific  (true);
+    this->setPrintHorizontally(false);
+    *filePtrSet.ofsVar << *this;
+    this->setPrintHorizontally(savedVectorPrintHorizontally);
+    this->setPrintScientific  (savedVectorPrintScientific);
+
+    *filePtrSet.ofsVar << "];\n";
+
+    m_env.closeFile(filePtrSet,fileType);
+  }
+
+  return;
+}
+
+template <unsigned int N>
+void
+uqFixedVectorClass<N>::subReadContents(
+  const std::string&            fileName,
+  const std::string&            fileType,
+  const std::set<unsigned int>& allowedSubEnvIds)
+{
+  UQ_FATAL_TEST_MACRO(m_env.subRank() < 0,
+                      m_env.worldRank(),
+                      "uqFixedVectorClass<N>::subReadContents()",
+                      "unexpected subRank");
+
+  uqFilePtrSetStruct filePtrSet;
+  if (m_env.openInputFile(fileName,
+                          fileType, // "m or hdf"
+                          allowedSubEnvIds,
+                          filePtrSet)) {
+    // Read the 'prefix_subN = zeros(n,1);' line and check its sizes
+    std::string tmpString;
+    *filePtrSet.ifsVar >> tmpString;
+    *filePtrSet.ifsVar >> tmpString;
+    UQ_FATAL_TEST_MACRO(tmpString != "=",
+                        m_env.worldRank(),
+                        "uqFixedVectorClass<N>::subReadContents()",
+                        "string should be the '=' sign");
+    *filePtrSet.ifsVar >> tmpString;
+    std::string::size_type posOfOpen  = tmpString.find('(');
+    std::string::size_type posOfComma = tmpString.find(',');
+    std::string::size_type posOfClose = tmpString.find(')');
+    UQ_FATAL_TEST_MACRO((posOfOpen  == std::string::npos) ||
+                        (posOfComma == std::string::npos) ||
+                        (posOfClose == std::string::npos),
+                        m_env.worldRank(),
+                        "uqFixedVectorClass<N>::subReadContents()",
+                        "sizes not found in first line of file");
+    unsigned int sizeOfVecInFile = (unsigned int) strtod(tmpString.substr(posOfOpen +1,posOfComma-posOfOpen -1).c_str(),NULL);
+    unsigned int numParamsInFile = (unsigned int) strtod(tmpString.substr(posOfComma+1,posOfClose-posOfComma-1).c_str(),NULL);
+    UQ_FATAL_TEST_MACRO(sizeOfVecInFile < N,
+                        m_env.worldRank(),
+                        "uqFixedVectorClass<N>::subReadContents()",
+                        "size of vec in file is not big enough");
+    UQ_FATAL_TEST_MACRO(numParamsInFile != 1,
+                        m_env.worldRank(),
+                        "uqFixedVectorClass<N>::subReadContents()",
+                        "number of parameters of vec in file is different than number of parameters in this vec object");
+
+    // Read the 'prefix_subN = [' tokens, then the values
+    *filePtrSet.ifsVar >> tmpString;
+    *filePtrSet.ifsVar >> tmpString;
+    UQ_FATAL_TEST_MACRO(tmpString != "=",
+                        m_env.worldRank(),
+                        "uqFixedVectorClass<N>::subReadContents()",
+                        "in core 0, string should be the '=' sign");
+    std::streampos tmpPos = filePtrSet.ifsVar->tellg();
+    filePtrSet.ifsVar->seekg(tmpPos+(std::streampos)2);
+    for (unsigned int i = 0; i < N; ++i) {
+      *filePtrSet.ifsVar >> m_values[i];
+    }
+
+    m_env.closeFile(filePtrSet,fileType);
+  }
+
+  return;
+}
+
+template <unsigned int N>
+bool
+uqFixedVectorClass<N>::atLeastOneComponentSmallerThan(const uqFixedVectorClass<N>& rhs) const
+{
+  for (unsigned int i = 0; i < N; ++i) {
+    if (m_values[i] < rhs[i]) return true;
+  }
+  return false;
+}
+
+template <unsigned int N>
+bool
+uqFixedVectorClass<N>::atLeastOneComponentBiggerThan(const uqFixedVectorClass<N>& rhs) const
+{
+  for (unsigned int i = 0; i < N; ++i) {
+    if (m_values[i] > rhs[i]) return true;
+  }
+  return false;
+}
+
+template <unsigned int N>
+bool
+uqFixedVectorClass<N>::atLeastOneComponentSmallerOrEqualThan(const uqFixedVectorClass<N>& rhs) const
+{
+  for (unsigned int i = 0; i < N; ++i) {
+    if (m_values[i] <= rhs[i]) return true;
+  }
+  return false;
+}
+
+template <unsigned int N>
+bool
+uqFixedVectorClass<N>::atLeastOneComponentBiggerOrEqualThan(const uqFixedVectorClass<N>& rhs) const
+{
+  for (unsigned int i = 0; i < N; ++i) {
+    if (m_values[i] >= rhs[i]) return true;
+  }
+  return false;
+}
+
+template <unsigned int N>
+double
+uqFixedVectorClass<N>::getMaxValue() const
+{
+  return m_values[this->getMaxValueIndex()];
+}
+
+template <unsigned int N>
+double
+uqFixedVectorClass<N>::getMinValue() const
+{
+  return m_values[this->getMinValueIndex()];
+}
+
+template <unsigned int N>
+int
+uqFixedVectorClass<N>::getMaxValueIndex() const
+{
+  return std::max_element(m_values, m_values + N) - m_values;
+}
+
+template <unsigned int N>
+int
+uqFixedVectorClass<N>::getMinValueIndex() const
+{
+  return std::min_element(m_values, m_values + N) - m_values;
+}
+
+template <unsigned int N>
+void
+uqFixedVectorClass<N>::getMaxValueAndIndex( double& max_value, int& max_value_index )
+{
+  max_value_index = this->getMaxValueIndex();
+  max_value = m_values[max_value_index];
+  return;
+}
+
+template <unsigned int N>
+void
+uqFixedVectorClass<N>::getMinValueAndIndex( double& min_value, int& min_value_index )
+{
+  min_value_index = this->getMinValueIndex();
+  min_value = m_values[min_value_index];
+  return;
+}
+
+template <unsigned int N>
+uqFixedVectorClass<N>
+uqFixedVectorClass<N>::abs() const
+{
+  uqFixedVectorClass<N> abs_of_this_vec(*this);
+  for (unsigned int i = 0; i < N; ++i) {
+    abs_of_this_vec[i] = std::fabs(m_values[i]);
+  }
+  return abs_of_this_vec;
+}
+
+template <unsigned int N>
+std::ostream&
+operator<<(std::ostream& os, const uqFixedVectorClass<N>& obj)
+{
+  obj.print(os);
+
+  return os;
+}
+
+template <unsigned int N>
+uqFixedVectorClass<N> operator/(double a, const uqFixedVectorClass<N>& x)
+{
+  uqFixedVectorClass<N> answer(x);
+  answer.cwInvert();
+  answer *= a;
+
+  return answer;
+}
+
+template <unsigned int N>
+uqFixedVectorClass<N> operator/(const uqFixedVectorClass<N>& x, const uqFixedVectorClass<N>& y)
+{
+  uqFixedVectorClass<N> answer(x);
+  answer /= y;
+
+  return answer;
+}
+
+template <unsigned int N>
+uqFixedVectorClass<N> operator*(double a, const uqFixedVectorClass<N>& x)
+{
+  uqFixedVectorClass<N> answer(x);
+  answer *= a;
+
+  return answer;
+}
+
+template <unsigned int N>
+uqFixedVectorClass<N> operator*(const uqFixedVectorClass<N>& x, const uqFixedVectorClass<N>& y)
+{
+  uqFixedVectorClass<N> answer(x);
+  answer *= y;
+
+  return answer;
+}
+
+template <unsigned int N>
+double scalarProduct(const uqFixedVectorClass<N>& x, const uqFixedVectorClass<N>& y)
+{
+  double result = 0.;
+  for (unsigned int i = 0; i < N; ++i) {
+    result += x[i]*y[i];
+  }
+
+  return result;
+}
+
+template <unsigned int N>
+uqFixedVectorClass<N> operator+(const uqFixedVectorClass<N>& x, const uqFixedVectorClass<N>& y)
+{
+  uqFixedVectorClass<N> answer(x);
+  answer += y;
+
+  return answer;
+}
+
+template <unsigned int N>
+uqFixedVectorClass<N> operator-(const uqFixedVectorClass<N>& x, const uqFixedVectorClass<N>& y)
+{
+  uqFixedVectorClass<N> answer(x);
+  answer -= y;
+
+  return answer;
+}
+
+template <unsigned int N>
+bool
+operator==(const uqFixedVectorClass<N>& lhs, const uqFixedVectorClass<N>& rhs)
+{
+  for (unsigned int i = 0; i < N; ++i) {
+    if (lhs[i] != rhs[i]) return false;
+  }
+
+  return true;
+}
+
+#endif // __UQ_FIXED_VECTOR_H__
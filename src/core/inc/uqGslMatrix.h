@@ -188,6 +188,14 @@ public:
   //! This function multiplies \c this matrix by vector \c x and returns the resulting vector.
   uqGslVectorClass  multiply                  (const uqGslVectorClass& x) const;
 
+  //! This function multiplies \c this matrix by vector \c x and stores the resulting vector in \c y.
+  /*! No temporary vector is created; \c y must not be \c x.*/
+  void              multiply                  (const uqGslVectorClass& x, uqGslVectorClass& y) const;
+
+  //! This function sets \c this matrix to scale * \c this + alpha * x y^T in a single pass.
+  /*! It is equivalent to <tt>A = scale*A + alpha*matrixProduct(x,y)</tt>, but creates no temporary matrices.*/
+  void              rankOneUpdate             (double scale, double alpha, const uqGslVectorClass& x, const uqGslVectorClass& y);
+
   //! This function calculates the inverse of \c this matrix and multiplies it with vector \c b. 
   /*! It calls void uqGslMatrixClass::invertMultiply(const uqGslVectorClass& b, uqGslVectorClass& x) internally.*/
   uqGslVectorClass  invertMultiply            (const uqGslVectorClass& b) const;
@@ -378,9 +386,6 @@ private:
   //! In this function resets the LU decomposition of \c this matrix, as well as deletes the private member pointers, if existing.
   void              resetLU                   ();
 	
-  //! This function multiplies \c this matrix by vector \c x and stores the resulting vector in \c y.
-  void              multiply                  (const uqGslVectorClass& x, uqGslVectorClass& y) const;
-        
   //! This function factorizes the M-by-N matrix A into the singular value decomposition A = U S V^T for M >= N. On output the matrix A is replaced by U.
   int               internalSvd               () const;
 
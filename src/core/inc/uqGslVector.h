@@ -173,6 +173,9 @@ public:
   
   //! This function returns component-wise the square-root of \c this.  
   void         cwSqrt           ();
+
+  //! This function sets \c this to a*x + b*y in a single pass, without temporary vectors; \c x or \c y may be \c this.
+  void         cwSetLinearCombination(double a, const uqGslVectorClass& x, double b, const uqGslVectorClass& y);
   //@}
 
 //! @name I/O methods.
@@ -123,6 +123,9 @@ private:
   
   //! Number of elements owned by the calling processor.
   int            m_numMyElements;
+
+  //! Global index of the first element owned by the calling processor.
+  int            m_minMyGID;
 #endif
 };
 
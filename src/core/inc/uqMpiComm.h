@@ -136,6 +136,26 @@ public:
   
   //! @name Methods Overridden from Comm
   //@{ 
+  //! Gathers values from each process and distributes the collection to all processes.
+  /*!\param sendbuf starting address of send buffer
+   * \param sendcnt number of elements in send buffer
+   * \param sendtype data type of send buffer elements
+   * \param recvcount number of elements received from any single process
+   * \param recvtype data type of recv buffer elements
+   * \param recvbuf (output) address of receive buffer */
+  void               Allgather(void *sendbuf, int sendcnt, uqRawType_MPI_Datatype sendtype,
+                               void *recvbuf, int recvcount, uqRawType_MPI_Datatype recvtype,
+                               const char* whereMsg, const char* whatMsg) const;
+
+  //! Gathers into specified locations from all processes, and distributes the collection to all processes.
+  /*!\param recvcnts integer array (of length group size) containing the number of elements
+   * that are received from each process
+   * \param displs integer array (of length group size). Entry i specifies the displacement
+   * relative to recvbuf at which to place the incoming data from process i */
+  void               Allgatherv(void *sendbuf, int sendcnt, uqRawType_MPI_Datatype sendtype,
+                                void *recvbuf, int *recvcnts, int *displs, uqRawType_MPI_Datatype recvtype,
+                                const char* whereMsg, const char* whatMsg) const;
+
   //! Combines values from all processes and distributes the result back to all processes  
   /*! \param sendbuf starting address of send buffer
    * \param count number of elements in send buffer
@@ -144,6 +164,20 @@ public:
    * \param recvbuf (output) starting address of receive buffer*/
   void               Allreduce(void* sendbuf, void* recvbuf, int count, uqRawType_MPI_Datatype datatype, 
 			       uqRawType_MPI_Op op, const char* whereMsg, const char* whatMsg) const;
+
+  //! Sends \c sendcnt elements to each process and receives \c recvcount elements from each process.
+  void               Alltoall (void *sendbuf, int sendcnt, uqRawType_MPI_Datatype sendtype,
+                               void *recvbuf, int recvcount, uqRawType_MPI_Datatype recvtype,
+                               const char* whereMsg, const char* whatMsg) const;
+
+  //! Sends a different number of elements to each process, and receives a different number of elements from each process.
+  /*!\param sendcnts number of elements sent to each process
+   * \param sdispls displacements, relative to sendbuf, of the elements sent to each process
+   * \param recvcnts number of elements received from each process
+   * \param rdispls displacements, relative to recvbuf, at which to place the elements received from each process */
+  void               Alltoallv(void *sendbuf, int *sendcnts, int *sdispls, uqRawType_MPI_Datatype sendtype,
+                               void *recvbuf, int *recvcnts, int *rdispls, uqRawType_MPI_Datatype recvtype,
+                               const char* whereMsg, const char* whatMsg) const;
 			       
   //! Pause every process in *this communicator until all the processes reach this point. 
   /*! Blocks the caller until all processes in the communicator have called it; that is, 
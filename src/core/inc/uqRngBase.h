@@ -84,6 +84,15 @@ public:
   //! Samples a value from a Gamma distribution.
   virtual double gammaSample   (double a, double b)        const = 0;
 
+  //@}
+
+    //! @name I/O methods
+  //@{ 
+  //! Writes the internal state of the generator to \c os, so that readState() can later resume the same stream of samples.
+  virtual void   writeState    (std::ostream& os)          const = 0;
+
+  //! Restores a state previously written with writeState().
+  virtual void   readState     (std::istream& is)          const = 0;
   //@}
 protected:
   //! Seed.
@@ -103,6 +103,12 @@ public:
    * for various types of inverse scale (aka rate) parameters. Uses  
    * boost::math::gamma_distribution<double>  gamma_dist(a,b). Support (domain): [0,infinity).*/
   double   gammaSample   (double a, double b)        const;
+
+  //! Writes the state of \c m_rng to \c os, with the stream operator of boost::mt19937.
+  void     writeState    (std::ostream& os)          const;
+
+  //! Restores a state previously written with writeState().
+  void     readState     (std::istream& is)          const;
 	
 private:  
   //! Random number generator from class boost::mt19937. 
@@ -110,8 +116,9 @@ private:
    *  as it has not been initialized yet. mt19937 has length cycle of 2^(19937)-1, requires 
    * approximately 625*sizeof(uint32_t) of memory, has relatively high speed (93% of the 
    * fastest available in Boost library), and provides good uniform distribution in up to 
-   * 623 dimensions. */
-  boost::mt19937 m_rng; // it cannot be static, as it is not initialized yet
+   * 623 dimensions. All samples are drawn from this one engine, so that its state
+   * is the complete state of the generator. */
+  mutable boost::mt19937 m_rng; // it cannot be static, as it is not initialized yet
 };
 
 #endif // __UQ_RNG_BOOST_H__
@@ -107,6 +107,14 @@ public:
   //! GSL random number generator.
   const gsl_rng* rng           () const;
 
+  //! Writes the name, size and raw bytes of the state of \c m_rng to \c os.
+  /*! Uses gsl_rng_state() and gsl_rng_size(); the bytes are written in hexadecimal, so the
+   * output can be embedded in text files.*/
+  void     writeState    (std::ostream& os)          const;
+
+  //! Restores a state previously written with writeState(); the generator types must match.
+  void     readState     (std::istream& is)          const;
+
 protected:
   //! GSL random number generator. 
   /*! It is chosen, in the constructor, to be of type gsl_rng_ranlxd2. */
@@ -124,7 +124,7 @@ public:
   //! Returns the column dimension of \c this matrix.
   unsigned int      numCols                () const;
   
-  //! Returns a pointer to the first element of \c this matrix.
+  //! Returns a pointer to the first element of \c this matrix; cached factorizations are discarded.
   double*           values                 () ;//added by Kemelli on 12/04/12
   
   //! Returns the stride between the columns of this matrix in memory. 
@@ -193,10 +193,17 @@ public:
   
   //! This function multiplies \c this matrix by vector \c x and returns a vector.
   uqTeuchosVectorClass  multiply                  (const uqTeuchosVectorClass& x) const;
+
+  //! This function multiplies \c this matrix by vector \c x and stores the resulting vector in \c y.
+  /*! No temporary vector is created; \c y must not be \c x.*/
+  void                  multiply                  (const uqTeuchosVectorClass& x, uqTeuchosVectorClass& y) const;
+
+  //! This function sets \c this matrix to scale * \c this + alpha * x y^T in a single pass, without temporary matrices.
+  void                  rankOneUpdate             (double scale, double alpha, const uqTeuchosVectorClass& x, const uqTeuchosVectorClass& y);
   
   //! This function calculates the inverse of \c this matrix, multiplies it with vector \c b and stores the result in vector \c x.
-  /*! It checks for a previous LU decomposition of \c this matrix and does not recompute it
-   if private attribute m_LU != NULL .*/
+  /*! Symmetric positive definite matrices are solved with their Cholesky factor, other matrices with
+   their LU decomposition; either factorization is computed once and kept until \c this matrix changes.*/
   void                  invertMultiply            (const uqTeuchosVectorClass& b, uqTeuchosVectorClass& x) const;
   
   //! This function calculates the inverse of \c this matrix and multiplies it with vector \c b. 
@@ -204,7 +211,7 @@ public:
   uqTeuchosVectorClass  invertMultiply            (const uqTeuchosVectorClass& b) const;
   
   //! This function calculates the inverse of \c this matrix, multiplies it with matrix \c B and stores the result in matrix \c X.
-  /*! It checks for a previous LU decomposition of \c this matrix and does not recompute it if private attribute \c m_LU != NULL .*/
+  /*! All columns of \c B are solved at once, with the factorization kept by \c this matrix (Cholesky or LU).*/
   void                  invertMultiply            (const uqTeuchosMatrixClass& B, uqTeuchosMatrixClass& X) const;
   
   //! This function calculates the inverse of \c this matrix and multiplies it with matrix \c B.
@@ -338,9 +345,6 @@ private:
   
   //! In this function resets the LU decomposition of \c this matrix, as well as deletes the private member pointers, if existing.	
   void              resetLU                   ();
-  
-  //! This function multiplies \c this matrix by vector \c x and stores the resulting vector in \c y.
-  void              multiply                  (const uqTeuchosVectorClass& x, uqTeuchosVectorClass& y) const;
 	
   //! This function factorizes the M-by-N matrix A into the singular value decomposition A = U S V^T for M >= N. On output the matrix A is replaced by U.	
   /*! This function uses Teuchos GESVD computes the singular value decomposition (SVD) of a real  M-by-N matrix A, optionally computing 
@@ -351,6 +355,20 @@ private:
    * of U and V are the left and right singular vectors of A. Note that the routine returns V**T, not V. */
   int               internalSvd               () const;
 
+  //! Computes (once per mutation) the Cholesky factor of \c this matrix, which is kept in \c m_chol.
+  /*! Returns \c true if \c this matrix is symmetric and positive definite, so that the LAPACK SPD
+   * routines (POTRS) may be used in place of the general LU ones. */
+  bool              internalChol              () const;
+
+  //! Computes (once per mutation) the LU decomposition of \c this matrix, which is kept in \c m_LU and \c v_pivoting.
+  void              internalLU                () const;
+
+  //! Computes (once per mutation) the eigenvalues, and optionally the eigenvectors, of \c this real symmetric matrix.
+  void              internalEigen             (bool withVectors) const;
+
+  //! Returns a LAPACK workspace of at least \c size doubles, reusing the one kept with \c this matrix.
+  double*           workspace                 (int size) const;
+
   //! Teuchos matrix, also referred to as \c this matrix.
   Teuchos::SerialDenseMatrix<int,double> m_mat;
   
@@ -391,6 +409,24 @@ private:
   
   //! Indicates whether or not \c this matrix is singular.
   mutable bool              m_isSingular;
+
+  //! Upper Cholesky factor U of \c this matrix (A = U^T U), if \c m_cholState is 1.
+  mutable Teuchos::SerialDenseMatrix<int,double> m_chol;
+
+  //! State of \c m_chol: -1 if not yet attempted, 0 if \c this matrix is not SPD, 1 if available.
+  mutable int               m_cholState;
+
+  //! Eigenvalues of \c this (symmetric) matrix, in ascending order; empty if not yet computed.
+  mutable std::vector<double> m_eigenValues;
+
+  //! Eigenvectors of \c this (symmetric) matrix, stored by column, if \c m_hasEigenVectors.
+  mutable Teuchos::SerialDenseMatrix<int,double> m_eigenVectors;
+
+  //! Indicates whether or not \c m_eigenVectors is available.
+  mutable bool              m_hasEigenVectors;
+
+  //! LAPACK workspace, kept across calls in order to avoid one allocation per factorization.
+  mutable std::vector<double> m_lapackWork;
 };
 
 uqTeuchosMatrixClass operator*       (double a,                    const uqTeuchosMatrixClass& mat);
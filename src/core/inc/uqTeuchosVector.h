@@ -200,6 +200,9 @@ public:
   
   //! Component-wise sets the square-root of \c this.  
   void         cwSqrt();
+
+  //! Component-wise sets \c this to a*x + b*y in a single pass; \c x or \c y may be \c this.
+  void         cwSetLinearCombination(double a, const uqTeuchosVectorClass& x, double b, const uqTeuchosVectorClass& y);
   
   //! This function concatenates vectors \c v1 and \c v2 into \c this vector.
   void         cwSetConcatenated(const uqTeuchosVectorClass& v1, const uqTeuchosVectorClass& v2);
@@ -0,0 +1,174 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+// 
+// QUESO - a library to support the Quantification of Uncertainty
+// for Estimation, Simulation and Optimization
+//
+// Copyright (C) 2008,2009,2010,2011,2012,2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor, 
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+// 
+// $Id$
+//
+//--------------------------------------------------------------------------
+
+#ifndef __UQ_TRACER_H__
+#define __UQ_TRACER_H__
+
+#include <uqDefines.h>
+#include <sys/time.h>
+#include <time.h>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Ids of the events instrumented inside QUESO. Further events can be
+// registered by applications through uqTracerClass::eventId().
+#define UQ_TRACE_MH_CHAIN_ID           0
+#define UQ_TRACE_MH_CANDIDATE_ID       1
+#define UQ_TRACE_MH_TARGET_ID          2
+#define UQ_TRACE_MH_ALPHA_ID           3
+#define UQ_TRACE_MH_DR_ID              4
+#define UQ_TRACE_MH_AM_ID              5
+#define UQ_TRACE_MH_OUT_OF_SUPPORT_ID  6
+#define UQ_TRACE_SYNC_BCAST_ID         7
+#define UQ_TRACE_IO_WRITE_ID           8
+#define UQ_TRACE_MH_DR_ALPHA_ID        9
+#define UQ_TRACE_ML_STEP_01_ID        10 // Steps 01 to 11 use ids 10 to 20
+#define UQ_TRACE_NUM_BUILTIN_IDS      21
+
+class uqMpiCommClass;
+
+//! Monotonic time stamp in nanoseconds.
+/*! On Linux, CLOCK_MONOTONIC is served from user space (vDSO) out of the TSC,
+ *  so a call costs a few tens of nanoseconds and needs no calibration. */
+inline unsigned long long
+uqTracerNow()
+{
+#ifdef CLOCK_MONOTONIC
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ((unsigned long long) ts.tv_sec)*1000000000ULL + (unsigned long long) ts.tv_nsec;
+#else
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  return ((unsigned long long) tv.tv_sec)*1000000000ULL + ((unsigned long long) tv.tv_usec)*1000ULL;
+#endif
+}
+
+/*! \file uqTracer.h
+    \brief Low overhead timers and counters for the hot paths of QUESO.
+*/
+
+/*! \class uqTracerClass
+ *  \brief Collects named timed events and counters of one MPI process.
+ *
+ *  Each environment owns one tracer. When disabled (the default, see option
+ *  'env_traceFileName'), start() and stop() reduce to one test of a boolean.
+ *  When enabled, each event is appended to an in-memory buffer (up to
+ *  'env_traceMaxEvents' of them; later ones only feed the per-event totals),
+ *  and nothing is written until the environment is destroyed, when the
+ *  buffer is exported in Chrome trace (JSON) format, a summary per event
+ *  name is printed, and so is a summary over all processes of the full
+ *  communicator. */
+class uqTracerClass
+{
+public:
+  //! @name Constructor/Destructor methods
+  //@{
+  //! Default constructor: the tracer starts disabled.
+  uqTracerClass();
+
+  //! Destructor
+ ~uqTracerClass();
+  //@}
+
+  //! @name Set methods
+  //@{
+  //! Enables the tracer. Events are tagged with 'pid' = full rank and 'tid' = sub environment id.
+  void               enable    (int fullRank, unsigned int subId, unsigned int maxNumEvents);
+  //@}
+
+  //! @name Instrumentation methods
+  //@{
+  bool               enabled   () const { return m_enabled; }
+
+  //! Id of event 'name', registering it if needed.
+  unsigned int       eventId   (const std::string& name);
+
+  //! Name of event 'id'.
+  const std::string& eventName (unsigned int id) const;
+
+  //! Starting time stamp of an event; 0 if the tracer is disabled.
+  unsigned long long start     () const { return (m_enabled ? uqTracerNow() : 0ULL); }
+
+  //! Ends event 'id' started at 'startTime'.
+  void               stop      (unsigned int id, unsigned long long startTime)
+  {
+    if (m_enabled) this->record(id,startTime,uqTracerNow());
+  }
+
+  //! Adds 'value' to counter 'id'.
+  void               count     (unsigned int id, double value)
+  {
+    if (m_enabled) this->addToCounter(id,value);
+  }
+  //@}
+
+  //! @name I/O methods
+  //@{
+  //! Writes all buffered events and the final counter values in Chrome trace format.
+  void               writeChromeTrace(std::ostream& os) const;
+
+  //! Prints, per event name, number of calls and total/min/max/average times, and counter values.
+  void               printSummary    (std::ostream& os) const;
+
+  //! Prints, per event name, the min/max/mean over the processes of \c fullComm of the number of calls, total time and counter value.
+  /*! Collective on \c fullComm. Events registered by applications are included only if all processes
+   *  registered them in the same order. Only process 0 of \c fullComm writes, to \c os if not NULL. */
+  void               printFullSummary(const uqMpiCommClass& fullComm, std::ostream* os) const;
+  //@}
+
+private:
+  struct uqTraceEventStruct {
+    unsigned int       id;
+    unsigned long long startTime;
+    unsigned long long endTime;
+  };
+
+  void               record      (unsigned int id, unsigned long long startTime, unsigned long long endTime);
+  void               addToCounter(unsigned int id, double value);
+  void               grow        (unsigned int id);
+
+  bool                            m_enabled;
+  int                             m_fullRank;
+  unsigned int                    m_subId;
+  unsigned int                    m_maxNumEvents;
+  unsigned long long              m_originTime;
+  unsigned long long              m_numDroppedEvents;
+
+  std::vector<std::string>        m_names;
+  std::vector<uqTraceEventStruct> m_events;
+  std::vector<unsigned long long> m_numCalls;
+  std::vector<unsigned long long> m_totalTimes;
+  std::vector<unsigned long long> m_minTimes;
+  std::vector<unsigned long long> m_maxTimes;
+  std::vector<double>             m_counters;
+  std::vector<bool>               m_isCounter;
+};
+
+#endif // __UQ_TRACER_H__
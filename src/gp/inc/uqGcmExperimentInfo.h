@@ -108,6 +108,8 @@ public:
 
 	std::vector<uqVectorSpaceClass<D_V,D_M>* >        m_Rmat_v_i_spaces; // to be deleted on destructor
 	std::vector<D_M* >                                m_Rmat_v_is;       // to be deleted on destructor
+	std::vector<P_V* >                                m_Rmat_v_is_rhoKeys;     // to be deleted on destructor
+	std::vector<double>                               m_Smat_v_is_lambdaVKeys;
 
 	std::vector<uqVectorSpaceClass<D_V,D_M>* >        m_Smat_v_i_spaces; // to be deleted on destructor
 	std::vector<D_M* >                                m_Smat_v_is;       // to be deleted on destructor
@@ -191,6 +193,8 @@ uqGcmExperimentInfoClass<S_V,S_M,D_V,D_M,P_V,P_M>::uqGcmExperimentInfoClass(
   m_Imat_v_is                 (m_paper_F, (D_M*) NULL),                         // to be deleted on destructor
   m_Rmat_v_i_spaces           (m_paper_F, (uqVectorSpaceClass<D_V,D_M>*) NULL), // to be deleted on destructor
   m_Rmat_v_is                 (m_paper_F, (D_M*) NULL),                         // to be deleted on destructor
+  m_Rmat_v_is_rhoKeys         (m_paper_F, (P_V*) NULL),                         // to be deleted on destructor
+  m_Smat_v_is_lambdaVKeys     (m_paper_F, -INFINITY),
   m_Smat_v_i_spaces           (m_paper_F, (uqVectorSpaceClass<D_V,D_M>*) NULL), // to be deleted on destructor
   m_Smat_v_is                 (m_paper_F, (D_M*) NULL),                         // to be deleted on destructor
   m_Smat_v                    (m_v_space.zeroVector()),
@@ -491,6 +495,8 @@ uqGcmExperimentInfoClass<S_V,S_M,D_V,D_M,P_V,P_M>::~uqGcmExperimentInfoClass()
     delete m_Smat_v_i_spaces[i]; // to be deleted on destructor
     m_Smat_v_i_spaces[i] = NULL;
 
+    delete m_Rmat_v_is_rhoKeys[i]; // to be deleted on destructor
+    m_Rmat_v_is_rhoKeys[i] = NULL;
     delete m_Rmat_v_is[i]; // to be deleted on destructor
     m_Rmat_v_is[i] = NULL;
     delete m_Rmat_v_i_spaces[i]; // to be deleted on destructor
@@ -52,6 +52,13 @@ public:
 	std::vector<D_M* >                         m_Smat_u_is;       // to be deleted on destructor
 	std::vector<D_M* >                         m_Rmat_uw_is;      // to be deleted on destructor
 	std::vector<D_M* >                         m_Smat_uw_is;      // to be deleted on destructor
+	std::vector<P_V* >                         m_Rmat_u_is_rhoKeys;    // to be deleted on destructor
+	std::vector<P_V* >                         m_Rmat_u_is_thetaKeys;  // to be deleted on destructor
+	std::vector<double>                        m_Smat_u_is_lambdaWKeys;
+	std::vector<double>                        m_Smat_u_is_lambdaSKeys;
+	std::vector<P_V* >                         m_Rmat_uw_is_rhoKeys;   // to be deleted on destructor
+	std::vector<P_V* >                         m_Rmat_uw_is_thetaKeys; // to be deleted on destructor
+	std::vector<double>                        m_Smat_uw_is_lambdaWKeys;
         D_M                                        m_Smat_uw; // Computed with 'experimentlModel' and 'simulationModel'
         D_M                                        m_Smat_uw_t;
 
@@ -131,6 +138,13 @@ uqGcmJointInfoClass<S_V,S_M,D_V,D_M,P_V,P_M,Q_V,Q_M>::uqGcmJointInfoClass(
   m_Smat_u_is                                      (s.m_paper_p_eta, (D_M*) NULL), // to be deleted on destructor
   m_Rmat_uw_is                                     (s.m_paper_p_eta, (D_M*) NULL), // to be deleted on destructor
   m_Smat_uw_is                                     (s.m_paper_p_eta, (D_M*) NULL), // to be deleted on destructor
+  m_Rmat_u_is_rhoKeys                              (s.m_paper_p_eta, (P_V*) NULL), // to be deleted on destructor
+  m_Rmat_u_is_thetaKeys                            (s.m_paper_p_eta, (P_V*) NULL), // to be deleted on destructor
+  m_Smat_u_is_lambdaWKeys                          (s.m_paper_p_eta, -INFINITY),
+  m_Smat_u_is_lambdaSKeys                          (s.m_paper_p_eta, -INFINITY),
+  m_Rmat_uw_is_rhoKeys                             (s.m_paper_p_eta, (P_V*) NULL), // to be deleted on destructor
+  m_Rmat_uw_is_thetaKeys                           (s.m_paper_p_eta, (P_V*) NULL), // to be deleted on destructor
+  m_Smat_uw_is_lambdaWKeys                         (s.m_paper_p_eta, -INFINITY),
   m_Smat_uw                                        (m_env,  m_u_space.map(),s.m_w_size),
   m_Smat_uw_t                                      (m_env,s.m_w_space.map(),  m_u_size),
   m_Rmat_u_hat_u_asterisk_is                       (s.m_paper_p_eta, (D_M*) NULL), // to be deleted on destructor
@@ -852,6 +866,10 @@ uqGcmJointInfoClass<S_V,S_M,D_V,D_M,P_V,P_M,Q_V,Q_M>::~uqGcmJointInfoClass()
     m_Smat_uw_is[i] = NULL;
     delete m_Rmat_uw_is[i]; // to be deleted on destructor
     m_Rmat_uw_is[i] = NULL;
+    delete m_Rmat_uw_is_thetaKeys[i]; // to be deleted on destructor
+    m_Rmat_uw_is_thetaKeys[i] = NULL;
+    delete m_Rmat_uw_is_rhoKeys[i]; // to be deleted on destructor
+    m_Rmat_uw_is_rhoKeys[i] = NULL;
   }
 
   for (unsigned int i = 0; i < m_Smat_u_is.size(); ++i) {
@@ -859,6 +877,10 @@ uqGcmJointInfoClass<S_V,S_M,D_V,D_M,P_V,P_M,Q_V,Q_M>::~uqGcmJointInfoClass()
     m_Smat_u_is[i] = NULL;
     delete m_Rmat_u_is[i]; // to be deleted on destructor
     m_Rmat_u_is[i] = NULL;
+    delete m_Rmat_u_is_thetaKeys[i]; // to be deleted on destructor
+    m_Rmat_u_is_thetaKeys[i] = NULL;
+    delete m_Rmat_u_is_rhoKeys[i]; // to be deleted on destructor
+    m_Rmat_u_is_rhoKeys[i] = NULL;
   }
 
   delete m_Bop_t__Wy__Bop__inv;
@@ -113,6 +113,9 @@ public:
         P_V                                                m_tmp_rho_w_vec;
 	std::vector<Q_M* >                                 m_Rmat_w_is;       // to be deleted on destructor
 	std::vector<Q_M* >                                 m_Smat_w_is;       // to be deleted on destructor
+	std::vector<P_V* >                                 m_Rmat_w_is_rhoKeys;     // to be deleted on destructor
+	std::vector<double>                                m_Smat_w_is_lambdaWKeys;
+	std::vector<double>                                m_Smat_w_is_lambdaSKeys;
         Q_M                                                m_Smat_w;  // Computed with 'm_simulationModel'
         Q_M                                                m_Smat_w_hat;
 	std::vector<Q_M* >                                 m_Rmat_w_hat_w_asterisk_is; // to be deleted on destructor
@@ -227,6 +230,9 @@ uqGcmSimulationInfoClass<S_V,S_M,P_V,P_M,Q_V,Q_M>::uqGcmSimulationInfoClass(
   m_tmp_rho_w_vec                                  (m_rho_w_space.zeroVector()),
   m_Rmat_w_is                                      (m_paper_p_eta, (Q_M*) NULL), // to be deleted on destructor
   m_Smat_w_is                                      (m_paper_p_eta, (Q_M*) NULL), // to be deleted on destructor
+  m_Rmat_w_is_rhoKeys                              (m_paper_p_eta, (P_V*) NULL), // to be deleted on destructor
+  m_Smat_w_is_lambdaWKeys                          (m_paper_p_eta, -INFINITY),
+  m_Smat_w_is_lambdaSKeys                          (m_paper_p_eta, -INFINITY),
   m_Smat_w                                         (m_w_space.zeroVector()),
   m_Smat_w_hat                                     (m_w_space.zeroVector()),
   m_Rmat_w_hat_w_asterisk_is                       (m_paper_p_eta, (Q_M*) NULL), // to be deleted on destructor
@@ -503,6 +509,8 @@ uqGcmSimulationInfoClass<S_V,S_M,P_V,P_M,Q_V,Q_M>::~uqGcmSimulationInfoClass()
     m_Smat_w_is[i] = NULL;
     delete m_Rmat_w_is[i]; // to be deleted on destructor
     m_Rmat_w_is[i] = NULL;
+    delete m_Rmat_w_is_rhoKeys[i]; // to be deleted on destructor
+    m_Rmat_w_is_rhoKeys[i] = NULL;
   }
 
   delete m_Kt_K_inv; // to be deleted on destructor
@@ -64,6 +64,9 @@ public:
         D_M                         m_tmp_Smat_extra;
         D_M                         m_tmp_Smat_z_hat;
         D_M                         m_tmp_Smat_z_hat_inv;
+        bool                        m_tmp_Smat_z_hat_isCached;
+        double                      m_tmp_Smat_extra_lambdaYKey;
+        double                      m_tmp_Smat_extra_lambdaEtaKey;
 
 private:
   void commonConstructor();
@@ -85,7 +88,10 @@ uqGcmZInfoClass<S_V,S_M,D_V,D_M,P_V,P_M,Q_V,Q_M>::uqGcmZInfoClass(
   m_tmp_Smat_z        (m_z_space.zeroVector()),
   m_tmp_Smat_extra    (m_z_space.zeroVector()),
   m_tmp_Smat_z_hat    (m_z_space.zeroVector()),
-  m_tmp_Smat_z_hat_inv(m_z_space.zeroVector())
+  m_tmp_Smat_z_hat_inv(m_z_space.zeroVector()),
+  m_tmp_Smat_z_hat_isCached    (false),
+  m_tmp_Smat_extra_lambdaYKey  (-INFINITY),
+  m_tmp_Smat_extra_lambdaEtaKey(-INFINITY)
 {
   if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 2)) {
     *m_env.subDisplayFile() << "Entering uqGcmZInfoClass<S_V,S_M,D_V,D_M,P_V,P_M,Q_V,Q_M>::constructor(1)"
@@ -128,7 +134,10 @@ uqGcmZInfoClass<S_V,S_M,D_V,D_M,P_V,P_M,Q_V,Q_M>::uqGcmZInfoClass(
   m_tmp_Smat_z        (m_z_space.zeroVector()),
   m_tmp_Smat_extra    (m_z_space.zeroVector()),
   m_tmp_Smat_z_hat    (m_z_space.zeroVector()),
-  m_tmp_Smat_z_hat_inv(m_z_space.zeroVector())
+  m_tmp_Smat_z_hat_inv(m_z_space.zeroVector()),
+  m_tmp_Smat_z_hat_isCached    (false),
+  m_tmp_Smat_extra_lambdaYKey  (-INFINITY),
+  m_tmp_Smat_extra_lambdaEtaKey(-INFINITY)
 {
   if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 2)) {
     *m_env.subDisplayFile() << "Entering uqGcmZInfoClass<S_V,S_M,D_V,D_M,P_V,P_M,Q_V,Q_M>::constructor(2)"
@@ -220,7 +229,10 @@ uqGcmZInfoClass<S_V,S_M,D_V,D_M,P_V,P_M,Q_V,Q_M>::uqGcmZInfoClass(
   m_tmp_Smat_z        (m_z_space.zeroVector()),
   m_tmp_Smat_extra    (m_z_space.zeroVector()),
   m_tmp_Smat_z_hat    (m_z_space.zeroVector()),
-  m_tmp_Smat_z_hat_inv(m_z_space.zeroVector())
+  m_tmp_Smat_z_hat_inv(m_z_space.zeroVector()),
+  m_tmp_Smat_z_hat_isCached    (false),
+  m_tmp_Smat_extra_lambdaYKey  (-INFINITY),
+  m_tmp_Smat_extra_lambdaEtaKey(-INFINITY)
 {
   if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 2)) {
     *m_env.subDisplayFile() << "Entering uqGcmZInfoClass<S_V,S_M,D_V,D_M,P_V,P_M,Q_V,Q_M>::constructor(3)"
@@ -110,6 +110,11 @@ public:
   const uqVectorSpaceClass    <P_V,P_M>& unique_vu_space                          () const;
   const uqBaseVectorRVClass   <P_V,P_M>& totalPriorRv                             () const;
   const uqGenericVectorRVClass<P_V,P_M>& totalPostRv                              () const;
+  const uqBaseScalarFunctionClass<P_V,P_M>& likelihoodFunction                     () const;
+        unsigned int                     likelihoodCacheLookups                   () const;
+        unsigned int                     likelihoodCacheHits                      () const;
+        unsigned int                     likelihoodCacheTotalLookups              () const;
+        unsigned int                     likelihoodCacheTotalHits                 () const;
 
         void                             print                                    (std::ostream& os) const;
 
@@ -193,6 +198,15 @@ private:
                                                                                    const P_V&                      input_8thetaVec,
                                                                                          unsigned int              outerCounter);
 
+        // These routines are called by formSigma_z() and formSigma_z_hat()
+        // A cached block is reused only if all the hyperparameters it depends on are unchanged
+        bool                             likelihoodCacheKeyMatches                (P_V*&                           key,
+                                                                                   const P_V&                      value);
+        bool                             likelihoodCacheKeyMatches                (double&                         key,
+                                                                                   double                          value);
+        void                             countLikelihoodCacheLookup               (bool                            hit);
+        void                             resetLikelihoodCaches                    ();
+
   //*******************************************************************************
   // The following routines are in uqGpmsaComputerModel5.h
   //*******************************************************************************
@@ -269,6 +283,10 @@ private:
         bool                                                            m_cMatIsRankDefficient;
         uqBaseScalarFunctionClass    <P_V,P_M>*                         m_likelihoodFunction;
         unsigned int                                                    m_like_counter;
+        unsigned int                                                    m_like_cacheLookups;
+        unsigned int                                                    m_like_cacheHits;
+        unsigned int                                                    m_like_cacheTotalLookups;
+        unsigned int                                                    m_like_cacheTotalHits;
 
 };
 
@@ -56,7 +56,11 @@ uqGpmsaComputerModelClass<S_V,S_M,D_V,D_M,P_V,P_M,Q_V,Q_M>::uqGpmsaComputerModel
   m_formCMatrix             (true), // it will be updated
   m_cMatIsRankDefficient    (false),
   m_likelihoodFunction      (NULL),
-  m_like_counter            (uqMiscUintDebugMessage(0,NULL))
+  m_like_counter            (uqMiscUintDebugMessage(0,NULL)),
+  m_like_cacheLookups       (0),
+  m_like_cacheHits          (0),
+  m_like_cacheTotalLookups  (0),
+  m_like_cacheTotalHits     (0)
 {
   if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 2)) {
     *m_env.subDisplayFile() << "Entering uqGpmsaComputerModelClass<S_V,S_M,D_V,D_M,P_V,P_M,Q_V,Q_M>::constructor()"
@@ -73,6 +73,46 @@ uqGpmsaComputerModelClass<S_V,S_M,D_V,D_M,P_V,P_M,Q_V,Q_M>::totalPostRv() const
   return m_t->m_totalPostRv;
 }
 
+template <class S_V,class S_M,class D_V,class D_M,class P_V,class P_M,class Q_V,class Q_M>
+const uqBaseScalarFunctionClass<P_V,P_M>&
+uqGpmsaComputerModelClass<S_V,S_M,D_V,D_M,P_V,P_M,Q_V,Q_M>::likelihoodFunction() const
+{
+  UQ_FATAL_TEST_MACRO(m_likelihoodFunction == NULL,
+                      m_env.worldRank(),
+                      "uqGpmsaComputerModelClass<S_V,S_M,D_V,D_M,P_V,P_M,Q_V,Q_M>::likelihoodFunction()",
+                      "m_likelihoodFunction is NULL");
+  return *m_likelihoodFunction;
+}
+
+// Cache lookups and hits of the last likelihood call; the totals cover all calls so far
+template <class S_V,class S_M,class D_V,class D_M,class P_V,class P_M,class Q_V,class Q_M>
+unsigned int
+uqGpmsaComputerModelClass<S_V,S_M,D_V,D_M,P_V,P_M,Q_V,Q_M>::likelihoodCacheLookups() const
+{
+  return m_like_cacheLookups;
+}
+
+template <class S_V,class S_M,class D_V,class D_M,class P_V,class P_M,class Q_V,class Q_M>
+unsigned int
+uqGpmsaComputerModelClass<S_V,S_M,D_V,D_M,P_V,P_M,Q_V,Q_M>::likelihoodCacheHits() const
+{
+  return m_like_cacheHits;
+}
+
+template <class S_V,class S_M,class D_V,class D_M,class P_V,class P_M,class Q_V,class Q_M>
+unsigned int
+uqGpmsaComputerModelClass<S_V,S_M,D_V,D_M,P_V,P_M,Q_V,Q_M>::likelihoodCacheTotalLookups() const
+{
+  return m_like_cacheTotalLookups;
+}
+
+template <class S_V,class S_M,class D_V,class D_M,class P_V,class P_M,class Q_V,class Q_M>
+unsigned int
+uqGpmsaComputerModelClass<S_V,S_M,D_V,D_M,P_V,P_M,Q_V,Q_M>::likelihoodCacheTotalHits() const
+{
+  return m_like_cacheTotalHits;
+}
+
 template <class S_V,class S_M,class D_V,class D_M,class P_V,class P_M,class Q_V,class Q_M>
 void
 uqGpmsaComputerModelClass<S_V,S_M,D_V,D_M,P_V,P_M,Q_V,Q_M>::print(std::ostream& os) const
@@ -198,6 +238,8 @@ uqGpmsaComputerModelClass<S_V,S_M,D_V,D_M,P_V,P_M,Q_V,Q_M>::likelihoodRoutine(
   gettimeofday(&timevalBegin, NULL);
 
   m_like_counter++;
+  m_like_cacheLookups = 0;
+  m_like_cacheHits    = 0;
   //std::cout << "Entering uqGpmsaComputerModelClass<S_V,S_M,D_V,D_M,P_V,P_M,Q_V,Q_M>::likelihoodRoutine(), m_like_counter = " << m_like_counter << std::endl;
   if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 2)) {
     *m_env.subDisplayFile() << "Entering uqGpmsaComputerModelClass<S_V,S_M,D_V,D_M,P_V,P_M,Q_V,Q_M>::likelihoodRoutine()..."
@@ -284,7 +326,9 @@ uqGpmsaComputerModelClass<S_V,S_M,D_V,D_M,P_V,P_M,Q_V,Q_M>::likelihoodRoutine(
   }
 
   //********************************************************************************
-  // Check if current 'totalValues' has any common values with previous 'totalValues' (todo)
+  // Check if current 'totalValues' has any common values with previous 'totalValues'
+  // The actual reuse of R blocks, \Sigma blocks and factorizations is decided
+  // block by block inside formSigma_z() and formSigma_z_hat()
   //********************************************************************************
   bool here_1_repeats = false;
   bool here_2_repeats = false;
@@ -295,11 +339,11 @@ uqGpmsaComputerModelClass<S_V,S_M,D_V,D_M,P_V,P_M,Q_V,Q_M>::likelihoodRoutine(
   bool here_7_repeats = false;
   bool here_8_repeats = false;
   if ((m_optionsObj->m_ov.m_checkAgainstPreviousSample) &&
-      (m_like_counter == 1                            )) {
+      (m_like_counter > 1                             )) {
     here_1_repeats = (m_s->m_like_previous1 == m_s->m_tmp_1lambdaEtaVec);
     here_2_repeats = (m_s->m_like_previous2 == m_s->m_tmp_2lambdaWVec);
     here_3_repeats = (m_s->m_like_previous3 == m_s->m_tmp_3rhoWVec);
-    here_4_repeats = (m_s->m_like_previous2 == m_s->m_tmp_4lambdaSVec);
+    here_4_repeats = (m_s->m_like_previous4 == m_s->m_tmp_4lambdaSVec);
     if (m_thereIsExperimentalData) {
       here_5_repeats = (m_e->m_like_previous5 == m_e->m_tmp_5lambdaYVec);
       here_6_repeats = (m_e->m_like_previous6 == m_e->m_tmp_6lambdaVVec);
@@ -311,7 +355,8 @@ uqGpmsaComputerModelClass<S_V,S_M,D_V,D_M,P_V,P_M,Q_V,Q_M>::likelihoodRoutine(
                               << ", m_like_counter = "     << m_like_counter
                               << "\n  m_like_previous1 = " << m_s->m_like_previous1
                               << "\n  m_like_previous2 = " << m_s->m_like_previous2
-                              << "\n  m_like_previous3 = " << m_s->m_like_previous3;
+                              << "\n  m_like_previous3 = " << m_s->m_like_previous3
+                              << "\n  m_like_previous4 = " << m_s->m_like_previous4;
       if (m_thereIsExperimentalData) {
         *m_env.subDisplayFile() << "\n  m_like_previous5 = " << m_e->m_like_previous5
                                 << "\n  m_like_previous6 = " << m_e->m_like_previous6
@@ -582,7 +627,7 @@ uqGpmsaComputerModelClass<S_V,S_M,D_V,D_M,P_V,P_M,Q_V,Q_M>::likelihoodRoutine(
   m_s->m_like_previous1 = m_s->m_tmp_1lambdaEtaVec;
   m_s->m_like_previous2 = m_s->m_tmp_2lambdaWVec;
   m_s->m_like_previous3 = m_s->m_tmp_3rhoWVec;
-  m_s->m_like_previous2 = m_s->m_tmp_4lambdaSVec;
+  m_s->m_like_previous4 = m_s->m_tmp_4lambdaSVec;
   m_e->m_like_previous5 = m_e->m_tmp_5lambdaYVec;
   m_e->m_like_previous6 = m_e->m_tmp_6lambdaVVec;
   m_e->m_like_previous7 = m_e->m_tmp_7rhoVVec;
@@ -598,6 +643,11 @@ uqGpmsaComputerModelClass<S_V,S_M,D_V,D_M,P_V,P_M,Q_V,Q_M>::likelihoodRoutine(
                             << ", lnLikelihoodValue = " << lnLikelihoodValue
                             << " after "                << totalTime
                             << " seconds"
+                            << ", cache hits = "        << m_like_cacheHits
+                            << " out of "               << m_like_cacheLookups
+                            << " block lookups (total so far: " << m_like_cacheTotalHits
+                            << " out of "               << m_like_cacheTotalLookups
+                            << ")"
                             << std::endl;
   }
 
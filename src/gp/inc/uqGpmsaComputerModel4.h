@@ -97,6 +97,24 @@ uqGpmsaComputerModelClass<S_V,S_M,D_V,D_M,P_V,P_M,Q_V,Q_M>::formSigma_z_hat(
   }
 
 
+  //********************************************************************************
+  // Reuse '\Sigma_z_hat' (and hence its factorization) if neither '\Sigma_z'
+  // nor the \lambda_y and \lambda_eta values changed since it was last formed
+  //********************************************************************************
+  bool extraHit = this->likelihoodCacheKeyMatches(m_z->m_tmp_Smat_extra_lambdaYKey,input_5lambdaYVec[0]);
+  extraHit = this->likelihoodCacheKeyMatches(m_z->m_tmp_Smat_extra_lambdaEtaKey,input_1lambdaEtaVec[0]) && extraHit;
+  bool zHatHit = m_z->m_tmp_Smat_z_hat_isCached && extraHit;
+  this->countLikelihoodCacheLookup(zHatHit);
+  if (zHatHit) {
+    if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 4)) {
+      *m_env.subDisplayFile() << "Leaving uqGpmsaComputerModelClass<S_V,S_M,D_V,D_M,P_V,P_M,Q_V,Q_M>::formSigma_z_hat(1)"
+                              << ", outerCounter = " << outerCounter
+                              << ": reusing cached 'm_tmp_Smat_z_hat'"
+                              << std::endl;
+    }
+    return;
+  }
+
   //********************************************************************************
   // Form '\Sigma_{extra}' matrix
   //********************************************************************************
@@ -141,6 +159,7 @@ uqGpmsaComputerModelClass<S_V,S_M,D_V,D_M,P_V,P_M,Q_V,Q_M>::formSigma_z_hat(
   // Compute '\Sigma_z_hat' matrix
   //********************************************************************************
   m_z->m_tmp_Smat_z_hat = m_z->m_tmp_Smat_z + m_z->m_tmp_Smat_extra;
+  m_z->m_tmp_Smat_z_hat_isCached = m_optionsObj->m_ov.m_checkAgainstPreviousSample;
 
   if (m_env.displayVerbosity() >= 4) {
     double       zHatLnDeterminant = m_z->m_tmp_Smat_z_hat.lnDeterminant();
@@ -273,6 +292,7 @@ uqGpmsaComputerModelClass<S_V,S_M,D_V,D_M,P_V,P_M,Q_V,Q_M>::formSigma_z_hat(
   // Compute '\Sigma_z_hat' matrix
   //********************************************************************************
   m_z->m_tmp_Smat_z_hat = m_z->m_tmp_Smat_z + m_z->m_tmp_Smat_extra;
+  m_z->m_tmp_Smat_z_hat_isCached = false;
 
   if (m_env.displayVerbosity() >= 4) {
     double       zHatLnDeterminant = m_z->m_tmp_Smat_z_hat.lnDeterminant();
@@ -516,22 +536,42 @@ uqGpmsaComputerModelClass<S_V,S_M,D_V,D_M,P_V,P_M,Q_V,Q_M>::formSigma_z(
   // --> \Sigma_u,w_i = (1/\lambda_w_i).R(...) is n x m, i = 1,...,p_eta
   // --> \Sigma_u,w is (n.p_eta) x (m.p_eta) 
   //********************************************************************************
+  // Each R block is keyed by the \rho (and \theta) sub-vectors it depends on,
+  // and each \Sigma block additionally by its \lambda values: only blocks whose
+  // keys changed since they were last formed are recomputed.
+  //********************************************************************************
+  bool sigmaVChanged  = false;
+  bool sigmaUChanged  = false;
+  bool sigmaWChanged  = false;
+  bool sigmaUWChanged = false;
+
   unsigned int initialPos = 0;
   for (unsigned int i = 0; i < m_e->m_Smat_v_i_spaces.size(); ++i) {
     input_7rhoVVec.cwExtract(initialPos,m_e->m_tmp_rho_v_vec);
     initialPos += m_e->m_tmp_rho_v_vec.sizeLocal();
-    m_e->m_Rmat_v_is[i]->cwSet(0.);
-    this->fillR_formula2_for_Sigma_v(m_e->m_paper_xs_standard,
-                                     m_e->m_tmp_rho_v_vec,
-                                     *(m_e->m_Rmat_v_is[i]), // IMPORTANT-28
-                                     outerCounter);
+    bool rHit = this->likelihoodCacheKeyMatches(m_e->m_Rmat_v_is_rhoKeys[i],m_e->m_tmp_rho_v_vec);
+    this->countLikelihoodCacheLookup(rHit);
+    if (rHit == false) {
+      m_e->m_Rmat_v_is[i]->cwSet(0.);
+      this->fillR_formula2_for_Sigma_v(m_e->m_paper_xs_standard,
+                                       m_e->m_tmp_rho_v_vec,
+                                       *(m_e->m_Rmat_v_is[i]), // IMPORTANT-28
+                                       outerCounter);
+    }
 
-    m_e->m_Smat_v_is[i]->cwSet(0.);
-    m_e->m_Smat_v_is[i]->fillWithTensorProduct(0,0,*(m_e->m_Imat_v_is[i]),*(m_e->m_Rmat_v_is[i]),true,true); // IMPORTANT-28
-    *(m_e->m_Smat_v_is[i]) *= (1./input_6lambdaVVec[i]);
+    bool sHit = this->likelihoodCacheKeyMatches(m_e->m_Smat_v_is_lambdaVKeys[i],input_6lambdaVVec[i]) && rHit;
+    this->countLikelihoodCacheLookup(sHit);
+    if (sHit == false) {
+      m_e->m_Smat_v_is[i]->cwSet(0.);
+      m_e->m_Smat_v_is[i]->fillWithTensorProduct(0,0,*(m_e->m_Imat_v_is[i]),*(m_e->m_Rmat_v_is[i]),true,true); // IMPORTANT-28
+      *(m_e->m_Smat_v_is[i]) *= (1./input_6lambdaVVec[i]);
+      sigmaVChanged = true;
+    }
+  }
+  if (sigmaVChanged) {
+    m_e->m_Smat_v.cwSet(0.);
+    m_e->m_Smat_v.fillWithBlocksDiagonally(0,0,m_e->m_Smat_v_is,true,true);
   }
-  m_e->m_Smat_v.cwSet(0.);
-  m_e->m_Smat_v.fillWithBlocksDiagonally(0,0,m_e->m_Smat_v_is,true,true);
   if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 4)) {
     *m_env.subDisplayFile() << "In uqGpmsaComputerModelClass<S_V,S_M,D_V,D_M,P_V,P_M,Q_V,Q_M>::formSigma_z(1)"
                             << ", outerCounter = " << outerCounter
@@ -554,21 +594,34 @@ uqGpmsaComputerModelClass<S_V,S_M,D_V,D_M,P_V,P_M,Q_V,Q_M>::formSigma_z(
   for (unsigned int i = 0; i < m_j->m_Smat_u_is.size(); ++i) {
     input_3rhoWVec.cwExtract(initialPos,m_s->m_tmp_rho_w_vec);
     initialPos += m_s->m_tmp_rho_w_vec.sizeLocal();
-    m_j->m_Rmat_u_is[i]->cwSet(0.);
-    this->fillR_formula1_for_Sigma_u(m_e->m_paper_xs_standard,
-                                     input_8thetaVec,
-                                     m_s->m_tmp_rho_w_vec,
-                                     *(m_j->m_Rmat_u_is[i]),
-                                     outerCounter);
+    bool rHit = this->likelihoodCacheKeyMatches(m_j->m_Rmat_u_is_rhoKeys[i],m_s->m_tmp_rho_w_vec);
+    rHit = this->likelihoodCacheKeyMatches(m_j->m_Rmat_u_is_thetaKeys[i],input_8thetaVec) && rHit;
+    this->countLikelihoodCacheLookup(rHit);
+    if (rHit == false) {
+      m_j->m_Rmat_u_is[i]->cwSet(0.);
+      this->fillR_formula1_for_Sigma_u(m_e->m_paper_xs_standard,
+                                       input_8thetaVec,
+                                       m_s->m_tmp_rho_w_vec,
+                                       *(m_j->m_Rmat_u_is[i]),
+                                       outerCounter);
+    }
 
-    m_j->m_Smat_u_is[i]->cwSet(0.);
-    *(m_j->m_Smat_u_is[i]) = (1./input_2lambdaWVec[i]) * *(m_j->m_Rmat_u_is[i]);
-    for (unsigned int j = 0; j < m_j->m_Smat_u_is[i]->numRowsLocal(); ++j) {
-      (*(m_j->m_Smat_u_is[i]))(j,j) +=  1/m_s->m_tmp_4lambdaSVec[i]; // lambda_s
+    bool sHit = this->likelihoodCacheKeyMatches(m_j->m_Smat_u_is_lambdaWKeys[i],input_2lambdaWVec[i]);
+    sHit = this->likelihoodCacheKeyMatches(m_j->m_Smat_u_is_lambdaSKeys[i],m_s->m_tmp_4lambdaSVec[i]) && sHit && rHit;
+    this->countLikelihoodCacheLookup(sHit);
+    if (sHit == false) {
+      m_j->m_Smat_u_is[i]->cwSet(0.);
+      *(m_j->m_Smat_u_is[i]) = (1./input_2lambdaWVec[i]) * *(m_j->m_Rmat_u_is[i]);
+      for (unsigned int j = 0; j < m_j->m_Smat_u_is[i]->numRowsLocal(); ++j) {
+        (*(m_j->m_Smat_u_is[i]))(j,j) +=  1/m_s->m_tmp_4lambdaSVec[i]; // lambda_s
+      }
+      sigmaUChanged = true;
     }
   }
-  m_j->m_Smat_u.cwSet(0.);
-  m_j->m_Smat_u.fillWithBlocksDiagonally(0,0,m_j->m_Smat_u_is,true,true);
+  if (sigmaUChanged) {
+    m_j->m_Smat_u.cwSet(0.);
+    m_j->m_Smat_u.fillWithBlocksDiagonally(0,0,m_j->m_Smat_u_is,true,true);
+  }
   if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 4)) {
     *m_env.subDisplayFile() << "In uqGpmsaComputerModelClass<S_V,S_M,D_V,D_M,P_V,P_M,Q_V,Q_M>::formSigma_z(1)"
                             << ", outerCounter = " << outerCounter
@@ -591,21 +644,33 @@ uqGpmsaComputerModelClass<S_V,S_M,D_V,D_M,P_V,P_M,Q_V,Q_M>::formSigma_z(
   for (unsigned int i = 0; i < m_s->m_Smat_w_is.size(); ++i) {
     input_3rhoWVec.cwExtract(initialPos,m_s->m_tmp_rho_w_vec);
     initialPos += m_s->m_tmp_rho_w_vec.sizeLocal();
-    m_s->m_Rmat_w_is[i]->cwSet(0.); // This matrix is square: m_paper_m X m_paper_m
-    this->fillR_formula1_for_Sigma_w(m_s->m_paper_xs_asterisks_standard, // IMPORTANT
-                                     m_s->m_paper_ts_asterisks_standard,
-                                     m_s->m_tmp_rho_w_vec,
-                                     *(m_s->m_Rmat_w_is[i]),
-                                     outerCounter);
+    bool rHit = this->likelihoodCacheKeyMatches(m_s->m_Rmat_w_is_rhoKeys[i],m_s->m_tmp_rho_w_vec);
+    this->countLikelihoodCacheLookup(rHit);
+    if (rHit == false) {
+      m_s->m_Rmat_w_is[i]->cwSet(0.); // This matrix is square: m_paper_m X m_paper_m
+      this->fillR_formula1_for_Sigma_w(m_s->m_paper_xs_asterisks_standard, // IMPORTANT
+                                       m_s->m_paper_ts_asterisks_standard,
+                                       m_s->m_tmp_rho_w_vec,
+                                       *(m_s->m_Rmat_w_is[i]),
+                                       outerCounter);
+    }
 
-    m_s->m_Smat_w_is[i]->cwSet(0.);
-    *(m_s->m_Smat_w_is[i]) = (1./input_2lambdaWVec[i]) * *(m_s->m_Rmat_w_is[i]);
-    for (unsigned int j = 0; j < m_s->m_Smat_w_is[i]->numRowsLocal(); ++j) {
-      (*(m_s->m_Smat_w_is[i]))(j,j) +=  1/m_s->m_tmp_4lambdaSVec[i]; // lambda_s
+    bool sHit = this->likelihoodCacheKeyMatches(m_s->m_Smat_w_is_lambdaWKeys[i],input_2lambdaWVec[i]);
+    sHit = this->likelihoodCacheKeyMatches(m_s->m_Smat_w_is_lambdaSKeys[i],m_s->m_tmp_4lambdaSVec[i]) && sHit && rHit;
+    this->countLikelihoodCacheLookup(sHit);
+    if (sHit == false) {
+      m_s->m_Smat_w_is[i]->cwSet(0.);
+      *(m_s->m_Smat_w_is[i]) = (1./input_2lambdaWVec[i]) * *(m_s->m_Rmat_w_is[i]);
+      for (unsigned int j = 0; j < m_s->m_Smat_w_is[i]->numRowsLocal(); ++j) {
+        (*(m_s->m_Smat_w_is[i]))(j,j) +=  1/m_s->m_tmp_4lambdaSVec[i]; // lambda_s
+      }
+      sigmaWChanged = true;
     }
   }
-  m_s->m_Smat_w.cwSet(0.);
-  m_s->m_Smat_w.fillWithBlocksDiagonally(0,0,m_s->m_Smat_w_is,true,true);
+  if (sigmaWChanged) {
+    m_s->m_Smat_w.cwSet(0.);
+    m_s->m_Smat_w.fillWithBlocksDiagonally(0,0,m_s->m_Smat_w_is,true,true);
+  }
   if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 4)) {
     *m_env.subDisplayFile() << "In uqGpmsaComputerModelClass<S_V,S_M,D_V,D_M,P_V,P_M,Q_V,Q_M>::formSigma_z(1)"
                             << ", outerCounter = " << outerCounter
@@ -628,20 +693,32 @@ uqGpmsaComputerModelClass<S_V,S_M,D_V,D_M,P_V,P_M,Q_V,Q_M>::formSigma_z(
   for (unsigned int i = 0; i < m_j->m_Smat_uw_is.size(); ++i) {
     input_3rhoWVec.cwExtract(initialPos,m_s->m_tmp_rho_w_vec);
     initialPos += m_s->m_tmp_rho_w_vec.sizeLocal();
-    m_j->m_Rmat_uw_is[i]->cwSet(0.);
-    this->fillR_formula1_for_Sigma_uw(m_e->m_paper_xs_standard,
-                                      input_8thetaVec,
-                                      m_s->m_paper_xs_asterisks_standard,
-                                      m_s->m_paper_ts_asterisks_standard,
-                                      m_s->m_tmp_rho_w_vec,*(m_j->m_Rmat_uw_is[i]),
-                                      outerCounter);
+    bool rHit = this->likelihoodCacheKeyMatches(m_j->m_Rmat_uw_is_rhoKeys[i],m_s->m_tmp_rho_w_vec);
+    rHit = this->likelihoodCacheKeyMatches(m_j->m_Rmat_uw_is_thetaKeys[i],input_8thetaVec) && rHit;
+    this->countLikelihoodCacheLookup(rHit);
+    if (rHit == false) {
+      m_j->m_Rmat_uw_is[i]->cwSet(0.);
+      this->fillR_formula1_for_Sigma_uw(m_e->m_paper_xs_standard,
+                                        input_8thetaVec,
+                                        m_s->m_paper_xs_asterisks_standard,
+                                        m_s->m_paper_ts_asterisks_standard,
+                                        m_s->m_tmp_rho_w_vec,*(m_j->m_Rmat_uw_is[i]),
+                                        outerCounter);
+    }
 
-    m_j->m_Smat_uw_is[i]->cwSet(0.);
-    *(m_j->m_Smat_uw_is[i]) = (1./input_2lambdaWVec[i]) * *(m_j->m_Rmat_uw_is[i]);
+    bool sHit = this->likelihoodCacheKeyMatches(m_j->m_Smat_uw_is_lambdaWKeys[i],input_2lambdaWVec[i]) && rHit;
+    this->countLikelihoodCacheLookup(sHit);
+    if (sHit == false) {
+      m_j->m_Smat_uw_is[i]->cwSet(0.);
+      *(m_j->m_Smat_uw_is[i]) = (1./input_2lambdaWVec[i]) * *(m_j->m_Rmat_uw_is[i]);
+      sigmaUWChanged = true;
+    }
+  }
+  if (sigmaUWChanged) {
+    m_j->m_Smat_uw.cwSet(0.);
+    m_j->m_Smat_uw.fillWithBlocksDiagonally(0,0,m_j->m_Smat_uw_is,true,true);
+    m_j->m_Smat_uw_t.fillWithTranspose(0,0,m_j->m_Smat_uw,true,true);
   }
-  m_j->m_Smat_uw.cwSet(0.);
-  m_j->m_Smat_uw.fillWithBlocksDiagonally(0,0,m_j->m_Smat_uw_is,true,true);
-  m_j->m_Smat_uw_t.fillWithTranspose(0,0,m_j->m_Smat_uw,true,true);
   if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 4)) {
     *m_env.subDisplayFile() << "In uqGpmsaComputerModelClass<S_V,S_M,D_V,D_M,P_V,P_M,Q_V,Q_M>::formSigma_z(1)"
                             << ", outerCounter = " << outerCounter
@@ -684,16 +761,22 @@ uqGpmsaComputerModelClass<S_V,S_M,D_V,D_M,P_V,P_M,Q_V,Q_M>::formSigma_z(
 
   this->memoryCheck(95);
 
-  m_z->m_tmp_Smat_z.cwSet(0.);
-  if (m_allOutputsAreScalar) {
-    // ppp
-  }
-  else {
-    m_z->m_tmp_Smat_z.cwSet(0,0,m_e->m_Smat_v);
-    m_z->m_tmp_Smat_z.cwSet(m_e->m_Smat_v.numRowsLocal(),                             m_e->m_Smat_v.numCols(),                        m_j->m_Smat_u);
-    m_z->m_tmp_Smat_z.cwSet(m_e->m_Smat_v.numRowsLocal(),                             m_e->m_Smat_v.numCols()+m_j->m_Smat_u.numCols(),m_j->m_Smat_uw);
-    m_z->m_tmp_Smat_z.cwSet(m_e->m_Smat_v.numRowsLocal()+m_j->m_Smat_u.numRowsLocal(),m_e->m_Smat_v.numCols(),                        m_j->m_Smat_uw_t);
-    m_z->m_tmp_Smat_z.cwSet(m_e->m_Smat_v.numRowsLocal()+m_j->m_Smat_u.numRowsLocal(),m_e->m_Smat_v.numCols()+m_j->m_Smat_u.numCols(),m_s->m_Smat_w);
+  if (sigmaVChanged  ||
+      sigmaUChanged  ||
+      sigmaWChanged  ||
+      sigmaUWChanged) {
+    m_z->m_tmp_Smat_z.cwSet(0.);
+    if (m_allOutputsAreScalar) {
+      // ppp
+    }
+    else {
+      m_z->m_tmp_Smat_z.cwSet(0,0,m_e->m_Smat_v);
+      m_z->m_tmp_Smat_z.cwSet(m_e->m_Smat_v.numRowsLocal(),                             m_e->m_Smat_v.numCols(),                        m_j->m_Smat_u);
+      m_z->m_tmp_Smat_z.cwSet(m_e->m_Smat_v.numRowsLocal(),                             m_e->m_Smat_v.numCols()+m_j->m_Smat_u.numCols(),m_j->m_Smat_uw);
+      m_z->m_tmp_Smat_z.cwSet(m_e->m_Smat_v.numRowsLocal()+m_j->m_Smat_u.numRowsLocal(),m_e->m_Smat_v.numCols(),                        m_j->m_Smat_uw_t);
+      m_z->m_tmp_Smat_z.cwSet(m_e->m_Smat_v.numRowsLocal()+m_j->m_Smat_u.numRowsLocal(),m_e->m_Smat_v.numCols()+m_j->m_Smat_u.numCols(),m_s->m_Smat_w);
+    }
+    m_z->m_tmp_Smat_z_hat_isCached = false;
   }
 
   if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 4)) {
@@ -723,6 +806,9 @@ void
   std::set<unsigned int> tmpSet;
   tmpSet.insert(m_env.subId());
 
+  // All blocks below are overwritten without going through the likelihood caches
+  this->resetLikelihoodCaches();
+
   this->memoryCheck(90);
 
   // Fill m_Rmat_v_is,  m_Smat_v_is,  m_Smat_v
@@ -957,6 +1043,9 @@ uqGpmsaComputerModelClass<S_V,S_M,D_V,D_M,P_V,P_M,Q_V,Q_M>::formSigma_w_hat(
                             << std::endl;
   }
 
+  // 'm_Rmat_w_is', 'm_Smat_w_is' and 'm_Smat_w' are overwritten below
+  this->resetLikelihoodCaches();
+
   unsigned int initialPos = 0;
   for (unsigned int i = 0; i < m_s->m_Smat_w_is.size(); ++i) {
     input_3rhoWVec.cwExtract(initialPos,m_s->m_tmp_rho_w_vec);
@@ -999,4 +1088,77 @@ uqGpmsaComputerModelClass<S_V,S_M,D_V,D_M,P_V,P_M,Q_V,Q_M>::formSigma_w_hat(
   return;
 }
 
+template <class S_V,class S_M,class D_V,class D_M,class P_V,class P_M,class Q_V,class Q_M>
+bool
+uqGpmsaComputerModelClass<S_V,S_M,D_V,D_M,P_V,P_M,Q_V,Q_M>::likelihoodCacheKeyMatches(
+  P_V*&      key,
+  const P_V& value)
+{
+  bool matches = (m_optionsObj->m_ov.m_checkAgainstPreviousSample) &&
+                 (key != NULL                                    ) &&
+                 (*key == value                                  );
+  if (matches == false) {
+    if (key == NULL) key = new P_V(value); // to be deleted on info destructors
+    else             *key = value;
+  }
+
+  return matches;
+}
+
+template <class S_V,class S_M,class D_V,class D_M,class P_V,class P_M,class Q_V,class Q_M>
+bool
+uqGpmsaComputerModelClass<S_V,S_M,D_V,D_M,P_V,P_M,Q_V,Q_M>::likelihoodCacheKeyMatches(
+  double& key,
+  double  value)
+{
+  bool matches = (m_optionsObj->m_ov.m_checkAgainstPreviousSample) &&
+                 (key == value                                   );
+  key = value;
+
+  return matches;
+}
+
+template <class S_V,class S_M,class D_V,class D_M,class P_V,class P_M,class Q_V,class Q_M>
+void
+uqGpmsaComputerModelClass<S_V,S_M,D_V,D_M,P_V,P_M,Q_V,Q_M>::countLikelihoodCacheLookup(bool hit)
+{
+  m_like_cacheLookups++;
+  m_like_cacheTotalLookups++;
+  if (hit) {
+    m_like_cacheHits++;
+    m_like_cacheTotalHits++;
+  }
+
+  return;
+}
+
+template <class S_V,class S_M,class D_V,class D_M,class P_V,class P_M,class Q_V,class Q_M>
+void
+uqGpmsaComputerModelClass<S_V,S_M,D_V,D_M,P_V,P_M,Q_V,Q_M>::resetLikelihoodCaches()
+{
+  // Deleting a vector key forces a miss on the R block, which in turn forces
+  // a miss on the corresponding \Sigma block and a new '\Sigma_z'
+  for (unsigned int i = 0; i < m_s->m_Rmat_w_is_rhoKeys.size(); ++i) {
+    delete m_s->m_Rmat_w_is_rhoKeys[i];
+    m_s->m_Rmat_w_is_rhoKeys[i] = NULL;
+  }
+  if (m_thereIsExperimentalData) {
+    for (unsigned int i = 0; i < m_e->m_Rmat_v_is_rhoKeys.size(); ++i) {
+      delete m_e->m_Rmat_v_is_rhoKeys[i];
+      m_e->m_Rmat_v_is_rhoKeys[i] = NULL;
+    }
+    for (unsigned int i = 0; i < m_j->m_Rmat_u_is_rhoKeys.size(); ++i) {
+      delete m_j->m_Rmat_u_is_rhoKeys[i];
+      m_j->m_Rmat_u_is_rhoKeys[i] = NULL;
+    }
+    for (unsigned int i = 0; i < m_j->m_Rmat_uw_is_rhoKeys.size(); ++i) {
+      delete m_j->m_Rmat_uw_is_rhoKeys[i];
+      m_j->m_Rmat_uw_is_rhoKeys[i] = NULL;
+    }
+  }
+  m_z->m_tmp_Smat_z_hat_isCached = false;
+
+  return;
+}
+
 #endif // __UQ_GCM_4_H__
@@ -36,6 +36,10 @@
 #include <vector>
 #include <math.h>
 #include <fstream>
+#include <algorithm>
+
+//! Number of points handed to uqBase1D1DFunctionClass::values() per batch by the KDE integrals.
+#define UQ_1D1D_FUNCTION_BATCH_SIZE 4096U
 
 /*! \file uqBase1D1DFunction.h
     \brief One-dimension function class.
@@ -78,12 +82,20 @@ public:
   
   //! Returns the value of the derivative of the function. See template specialization.
   virtual  double deriv         (double domainValue) const = 0;
+
+  //! Evaluates the function at the \c numValues points \c domainValues, storing the results in \c imageValues.
+  /*! The default implementation calls value() once per point. Derived classes override it in order
+   * to check the domain only once per batch and to avoid one virtual call per point. */
+  virtual  void   values        (const double* domainValues, double* imageValues, unsigned int numValues) const;
   
   //! TODO: Multiplies \c this function with \c function, and integrates it numerically.  See template specialization.
   /*! \todo: Please, implement me!*/
   virtual  double multiplyAndIntegrate(const uqBase1D1DFunctionClass& func, unsigned int quadratureOrder, double* resultWithMultiplicationByTAsWell) const;
   //@}
 protected:
+  //! Checks, in one pass, that all \c numValues points \c domainValues belong to the domain of \c this function.
+  void   checkDomainValues(const double* domainValues, unsigned int numValues, const char* where) const;
+
   double m_minDomainValue;
   double m_maxDomainValue;
 };
@@ -158,6 +170,9 @@ public:
    * and in affirmative case, it evaluates the function at such point, which is the constant
    * value \c constantValue passed to the constructor of this class. */
   double value(double domainValue) const;
+
+  //! Fills \c imageValues with the constant value, after checking the domain once.
+  void   values(const double* domainValues, double* imageValues, unsigned int numValues) const;
   
   //! Returns the value of the derivative of the constant function at point \c domainValue.
   /*! This function checks if point \c domainValue belongs to the domain of \c this function,
@@ -207,6 +222,9 @@ public:
   /*! This function checks if point \c domainValue belongs to the domain of \c this function,
    * and in affirmative case, it evaluates the function at such point. */
   double value(double domainValue) const;
+
+  //! Returns the values of the linear function at the \c numValues points \c domainValues.
+  void   values(const double* domainValues, double* imageValues, unsigned int numValues) const;
   
   //! Returns the value of the derivative of the linear function at point \c domainValue.
   /*! This function checks if point \c domainValue belongs to the domain of \c this function,
@@ -256,6 +274,10 @@ public:
   /*! This function checks if point \c domainValue belongs to the domain of \c this function,
    * and in affirmative case, it evaluates the function at such point. */
   double value(double domainValue) const;
+
+  //! Returns the values of the piecewise linear function at the \c numValues points \c domainValues.
+  /*! Each reference interval is located through a binary search. */
+  void   values(const double* domainValues, double* imageValues, unsigned int numValues) const;
   
   //! Returns the value of the derivative of the piecewise-linear function at point \c domainValue.
   /*! This function checks if point \c domainValue belongs to the domain of \c this function,
@@ -313,6 +335,9 @@ public:
    * and in affirmative case, it evaluates the function at such point, namely: 
    * <c>imageValue = a*domainValue^2 + b*domainValue + c </c>\f$.*/
   double value(double domainValue) const;
+
+  //! Returns the values of the quadratic function at the \c numValues points \c domainValues (Horner's rule).
+  void   values(const double* domainValues, double* imageValues, unsigned int numValues) const;
   
   //! Returns the value of the derivative of the quadratic function at point \c domainValue.
   /*! This function checks if point \c domainValue belongs to the domain of \c this function,
@@ -372,6 +397,11 @@ public:
    * passed to the function. If there isn't any, it calculates a linear approximation for the 
    * image value of \c domainValue, considering its neighbors points in the domain.*/
   virtual double       value(double domainValue) const;
+
+  //! Returns the values of the sampled function at the \c numValues points \c domainValues.
+  /*! Same interpolation as value(), but the domain is checked once per batch and each
+   * point is located through a binary search on \c domainValues(). */
+  virtual void         values(const double* domainValues, double* imageValues, unsigned int numValues) const;
   
   //! <b>Bogus</b>: Derivative of the function.
   /*! Derivatives are not defined over sampled functions! Thus, this function simply checks if
@@ -439,6 +469,9 @@ public:
    * value by the scalar passed to the constructor. */
   double value(double domainValue) const;
 
+  //! Returns the values of the scaled function at the \c numValues points \c domainValues.
+  void   values(const double* domainValues, double* imageValues, unsigned int numValues) const;
+
   //! TODO: Returns the value of the derivative of the function multiplied by the given scalar at point \c domainValue.
   /*! \todo Please, implement me! */  
   double deriv(double domainValue) const;
@@ -479,6 +512,9 @@ public:
   /*! This function calls the value() method of the both functions and multiplies their return 
    * value with one another.*/
   double value(double domainValue) const;
+
+  //! Returns the values of the product at the \c numValues points \c domainValues, with one batch call per factor.
+  void   values(const double* domainValues, double* imageValues, unsigned int numValues) const;
   
   //! TODO: Returns the value of the derivative of the function \c func1 by another function \c func2 at the point \c domainValue.
   /*! \todo Please, implement me! \n
@@ -521,6 +557,9 @@ public:
   /*! This function calls the value() method of the both functions and adds their return 
    * value with one another.*/
   double value(double domainValue) const;
+
+  //! Returns the values of the sum at the \c numValues points \c domainValues, with one batch call per term.
+  void   values(const double* domainValues, double* imageValues, unsigned int numValues) const;
   
   //! TODO: Returns the value of the derivative of the addition of two functions.
   /*! \todo Please, implement me! \n*/
@@ -573,6 +612,10 @@ public:
   //@{
   //! Returns the value of the Lagrange polynomial at point \c domainValue.
   double value(double domainValue) const;
+
+  //! Returns the values of the Lagrange polynomial at the \c numValues points \c domainValues.
+  /*! Uses the barycentric form with weights computed at construction, i.e. O(n) instead of O(n^2) per point. */
+  void   values(const double* domainValues, double* imageValues, unsigned int numValues) const;
   
   //! TODO: Returns the value of the derivative of the Lagrange polynomial at point \c domainValue.
   /*! \todo This function checks if point \c domainValue belongs to the domain of \c this function,
@@ -585,6 +628,9 @@ protected:
 
   std::vector<double> m_positionValues;
   std::vector<double> m_functionValues;
+
+  //! Barycentric weights \f$ w_k = 1/\prod_{j\not=k}(x_k-x_j) \f$.
+  std::vector<double> m_barycentricWeights;
 };
 
 //*****************************************************
@@ -624,6 +670,10 @@ public:
   //@{
   //! Returns the value of the Lagrange basis at point \c domainValue.
   double value(double domainValue) const;
+
+  //! Returns the values of the Lagrange basis at the \c numValues points \c domainValues.
+  /*! The denominator of the basis is computed once per batch. */
+  void   values(const double* domainValues, double* imageValues, unsigned int numValues) const;
   
   //! TODO: Returns the value of the derivative of the Lagrange basis at point \c domainValue.
   /*! \todo This function checks if point \c domainValue belongs to the domain of \c this function,
@@ -675,18 +725,41 @@ uqSubF1F2Gaussian2dKdeIntegral(const uqScalarSequenceClass<T>& scalarSeq1,
                       "uqSubF1F2Gaussian2dKdeIntegral()",
                       "quadObj has invalid state");
 
+  // Samples are processed in blocks, so that each function is evaluated
+  // through one batch call per block instead of one virtual call per node
   unsigned int numQuadraturePositions = quadPositions.size();
   unsigned int dataSize = scalarSeq1.subSequenceSize();
-  for (unsigned int k = 0; k < dataSize; ++k) {
-    double value1 = 0.;
-    double value2 = 0.;
-    double x1k = scalarSeq1[k];
-    double x2k = scalarSeq2[k];
-    for (unsigned int j = 0; j < numQuadraturePositions; ++j) {
-      value1 += func1.value(scaleValue1*quadPositions[j]+x1k)*quadWeights[j];
-      value2 += func2.value(scaleValue2*quadPositions[j]+x2k)*quadWeights[j];
+  unsigned int blockSize = std::max(1U,UQ_1D1D_FUNCTION_BATCH_SIZE/numQuadraturePositions);
+  std::vector<double> domainValues1(blockSize*numQuadraturePositions,0.);
+  std::vector<double> domainValues2(blockSize*numQuadraturePositions,0.);
+  std::vector<double> imageValues1 (blockSize*numQuadraturePositions,0.);
+  std::vector<double> imageValues2 (blockSize*numQuadraturePositions,0.);
+  for (unsigned int k0 = 0; k0 < dataSize; k0 += blockSize) {
+    unsigned int numSamples = std::min(blockSize,dataSize-k0);
+    unsigned int pos = 0;
+    for (unsigned int k = 0; k < numSamples; ++k) {
+      double x1k = scalarSeq1[k0+k];
+      double x2k = scalarSeq2[k0+k];
+      for (unsigned int j = 0; j < numQuadraturePositions; ++j) {
+        domainValues1[pos] = scaleValue1*quadPositions[j]+x1k;
+        domainValues2[pos] = scaleValue2*quadPositions[j]+x2k;
+        ++pos;
+      }
+    }
+    func1.values(&domainValues1[0],&imageValues1[0],pos);
+    func2.values(&domainValues2[0],&imageValues2[0],pos);
+
+    pos = 0;
+    for (unsigned int k = 0; k < numSamples; ++k) {
+      double value1 = 0.;
+      double value2 = 0.;
+      for (unsigned int j = 0; j < numQuadraturePositions; ++j) {
+        value1 += imageValues1[pos]*quadWeights[j];
+        value2 += imageValues2[pos]*quadWeights[j];
+        ++pos;
+      }
+      resultValue += value1*value2;
     }
-    resultValue += value1*value2;
   }
   resultValue *= 1./(2.*M_PI)/((double) dataSize);
 
@@ -168,7 +168,8 @@ public:
   //! Default constructor. 
   /*! Constructs a Gaussian-Legendre quadrature of order \c order, in the interval 
    * <c>[minDomainValue,maxDomainValue]</c>. Valid values for the order of the 
-   * quadrature rule are: 1-7, 10-12, 16. This method scales the abscissas (positions) 
+   * quadrature rule are tabulated for 1-7, 10-12, 16; other orders are computed with the
+   * Golub-Welsch algorithm. This method scales the abscissas (positions) 
    * of the quadrature from the interval [-1,1] to <c>[minDomainValue,maxDomainValue]</c>, 
    * and the parameter \c densityIsNormalized determines whether the weights should be 
    * scaled as well. */
@@ -224,7 +225,8 @@ public:
   //@{ 
   //! Default constructor. 
   /*! Constructs a Gaussian-Hermite quadrature of order \c order.
-   * Valid values for the order of the  quadrature rule are: 1-9, 19.
+   * The quadrature rule is tabulated for orders 1-9, 19; other orders are computed
+   * with the Golub-Welsch algorithm.
    * \todo: Prepare the code to include both parameters \c mean and \c stddev. */
   uqGaussianHermite1DQuadratureClass(double       mean,
                                      double       stddev,
@@ -341,5 +343,52 @@ protected:
   using uqBase1DQuadratureClass::m_positions;
   using uqBase1DQuadratureClass::m_weights;
 };
+
+//*****************************************************
+// Clenshaw/Curtis 1D quadrature class
+//*****************************************************
+/*! \class uqClenshawCurtis1DQuadratureClass
+ *  \brief Class for Clenshaw-Curtis quadrature rule for one-dimensional functions.
+ *
+ * Clenshaw-Curtis quadrature integrates over the interval [-1,1] with weighting function
+ * \f$ W(x)=1 \f$, using the extrema \f$ x_j=-\cos(\frac{j\pi}{n}), j=0,\ldots,n \f$ of the
+ * Chebyshev polynomial \f$ T_n(x) \f$ as abscissas. Its weights are
+ * \f[ w_j=\frac{c_j}{n}\left[1-\sum_{k=1}^{\lfloor n/2 \rfloor}\frac{b_k}{4k^2-1}\cos\left(\frac{2kj\pi}{n}\right)\right], \f]
+ * with \f$ c_0=c_n=1 \f$, \f$ c_j=2 \f$ otherwise, \f$ b_{n/2}=1 \f$ and \f$ b_k=2 \f$ otherwise.\n
+ *
+ * Rules of orders \f$ 0, 2, 4, 8, 16, \ldots \f$ are nested: every abscissa of a rule is also an
+ * abscissa of the next one, what makes them the natural building block of sparse grids.
+ *
+ * \see http://en.wikipedia.org/wiki/Clenshaw-Curtis_quadrature. */
+
+class uqClenshawCurtis1DQuadratureClass : public uqBase1DQuadratureClass {
+public:
+  //! @name Constructor/Destructor methods
+  //@{
+  //! Default constructor.
+  /*! Constructs a Clenshaw-Curtis quadrature of order \c order (with <c>order+1</c> abscissas),
+   * in the interval <c>[minDomainValue,maxDomainValue]</c>. Order 0 is the one point (midpoint)
+   * rule. The parameter \c densityIsNormalized determines whether the weights should be
+   * scaled with the length of the interval as well. */
+  uqClenshawCurtis1DQuadratureClass(double       minDomainValue,
+                                    double       maxDomainValue,
+                                    unsigned int order,
+                                    bool         densityIsNormalized);
+  //! Destructor.
+  ~uqClenshawCurtis1DQuadratureClass();
+  //@}
+
+  //! @name Mathematical  methods
+  //@{
+  //! Bogus routine.
+  void dumbRoutine() const;
+  //@}
+protected:
+  using uqBase1DQuadratureClass::m_minDomainValue;
+  using uqBase1DQuadratureClass::m_maxDomainValue;
+  using uqBase1DQuadratureClass::m_order;
+  using uqBase1DQuadratureClass::m_positions;
+  using uqBase1DQuadratureClass::m_weights;
+};
 #endif // __UQ_1D_1D_QUADRATURE_H__
 
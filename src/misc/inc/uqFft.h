@@ -34,6 +34,7 @@
 //#include <gsl/gsl_fft_complex.h>
 #include <vector>
 #include <complex>
+#include <map>
 
 /*! \file uqFft.h
     \brief Matrix class.
@@ -57,8 +58,9 @@
     \f$ f_1 f_2 ... f_n \f$ then the DFT can be computed in \f$ O(N \sum f_i) \f$ operations. 
     For a radix-2 FFT this gives an operation count of \f$ O(N \log_2 N)\f$.
     
-    \todo: Implement Forward Fourier Transform for Complex data.
-      
+    GSL trigonometric tables and workspaces are allocated once per transform size and kept
+    in a plan cache until the object is destroyed, so repeated transforms of the same size
+    (e.g. over several chain components or PSD blocks) do not pay for them again.
 */
 /* If the function to be transformed is not 
     harmonically related to the sampling frequency, the response of an FFT looks like a sinc 
@@ -81,7 +83,7 @@ public:
 
   //! @name Mathematical methods
   //@{    
-  //! Calculates the forward Fourier transform (for real data. TODO: complex data).
+  //! Calculates the forward Fourier transform (for real and complex data).
   /*! This function uses GSL function 'gsl_fft_real_transform' to compute the FFT of 
    * \c data, a real array (of time-ordered real data) of length \c fftSize, using a 
    * mixed radix decimation-in-frequency algorithm. There is no restriction on the length 
@@ -90,7 +92,8 @@ public:
    * \c fftSize module. The caller must supply a wavetable containing trigonometric lookup 
    * tables and a workspace work.\n The definition of the forward Fourier transform, 
    * \f$ x = FFT(z) \f$ of size \f$ N \f$ is:
-   * \f[ x_j = \sum_{k=0}^{N-1} z_k \exp(-2\pi i j k / N).  \f]*/
+   * \f[ x_j = \sum_{k=0}^{N-1} z_k \exp(-2\pi i j k / N).  \f]
+   * Complex data is transformed with 'gsl_fft_complex_forward'. */
   void forward(const std::vector<T>&                     data, 
                      unsigned int                        fftSize,
                      std::vector<std::complex<double> >& result);
@@ -109,30 +112,69 @@ public:
   void inverse(const std::vector<T>&                     data, 
                      unsigned int                        fftSize,
                      std::vector<std::complex<double> >& result);
+
+  //! Calculates the linear auto-correlations of several real data sets in one blocked pass.
+  /*! \c data holds \c numSeqs sequences of equal length \c n = data.size()/numSeqs, stored
+   * one after the other. On output, \c result holds \c numSeqs blocks of \c maxLag+1 values,
+   * \f$ r_k = \sum_{t=0}^{n-1-k} x_t x_{t+k} \f$, for \f$ k = 0, ..., maxLag \f$. Each sequence
+   * is zero padded to fastSize(n+maxLag), transformed with 'gsl_fft_real_transform', squared
+   * in halfcomplex storage and transformed back with 'gsl_fft_halfcomplex_inverse', so no
+   * complex transform is involved. The padding is the smallest one that avoids circular
+   * wrap-around for the requested lags. Plans and buffers are shared by all sequences. */
+  void autoCorrelations(const std::vector<double>& data,
+                              unsigned int         numSeqs,
+                              unsigned int         maxLag,
+                              std::vector<double>& result);
+
+  //! Returns the smallest size \f$ \ge \c minSize \f$ of the form \f$ 2^a 3^b 5^c \f$.
+  /*! GSL has efficient modules for all these factors, so such sizes are transformed as fast
+   * as powers of two, while wasting much less padding. */
+  static unsigned int fastSize(unsigned int minSize);
   //@}
 private:
-  //void allocTables(unsigned int fftSize);
-  //void freeTables ();
+  //! GSL tables, workspaces and scratch buffer for one transform size.
+  /*! Defined in the source file of each specialization, so that this header does not depend
+   * on GSL. */
+  struct uqFftPlanStruct;
 
-  const uqBaseEnvironmentClass& m_env;
-  //unsigned int               m_fftSize;
+  //! Returns the (cached) plan for transforms of size \c fftSize.
+  uqFftPlanStruct* plan     (unsigned int fftSize);
+  void             freePlans();
 
-  //gsl_fft_real_workspace*    m_realWkSpace;
-  //gsl_fft_real_wavetable*    m_realWvTable;
-  //gsl_fft_complex_workspace* m_complexWkSpace;
-  //gsl_fft_complex_wavetable* m_complexWvTable;
+  const uqBaseEnvironmentClass&             m_env;
+  std::map<unsigned int, uqFftPlanStruct*> m_plans;
 };
 // Constructor-------------------------------------------
 template <class T>
 uqFftClass<T>::uqFftClass(const uqBaseEnvironmentClass& env)
   :
-  m_env(env)
+  m_env  (env),
+  m_plans()
 {
 }
 // Destructor--------------------------------------------
 template <class T>
 uqFftClass<T>::~uqFftClass()
 {
+  this->freePlans();
+}
+// Math methods------------------------------------------
+template <class T>
+unsigned int
+uqFftClass<T>::fastSize(unsigned int minSize)
+{
+  unsigned int bestSize = 1;
+  while (bestSize < minSize) bestSize *= 2;
+
+  for (unsigned int pow5 = 1; pow5 < bestSize; pow5 *= 5) {
+    for (unsigned int pow35 = pow5; pow35 < bestSize; pow35 *= 3) {
+      unsigned int candidate = pow35;
+      while (candidate < minSize) candidate *= 2;
+      if (candidate < bestSize) bestSize = candidate;
+    }
+  }
+
+  return bestSize;
 }
 
 #endif // __UQ_FFT_H__
@@ -35,6 +35,10 @@
 #include <vector>
 #include <math.h>
 
+#define UQ_IACT_GEYER_METHOD "geyer"
+#define UQ_IACT_SOKAL_METHOD "sokal"
+#define UQ_IACT_SOKAL_WINDOW_FACTOR 5.
+
 void         uqMiscReadDoublesFromString      (const std::string&        inputString,
                                                std::vector<double>&      outputDoubles);
 void         uqMiscReadWordsFromString        (const std::string&        inputString,
@@ -61,6 +65,11 @@ double       uqMiscHammingWindow              (unsigned int              N,
 double       uqMiscGaussianDensity            (double                    x,
                                                double                    mu,
                                                double                    sigma);
+double       uqMiscGeyerIntegratedAutoCorrTime(const double*             autoCovs,
+                                               unsigned int              numLags);
+double       uqMiscSokalIntegratedAutoCorrTime(const double*             autoCovs,
+                                               unsigned int              numLags,
+                                               double                    windowFactor);
 unsigned int uqMiscUintDebugMessage           (unsigned int              value,
                                                const char*               message);
 int          uqMiscIntDebugMessage            (int                       value,
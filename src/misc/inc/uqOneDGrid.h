@@ -31,6 +31,7 @@
 
 #include <uqEnvironment.h>
 #include <math.h>
+#include <algorithm>
 
 //*****************************************************
 // Classes to accommodate a one dimensional grid
@@ -285,14 +286,21 @@ public:
   unsigned int size          ()                    const;
   
   //! Finds the ID of an interval. See template specialization.
+  /*! Uses the guide table if there is one (expected O(1) cost), and a binary search otherwise.*/
   unsigned int findIntervalId(const T& paramValue) const; 
+
+  //! Builds a guide table (Chen and Asau) with \c numBuckets equal width buckets; 0 removes the table.
+  /*! The constructor builds a table with as many buckets as grid points.*/
+  void         setGuideTableSize(unsigned int numBuckets);
   //@}
 
 protected:
   using uqBaseOneDGridClass<T>::m_env;
   using uqBaseOneDGridClass<T>::m_prefix;
 
-  std::vector<T> m_points;
+  std::vector<T>            m_points;
+  std::vector<unsigned int> m_guideIds; // m_guideIds[b] = last point id lying in a bucket before bucket 'b'
+  double                    m_guideScale;
 };
 
 template<class T>
@@ -302,7 +310,9 @@ uqStdOneDGridClass<T>::uqStdOneDGridClass(
   const std::vector<T>&         points)
   :
   uqBaseOneDGridClass<T>(env,prefix),
-  m_points              (points)
+  m_points              (points),
+  m_guideIds            (0),
+  m_guideScale          (0.)
 {
   if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 5)) {
     *m_env.subDisplayFile() << "Entering uqStdOneDGridClass<T>::constructor()"
@@ -310,6 +320,8 @@ uqStdOneDGridClass<T>::uqStdOneDGridClass(
                            << std::endl;
   }
 
+  this->setGuideTableSize(m_points.size());
+
   if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 5)) {
     *m_env.subDisplayFile() << "Leaving uqStdOneDGridClass<T>::constructor()"
                            << ": prefix = " << m_prefix
@@ -351,15 +363,51 @@ uqStdOneDGridClass<T>::findIntervalId(const T& paramValue) const
                       "paramValue is out of domain");
 
   unsigned int iMax = m_points.size();
-  unsigned int i = 1; // Yes, '1'
-  for (i = 1; i < iMax; ++i) { // Yes, '1'
-    if (paramValue < m_points[i]) {
-      i--;
-      break;
-    }
+  if (!(paramValue < m_points[iMax-1])) {
+    return iMax; // Same as the former linear scan, which ran out of the loop
+  }
+
+  unsigned int i = 0;
+  if (m_guideIds.size() > 0) {
+    unsigned int bucketId = std::min((unsigned int) ((paramValue - m_points[0])*m_guideScale),(unsigned int) m_guideIds.size()-1);
+    i = m_guideIds[bucketId];
+    while (!(paramValue < m_points[i+1])) ++i;
+  }
+  else {
+    i = (std::upper_bound(m_points.begin(),m_points.end(),paramValue) - m_points.begin()) - 1;
   }
 
   return i;
 }
 
+template<class T>
+void
+uqStdOneDGridClass<T>::setGuideTableSize(unsigned int numBuckets)
+{
+  m_guideIds.clear();
+  m_guideScale = 0.;
+
+  unsigned int iMax = m_points.size();
+  if ((numBuckets == 0                       ) ||
+      (iMax       <  2                       ) ||
+      (!(m_points[0] < m_points[iMax-1])     )) {
+    return;
+  }
+
+  // A point lies in bucket 'b' = floor((point - m_points[0])*m_guideScale). Since all points in
+  // buckets before 'b' are below any value in bucket 'b', the search can start at m_guideIds[b].
+  m_guideScale = ((double) numBuckets)/((double) (m_points[iMax-1] - m_points[0]));
+  m_guideIds.resize(numBuckets,0);
+  unsigned int i = 0;
+  for (unsigned int b = 0; b < numBuckets; ++b) {
+    while ((i+1 < iMax) &&
+           ((unsigned int) ((m_points[i+1] - m_points[0])*m_guideScale) < b)) {
+      ++i;
+    }
+    m_guideIds[b] = i;
+  }
+
+  return;
+}
+
 #endif // __UQ_ONE_D_GRID_FUNCTION_H__
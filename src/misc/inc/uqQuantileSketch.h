@@ -0,0 +1,183 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+// 
+// QUESO - a library to support the Quantification of Uncertainty
+// for Estimation, Simulation and Optimization
+//
+// Copyright (C) 2008,2009,2010,2011,2012,2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor, 
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+// 
+// $Id$
+//
+//--------------------------------------------------------------------------
+
+#ifndef __UQ_QUANTILE_SKETCH_H__
+#define __UQ_QUANTILE_SKETCH_H__
+
+#include <uqEnvironment.h>
+#include <uqDefines.h>
+#include <vector>
+#include <iostream>
+
+/*!\file uqQuantileSketch.h
+ * \brief A mergeable streaming quantile sketch. */
+
+//! Default value of the accuracy parameter 'k' of uqQuantileSketchClass.
+#define UQ_QUANTILE_SKETCH_K_ODV 200
+
+/*! \class uqQuantileSketchClass
+ *  \brief A mergeable quantile sketch of a stream of scalars (KLL sketch).
+ *
+ * The sketch keeps a hierarchy of compactors: values retained at level h stand for 2^h
+ * inserted values. When a level is full it is sorted and every other value, starting at an
+ * alternating offset, is promoted to the next level. The capacity of each level decreases
+ * geometrically (factor 2/3) from the top level, whose capacity is \c k, so that the sketch
+ * retains at most about 3k values whatever the number of inserted values.
+ *
+ * Rank queries have an error of order n/k, i.e. the memory is O(1/epsilon) for a relative
+ * rank error epsilon. Minimum and maximum values are kept exactly. Sketches fed on different
+ * processors, or with different pieces of a sequence, can be merged.
+ *
+ * \see Karnin, Lang and Liberty, "Optimal quantile approximation in streams", FOCS 2016.*/
+class uqQuantileSketchClass
+{
+public:
+  //! @name Constructor/Destructor methods
+  //@{
+  //! Constructor, given the accuracy parameter \c k (at least 8).
+  uqQuantileSketchClass(unsigned int k);
+
+  //! Copy constructor.
+  uqQuantileSketchClass(const uqQuantileSketchClass& src);
+
+  //! Destructor.
+  ~uqQuantileSketchClass();
+  //@}
+
+  //! @name Set methods
+  //@{
+  //! Assignment operator.
+  uqQuantileSketchClass& operator= (const uqQuantileSketchClass& rhs);
+  //@}
+
+  //! @name Sketch methods
+  //@{
+  //! Adds \c value to the sketch.
+  void         insert              (double value);
+
+  //! Adds all values summarized by \c src to the sketch.
+  void         merge               (const uqQuantileSketchClass& src);
+
+  //! Merges the sketches of all processors of \c comm, with one all-gather; on output all processors hold the same sketch.
+  void         unifiedMerge        (const uqMpiCommClass& comm);
+
+  //! Removes all values from the sketch.
+  void         clear               ();
+  //@}
+
+  //! @name Query methods
+  //@{
+  //! Accuracy parameter.
+  unsigned int k                   () const;
+
+  //! Number of inserted values.
+  double       count               () const;
+
+  //! Number of values currently retained by the sketch.
+  unsigned int numRetained         () const;
+
+  //! Smallest inserted value.
+  double       minValue            () const;
+
+  //! Largest inserted value.
+  double       maxValue            () const;
+
+  //! Returns the (approximate) fraction of inserted values less than or equal to \c value.
+  double       cdf                 (double value) const;
+
+  //! Returns the (approximate) quantile at \c probability, in [0,1].
+  double       quantile            (double probability) const;
+
+  //! Returns the (approximate) median.
+  double       median              () const;
+
+  //! Returns the (approximate) interquartile range.
+  double       interQuantileRange  () const;
+
+  //! Histogram with the same bins as uqScalarSequenceClass<T>::subHistogram().
+  /*! The first and last bins count the values below \c minHorizontalValue and not below
+   * \c maxHorizontalValue, respectively; the interior bins split [min,max) uniformly. */
+  void         histogram           (double                     minHorizontalValue,
+                                    double                     maxHorizontalValue,
+                                    std::vector<double>&       centers,
+                                    std::vector<unsigned int>& bins) const;
+
+  //! Uniformly sampled CDF, with the same grid as uqScalarSequenceClass<T>::subUniformlySampledCdf().
+  void         uniformlySampledCdf (unsigned int               numEvaluationPoints,
+                                    double&                    minDomainValue,
+                                    double&                    maxDomainValue,
+                                    std::vector<double>&       cdfValues) const;
+  //@}
+
+  //! @name I/O methods
+  //@{
+  //! Prints the size and a few quantiles of the sketch.
+  void         print               (std::ostream& os) const;
+  //@}
+
+private:
+  //! Copies \c src to \c this.
+  void         copy                (const uqQuantileSketchClass& src);
+
+  //! Capacity of the compactor at level \c level.
+  unsigned int capacity            (unsigned int level) const;
+
+  //! Adds one (empty) level on top of the hierarchy of compactors.
+  void         grow                ();
+
+  //! Compacts the lowest full level(s) until the sketch fits in its maximum size.
+  void         compress            ();
+
+  //! Sorted retained values, with the cumulative weight (number of inserted values) up to each of them.
+  void         sortedItems         (std::vector<double>& values,
+                                    std::vector<double>& cumulativeWeights) const;
+
+  //! Number of inserted values strictly less than \c value, given the output of sortedItems().
+  double       rankBelow           (const std::vector<double>& values,
+                                    const std::vector<double>& cumulativeWeights,
+                                    double                     value) const;
+
+  //! Serializes the sketch into \c buffer.
+  void         pack                (std::vector<double>& buffer) const;
+
+  //! Merges the sketch serialized at \c buffer into \c this.
+  void         mergePacked         (const double* buffer);
+
+  unsigned int                     m_k;
+  double                           m_count;
+  double                           m_minValue;
+  double                           m_maxValue;
+  unsigned int                     m_numRetained;
+  unsigned int                     m_maxNumRetained;
+  bool                             m_compactionOffset;
+  std::vector<std::vector<double> > m_compactors;
+};
+
+std::ostream& operator<<(std::ostream& os, const uqQuantileSketchClass& obj);
+
+#endif // __UQ_QUANTILE_SKETCH_H__
@@ -0,0 +1,584 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// QUESO - a library to support the Quantification of Uncertainty
+// for Estimation, Simulation and Optimization
+//
+// Copyright (C) 2008,2009,2010,2011,2012,2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+//
+// $Id$
+//
+//--------------------------------------------------------------------------
+
+#ifndef __UQ_GAUSSIAN_RANDOM_FIELD_SAMPLER_H__
+#define __UQ_GAUSSIAN_RANDOM_FIELD_SAMPLER_H__
+
+#include <uqVectorSpace.h>
+#include <uqFft.h>
+#include <uqEnvironment.h>
+#include <uqDefines.h>
+#include <vector>
+#include <complex>
+#include <algorithm>
+#include <cmath>
+
+// Relative tolerance used to decide whether field positions lie on grid nodes.
+#define UQ_GRF_SAMPLER_GRID_REL_TOL             1.e-8
+
+// Negative (or complex) parts of the embedding spectrum below this fraction of its largest
+// entry are rounding noise and are clipped.
+#define UQ_GRF_SAMPLER_SPECTRUM_REL_TOL         1.e-8
+
+// Largest refinement of the minimal circulant embedding tried before giving up on it.
+#define UQ_GRF_SAMPLER_MAX_EMBEDDING_REFINEMENT 4
+
+// Fraction of the field variance that truncated Karhunen-Loeve expansions may discard.
+#define UQ_GRF_SAMPLER_KL_ENERGY_REL_TOL        1.e-8
+
+/*!
+ * \file uqGaussianRandomFieldSampler.h
+ * \brief Fast sampling of Gaussian random fields at a fixed set of positions.
+ *
+ * \class uqGaussianRandomFieldSamplerClass
+ * \brief A class that draws zero mean Gaussian vectors with the covariance of a random field.
+ *
+ * The sampled vector holds \c numPositions blocks of \c blockSize values, one block per field
+ * position (\c blockSize is 1 for scalar fields). Two factorizations of the covariance are
+ * supported, and both are computed once and then reused for every realization:
+ * - circulant embedding: when the positions are the nodes of a regular grid and the covariance
+ * is stationary, the covariance is embedded in a periodic one on a larger grid, which the
+ * multidimensional FFT diagonalizes. Setup and realizations cost \f$ O(N \log N) \f$, where
+ * \f$ N \f$ is the size of the embedding grid, and no covariance matrix is ever formed. Each
+ * complex transform yields two independent realizations, so every other call is free.
+ * - truncated Karhunen-Loeve expansion: for arbitrary positions, the covariance matrix is
+ * decomposed into eigenpairs, and only the leading modes that carry all but a negligible
+ * fraction of the variance are kept. Realizations then cost \f$ O(n r) \f$ for \f$ r \f$
+ * retained modes, instead of \f$ O(n^2) \f$ for a dense Cholesky factor. */
+
+template <class V, class M>
+class uqGaussianRandomFieldSamplerClass
+{
+public:
+  //! @name Constructor/Destructor methods
+  //@{
+  //! Constructor.
+  /*! \c imageSpace is the space of the sampled vectors. \c blockSpace is the space of the field
+   * values at one position; it must be NULL for scalar fields. */
+  uqGaussianRandomFieldSamplerClass(const uqVectorSpaceClass<V,M>& imageSpace,
+                                    const uqVectorSpaceClass<V,M>* blockSpace);
+
+  //! Destructor.
+  ~uqGaussianRandomFieldSamplerClass();
+  //@}
+
+  //! @name Grid methods
+  //@{
+  //! Checks whether \c positions are the nodes of a full regular grid, each one listed once.
+  /*! On success, \c gridCounts and \c gridSpacings hold the number of nodes and the spacing in
+   * each dimension, and \c gridIndices holds the linear grid index of each position, the first
+   * dimension running fastest. Node 0 is the grid corner with the smallest coordinates. */
+  template <class P_V>
+  static bool regularGrid    (const std::vector<P_V*>&         positions,
+                                    std::vector<unsigned int>& gridCounts,
+                                    std::vector<double>&       gridSpacings,
+                                    std::vector<unsigned int>& gridIndices);
+
+  //! Sizes of the periodic grid that embeds a grid of \c gridCounts nodes.
+  /*! The minimal embedding doubles every dimension; \c refinement enlarges it further. Sizes are
+   * rounded up to fast FFT sizes. */
+  static void embeddingCounts(const std::vector<unsigned int>& gridCounts,
+                                    unsigned int               refinement,
+                                    std::vector<unsigned int>& counts);
+
+  //! Signed lag, in grid steps along each dimension, represented by entry \c embeddingIndex of a periodic grid.
+  static void embeddingLag   (      unsigned int               embeddingIndex,
+                              const std::vector<unsigned int>& counts,
+                                    std::vector<int>&          lag);
+  //@}
+
+  //! @name Setup methods
+  //@{
+  //! Sets up circulant embedding sampling.
+  /*! \c gridCounts and \c gridIndices describe the field positions, as returned by
+   * regularGrid(). \c embeddedCovs holds, for each entry of the periodic grid of sizes
+   * \c counts, the \c blockSize x \c blockSize covariance (row-major) between the field at the
+   * corresponding lag (see embeddingLag()) and the field at lag zero. Returns \c false, leaving
+   * \c this unchanged, if the embedding is not nonnegative definite; a larger embedding may
+   * then succeed. */
+  bool setCirculantEmbedding(const std::vector<unsigned int>& gridCounts,
+                             const std::vector<unsigned int>& gridIndices,
+                             const std::vector<unsigned int>& counts,
+                             const std::vector<double>&       embeddedCovs);
+
+  //! Sets up sampling through the truncated Karhunen-Loeve expansion of \c covMatrix.
+  void setKarhunenLoeve     (const M&                         covMatrix);
+
+  //! Whether realizations come from the circulant embedding.
+  bool         usesCirculantEmbedding() const;
+
+  //! Number of modes of the expansion: Fourier modes of the embedding, or retained Karhunen-Loeve modes.
+  unsigned int numModes              () const;
+  //@}
+
+  //! @name Sampling methods
+  //@{
+  //! Draws a zero mean realization into \c values.
+  void         realization           (V& values);
+  //@}
+
+private:
+  //! In place, unnormalized multidimensional forward FFT of \c data, laid out on a grid of sizes \c counts.
+  void         transform             (const std::vector<unsigned int>& counts, std::vector<std::complex<double> >& data);
+
+  const uqBaseEnvironmentClass&        m_env;
+  const uqVectorSpaceClass<V,M>&       m_imageSpace;
+  const uqVectorSpaceClass<V,M>*       m_blockSpace;
+        unsigned int                   m_blockSize;
+        unsigned int                   m_numPositions;
+        bool                           m_isSet;
+        bool                           m_usesCirculantEmbedding;
+        unsigned int                   m_numModes;
+
+  // Circulant embedding: sizes of the periodic grid, its entry for each position, and, per
+  // frequency, a real square root (row-major) of the spectral block, scaled by 1/sqrt(N).
+        std::vector<unsigned int>      m_counts;
+        std::vector<unsigned int>      m_embeddingIndices;
+        std::vector<double>            m_spectralFactors;
+        bool                           m_hasSpareRealization;
+        std::vector<double>            m_spareRealization;
+        uqFftClass<std::complex<double> > m_fftObj;
+
+  // Truncated Karhunen-Loeve expansion: eigenvectors scaled by the square root of their eigenvalues.
+        std::vector<double>            m_klModes;
+};
+// Constructor -------------------------------------
+template <class V, class M>
+uqGaussianRandomFieldSamplerClass<V,M>::uqGaussianRandomFieldSamplerClass(
+  const uqVectorSpaceClass<V,M>& imageSpace,
+  const uqVectorSpaceClass<V,M>* blockSpace)
+  :
+  m_env                   (imageSpace.env()),
+  m_imageSpace            (imageSpace),
+  m_blockSpace            (blockSpace),
+  m_blockSize             (1),
+  m_numPositions          (imageSpace.dimLocal()),
+  m_isSet                 (false),
+  m_usesCirculantEmbedding(false),
+  m_numModes              (0),
+  m_counts                (0),
+  m_embeddingIndices      (0),
+  m_spectralFactors       (0),
+  m_hasSpareRealization   (false),
+  m_spareRealization      (0),
+  m_fftObj                (imageSpace.env()),
+  m_klModes               (0)
+{
+  if (m_blockSpace) {
+    m_blockSize = m_blockSpace->dimLocal();
+    UQ_FATAL_TEST_MACRO((m_blockSize == 0) || ((imageSpace.dimLocal() % m_blockSize) != 0),
+                        m_env.worldRank(),
+                        "uqGaussianRandomFieldSamplerClass<V,M>::constructor()",
+                        "image space dimension is not a multiple of the block dimension");
+    m_numPositions = imageSpace.dimLocal()/m_blockSize;
+  }
+}
+// Destructor --------------------------------------
+template <class V, class M>
+uqGaussianRandomFieldSamplerClass<V,M>::~uqGaussianRandomFieldSamplerClass()
+{
+}
+// Grid methods ------------------------------------
+template <class V, class M>
+template <class P_V>
+bool
+uqGaussianRandomFieldSamplerClass<V,M>::regularGrid(
+  const std::vector<P_V*>&         positions,
+        std::vector<unsigned int>& gridCounts,
+        std::vector<double>&       gridSpacings,
+        std::vector<unsigned int>& gridIndices)
+{
+  unsigned int numPositions = positions.size();
+  if (numPositions < 2) return false;
+
+  unsigned int dim = positions[0]->sizeLocal();
+  gridCounts.assign(dim,1);
+  gridSpacings.assign(dim,0.);
+  gridIndices.assign(numPositions,0);
+
+  std::vector<double> coords(numPositions,0.);
+  std::vector<double> sortedCoords(numPositions,0.);
+  unsigned int stride = 1;
+  for (unsigned int d = 0; d < dim; ++d) {
+    for (unsigned int i = 0; i < numPositions; ++i) {
+      if (positions[i]->sizeLocal() != dim) return false;
+      coords[i] = (*(positions[i]))[d];
+    }
+    sortedCoords = coords;
+    std::sort(sortedCoords.begin(),sortedCoords.end());
+    double minValue = sortedCoords[0];
+    double range    = sortedCoords[numPositions-1] - minValue;
+    if (range <= 0.) continue;
+
+    // Distinct coordinates along this dimension must be equally spaced
+    double tol = UQ_GRF_SAMPLER_GRID_REL_TOL*range;
+    unsigned int count = 1;
+    for (unsigned int j = 1; j < numPositions; ++j) {
+      if (sortedCoords[j] - sortedCoords[j-1] > tol) ++count;
+    }
+    if (count > numPositions/stride) return false;
+    double spacing = range/((double) (count-1));
+    for (unsigned int i = 0; i < numPositions; ++i) {
+      double       t   = (coords[i] - minValue)/spacing;
+      unsigned int idx = (unsigned int) (t + .5);
+      if (std::fabs(t - (double) idx)*spacing > tol) return false;
+      gridIndices[i] += idx*stride;
+    }
+    gridCounts  [d] = count;
+    gridSpacings[d] = spacing;
+    stride *= count;
+  }
+
+  // Every grid node must be listed exactly once
+  if (stride != numPositions) return false;
+  std::vector<bool> isListed(numPositions,false);
+  for (unsigned int i = 0; i < numPositions; ++i) {
+    if (isListed[gridIndices[i]]) return false;
+    isListed[gridIndices[i]] = true;
+  }
+
+  return true;
+}
+// --------------------------------------------------
+template <class V, class M>
+void
+uqGaussianRandomFieldSamplerClass<V,M>::embeddingCounts(
+  const std::vector<unsigned int>& gridCounts,
+        unsigned int               refinement,
+        std::vector<unsigned int>& counts)
+{
+  counts.resize(gridCounts.size(),1);
+  for (unsigned int d = 0; d < gridCounts.size(); ++d) {
+    if (gridCounts[d] > 1) {
+      counts[d] = uqFftClass<std::complex<double> >::fastSize(2*(gridCounts[d]-1)*refinement);
+    }
+    else {
+      counts[d] = 1;
+    }
+  }
+
+  return;
+}
+// --------------------------------------------------
+template <class V, class M>
+void
+uqGaussianRandomFieldSamplerClass<V,M>::embeddingLag(
+        unsigned int               embeddingIndex,
+  const std::vector<unsigned int>& counts,
+        std::vector<int>&          lag)
+{
+  lag.resize(counts.size(),0);
+  for (unsigned int d = 0; d < counts.size(); ++d) {
+    unsigned int j = embeddingIndex % counts[d];
+    embeddingIndex /= counts[d];
+    if (2*j <= counts[d]) lag[d] = (int) j;
+    else                  lag[d] = (int) j - (int) counts[d];
+  }
+
+  return;
+}
+// Setup methods -----------------------------------
+template <class V, class M>
+bool
+uqGaussianRandomFieldSamplerClass<V,M>::setCirculantEmbedding(
+  const std::vector<unsigned int>& gridCounts,
+  const std::vector<unsigned int>& gridIndices,
+  const std::vector<unsigned int>& counts,
+  const std::vector<double>&       embeddedCovs)
+{
+  unsigned int numEmbeddingPoints = 1;
+  for (unsigned int d = 0; d < counts.size(); ++d) {
+    numEmbeddingPoints *= counts[d];
+  }
+  unsigned int blockSq = m_blockSize*m_blockSize;
+
+  UQ_FATAL_TEST_MACRO((gridCounts.size()   != counts.size()        ) ||
+                      (gridIndices.size()  != m_numPositions       ) ||
+                      (embeddedCovs.size() != numEmbeddingPoints*blockSq),
+                      m_env.worldRank(),
+                      "uqGaussianRandomFieldSamplerClass<V,M>::setCirculantEmbedding()",
+                      "invalid input sizes");
+
+  // Spectrum of each entry of the covariance blocks
+  std::vector<std::complex<double> > data(numEmbeddingPoints,std::complex<double>(0.,0.));
+  std::vector<double> spectra(numEmbeddingPoints*blockSq,0.);
+  double maxAbs  = 0.;
+  double maxImag = 0.;
+  for (unsigned int ab = 0; ab < blockSq; ++ab) {
+    for (unsigned int e = 0; e < numEmbeddingPoints; ++e) {
+      data[e] = std::complex<double>(embeddedCovs[e*blockSq + ab],0.);
+    }
+    this->transform(counts,data);
+    for (unsigned int w = 0; w < numEmbeddingPoints; ++w) {
+      spectra[w*blockSq + ab] = data[w].real();
+      maxAbs  = std::max(maxAbs, std::fabs(data[w].real()));
+      maxImag = std::max(maxImag,std::fabs(data[w].imag()));
+    }
+  }
+  if (maxAbs <= 0.) return false;
+
+  // A complex spectrum means the embedded covariance is not even, and negative eigenvalues
+  // mean the embedding is not a covariance
+  double tol = UQ_GRF_SAMPLER_SPECTRUM_REL_TOL*maxAbs;
+  if (maxImag > tol) return false;
+
+  double invSqrtN = 1./std::sqrt((double) numEmbeddingPoints);
+  std::vector<double> factors(numEmbeddingPoints*blockSq,0.);
+  if (m_blockSize == 1) {
+    for (unsigned int w = 0; w < numEmbeddingPoints; ++w) {
+      if (spectra[w] < -tol) return false;
+      factors[w] = std::sqrt(std::max(spectra[w],0.))*invSqrtN;
+    }
+  }
+  else {
+    V blockValues (m_blockSpace->zeroVector());
+    M block       (blockValues);
+    M blockVectors(blockValues);
+    for (unsigned int w = 0; w < numEmbeddingPoints; ++w) {
+      const double* spectrum = &spectra[w*blockSq];
+      for (unsigned int a = 0; a < m_blockSize; ++a) {
+        for (unsigned int b = 0; b < m_blockSize; ++b) {
+          block(a,b) = .5*(spectrum[a*m_blockSize + b] + spectrum[b*m_blockSize + a]);
+        }
+      }
+      block.eigen(blockValues,&blockVectors);
+      for (unsigned int c = 0; c < m_blockSize; ++c) {
+        if (blockValues[c] < -tol) return false;
+        double scale = std::sqrt(std::max(blockValues[c],0.))*invSqrtN;
+        for (unsigned int a = 0; a < m_blockSize; ++a) {
+          factors[w*blockSq + a*m_blockSize + c] = blockVectors(a,c)*scale;
+        }
+      }
+    }
+  }
+
+  // Entry of the periodic grid holding each position
+  m_embeddingIndices.assign(m_numPositions,0);
+  for (unsigned int i = 0; i < m_numPositions; ++i) {
+    unsigned int gridIndex = gridIndices[i];
+    unsigned int stride    = 1;
+    for (unsigned int d = 0; d < counts.size(); ++d) {
+      m_embeddingIndices[i] += (gridIndex % gridCounts[d])*stride;
+      gridIndex /= gridCounts[d];
+      stride    *= counts[d];
+    }
+  }
+
+  m_counts = counts;
+  m_spectralFactors.swap(factors);
+  m_klModes.clear();
+  m_numModes               = numEmbeddingPoints;
+  m_hasSpareRealization    = false;
+  m_usesCirculantEmbedding = true;
+  m_isSet                  = true;
+
+  return true;
+}
+// --------------------------------------------------
+template <class V, class M>
+void
+uqGaussianRandomFieldSamplerClass<V,M>::setKarhunenLoeve(const M& covMatrix)
+{
+  unsigned int size = m_numPositions*m_blockSize;
+
+  UQ_FATAL_TEST_MACRO((covMatrix.numRowsLocal() != size) || (covMatrix.numCols() != size),
+                      m_env.worldRank(),
+                      "uqGaussianRandomFieldSamplerClass<V,M>::setKarhunenLoeve()",
+                      "invalid covariance matrix size");
+
+  // eigen() overwrites part of the matrix it decomposes
+  V eigenValues (m_imageSpace.zeroVector());
+  M eigenVectors(eigenValues);
+  M workMatrix  (covMatrix);
+  workMatrix.eigen(eigenValues,&eigenVectors);
+
+  std::vector<std::pair<double,unsigned int> > sortedEigenValues(size);
+  double totalVariance = 0.;
+  for (unsigned int j = 0; j < size; ++j) {
+    sortedEigenValues[j] = std::make_pair(-eigenValues[j],j);
+    if (eigenValues[j] > 0.) totalVariance += eigenValues[j];
+  }
+  std::sort(sortedEigenValues.begin(),sortedEigenValues.end());
+
+  // Keep the leading modes until the discarded variance is negligible
+  unsigned int numModes = 0;
+  double tailVariance = totalVariance;
+  while ((numModes < size                                                   ) &&
+         (-sortedEigenValues[numModes].first > 0.                            ) &&
+         (tailVariance > UQ_GRF_SAMPLER_KL_ENERGY_REL_TOL*totalVariance)) {
+    tailVariance += sortedEigenValues[numModes].first;
+    ++numModes;
+  }
+
+  m_klModes.assign(numModes*size,0.);
+  for (unsigned int r = 0; r < numModes; ++r) {
+    double       scale = std::sqrt(-sortedEigenValues[r].first);
+    unsigned int col   = sortedEigenValues[r].second;
+    for (unsigned int i = 0; i < size; ++i) {
+      m_klModes[r*size + i] = scale*eigenVectors(i,col);
+    }
+  }
+
+  m_counts.clear();
+  m_embeddingIndices.clear();
+  m_spectralFactors.clear();
+  m_numModes               = numModes;
+  m_hasSpareRealization    = false;
+  m_usesCirculantEmbedding = false;
+  m_isSet                  = true;
+
+  if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 3)) {
+    *m_env.subDisplayFile() << "In uqGaussianRandomFieldSamplerClass<V,M>::setKarhunenLoeve()"
+                            << ": kept " << numModes
+                            << " of "    << size
+                            << " modes, discarding a variance fraction of " << tailVariance/std::max(totalVariance,1.e-300)
+                            << std::endl;
+  }
+
+  return;
+}
+// --------------------------------------------------
+template <class V, class M>
+bool
+uqGaussianRandomFieldSamplerClass<V,M>::usesCirculantEmbedding() const
+{
+  return m_usesCirculantEmbedding;
+}
+// --------------------------------------------------
+template <class V, class M>
+unsigned int
+uqGaussianRandomFieldSamplerClass<V,M>::numModes() const
+{
+  return m_numModes;
+}
+// Sampling methods --------------------------------
+template <class V, class M>
+void
+uqGaussianRandomFieldSamplerClass<V,M>::realization(V& values)
+{
+  unsigned int size = m_numPositions*m_blockSize;
+
+  UQ_FATAL_TEST_MACRO(!m_isSet,
+                      m_env.worldRank(),
+                      "uqGaussianRandomFieldSamplerClass<V,M>::realization()",
+                      "no covariance factorization has been set");
+
+  UQ_FATAL_TEST_MACRO(values.sizeLocal() != size,
+                      m_env.worldRank(),
+                      "uqGaussianRandomFieldSamplerClass<V,M>::realization()",
+                      "invalid input vector size");
+
+  const uqRngBaseClass* rngObject = m_env.rngObject();
+
+  if (m_usesCirculantEmbedding) {
+    if (m_hasSpareRealization) {
+      for (unsigned int i = 0; i < size; ++i) {
+        values[i] = m_spareRealization[i];
+      }
+      m_hasSpareRealization = false;
+      return;
+    }
+
+    // The real and imaginary parts of the transformed complex noise are two independent realizations
+    unsigned int numEmbeddingPoints = m_spectralFactors.size()/(m_blockSize*m_blockSize);
+    std::vector<std::complex<double> > noise(numEmbeddingPoints*m_blockSize,std::complex<double>(0.,0.));
+    for (unsigned int j = 0; j < noise.size(); ++j) {
+      double realPart = rngObject->gaussianSample(1.);
+      noise[j] = std::complex<double>(realPart,rngObject->gaussianSample(1.));
+    }
+
+    std::vector<std::complex<double> > data(numEmbeddingPoints,std::complex<double>(0.,0.));
+    m_spareRealization.resize(size,0.);
+    for (unsigned int c = 0; c < m_blockSize; ++c) {
+      for (unsigned int w = 0; w < numEmbeddingPoints; ++w) {
+        const double* factor = &m_spectralFactors[(w*m_blockSize + c)*m_blockSize];
+        std::complex<double> sum(0.,0.);
+        for (unsigned int b = 0; b < m_blockSize; ++b) {
+          sum += factor[b]*noise[w*m_blockSize + b];
+        }
+        data[w] = sum;
+      }
+      this->transform(m_counts,data);
+      for (unsigned int i = 0; i < m_numPositions; ++i) {
+        const std::complex<double>& value = data[m_embeddingIndices[i]];
+        values            [i*m_blockSize + c] = value.real();
+        m_spareRealization[i*m_blockSize + c] = value.imag();
+      }
+    }
+    m_hasSpareRealization = true;
+  }
+  else {
+    values.cwSet(0.);
+    for (unsigned int r = 0; r < m_numModes; ++r) {
+      double        xi   = rngObject->gaussianSample(1.);
+      const double* mode = &m_klModes[r*size];
+      for (unsigned int i = 0; i < size; ++i) {
+        values[i] += xi*mode[i];
+      }
+    }
+  }
+
+  return;
+}
+// Private methods ---------------------------------
+template <class V, class M>
+void
+uqGaussianRandomFieldSamplerClass<V,M>::transform(
+  const std::vector<unsigned int>&          counts,
+        std::vector<std::complex<double> >& data)
+{
+  unsigned int totalSize = data.size();
+  std::vector<std::complex<double> > line(0);
+  std::vector<std::complex<double> > lineResult(0);
+
+  // One dimension at a time, over every line of the grid along that dimension
+  unsigned int stride = 1;
+  for (unsigned int d = 0; d < counts.size(); ++d) {
+    unsigned int count = counts[d];
+    if (count > 1) {
+      line.resize(count);
+      for (unsigned int outer = 0; outer < totalSize; outer += stride*count) {
+        for (unsigned int inner = 0; inner < stride; ++inner) {
+          unsigned int base = outer + inner;
+          for (unsigned int j = 0; j < count; ++j) {
+            line[j] = data[base + j*stride];
+          }
+          m_fftObj.forward(line,count,lineResult);
+          for (unsigned int j = 0; j < count; ++j) {
+            data[base + j*stride] = lineResult[j];
+          }
+        }
+      }
+    }
+    stride *= count;
+  }
+
+  return;
+}
+
+#endif // __UQ_GAUSSIAN_RANDOM_FIELD_SAMPLER_H__
@@ -0,0 +1,972 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+// 
+// QUESO - a library to support the Quantification of Uncertainty
+// for Estimation, Simulation and Optimization
+//
+// Copyright (C) 2008,2009,2010,2011,2012,2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor, 
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+// 
+// $Id$
+//
+//--------------------------------------------------------------------------
+
+#ifndef __UQ_HMC_SG_H__
+#define __UQ_HMC_SG_H__
+
+#include <uqHamiltonianMCSGOptions.h>
+#include <uqMetropolisHastingsSG1.h>
+#include <uqVectorRV.h>
+#include <uqVectorSpace.h>
+#include <uqScalarFunctionSynchronizer.h>
+#include <uqSequenceOfVectors.h>
+#include <sys/time.h>
+
+#define UQ_HMC_SG_MAX_ENERGY_ERROR   1000. // Energy error beyond which a trajectory is flagged as divergent
+#define UQ_HMC_SG_DA_GAMMA           0.05  // Dual averaging constants of Hoffman and Gelman (2014)
+#define UQ_HMC_SG_DA_T0              10.
+#define UQ_HMC_SG_DA_KAPPA           0.75
+#define UQ_HMC_SG_MASS_REGULARIZER   1.e-3 // Shrinkage target of the adapted inverse mass matrix
+#define UQ_HMC_SG_MAX_STEP_SEARCHES  100
+
+/*! \file uqHamiltonianMCSG.h
+ * \brief A templated class that represents a gradient based (MALA, HMC, NUTS) generator of samples.
+ *
+ * \class uqHamiltonianMCSGClass
+ * \brief A templated class that represents a gradient based generator of samples.
+ *
+ * This class is a sibling of uqMetropolisHastingsSGClass: it generates a Markov chain targeting the pdf
+ * of a vector random variable, but its proposals follow Hamiltonian dynamics driven by the gradient of
+ * the log target, which is requested from the target pdf through the 'gradVector' argument of lnValue().
+ * Three algorithms are available (option '\<prefix\>_hmc_algorithm'):
+ <list type=number>
+ <item> 'mala': Metropolis adjusted Langevin algorithm, i.e., HMC with a single leapfrog step;
+ <item> 'hmc': Hamiltonian Monte Carlo with a fixed number of leapfrog steps;
+ <item> 'nuts': the No-U-Turn sampler (slice variant, Hoffman and Gelman, JMLR 15 (2014) 1593-1623).
+ </list>
+ * During the first '\<prefix\>_hmc_warmupSize' positions the step size is tuned by dual averaging
+ * towards '\<prefix\>_hmc_targetAcceptance' and, if requested, the inverse mass matrix is set to a
+ * regularized (diagonal or dense) estimate of the posterior covariance, computed with the same recursive
+ * update used by adaptive Metropolis. Warmup positions are kept in the raw chain, as with the
+ * adaptive Metropolis positions of uqMetropolisHastingsSGClass; filter them out with a burn-in. */
+
+template <class P_V,class P_M>
+class uqHamiltonianMCSGClass
+{
+public:
+  //! @name Constructor/Destructor methods
+  //@{
+  //! Constructor.
+  /*! Requirements: 1) the image set of the vector random variable 'sourceRv' should belong to a
+   * vector space of dimension equal to the size of the vector 'initialPosition' and 2) if
+   * 'inputInverseMassMatrix' is not NULL, it should be square, symmetric positive definite and of size
+   * equal to the size of 'initialPosition'; otherwise the identity is used. The constructor reads
+   * options that begin with the string '\<prefix\>_hmc_'. Options reading is handled by class
+   * 'uqHamiltonianMCSGOptionsClass'. */
+  uqHamiltonianMCSGClass(const char*                         prefix,
+                         const uqHmcOptionsValuesClass*      alternativeOptionsValues,
+                         const uqBaseVectorRVClass<P_V,P_M>& sourceRv,
+                         const P_V&                          initialPosition,
+                         const P_M*                          inputInverseMassMatrix);
+
+  //! Destructor
+  ~uqHamiltonianMCSGClass();
+  //@}
+
+  //! @name Statistical methods
+  //@{
+  //! Method to generate the chain.
+  /*! Sets the size and the contents of 'workingChain' using the algorithm options set in the
+   * constructor. If not NULL, 'workingLogLikelihoodValues' and 'workingLogTargetValues' are set
+   * accordingly. */
+  void         generateSequence   (uqBaseVectorSequenceClass<P_V,P_M>& workingChain,
+                                   uqScalarSequenceClass<double>*      workingLogLikelihoodValues,
+                                   uqScalarSequenceClass<double>*      workingLogTargetValues);
+
+  //! Leapfrog step size in use (the adapted one, after warmup).
+  double       stepSize           () const;
+
+  //! Inverse mass matrix in use (the adapted one, after warmup).
+  const P_M&   inverseMassMatrix  () const;
+  //@}
+
+  //! @name I/O methods
+  //@{
+  //! Prints the counters of the last generated chain.
+  void         print              (std::ostream& os) const;
+  //@}
+
+private:
+  //! State of a NUTS subtree: its leftmost and rightmost points, and the point it proposes.
+  struct uqHmcTreeStruct
+  {
+    uqHmcTreeStruct(const P_V& zeroVector);
+
+    P_V          minusPosition;
+    P_V          minusMomentum;
+    P_V          minusGrad;
+    P_V          plusPosition;
+    P_V          plusMomentum;
+    P_V          plusGrad;
+    P_V          proposedPosition;
+    P_V          proposedGrad;
+    double       proposedLogTarget;
+    double       proposedLogLikelihood;
+    unsigned int numValid;
+    bool         keepGoing;
+    double       sumAlpha;
+    unsigned int numAlpha;
+  };
+
+  //! Computes the log target and its gradient; returns -INFINITY (and a null gradient) out of the target support.
+  double logTargetAndGrad         (const P_V& position, P_V& grad, double& logLikelihood);
+
+  //! Returns 0.5 * momentum^T * inverseMassMatrix * momentum.
+  double kineticEnergy            (const P_V& momentum) const;
+
+  //! Draws a momentum from N(0,massMatrix).
+  void   sampleMomentum           (P_V& momentum) const;
+
+  //! Performs one leapfrog step of size 'stepSize'; returns false if the trajectory leaves the target support.
+  bool   leapfrog                 (P_V& position, P_V& momentum, P_V& grad, double& logTarget, double& logLikelihood, double stepSize);
+
+  //! Heuristic for a first step size (Algorithm 4 of Hoffman and Gelman).
+  double findReasonableStepSize   (const P_V& position, const P_V& grad, double logTarget);
+
+  //! One HMC (or MALA) transition; returns the acceptance probability, used by dual averaging.
+  double hmcTransition            (P_V& position, P_V& grad, double& logTarget, double& logLikelihood, unsigned int numSteps);
+
+  //! One NUTS transition; returns the mean acceptance probability over the tree, used by dual averaging.
+  double nutsTransition           (P_V& position, P_V& grad, double& logTarget, double& logLikelihood);
+
+  //! Recursively builds a NUTS subtree of depth 'depth' in direction 'direction' (Algorithm 3 of Hoffman and Gelman).
+  void   buildTree                (const P_V& position, const P_V& momentum, const P_V& grad, double logSlice, int direction,
+                                   unsigned int depth, double initialJoint, uqHmcTreeStruct& tree);
+
+  //! Returns true if the trajectory from 'minusPosition' to 'plusPosition' has not yet made a U-turn.
+  bool   noUTurn                  (const P_V& minusPosition, const P_V& plusPosition, const P_V& minusMomentum, const P_V& plusMomentum) const;
+
+  //! Updates the inverse mass matrix with the chain positions since the last update.
+  void   updateInverseMassMatrix  (const uqBaseVectorSequenceClass<P_V,P_M>& workingChain, unsigned int positionId);
+
+  //! Generates the chain.
+  void   generateFullChain        (const P_V&                          valuesOf1stPosition,
+                                   unsigned int                        chainSize,
+                                   uqBaseVectorSequenceClass<P_V,P_M>& workingChain,
+                                   uqScalarSequenceClass<double>*      workingLogLikelihoodValues,
+                                   uqScalarSequenceClass<double>*      workingLogTargetValues);
+
+  const uqBaseEnvironmentClass&                     m_env;
+  const uqVectorSpaceClass <P_V,P_M>&               m_vectorSpace;
+  const uqBaseJointPdfClass<P_V,P_M>&               m_targetPdf;
+        P_V                                         m_initialPosition;
+        P_M                                         m_inverseMassMatrix;
+        P_M                                         m_lowerCholInverseMassMatrix;
+  const uqScalarFunctionSynchronizerClass<P_V,P_M>* m_targetPdfSynchronizer;
+
+        double                                      m_stepSize;
+        double                                      m_lastChainSize;
+        P_V*                                        m_lastMean;
+        P_M*                                        m_lastAdaptedCovMatrix;
+
+        unsigned int                                m_numTargetCalls;
+        unsigned int                                m_numRejections;
+        unsigned int                                m_numDivergences;
+        unsigned int                                m_numOutOfTargetSupport;
+        unsigned long                               m_numLeapfrogSteps;
+        double                                      m_runTime;
+
+        uqHmcOptionsValuesClass                     m_alternativeOptionsValues;
+        uqHamiltonianMCSGOptionsClass*              m_optionsObj;
+};
+//! Prints the object \c obj, overloading an operator.
+template<class P_V,class P_M>
+std::ostream& operator<<(std::ostream& os, const uqHamiltonianMCSGClass<P_V,P_M>& obj);
+
+// Constructor -------------------------------------
+template<class P_V,class P_M>
+uqHamiltonianMCSGClass<P_V,P_M>::uqHamiltonianMCSGClass(
+  /*! Prefix                     */ const char*                         prefix,
+  /*! Options (if no input file) */ const uqHmcOptionsValuesClass*      alternativeOptionsValues,
+  /*! The source RV              */ const uqBaseVectorRVClass<P_V,P_M>& sourceRv,
+  /*! Initial chain position     */ const P_V&                          initialPosition,
+  /*! Inverse mass matrix        */ const P_M*                          inputInverseMassMatrix)
+  :
+  m_env                       (sourceRv.env()),
+  m_vectorSpace               (sourceRv.imageSet().vectorSpace()),
+  m_targetPdf                 (sourceRv.pdf()),
+  m_initialPosition           (initialPosition),
+  m_inverseMassMatrix         (m_vectorSpace.zeroVector(),1.),
+  m_lowerCholInverseMassMatrix(m_vectorSpace.zeroVector(),1.),
+  m_targetPdfSynchronizer     (new uqScalarFunctionSynchronizerClass<P_V,P_M>(m_targetPdf,m_initialPosition)),
+  m_stepSize                  (0.),
+  m_lastChainSize             (0),
+  m_lastMean                  (NULL),
+  m_lastAdaptedCovMatrix      (NULL),
+  m_numTargetCalls            (0),
+  m_numRejections             (0),
+  m_numDivergences            (0),
+  m_numOutOfTargetSupport     (0),
+  m_numLeapfrogSteps          (0),
+  m_runTime                   (0.),
+  m_alternativeOptionsValues  (),
+  m_optionsObj                (NULL)
+{
+  if (alternativeOptionsValues) m_alternativeOptionsValues = *alternativeOptionsValues;
+  if (m_env.optionsInputFileName() == "") {
+    m_optionsObj = new uqHamiltonianMCSGOptionsClass(m_env,prefix,m_alternativeOptionsValues);
+  }
+  else {
+    m_optionsObj = new uqHamiltonianMCSGOptionsClass(m_env,prefix);
+    m_optionsObj->scanOptionsValues();
+  }
+  m_stepSize = m_optionsObj->m_ov.m_stepSize;
+
+  if (m_env.subDisplayFile()) {
+    *m_env.subDisplayFile() << "Entering uqHamiltonianMCSGClass<P_V,P_M>::constructor()"
+                            << ": prefix = " << prefix
+                            << ", alternativeOptionsValues = " << alternativeOptionsValues
+                            << ", m_env.optionsInputFileName() = " << m_env.optionsInputFileName()
+                            << std::endl;
+  }
+
+  UQ_FATAL_TEST_MACRO(sourceRv.imageSet().vectorSpace().dimLocal() != initialPosition.sizeLocal(),
+                      m_env.worldRank(),
+                      "uqHamiltonianMCSGClass<P_V,P_M>::constructor()",
+                      "'sourceRv' and 'initialPosition' should have equal dimensions");
+
+  UQ_FATAL_TEST_MACRO((m_optionsObj->m_ov.m_algorithm != "mala") &&
+                      (m_optionsObj->m_ov.m_algorithm != "hmc" ) &&
+                      (m_optionsObj->m_ov.m_algorithm != "nuts"),
+                      m_env.worldRank(),
+                      "uqHamiltonianMCSGClass<P_V,P_M>::constructor()",
+                      "invalid algorithm: should be 'mala', 'hmc' or 'nuts'");
+
+  UQ_FATAL_TEST_MACRO((m_optionsObj->m_ov.m_massAdaptation != "none"    ) &&
+                      (m_optionsObj->m_ov.m_massAdaptation != "diagonal") &&
+                      (m_optionsObj->m_ov.m_massAdaptation != "dense"   ),
+                      m_env.worldRank(),
+                      "uqHamiltonianMCSGClass<P_V,P_M>::constructor()",
+                      "invalid mass matrix adaptation: should be 'none', 'diagonal' or 'dense'");
+
+  UQ_FATAL_TEST_MACRO((m_optionsObj->m_ov.m_massAdaptation  != "none") &&
+                      (m_optionsObj->m_ov.m_massAdaptPeriod <  2     ),
+                      m_env.worldRank(),
+                      "uqHamiltonianMCSGClass<P_V,P_M>::constructor()",
+                      "mass matrix adaptation period should be >= 2");
+
+  UQ_FATAL_TEST_MACRO(m_stepSize <= 0.,
+                      m_env.worldRank(),
+                      "uqHamiltonianMCSGClass<P_V,P_M>::constructor()",
+                      "step size should be positive");
+
+  UQ_FATAL_TEST_MACRO((m_optionsObj->m_ov.m_targetAcceptance <= 0.) ||
+                      (m_optionsObj->m_ov.m_targetAcceptance >= 1.),
+                      m_env.worldRank(),
+                      "uqHamiltonianMCSGClass<P_V,P_M>::constructor()",
+                      "target acceptance should be in (0,1)");
+
+  if (inputInverseMassMatrix) {
+    UQ_FATAL_TEST_MACRO(sourceRv.imageSet().vectorSpace().dimLocal() != inputInverseMassMatrix->numRowsLocal(),
+                        m_env.worldRank(),
+                        "uqHamiltonianMCSGClass<P_V,P_M>::constructor()",
+                        "'sourceRv' and 'inputInverseMassMatrix' should have equal dimensions");
+    UQ_FATAL_TEST_MACRO(inputInverseMassMatrix->numCols() != inputInverseMassMatrix->numRowsGlobal(),
+                        m_env.worldRank(),
+                        "uqHamiltonianMCSGClass<P_V,P_M>::constructor()",
+                        "'inputInverseMassMatrix' should be a square matrix");
+
+    m_inverseMassMatrix          = *inputInverseMassMatrix;
+    m_lowerCholInverseMassMatrix = *inputInverseMassMatrix;
+    int iRC = m_lowerCholInverseMassMatrix.chol();
+    UQ_FATAL_TEST_MACRO(iRC != 0,
+                        m_env.worldRank(),
+                        "uqHamiltonianMCSGClass<P_V,P_M>::constructor()",
+                        "'inputInverseMassMatrix' should be positive definite");
+    m_lowerCholInverseMassMatrix.zeroUpper(false);
+  }
+
+  if (m_env.subDisplayFile()) {
+    *m_env.subDisplayFile() << "Leaving uqHamiltonianMCSGClass<P_V,P_M>::constructor()"
+                            << std::endl;
+  }
+}
+// Destructor ---------------------------------------
+template<class P_V,class P_M>
+uqHamiltonianMCSGClass<P_V,P_M>::~uqHamiltonianMCSGClass()
+{
+  if (m_lastAdaptedCovMatrix ) delete m_lastAdaptedCovMatrix;
+  if (m_lastMean             ) delete m_lastMean;
+  if (m_targetPdfSynchronizer) delete m_targetPdfSynchronizer;
+  if (m_optionsObj           ) delete m_optionsObj;
+}
+// Tree state constructor ---------------------------
+template<class P_V,class P_M>
+uqHamiltonianMCSGClass<P_V,P_M>::uqHmcTreeStruct::uqHmcTreeStruct(const P_V& zeroVector)
+  :
+  minusPosition        (zeroVector),
+  minusMomentum        (zeroVector),
+  minusGrad            (zeroVector),
+  plusPosition         (zeroVector),
+  plusMomentum         (zeroVector),
+  plusGrad             (zeroVector),
+  proposedPosition     (zeroVector),
+  proposedGrad         (zeroVector),
+  proposedLogTarget    (-INFINITY),
+  proposedLogLikelihood(-INFINITY),
+  numValid             (0),
+  keepGoing            (false),
+  sumAlpha             (0.),
+  numAlpha             (0)
+{
+}
+// Statistical methods -----------------------------
+template<class P_V,class P_M>
+double
+uqHamiltonianMCSGClass<P_V,P_M>::stepSize() const
+{
+  return m_stepSize;
+}
+//--------------------------------------------------
+template<class P_V,class P_M>
+const P_M&
+uqHamiltonianMCSGClass<P_V,P_M>::inverseMassMatrix() const
+{
+  return m_inverseMassMatrix;
+}
+//--------------------------------------------------
+template <class P_V,class P_M>
+void
+uqHamiltonianMCSGClass<P_V,P_M>::generateSequence(
+  uqBaseVectorSequenceClass<P_V,P_M>& workingChain,
+  uqScalarSequenceClass<double>*      workingLogLikelihoodValues,
+  uqScalarSequenceClass<double>*      workingLogTargetValues)
+{
+  if ((m_env.subDisplayFile()       ) &&
+      (m_env.displayVerbosity() >= 5)) {
+    *m_env.subDisplayFile() << "Entering uqHamiltonianMCSGClass<P_V,P_M>::generateSequence()..."
+                            << std::endl;
+  }
+
+  UQ_FATAL_TEST_MACRO(m_vectorSpace.dimLocal() != workingChain.vectorSizeLocal(),
+                      m_env.worldRank(),
+                      "uqHamiltonianMCSGClass<P_V,P_M>::generateSequence()",
+                      "'m_vectorSpace' and 'workingChain' are related to vector spaces of different dimensions");
+
+  uqMiscCheckTheParallelEnvironment<P_V,P_V>(m_initialPosition,
+                                             m_initialPosition);
+
+  workingChain.setName(m_optionsObj->m_prefix + "rawChain");
+
+  generateFullChain(m_initialPosition,
+                    m_optionsObj->m_ov.m_rawChainSize,
+                    workingChain,
+                    workingLogLikelihoodValues,
+                    workingLogTargetValues);
+
+  if (m_optionsObj->m_ov.m_rawChainDataOutputFileName != UQ_HMC_SG_FILENAME_FOR_NO_FILE) {
+    workingChain.subWriteContents(0,
+                                  workingChain.subSequenceSize(),
+                                  m_optionsObj->m_ov.m_rawChainDataOutputFileName,
+                                  m_optionsObj->m_ov.m_rawChainDataOutputFileType,
+                                  m_optionsObj->m_ov.m_rawChainDataOutputAllowedSet);
+    if (workingLogLikelihoodValues) {
+      workingLogLikelihoodValues->subWriteContents(0,
+                                                   workingLogLikelihoodValues->subSequenceSize(),
+                                                   m_optionsObj->m_ov.m_rawChainDataOutputFileName + "_likelihood",
+                                                   m_optionsObj->m_ov.m_rawChainDataOutputFileType,
+                                                   m_optionsObj->m_ov.m_rawChainDataOutputAllowedSet);
+    }
+    if (workingLogTargetValues) {
+      workingLogTargetValues->subWriteContents(0,
+                                               workingLogTargetValues->subSequenceSize(),
+                                               m_optionsObj->m_ov.m_rawChainDataOutputFileName + "_target",
+                                               m_optionsObj->m_ov.m_rawChainDataOutputFileType,
+                                               m_optionsObj->m_ov.m_rawChainDataOutputAllowedSet);
+    }
+    if (m_env.subDisplayFile()) {
+      *m_env.subDisplayFile() << "In uqHamiltonianMCSGClass<P_V,P_M>::generateSequence()"
+                              << ", prefix = "                 << m_optionsObj->m_prefix
+                              << ": wrote raw chain to file '" << m_optionsObj->m_ov.m_rawChainDataOutputFileName
+                              << "."                           << m_optionsObj->m_ov.m_rawChainDataOutputFileType
+                              << "'"
+                              << std::endl;
+    }
+  }
+
+  if ((m_env.subDisplayFile()       ) &&
+      (m_env.displayVerbosity() >= 5)) {
+    *m_env.subDisplayFile() << "Leaving uqHamiltonianMCSGClass<P_V,P_M>::generateSequence()"
+                            << std::endl;
+  }
+
+  return;
+}
+// Private methods----------------------------------
+template <class P_V,class P_M>
+void
+uqHamiltonianMCSGClass<P_V,P_M>::generateFullChain(
+  const P_V&                          valuesOf1stPosition,
+        unsigned int                  chainSize,
+  uqBaseVectorSequenceClass<P_V,P_M>& workingChain,
+  uqScalarSequenceClass<double>*      workingLogLikelihoodValues,
+  uqScalarSequenceClass<double>*      workingLogTargetValues)
+{
+  if (m_env.subDisplayFile()) {
+    *m_env.subDisplayFile() << "Starting the generation of Markov chain " << workingChain.name()
+                            << " with algorithm '"                        << m_optionsObj->m_ov.m_algorithm
+                            << "', with "                                 << chainSize
+                            << " positions..."
+                            << std::endl;
+  }
+
+  struct timeval timevalChain;
+  gettimeofday(&timevalChain, NULL);
+
+  m_numTargetCalls        = 0;
+  m_numRejections         = 0;
+  m_numDivergences        = 0;
+  m_numOutOfTargetSupport = 0;
+  m_numLeapfrogSteps      = 0;
+  m_runTime               = 0.;
+
+  UQ_FATAL_TEST_MACRO(m_targetPdf.domainSet().contains(valuesOf1stPosition) == false,
+                      m_env.worldRank(),
+                      "uqHamiltonianMCSGClass<P_V,P_M>::generateFullChain()",
+                      "initial position should not be out of target pdf support");
+
+  workingChain.resizeSequence(chainSize);
+  if (workingLogLikelihoodValues) workingLogLikelihoodValues->resizeSequence(chainSize);
+  if (workingLogTargetValues    ) workingLogTargetValues->resizeSequence    (chainSize);
+
+  if ((m_env.numSubEnvironments() < (unsigned int) m_env.fullComm().NumProc()) &&
+      (m_initialPosition.numOfProcsForStorage() == 1                         ) &&
+      (m_env.subRank()                          != 0                         )) {
+    // subRank != 0 --> Enter the barrier and wait for processor 0 to decide to call the targetPdf
+    double aux = 0.;
+    aux = m_targetPdfSynchronizer->callFunction(NULL,
+                                                NULL,
+                                                NULL,
+                                                NULL,
+                                                NULL,
+                                                NULL,
+                                                NULL);
+    if (aux) {}; // just to remove compiler warning
+    for (unsigned int positionId = 0; positionId < workingChain.subSequenceSize(); ++positionId) {
+      // Multiply by position values by 'positionId+1' in order to avoid a constant sequence,
+      // which would cause zero variance and eventually OVERFLOW flags raised
+      workingChain.setPositionValues(positionId,((double) (positionId+1)) * valuesOf1stPosition);
+    }
+    m_numRejections = workingChain.subSequenceSize();
+    m_runTime = uqMiscGetEllapsedSeconds(&timevalChain);
+    return;
+  }
+
+  P_V    position(valuesOf1stPosition);
+  P_V    grad(m_vectorSpace.zeroVector());
+  double logLikelihood = 0.;
+  double logTarget     = logTargetAndGrad(position,grad,logLikelihood);
+
+  // Dual averaging state
+  unsigned int warmupSize       = m_optionsObj->m_ov.m_warmupSize;
+  double       targetAcceptance = m_optionsObj->m_ov.m_targetAcceptance;
+  double       logStepSizeBar   = 0.;
+  double       hBar             = 0.;
+  double       mu               = 0.;
+  unsigned int adaptCount       = 0;
+  if (warmupSize > 0) {
+    m_stepSize = findReasonableStepSize(position,grad,logTarget);
+    mu         = log(10.*m_stepSize);
+  }
+
+  unsigned int numSteps = 1;
+  if (m_optionsObj->m_ov.m_algorithm == "hmc") numSteps = m_optionsObj->m_ov.m_numLeapfrogSteps;
+
+  for (unsigned int positionId = 0; positionId < workingChain.subSequenceSize(); ++positionId) {
+    if (positionId > 0) {
+      double alpha = 0.;
+      if (m_optionsObj->m_ov.m_algorithm == "nuts") {
+        alpha = nutsTransition(position,grad,logTarget,logLikelihood);
+      }
+      else {
+        alpha = hmcTransition(position,grad,logTarget,logLikelihood,numSteps);
+      }
+
+      if (positionId <= warmupSize) {
+        adaptCount++;
+        double count = (double) adaptCount;
+        hBar            = (1. - 1./(count + UQ_HMC_SG_DA_T0)) * hBar + (targetAcceptance - alpha)/(count + UQ_HMC_SG_DA_T0);
+        double logStep  = mu - sqrt(count)/UQ_HMC_SG_DA_GAMMA * hBar;
+        double eta      = pow(count,-UQ_HMC_SG_DA_KAPPA);
+        logStepSizeBar  = eta * logStep + (1. - eta) * logStepSizeBar;
+        m_stepSize      = exp(logStep);
+        if (positionId == warmupSize) {
+          m_stepSize = exp(logStepSizeBar);
+          if (m_env.subDisplayFile()) {
+            *m_env.subDisplayFile() << "In uqHamiltonianMCSGClass<P_V,P_M>::generateFullChain()"
+                                    << ": end of warmup, adapted step size = " << m_stepSize
+                                    << std::endl;
+          }
+        }
+      }
+    }
+
+    workingChain.setPositionValues(positionId,position);
+    if (workingLogLikelihoodValues) (*workingLogLikelihoodValues)[positionId] = logLikelihood;
+    if (workingLogTargetValues    ) (*workingLogTargetValues    )[positionId] = logTarget;
+
+    if ((m_optionsObj->m_ov.m_massAdaptation != "none"                          ) &&
+        (positionId                          >  0                               ) &&
+        (positionId                          <  warmupSize                      ) &&
+        ((positionId % m_optionsObj->m_ov.m_massAdaptPeriod) == 0               )) {
+      updateInverseMassMatrix(workingChain,positionId);
+
+      // The geometry changed: restart step size adaptation
+      m_stepSize     = findReasonableStepSize(position,grad,logTarget);
+      mu             = log(10.*m_stepSize);
+      hBar           = 0.;
+      logStepSizeBar = 0.;
+      adaptCount     = 0;
+    }
+
+    if ((m_optionsObj->m_ov.m_rawChainDisplayPeriod                     > 0) &&
+        (((positionId+1) % m_optionsObj->m_ov.m_rawChainDisplayPeriod) == 0) &&
+        (m_env.subDisplayFile()                                            )) {
+      *m_env.subDisplayFile() << "Finished generating " << positionId+1
+                              << " positions"
+                              << ", step size = "       << m_stepSize
+                              << std::endl;
+    }
+  }
+
+  if ((m_env.numSubEnvironments() < (unsigned int) m_env.fullComm().NumProc()) &&
+      (m_initialPosition.numOfProcsForStorage() == 1                         ) &&
+      (m_env.subRank()                          == 0                         )) {
+    // subRank == 0 --> Tell all other processors to exit barrier now that the chain has been fully generated
+    double aux = 0.;
+    aux = m_targetPdfSynchronizer->callFunction(NULL,
+                                                NULL,
+                                                NULL,
+                                                NULL,
+                                                NULL,
+                                                NULL,
+                                                NULL);
+    if (aux) {}; // just to remove compiler warning
+  }
+
+  m_runTime = uqMiscGetEllapsedSeconds(&timevalChain);
+  if (m_env.subDisplayFile()) {
+    *m_env.subDisplayFile() << "Finished the generation of Markov chain " << workingChain.name()
+                            << ", with sub "                              << workingChain.subSequenceSize()
+                            << " positions";
+    *m_env.subDisplayFile() << "\nSome information about this chain:\n";
+    this->print(*m_env.subDisplayFile());
+    *m_env.subDisplayFile() << std::endl;
+  }
+
+  return;
+}
+//--------------------------------------------------
+template <class P_V,class P_M>
+double
+uqHamiltonianMCSGClass<P_V,P_M>::logTargetAndGrad(const P_V& position, P_V& grad, double& logLikelihood)
+{
+  if (m_targetPdf.domainSet().contains(position) == false) {
+    m_numOutOfTargetSupport++;
+    grad.cwSet(0.);
+    logLikelihood = -INFINITY;
+    return -INFINITY;
+  }
+
+  double logPrior = 0.;
+#ifdef QUESO_EXPECTS_LN_LIKELIHOOD_INSTEAD_OF_MINUS_2_LN
+  double logTarget =        m_targetPdfSynchronizer->callFunction(&position,NULL,&grad,NULL,NULL,&logPrior,&logLikelihood); // Might demand parallel environment
+#else
+  double logTarget = -0.5 * m_targetPdfSynchronizer->callFunction(&position,NULL,&grad,NULL,NULL,&logPrior,&logLikelihood); // Might demand parallel environment
+  grad *= -0.5;
+#endif
+  m_numTargetCalls++;
+
+  return logTarget;
+}
+//--------------------------------------------------
+template <class P_V,class P_M>
+double
+uqHamiltonianMCSGClass<P_V,P_M>::kineticEnergy(const P_V& momentum) const
+{
+  return 0.5 * scalarProduct(momentum,m_inverseMassMatrix * momentum);
+}
+//--------------------------------------------------
+template <class P_V,class P_M>
+void
+uqHamiltonianMCSGClass<P_V,P_M>::sampleMomentum(P_V& momentum) const
+{
+  // With inverseMassMatrix = L * L^T, massMatrix^{-1} * (L * z) = L^{-T} * z has covariance massMatrix
+  P_V gaussianVector(m_vectorSpace.zeroVector());
+  gaussianVector.cwSetGaussian(0.,1.);
+  momentum = m_inverseMassMatrix.invertMultiply(m_lowerCholInverseMassMatrix * gaussianVector);
+
+  return;
+}
+//--------------------------------------------------
+template <class P_V,class P_M>
+bool
+uqHamiltonianMCSGClass<P_V,P_M>::leapfrog(
+  P_V&    position,
+  P_V&    momentum,
+  P_V&    grad,
+  double& logTarget,
+  double& logLikelihood,
+  double  stepSize)
+{
+  momentum  += (0.5*stepSize) * grad;
+  position  += stepSize * (m_inverseMassMatrix * momentum);
+  logTarget  = logTargetAndGrad(position,grad,logLikelihood);
+  m_numLeapfrogSteps++;
+  if (logTarget == -INFINITY) return false;
+  momentum  += (0.5*stepSize) * grad;
+
+  return true;
+}
+//--------------------------------------------------
+template <class P_V,class P_M>
+double
+uqHamiltonianMCSGClass<P_V,P_M>::findReasonableStepSize(const P_V& position, const P_V& grad, double logTarget)
+{
+  double stepSize = m_optionsObj->m_ov.m_stepSize;
+
+  P_V    momentum(m_vectorSpace.zeroVector());
+  sampleMomentum(momentum);
+  double initialJoint = logTarget - kineticEnergy(momentum);
+
+  P_V    newPosition(position);
+  P_V    newMomentum(momentum);
+  P_V    newGrad(grad);
+  double newLogTarget     = 0.;
+  double newLogLikelihood = 0.;
+  double logRatio         = -INFINITY;
+  if (leapfrog(newPosition,newMomentum,newGrad,newLogTarget,newLogLikelihood,stepSize)) {
+    logRatio = newLogTarget - kineticEnergy(newMomentum) - initialJoint;
+  }
+
+  // Double (or halve) the step size until the acceptance probability crosses 0.5
+  double direction = (logRatio > log(0.5)) ? 1. : -1.;
+  for (unsigned int i = 0; (i < UQ_HMC_SG_MAX_STEP_SEARCHES) && (direction*logRatio > -direction*log(2.)); ++i) {
+    stepSize *= pow(2.,direction);
+    newPosition = position;
+    newMomentum = momentum;
+    newGrad     = grad;
+    logRatio    = -INFINITY;
+    if (leapfrog(newPosition,newMomentum,newGrad,newLogTarget,newLogLikelihood,stepSize)) {
+      logRatio = newLogTarget - kineticEnergy(newMomentum) - initialJoint;
+    }
+  }
+
+  if ((m_env.subDisplayFile()       ) &&
+      (m_env.displayVerbosity() >= 3)) {
+    *m_env.subDisplayFile() << "In uqHamiltonianMCSGClass<P_V,P_M>::findReasonableStepSize()"
+                            << ": stepSize = " << stepSize
+                            << std::endl;
+  }
+
+  return stepSize;
+}
+//--------------------------------------------------
+template <class P_V,class P_M>
+double
+uqHamiltonianMCSGClass<P_V,P_M>::hmcTransition(
+  P_V&         position,
+  P_V&         grad,
+  double&      logTarget,
+  double&      logLikelihood,
+  unsigned int numSteps)
+{
+  P_V momentum(m_vectorSpace.zeroVector());
+  sampleMomentum(momentum);
+  double initialJoint = logTarget - kineticEnergy(momentum);
+
+  P_V    newPosition(position);
+  P_V    newGrad(grad);
+  double newLogTarget     = logTarget;
+  double newLogLikelihood = logLikelihood;
+  bool   inSupport        = true;
+  for (unsigned int l = 0; (l < numSteps) && inSupport; ++l) {
+    inSupport = leapfrog(newPosition,momentum,newGrad,newLogTarget,newLogLikelihood,m_stepSize);
+  }
+
+  double alpha = 0.;
+  if (inSupport) {
+    double newJoint = newLogTarget - kineticEnergy(momentum);
+    if (initialJoint - newJoint > UQ_HMC_SG_MAX_ENERGY_ERROR) m_numDivergences++;
+    alpha = std::min(1.,exp(newJoint - initialJoint));
+    if (boost::math::isnan(alpha)) alpha = 0.;
+  }
+
+  if ((alpha > 0.) && (m_env.rngObject()->uniformSample() < alpha)) {
+    position      = newPosition;
+    grad          = newGrad;
+    logTarget     = newLogTarget;
+    logLikelihood = newLogLikelihood;
+  }
+  else {
+    m_numRejections++;
+  }
+
+  return alpha;
+}
+//--------------------------------------------------
+template <class P_V,class P_M>
+double
+uqHamiltonianMCSGClass<P_V,P_M>::nutsTransition(
+  P_V&    position,
+  P_V&    grad,
+  double& logTarget,
+  double& logLikelihood)
+{
+  P_V momentum(m_vectorSpace.zeroVector());
+  sampleMomentum(momentum);
+  double initialJoint = logTarget - kineticEnergy(momentum);
+  double logSlice     = initialJoint + log(m_env.rngObject()->uniformSample());
+
+  P_V minusPosition(position);
+  P_V minusMomentum(momentum);
+  P_V minusGrad    (grad);
+  P_V plusPosition (position);
+  P_V plusMomentum (momentum);
+  P_V plusGrad     (grad);
+
+  uqHmcTreeStruct tree(m_vectorSpace.zeroVector());
+  unsigned int numValid  = 1;
+  bool         keepGoing = true;
+  bool         moved     = false;
+  double       sumAlpha  = 0.;
+  unsigned int numAlpha  = 0;
+  for (unsigned int depth = 0; keepGoing && (depth < m_optionsObj->m_ov.m_maxTreeDepth); ++depth) {
+    int direction = (m_env.rngObject()->uniformSample() < 0.5) ? -1 : 1;
+    if (direction == -1) {
+      buildTree(minusPosition,minusMomentum,minusGrad,logSlice,direction,depth,initialJoint,tree);
+      minusPosition = tree.minusPosition;
+      minusMomentum = tree.minusMomentum;
+      minusGrad     = tree.minusGrad;
+    }
+    else {
+      buildTree(plusPosition,plusMomentum,plusGrad,logSlice,direction,depth,initialJoint,tree);
+      plusPosition = tree.plusPosition;
+      plusMomentum = tree.plusMomentum;
+      plusGrad     = tree.plusGrad;
+    }
+
+    if ((tree.keepGoing) &&
+        (m_env.rngObject()->uniformSample() < ((double) tree.numValid)/((double) numValid))) {
+      position      = tree.proposedPosition;
+      grad          = tree.proposedGrad;
+      logTarget     = tree.proposedLogTarget;
+      logLikelihood = tree.proposedLogLikelihood;
+      moved         = true;
+    }
+    numValid  += tree.numValid;
+    sumAlpha  += tree.sumAlpha;
+    numAlpha  += tree.numAlpha;
+    keepGoing  = tree.keepGoing && noUTurn(minusPosition,plusPosition,minusMomentum,plusMomentum);
+  }
+  if (moved == false) m_numRejections++;
+
+  if (numAlpha == 0) return 0.;
+  return sumAlpha/((double) numAlpha);
+}
+//--------------------------------------------------
+template <class P_V,class P_M>
+void
+uqHamiltonianMCSGClass<P_V,P_M>::buildTree(
+  const P_V&            position,
+  const P_V&            momentum,
+  const P_V&            grad,
+        double          logSlice,
+        int             direction,
+        unsigned int    depth,
+        double          initialJoint,
+        uqHmcTreeStruct& tree)
+{
+  if (depth == 0) {
+    // Base case: a single leapfrog step in the given direction
+    P_V    newPosition(position);
+    P_V    newMomentum(momentum);
+    P_V    newGrad(grad);
+    double newLogTarget     = 0.;
+    double newLogLikelihood = 0.;
+    double newJoint         = -INFINITY;
+    if (leapfrog(newPosition,newMomentum,newGrad,newLogTarget,newLogLikelihood,((double) direction)*m_stepSize)) {
+      newJoint = newLogTarget - kineticEnergy(newMomentum);
+      if (boost::math::isnan(newJoint)) newJoint = -INFINITY;
+    }
+
+    tree.minusPosition         = newPosition;
+    tree.minusMomentum         = newMomentum;
+    tree.minusGrad             = newGrad;
+    tree.plusPosition          = newPosition;
+    tree.plusMomentum          = newMomentum;
+    tree.plusGrad              = newGrad;
+    tree.proposedPosition      = newPosition;
+    tree.proposedGrad          = newGrad;
+    tree.proposedLogTarget     = newLogTarget;
+    tree.proposedLogLikelihood = newLogLikelihood;
+    tree.numValid              = (logSlice <= newJoint) ? 1 : 0;
+    tree.keepGoing             = (logSlice <  newJoint + UQ_HMC_SG_MAX_ENERGY_ERROR);
+    tree.sumAlpha              = std::min(1.,exp(newJoint - initialJoint));
+    tree.numAlpha              = 1;
+    if (tree.keepGoing == false) m_numDivergences++;
+    return;
+  }
+
+  // Recursion: build the left and right subtrees
+  buildTree(position,momentum,grad,logSlice,direction,depth-1,initialJoint,tree);
+  if (tree.keepGoing == false) return;
+
+  uqHmcTreeStruct subTree(m_vectorSpace.zeroVector());
+  if (direction == -1) {
+    buildTree(tree.minusPosition,tree.minusMomentum,tree.minusGrad,logSlice,direction,depth-1,initialJoint,subTree);
+    tree.minusPosition = subTree.minusPosition;
+    tree.minusMomentum = subTree.minusMomentum;
+    tree.minusGrad     = subTree.minusGrad;
+  }
+  else {
+    buildTree(tree.plusPosition,tree.plusMomentum,tree.plusGrad,logSlice,direction,depth-1,initialJoint,subTree);
+    tree.plusPosition = subTree.plusPosition;
+    tree.plusMomentum = subTree.plusMomentum;
+    tree.plusGrad     = subTree.plusGrad;
+  }
+
+  unsigned int numValid = tree.numValid + subTree.numValid;
+  if ((numValid > 0) &&
+      (m_env.rngObject()->uniformSample() < ((double) subTree.numValid)/((double) numValid))) {
+    tree.proposedPosition      = subTree.proposedPosition;
+    tree.proposedGrad          = subTree.proposedGrad;
+    tree.proposedLogTarget     = subTree.proposedLogTarget;
+    tree.proposedLogLikelihood = subTree.proposedLogLikelihood;
+  }
+  tree.numValid   = numValid;
+  tree.sumAlpha  += subTree.sumAlpha;
+  tree.numAlpha  += subTree.numAlpha;
+  tree.keepGoing  = subTree.keepGoing && noUTurn(tree.minusPosition,tree.plusPosition,tree.minusMomentum,tree.plusMomentum);
+
+  return;
+}
+//--------------------------------------------------
+template <class P_V,class P_M>
+bool
+uqHamiltonianMCSGClass<P_V,P_M>::noUTurn(
+  const P_V& minusPosition,
+  const P_V& plusPosition,
+  const P_V& minusMomentum,
+  const P_V& plusMomentum) const
+{
+  P_V span(plusPosition - minusPosition);
+  return ((scalarProduct(span,m_inverseMassMatrix * minusMomentum) >= 0.) &&
+          (scalarProduct(span,m_inverseMassMatrix * plusMomentum ) >= 0.));
+}
+//--------------------------------------------------
+template <class P_V,class P_M>
+void
+uqHamiltonianMCSGClass<P_V,P_M>::updateInverseMassMatrix(
+  const uqBaseVectorSequenceClass<P_V,P_M>& workingChain,
+  unsigned int                              positionId)
+{
+  unsigned int period                      = m_optionsObj->m_ov.m_massAdaptPeriod;
+  unsigned int idOfFirstPositionInSubChain = 0;
+  uqSequenceOfVectorsClass<P_V,P_M> partialChain(m_vectorSpace,0,m_optionsObj->m_prefix+"partialChain");
+  if (m_lastMean == NULL) {
+    partialChain.resizeSequence(positionId+1);
+    m_lastMean             = m_vectorSpace.newVector();
+    m_lastAdaptedCovMatrix = m_vectorSpace.newMatrix();
+  }
+  else {
+    idOfFirstPositionInSubChain = positionId + 1 - period;
+    partialChain.resizeSequence(period);
+  }
+
+  P_V transporterVec(m_vectorSpace.zeroVector());
+  for (unsigned int i = 0; i < partialChain.subSequenceSize(); ++i) {
+    workingChain.getPositionValues(idOfFirstPositionInSubChain+i,transporterVec);
+    partialChain.setPositionValues(i,transporterVec);
+  }
+  uqUpdateAdaptedCovMatrix(partialChain,
+                           idOfFirstPositionInSubChain,
+                           m_lastChainSize,
+                          *m_lastMean,
+                          *m_lastAdaptedCovMatrix);
+
+  // Shrink towards a multiple of the identity, as in Stan's windowed adaptation
+  double n = m_lastChainSize;
+  P_M attemptedMatrix((n/(n + 5.)) * (*m_lastAdaptedCovMatrix));
+  for (unsigned int i = 0; i < attemptedMatrix.numRowsLocal(); ++i) {
+    if (m_optionsObj->m_ov.m_massAdaptation == "diagonal") {
+      for (unsigned int j = 0; j < attemptedMatrix.numCols(); ++j) {
+        if (i != j) attemptedMatrix(i,j) = 0.;
+      }
+    }
+    attemptedMatrix(i,i) += UQ_HMC_SG_MASS_REGULARIZER * (5./(n + 5.));
+  }
+
+  P_M attemptedChol(attemptedMatrix);
+  if (attemptedChol.chol() == 0) {
+    attemptedChol.zeroUpper(false);
+    m_inverseMassMatrix          = attemptedMatrix;
+    m_lowerCholInverseMassMatrix = attemptedChol;
+  }
+  else if (m_env.subDisplayFile()) {
+    *m_env.subDisplayFile() << "WARNING in uqHamiltonianMCSGClass<P_V,P_M>::updateInverseMassMatrix()"
+                            << ", positionId = " << positionId
+                            << ": adapted matrix is not positive definite, keeping the previous one"
+                            << std::endl;
+  }
+
+  if ((m_env.subDisplayFile()       ) &&
+      (m_env.displayVerbosity() >= 3)) {
+    *m_env.subDisplayFile() << "In uqHamiltonianMCSGClass<P_V,P_M>::updateInverseMassMatrix()"
+                            << ", positionId = " << positionId
+                            << ": inverse mass matrix = " << m_inverseMassMatrix
+                            << std::endl;
+  }
+
+  return;
+}
+// I/O methods -------------------------------------
+template <class P_V,class P_M>
+void
+uqHamiltonianMCSGClass<P_V,P_M>::print(std::ostream& os) const
+{
+  os << "  Chain run time         = " << m_runTime << " seconds"
+     << "\n  Algorithm              = " << m_optionsObj->m_ov.m_algorithm
+     << "\n  Step size              = " << m_stepSize
+     << "\n  Num target calls       = " << m_numTargetCalls
+     << "\n  Num leapfrog steps     = " << m_numLeapfrogSteps
+     << "\n  Num rejections         = " << m_numRejections
+     << "\n  Num divergences        = " << m_numDivergences
+     << "\n  Out of target support  = " << m_numOutOfTargetSupport;
+
+  return;
+}
+//--------------------------------------------------
+template<class P_V,class P_M>
+std::ostream& operator<<(std::ostream& os, const uqHamiltonianMCSGClass<P_V,P_M>& obj)
+{
+  obj.print(os);
+
+  return os;
+}
+#endif // __UQ_HMC_SG_H__
@@ -0,0 +1,179 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+// 
+// QUESO - a library to support the Quantification of Uncertainty
+// for Estimation, Simulation and Optimization
+//
+// Copyright (C) 2008,2009,2010,2011,2012,2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor, 
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+// 
+// $Id$
+//
+//--------------------------------------------------------------------------
+
+#ifndef __UQ_HMC_SG_OPTIONS_H__
+#define __UQ_HMC_SG_OPTIONS_H__
+
+#include <uqEnvironment.h>
+
+#define UQ_HMC_SG_FILENAME_FOR_NO_FILE "."
+
+// _ODV = option default value
+#define UQ_HMC_SG_ALGORITHM_ODV                         "nuts" // "mala", "hmc" or "nuts"
+#define UQ_HMC_SG_RAW_CHAIN_SIZE_ODV                    100
+#define UQ_HMC_SG_RAW_CHAIN_DISPLAY_PERIOD_ODV          500
+#define UQ_HMC_SG_RAW_CHAIN_DATA_OUTPUT_FILE_NAME_ODV   UQ_HMC_SG_FILENAME_FOR_NO_FILE
+#define UQ_HMC_SG_RAW_CHAIN_DATA_OUTPUT_FILE_TYPE_ODV   UQ_FILE_EXTENSION_FOR_MATLAB_FORMAT
+#define UQ_HMC_SG_RAW_CHAIN_DATA_OUTPUT_ALLOWED_SET_ODV ""
+#define UQ_HMC_SG_STEP_SIZE_ODV                         0.1
+#define UQ_HMC_SG_NUM_LEAPFROG_STEPS_ODV                10
+#define UQ_HMC_SG_MAX_TREE_DEPTH_ODV                    10
+#define UQ_HMC_SG_WARMUP_SIZE_ODV                       0
+#define UQ_HMC_SG_TARGET_ACCEPTANCE_ODV                 0.8
+#define UQ_HMC_SG_MASS_ADAPTATION_ODV                   "none" // "none", "diagonal" or "dense"
+#define UQ_HMC_SG_MASS_ADAPT_PERIOD_ODV                 100
+
+/*! \file uqHamiltonianMCSGOptions.h
+    \brief Classes to allow options to be passed to a gradient based (MALA, HMC, NUTS) sequence generator.
+*/
+
+/*! \class uqHmcOptionsValuesClass
+ *  \brief This class provides options for the gradient based sequence generator if no input file is available.
+ * 
+ *  The gradient based sequence generator expects options for its methods. This class provides default
+ * values for such options if no input file is available. */
+
+class uqHmcOptionsValuesClass
+{
+public:
+  //! @name Constructor/Destructor methods
+  //@{ 
+  //! Default constructor.
+  /*! Assigns the default suite of options to the gradient based sequence generator.*/
+  uqHmcOptionsValuesClass            ();
+
+  //! Copy constructor.
+  /*! It assigns the same options values from  \c src to \c this.*/
+  uqHmcOptionsValuesClass            (const uqHmcOptionsValuesClass& src);
+  
+  //! Destructor
+  ~uqHmcOptionsValuesClass            ();
+  //@}
+  
+  //! @name Set methods
+  //@{ 
+  //! Assignment operator; it copies \c rhs to \c this. 
+  uqHmcOptionsValuesClass& operator= (const uqHmcOptionsValuesClass& rhs);
+  //@}
+
+  std::string                        m_algorithm;
+
+  unsigned int                       m_rawChainSize;
+  unsigned int                       m_rawChainDisplayPeriod;
+  std::string                        m_rawChainDataOutputFileName;
+  std::string                        m_rawChainDataOutputFileType;
+  std::set<unsigned int>             m_rawChainDataOutputAllowedSet;
+
+  double                             m_stepSize;
+  unsigned int                       m_numLeapfrogSteps;
+  unsigned int                       m_maxTreeDepth;
+
+  unsigned int                       m_warmupSize;
+  double                             m_targetAcceptance;
+  std::string                        m_massAdaptation;
+  unsigned int                       m_massAdaptPeriod;
+
+private:
+  //! Copies the option values from \c src to \c this.
+  void copy(const uqHmcOptionsValuesClass& src);
+};
+
+// --------------------------------------------------
+// --------------------------------------------------
+// --------------------------------------------------
+
+/*! \class uqHamiltonianMCSGOptionsClass
+ *  \brief This class reads the options for the gradient based sequence generator from an input file.
+ * 
+ * The gradient based sequence generator expects options for its methods. This class reads the 
+ * options for it from an input file provided by the user. The class expects the prefix
+ * '\<prefix\>_hmc_'. For instance, if 'prefix' is 'foo_775_ip_', then the constructor will read
+ * all options that begin with 'foo_775_ip_hmc_'. */
+
+class uqHamiltonianMCSGOptionsClass
+{
+public:
+  
+  //! @name Constructor/Destructor methods
+  //@{ 
+  //! Constructor: reads options from the input file.
+  uqHamiltonianMCSGOptionsClass(const uqBaseEnvironmentClass& env, const char* prefix);
+  
+  //! Constructor: with alternative option values.
+  /*! In this constructor, the input options are given by \c alternativeOptionsValues, thus, they
+   * are not read from an input file.*/
+  uqHamiltonianMCSGOptionsClass(const uqBaseEnvironmentClass& env, const char* prefix, const uqHmcOptionsValuesClass& alternativeOptionsValues);
+ 
+  //! Destructor
+  ~uqHamiltonianMCSGOptionsClass();
+  //@}
+  
+  //! @name I/O methods
+  //@{
+  //! It scans the option values from the options input file.
+  void scanOptionsValues();
+  
+  //!  It prints the option values.
+  void print            (std::ostream& os) const;
+  //@}
+  
+  uqHmcOptionsValuesClass            m_ov;
+  std::string                        m_prefix;
+
+private:
+  //! Defines the options for the gradient based sequence generator as the default options.
+  void   defineMyOptions  (po::options_description& optionsDesc) const;
+  
+  //! Gets the sequence options.
+  void   getMyOptionValues(po::options_description& optionsDesc);
+
+  const uqBaseEnvironmentClass& m_env;
+  po::options_description*      m_optionsDesc;
+
+  std::string                   m_option_help;
+  std::string                   m_option_algorithm;
+
+  std::string                   m_option_rawChain_size;
+  std::string                   m_option_rawChain_displayPeriod;
+  std::string                   m_option_rawChain_dataOutputFileName;
+  std::string                   m_option_rawChain_dataOutputFileType;
+  std::string                   m_option_rawChain_dataOutputAllowedSet;
+
+  std::string                   m_option_stepSize;
+  std::string                   m_option_numLeapfrogSteps;
+  std::string                   m_option_maxTreeDepth;
+
+  std::string                   m_option_warmupSize;
+  std::string                   m_option_targetAcceptance;
+  std::string                   m_option_massAdaptation;
+  std::string                   m_option_massAdaptPeriod;
+};
+
+//! Prints the object \c obj, overloading an operator.
+std::ostream& operator<<(std::ostream& os, const uqHamiltonianMCSGOptionsClass& obj);
+#endif // __UQ_HMC_SG_OPTIONS_H__
@@ -32,6 +32,8 @@
 #include <uqDefines.h>
 #ifdef QUESO_HAS_ANN
 
+#include <uqMpiComm.h>
+
 #include <ANN/ANN.h>
 #include <ANN/ANNx.h>
 #include <gsl/gsl_sf_psi.h>
@@ -40,6 +42,11 @@
 #define UQ_INFTH_ANN_NO_SMP        10000
 #define UQ_INFTH_ANN_EPS           0.0
 #define UQ_INFTH_ANN_KNN           6
+#define UQ_INFTH_ANN_JITTER        1.e-10 // relative to the (unit) std of the normalized data
+
+unsigned long int tieNeighboursANN();
+
+void resetTieNeighboursANN();
 
 void distANN_XY( const ANNpointArray dataX, const ANNpointArray dataY, 
 		 double* distsXY, 
@@ -47,6 +54,11 @@ void distANN_XY( const ANNpointArray dataX, const ANNpointArray dataY,
 		 unsigned int xN, unsigned int yN, 
 		 unsigned int k, double eps );
 
+void distANN_XY( ANNkd_tree& kdTreeY, const ANNpointArray dataX,
+		 double* distsXY,
+		 unsigned int xN, unsigned int yN,
+		 unsigned int k, double eps );
+
 void normalizeANN_XY( ANNpointArray dataXY, unsigned int dimXY,
 		      ANNpointArray dataX, unsigned int dimX,
 		      ANNpointArray dataY, unsigned int dimY,
@@ -55,10 +67,26 @@ void normalizeANN_XY( ANNpointArray dataXY, unsigned int dimXY,
 void whiteningANN_X_Y( ANNpointArray dataX1, ANNpointArray dataX2, 
 		       unsigned int dimX, unsigned int N1, unsigned int N2 );
 
+void jitterANN_XY( ANNpointArray dataXY, unsigned int dimXY,
+		   ANNpointArray dataX, unsigned int dimX,
+		   ANNpointArray dataY, unsigned int dimY,
+		   unsigned int N, double amplitude );
+
+void sliceANN( unsigned int N, unsigned int numProcs, unsigned int procId,
+	       unsigned int& firstId, unsigned int& numIds );
+
+void broadcastANN_XY( ANNpointArray dataXY, unsigned int dimXY,
+		      unsigned int N, const uqMpiCommClass& comm );
+
 double computeMI_ANN( ANNpointArray dataXY,
 		      unsigned int dimX, unsigned int dimY,
 		      unsigned int k, unsigned int N, double eps );
 
+double computeMI_ANN( ANNpointArray dataXY,
+		      unsigned int dimX, unsigned int dimY,
+		      unsigned int k, unsigned int N, double eps,
+		      const uqMpiCommClass& comm );
+
 //*****************************************************
 // Function: estimateMI_ANN (using a joint)
 // (Mutual Information)
@@ -77,9 +105,15 @@ double estimateMI_ANN( const RV<P_V,P_M>& jointRV,
   // Allocate memory
   dataXY = annAllocPts(N,dimXY);
 
+  // Processor 0 of the sub environment draws the samples: the processors of a
+  // sub environment share their random seed unless the seed option is negative,
+  // so their draws would repeat each other
+  const uqMpiCommClass& comm = jointRV.env().subComm();
+  unsigned int numIds = ( comm.MyPID() == 0 ) ? N : 0;
+
   // Copy samples in ANN data structure
   P_V smpRV( jointRV.imageSet().vectorSpace().zeroVector() );
-  for( unsigned int i = 0; i < N; i++ ) {
+  for( unsigned int i = 0; i < numIds; i++ ) {
     // get a sample from the distribution
     jointRV.realizer().realization( smpRV );
 
@@ -93,9 +127,11 @@ double estimateMI_ANN( const RV<P_V,P_M>& jointRV,
     // annPrintPt( dataXY[i], dimXY, std::cout ); std::cout << std::endl;
   }
 
+  broadcastANN_XY( dataXY, dimXY, N, comm );
+
   MI_est = computeMI_ANN( dataXY,
 			  dimX, dimY,
-			  k, N, eps );
+			  k, N, eps, comm );
 
   // Deallocate memory
   annDeallocPts( dataXY );
@@ -124,11 +160,15 @@ double estimateMI_ANN( const RV_1<P_V,P_M>& xRV,
   // Allocate memory
   dataXY = annAllocPts(N,dimXY);
 
+  // Processor 0 of the sub environment draws the samples, see above
+  const uqMpiCommClass& comm = xRV.env().subComm();
+  unsigned int numIds = ( comm.MyPID() == 0 ) ? N : 0;
+
   // Copy samples in ANN data structure
   P_V smpRV_x( xRV.imageSet().vectorSpace().zeroVector() );
   P_V smpRV_y( yRV.imageSet().vectorSpace().zeroVector() );
 
-  for( unsigned int i = 0; i < N; i++ ) {
+  for( unsigned int i = 0; i < numIds; i++ ) {
     // get a sample from the distribution
     xRV.realizer().realization( smpRV_x );
     yRV.realizer().realization( smpRV_y );
@@ -143,9 +183,11 @@ double estimateMI_ANN( const RV_1<P_V,P_M>& xRV,
     // annPrintPt( dataXY[i], dimXY, std::cout ); std::cout << std::endl;
   }
 
+  broadcastANN_XY( dataXY, dimXY, N, comm );
+
   MI_est = computeMI_ANN( dataXY,
 			  dimX, dimY,
-			  k, N, eps );
+			  k, N, eps, comm );
 
   // Deallocate memory
   annDeallocPts( dataXY );
@@ -259,7 +301,6 @@ double estimateCE_ANN( RV_1<P_V,P_M>& xRV,
   dataX = annAllocPts( xN, dimX );
   dataY = annAllocPts( yN, dimY );
   distsXY = new double[xN];
-  kdTree = new ANNkd_tree( dataY, yN, dimY );
   
   // Copy X samples in ANN data structure
   P_V xSmpRV( xRV.imageSet().vectorSpace().zeroVector() );
@@ -283,19 +324,22 @@ double estimateCE_ANN( RV_1<P_V,P_M>& xRV,
     }
   }
 
-  // Get distance to knn for each point
-  distANN_XY( dataX, dataY, distsXY, dimX, dimY, xN, yN, k, eps );
+  // Get distance to knn for each point, building the tree over the Y samples once
   kdTree = new ANNkd_tree( dataY, yN, dimY );
+  distANN_XY( *kdTree, dataX, distsXY, xN, yN, k, eps );
 
-  // Compute cross entropy estimate
+  // Compute cross entropy estimate using the L-infinity (Max) norm, whose
+  // hyperball of radius r has a volume of (2r)^dim
   double sum_log = 0.0;
   for( unsigned int i = 0; i < xN; i++ ) 
     {
-      sum_log += log( distsXY[i] );
+      sum_log += log( 2.0*distsXY[i] );
     }
   CE_est = (double)dimX/(double)xN * sum_log + log( (double)yN ) - gsl_sf_psi_int( k );
 
   // Deallocate memory
+  delete kdTree;
+  annClose();
   annDeallocPts( dataX );
   annDeallocPts( dataY );
   delete [] distsXY;
@@ -685,8 +685,27 @@ public:
   
   //! Access to the vector of variance values and private attribute:  m_lawVarVector. 
   const V& lawVarVector() const;
+
+  //! Logarithm of the value of the Gaussian PDF at each of the points in \c domainVectors.
+  /*! Equivalent to calling lnValue() on each point, without directions, gradients or Hessians. */
+  void     lnValues          (const std::vector<const V*>& domainVectors, std::vector<double>& lnValues) const;
   //@}
 protected:
+  //! Refreshes the contiguous copy of the mean vector.
+  void     setLawExpCaches   ();
+
+  //! Refreshes inverse variances (diagonal case) or the Cholesky factor (general case), and the log-determinant.
+  void     setLawCovCaches   ();
+
+  //! Computes (domainVector - mean)^T * covMatrix^{-1} * (domainVector - mean) in one pass, without temporaries.
+  double   quadraticForm     (const V& domainVector) const;
+
+  //! Sets gradVector = -covMatrix^{-1} * (domainVector - mean); must follow quadraticForm() on the same domainVector.
+  void     lnValueGradient   (const V& domainVector, V& gradVector) const;
+
+  //! Sets hessianMatrix = -covMatrix^{-1} and hessianEffect = -covMatrix^{-1} * domainDirection, if not NULL.
+  void     lnValueHessian    (const V* domainDirection, M* hessianMatrix, V* hessianEffect) const;
+
   using uqBaseScalarFunctionClass<V,M>::m_env;
   using uqBaseScalarFunctionClass<V,M>::m_prefix;
   using uqBaseScalarFunctionClass<V,M>::m_domainSet;
@@ -696,6 +715,16 @@ protected:
   V*       m_lawVarVector;
   bool     m_diagonalCovMatrix;
   const M* m_lawCovMatrix;
+
+  std::vector<double>         m_lawExpValues;       // Copy of *m_lawExpVector
+  std::vector<double>         m_lawInvVarValues;    // Diagonal case: 1/variances
+  std::vector<double>         m_lowerCholValues;    // General case: lower Cholesky factor, packed by rows
+  std::vector<double>         m_lowerCholInvDiag;   // General case: 1/diagonal of the Cholesky factor
+  bool                        m_lowerCholIsValid;
+  double                      m_lnDeterminant;
+  mutable std::vector<double> m_workValues;
+  mutable V*                  m_workDiffVector;     // Fallback case: domainVector - mean
+  mutable V*                  m_workSolVector;      // Fallback case: covMatrix^{-1} * m_workDiffVector
 };
 // Constructor -------------------------------------
 template<class V,class M>
@@ -709,8 +738,19 @@ uqGaussianJointPdfClass<V,M>::uqGaussianJointPdfClass(
   m_lawExpVector     (new V(lawExpVector)),
   m_lawVarVector     (new V(lawVarVector)),
   m_diagonalCovMatrix(true),
-  m_lawCovMatrix     (m_domainSet.vectorSpace().newDiagMatrix(lawVarVector))
-{
+  m_lawCovMatrix     (m_domainSet.vectorSpace().newDiagMatrix(lawVarVector)),
+  m_lawExpValues     (0),
+  m_lawInvVarValues  (0),
+  m_lowerCholValues  (0),
+  m_lowerCholInvDiag (0),
+  m_lowerCholIsValid (false),
+  m_lnDeterminant    (0.),
+  m_workValues       (0),
+  m_workDiffVector   (new V(m_domainSet.vectorSpace().zeroVector())),
+  m_workSolVector    (new V(m_domainSet.vectorSpace().zeroVector()))
+{
+  this->setLawExpCaches();
+  this->setLawCovCaches();
 
   if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 54)) {
     *m_env.subDisplayFile() << "Entering uqGaussianJointPdfClass<V,M>::constructor() [1]"
@@ -744,8 +784,19 @@ uqGaussianJointPdfClass<V,M>::uqGaussianJointPdfClass(
   m_lawExpVector     (new V(lawExpVector)),
   m_lawVarVector     (domainSet.vectorSpace().newVector(INFINITY)), // FIX ME
   m_diagonalCovMatrix(false),
-  m_lawCovMatrix     (new M(lawCovMatrix))
-{
+  m_lawCovMatrix     (new M(lawCovMatrix)),
+  m_lawExpValues     (0),
+  m_lawInvVarValues  (0),
+  m_lowerCholValues  (0),
+  m_lowerCholInvDiag (0),
+  m_lowerCholIsValid (false),
+  m_lnDeterminant    (0.),
+  m_workValues       (0),
+  m_workDiffVector   (new V(m_domainSet.vectorSpace().zeroVector())),
+  m_workSolVector    (new V(m_domainSet.vectorSpace().zeroVector()))
+{
+  this->setLawExpCaches();
+  this->setLawCovCaches();
   if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 54)) {
     *m_env.subDisplayFile() << "Entering uqGaussianJointPdfClass<V,M>::constructor() [2]"
                             << ": prefix = " << m_prefix
@@ -770,6 +821,8 @@ uqGaussianJointPdfClass<V,M>::uqGaussianJointPdfClass(
 template<class V,class M>
 uqGaussianJointPdfClass<V,M>::~uqGaussianJointPdfClass()
 {
+  delete m_workSolVector;
+  delete m_workDiffVector;
   delete m_lawCovMatrix;
   delete m_lawVarVector;
   delete m_lawExpVector;
@@ -855,40 +908,26 @@ uqGaussianJointPdfClass<V,M>::lnValue(
                             << std::endl;
   }
 
-  UQ_FATAL_TEST_MACRO((gradVector || hessianMatrix || hessianEffect),
+  UQ_FATAL_TEST_MACRO((hessianEffect && (domainDirection == NULL)),
                       m_env.worldRank(),
                       "uqGaussianJointPdfClass<V,M>::lnValue()",
-                      "incomplete code for gradVector, hessianMatrix and hessianEffect calculations");
-
-  if (domainDirection) {}; // just to remove compiler warning
+                      "hessianEffect requires domainDirection");
 
   double returnValue = 0.;
 
-  double lnDeterminant = 0.;
   if (this->m_domainSet.contains(domainVector) == false) { // prudenci 2011-Oct-04
     returnValue = -INFINITY;
+    if (gradVector   ) gradVector->cwSet(0.);
+    if (hessianMatrix) hessianMatrix->cwSet(0.);
+    if (hessianEffect) hessianEffect->cwSet(0.);
   }
   else {
-    V diffVec(domainVector - this->lawExpVector());
-    if (m_diagonalCovMatrix) {
-      returnValue = ((diffVec*diffVec)/this->lawVarVector()).sumOfComponents();
-      if (m_normalizationStyle == 0) {
-        unsigned int iMax = this->lawVarVector().sizeLocal();
-        for (unsigned int i = 0; i < iMax; ++i) {
-          lnDeterminant += log(this->lawVarVector()[i]);
-        }
-      }
-    }
-    else {
-      V tmpVec = this->m_lawCovMatrix->invertMultiply(diffVec);
-      returnValue = (diffVec*tmpVec).sumOfComponents();
-      if (m_normalizationStyle == 0) {
-        lnDeterminant = this->m_lawCovMatrix->lnDeterminant();
-      }
-    }
+    returnValue = this->quadraticForm(domainVector);
+    if (gradVector) this->lnValueGradient(domainVector,*gradVector);
+    if (hessianMatrix || hessianEffect) this->lnValueHessian(domainDirection,hessianMatrix,hessianEffect);
     if (m_normalizationStyle == 0) {
-      returnValue += log(2*M_PI);   // normalization of pdf
-      returnValue += lnDeterminant; // normalization of pdf
+      returnValue += log(2*M_PI);     // normalization of pdf
+      returnValue += m_lnDeterminant; // normalization of pdf
     }
     returnValue *= -0.5;
   }
@@ -934,6 +973,7 @@ uqGaussianJointPdfClass<V,M>::updateLawExpVector(const V& newLawExpVector)
   // delete old expected values (allocated at construction or last call to this function)
   delete m_lawExpVector;
   m_lawExpVector = new V(newLawExpVector);
+  this->setLawExpCaches();
   return;
 }
 
@@ -944,6 +984,7 @@ uqGaussianJointPdfClass<V,M>::updateLawCovMatrix(const M& newLawCovMatrix)
   // delete old expected values (allocated at construction or last call to this function)
   delete m_lawCovMatrix;
   m_lawCovMatrix = new M(newLawCovMatrix);
+  this->setLawCovCaches();
   return;
 }
 
@@ -953,6 +994,249 @@ uqGaussianJointPdfClass<V,M>::lawCovMatrix() const
 {
   return *m_lawCovMatrix;
 }
+//--------------------------------------------------
+template<class V, class M>
+void
+uqGaussianJointPdfClass<V,M>::lnValues(
+  const std::vector<const V*>& domainVectors,
+        std::vector<double>&   lnValues) const
+{
+  lnValues.resize(domainVectors.size(),0.);
+
+  double constantTerm = 0.;
+  if (m_normalizationStyle == 0) {
+    constantTerm = log(2*M_PI) + m_lnDeterminant; // normalization of pdf
+  }
+
+  for (unsigned int k = 0; k < domainVectors.size(); ++k) {
+    UQ_FATAL_TEST_MACRO(domainVectors[k] == NULL,
+                        m_env.worldRank(),
+                        "uqGaussianJointPdfClass<V,M>::lnValues()",
+                        "NULL domain vector");
+    if (this->m_domainSet.contains(*domainVectors[k]) == false) {
+      lnValues[k] = -INFINITY;
+    }
+    else {
+      lnValues[k] = -0.5 * (this->quadraticForm(*domainVectors[k]) + constantTerm);
+    }
+    lnValues[k] += m_logOfNormalizationFactor; // [PDF-03]
+  }
+
+  return;
+}
+//--------------------------------------------------
+template<class V, class M>
+void
+uqGaussianJointPdfClass<V,M>::setLawExpCaches()
+{
+  unsigned int iMax = m_lawExpVector->sizeLocal();
+  m_lawExpValues.resize(iMax,0.);
+  for (unsigned int i = 0; i < iMax; ++i) {
+    m_lawExpValues[i] = (*m_lawExpVector)[i];
+  }
+  m_workValues.resize(iMax,0.);
+
+  return;
+}
+//--------------------------------------------------
+template<class V, class M>
+void
+uqGaussianJointPdfClass<V,M>::setLawCovCaches()
+{
+  m_lnDeterminant = 0.;
+
+  if (m_diagonalCovMatrix) {
+    unsigned int iMax = m_lawVarVector->sizeLocal();
+    m_lawInvVarValues.resize(iMax,0.);
+    for (unsigned int i = 0; i < iMax; ++i) {
+      m_lawInvVarValues[i] = 1./(*m_lawVarVector)[i];
+      m_lnDeterminant     += log((*m_lawVarVector)[i]);
+    }
+    if (m_lawVarVector->numOfProcsForStorage() > 1) {
+      double localLnDeterminant = m_lnDeterminant;
+      m_lawVarVector->map().Comm().Allreduce((void *) &localLnDeterminant, (void *) &m_lnDeterminant, (int) 1, uqRawValue_MPI_DOUBLE, uqRawValue_MPI_SUM,
+                                             "uqGaussianJointPdfClass<V,M>::setLawCovCaches()",
+                                             "failed MPI.Allreduce() for log determinant");
+    }
+    return;
+  }
+
+  if (m_lawCovMatrix->numOfProcsForStorage() > 1) {
+    // Rows are distributed: no dense factor, rely on the (collective) matrix routines
+    m_lowerCholValues.clear();
+    m_lowerCholInvDiag.clear();
+    m_lowerCholIsValid = false;
+    m_lnDeterminant    = m_lawCovMatrix->lnDeterminant();
+    return;
+  }
+
+  // Factor covMatrix = L * L^T once, so that each evaluation is a single forward substitution
+  unsigned int n = m_lawCovMatrix->numRowsLocal();
+  m_lowerCholValues.assign((n*(n+1))/2,0.);
+  m_lowerCholInvDiag.assign(n,0.);
+  m_lowerCholIsValid = true;
+  for (unsigned int i = 0; (i < n) && m_lowerCholIsValid; ++i) {
+    double* rowI = &m_lowerCholValues[(i*(i+1))/2];
+    for (unsigned int j = 0; j <= i; ++j) {
+      const double* rowJ = &m_lowerCholValues[(j*(j+1))/2];
+      double sum = (*m_lawCovMatrix)(i,j);
+      for (unsigned int k = 0; k < j; ++k) {
+        sum -= rowI[k]*rowJ[k];
+      }
+      if (j < i) {
+        rowI[j] = sum*m_lowerCholInvDiag[j];
+      }
+      else if (sum > 0.) {
+        rowI[i]                = sqrt(sum);
+        m_lowerCholInvDiag[i]  = 1./rowI[i];
+        m_lnDeterminant       += 2.*log(rowI[i]);
+      }
+      else {
+        m_lowerCholIsValid = false;
+      }
+    }
+  }
+
+  if (m_lowerCholIsValid == false) {
+    // Not numerically positive definite: fall back to the (LU based) matrix routines
+    m_lowerCholValues.clear();
+    m_lowerCholInvDiag.clear();
+    m_lnDeterminant = m_lawCovMatrix->lnDeterminant();
+    if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 2)) {
+      *m_env.subDisplayFile() << "In uqGaussianJointPdfClass<V,M>::setLawCovCaches()"
+                              << ", prefix = " << m_prefix
+                              << ": Cholesky factorization failed, using LU factorization instead"
+                              << std::endl;
+    }
+  }
+
+  return;
+}
+//--------------------------------------------------
+template<class V, class M>
+double
+uqGaussianJointPdfClass<V,M>::quadraticForm(const V& domainVector) const
+{
+  double       result = 0.;
+  unsigned int iMax   = m_lawExpValues.size();
+
+  if (m_diagonalCovMatrix) {
+    const double* mean   = &m_lawExpValues[0];
+    const double* invVar = &m_lawInvVarValues[0];
+    for (unsigned int i = 0; i < iMax; ++i) {
+      double diff = domainVector[i] - mean[i];
+      result += diff*diff*invVar[i];
+    }
+    if (m_lawExpVector->numOfProcsForStorage() > 1) {
+      double localResult = result;
+      m_lawExpVector->map().Comm().Allreduce((void *) &localResult, (void *) &result, (int) 1, uqRawValue_MPI_DOUBLE, uqRawValue_MPI_SUM,
+                                             "uqGaussianJointPdfClass<V,M>::quadraticForm()",
+                                             "failed MPI.Allreduce() for quadratic form");
+    }
+  }
+  else if (m_lowerCholIsValid) {
+    // Solve L * z = (domainVector - mean) and accumulate z^T * z
+    double*       z       = &m_workValues[0];
+    const double* mean    = &m_lawExpValues[0];
+    const double* invDiag = &m_lowerCholInvDiag[0];
+    for (unsigned int i = 0; i < iMax; ++i) {
+      const double* rowI = &m_lowerCholValues[(i*(i+1))/2];
+      double sum = domainVector[i] - mean[i];
+      for (unsigned int k = 0; k < i; ++k) {
+        sum -= rowI[k]*z[k];
+      }
+      z[i]    = sum*invDiag[i];
+      result += z[i]*z[i];
+    }
+  }
+  else {
+    m_workDiffVector->cwSetLinearCombination(1.,domainVector,-1.,*m_lawExpVector);
+    m_lawCovMatrix->invertMultiply(*m_workDiffVector,*m_workSolVector);
+    result = scalarProduct(*m_workDiffVector,*m_workSolVector);
+  }
+
+  return result;
+}
+
+//--------------------------------------------------
+template<class V, class M>
+void
+uqGaussianJointPdfClass<V,M>::lnValueGradient(const V& domainVector, V& gradVector) const
+{
+  unsigned int iMax = m_lawExpValues.size();
+
+  if (m_diagonalCovMatrix) {
+    const double* mean   = &m_lawExpValues[0];
+    const double* invVar = &m_lawInvVarValues[0];
+    for (unsigned int i = 0; i < iMax; ++i) {
+      gradVector[i] = -(domainVector[i] - mean[i])*invVar[i];
+    }
+  }
+  else if (m_lowerCholIsValid) {
+    // quadraticForm() left z = L^{-1} * (domainVector - mean) in m_workValues: solve L^T * w = z
+    double*       w       = &m_workValues[0];
+    const double* invDiag = &m_lowerCholInvDiag[0];
+    for (unsigned int i = iMax; i-- > 0; ) {
+      double sum = w[i];
+      for (unsigned int k = i+1; k < iMax; ++k) {
+        sum -= m_lowerCholValues[(k*(k+1))/2 + i]*w[k];
+      }
+      w[i]          = sum*invDiag[i];
+      gradVector[i] = -w[i];
+    }
+  }
+  else {
+    m_workDiffVector->cwSetLinearCombination(1.,domainVector,-1.,*m_lawExpVector);
+    m_lawCovMatrix->invertMultiply(*m_workDiffVector,gradVector);
+    gradVector *= -1.;
+  }
+
+  return;
+}
+
+//--------------------------------------------------
+template<class V, class M>
+void
+uqGaussianJointPdfClass<V,M>::lnValueHessian(const V* domainDirection, M* hessianMatrix, V* hessianEffect) const
+{
+  unsigned int iMax = m_lawExpValues.size();
+
+  if (m_diagonalCovMatrix) {
+    const double* invVar = &m_lawInvVarValues[0];
+    if (hessianMatrix) {
+      hessianMatrix->cwSet(0.);
+      for (unsigned int i = 0; i < iMax; ++i) {
+        (*hessianMatrix)(i,i) = -invVar[i];
+      }
+    }
+    if (hessianEffect) {
+      for (unsigned int i = 0; i < iMax; ++i) {
+        (*hessianEffect)[i] = -invVar[i]*(*domainDirection)[i];
+      }
+    }
+  }
+  else {
+    if (hessianMatrix) {
+      V unitVector(m_domainSet.vectorSpace().zeroVector());
+      V multVector(unitVector);
+      for (unsigned int j = 0; j < iMax; ++j) {
+        if (j > 0) unitVector[j-1] = 0.;
+        unitVector[j] = 1.;
+        this->m_lawCovMatrix->invertMultiply(unitVector, multVector);
+        for (unsigned int i = 0; i < iMax; ++i) {
+          (*hessianMatrix)(i,j) = -multVector[i];
+        }
+      }
+    }
+    if (hessianEffect) {
+      m_lawCovMatrix->invertMultiply(*domainDirection,*m_workSolVector);
+      *hessianEffect  = *m_workSolVector;
+      *hessianEffect *= -1.;
+    }
+  }
+
+  return;
+}
 
 //*****************************************************
 // Uniform probability density class [PDF-04]
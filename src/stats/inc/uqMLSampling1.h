@@ -75,7 +75,9 @@ struct uqExchangeInfoStruct
 template <class P_V>
 struct uqBalancedLinkedChainControlStruct
 {
-  P_V*         initialPosition; // KEY new: add logPrior and logLikelihood
+  P_V*         initialPosition;
+  double       initialLogPrior;      // ln(prior) at 'initialPosition'
+  double       initialLogLikelihood; // ln(likelihood) at 'initialPosition', not scaled by any exponent
   unsigned int numberOfPositions;
 };
 
@@ -89,7 +91,9 @@ struct uqBalancedLinkedChainsPerNodeStruct
 
 struct uqUnbalancedLinkedChainControlStruct
 {
-  unsigned int initialPositionIndexInPreviousChain; // KEY new: add logPrior and logLikelihood
+  unsigned int initialPositionIndexInPreviousChain;
+  double       initialLogPrior;      // ln(prior) at the initial position
+  double       initialLogLikelihood; // ln(likelihood) at the initial position, not scaled by any exponent
   unsigned int numberOfPositions;
 };
 
@@ -186,6 +190,9 @@ private:
                                         uqUnbalancedLinkedChainsPerNodeStruct&          unbalancedLinkControl,              // (possible) output
                                         const uqMLSamplingLevelOptionsClass*            currOptions,                        // input
                                         const uqSequenceOfVectorsClass<P_V,P_M>&        prevChain,                          // input
+                                        const uqScalarSequenceClass<double>&            prevLogLikelihoodValues,            // input
+                                        const uqScalarSequenceClass<double>&            prevLogTargetValues,                // input
+                                        double                                          prevExponent,                       // input
                                         std::vector<uqExchangeInfoStruct>&              exchangeStdVec,                     // (possible) input/output
                                         uqBalancedLinkedChainsPerNodeStruct<P_V>&       balancedLinkControl);               // (possible) output
 
@@ -193,6 +200,9 @@ private:
                                         uqGenericVectorRVClass<P_V,P_M>&                currRv);                            // output
 
   void   generateSequence_Step09_all   (const uqSequenceOfVectorsClass<P_V,P_M>&        prevChain,                          // input
+                                        const uqScalarSequenceClass<double>&            prevLogLikelihoodValues,            // input
+                                        const uqScalarSequenceClass<double>&            prevLogTargetValues,                // input
+                                        double                                          prevExponent,                       // input
                                         unsigned int                                    indexOfFirstWeight,                 // input
                                         unsigned int                                    indexOfLastWeight,                  // input
                                         const std::vector<double>&                      unifiedWeightStdVectorAtProc0Only,  // input
@@ -238,12 +248,18 @@ private:
 
   void   prepareBalLinkedChains_inter0 (const uqMLSamplingLevelOptionsClass*            currOptions,                        // input
                                         const uqSequenceOfVectorsClass<P_V,P_M>&        prevChain,                          // input
+                                        const uqScalarSequenceClass<double>&            prevLogLikelihoodValues,            // input
+                                        const uqScalarSequenceClass<double>&            prevLogTargetValues,                // input
+                                        double                                          prevExponent,                       // input
                                         std::vector<uqExchangeInfoStruct>&              exchangeStdVec,                     // input/output
                                         uqBalancedLinkedChainsPerNodeStruct<P_V>&       balancedLinkControl);               // output
 
   void   prepareUnbLinkedChains_inter0 (unsigned int                                    indexOfFirstWeight,                 // input
                                         unsigned int                                    indexOfLastWeight,                  // input
                                         const std::vector<unsigned int>&                unifiedIndexCountersAtProc0Only,    // input
+                                        const uqScalarSequenceClass<double>&            prevLogLikelihoodValues,            // input
+                                        const uqScalarSequenceClass<double>&            prevLogTargetValues,                // input
+                                        double                                          prevExponent,                       // input
                                         uqUnbalancedLinkedChainsPerNodeStruct&          unbalancedLinkControl);             // output
 
   void   generateBalLinkedChains_all   (uqMLSamplingLevelOptionsClass&                  inputOptions,                       // input, only m_rawChainSize changes
@@ -276,11 +292,21 @@ private:
                                         std::vector<uqExchangeInfoStruct>&              exchangeStdVec);                    // input/output
 
   void   mpiExchangePositions_inter0   (const uqSequenceOfVectorsClass<P_V,P_M>&        prevChain,                          // input
+                                        const uqScalarSequenceClass<double>&            prevLogLikelihoodValues,            // input
+                                        const uqScalarSequenceClass<double>&            prevLogTargetValues,                // input
+                                        double                                          prevExponent,                       // input
                                         const std::vector<uqExchangeInfoStruct>&        exchangeStdVec,                     // input
                                         const std::vector<unsigned int>&                finalNumChainsPerNode,              // input
                                         const std::vector<unsigned int>&                finalNumPositionsPerNode,           // input
                                         uqBalancedLinkedChainsPerNodeStruct<P_V>&       balancedLinkControl);               // output
 
+  void   getInitialLogValues           (const uqScalarSequenceClass<double>&            prevLogLikelihoodValues,            // input
+                                        const uqScalarSequenceClass<double>&            prevLogTargetValues,                // input
+                                        double                                          prevExponent,                       // input
+                                        unsigned int                                    index,                              // input
+                                        double&                                         logPrior,                           // output
+                                        double&                                         logLikelihood) const;               // output
+
   // Private variables
   const uqBaseEnvironmentClass&             m_env;
   const uqBaseVectorRVClass      <P_V,P_M>& m_priorRv;
@@ -292,7 +318,7 @@ private:
 
         unsigned int                        m_currLevel;          // restart
         unsigned int                        m_currStep;
-        double                              m_debugExponent;
+        double                              m_currExponent;
 	std::vector<double>                 m_logEvidenceFactors; // restart
         double                              m_logEvidence;
         double                              m_meanLogLikelihood;
@@ -319,7 +345,7 @@ uqMLSamplingClass<P_V,P_M>::uqMLSamplingClass(
   m_options           (m_env,prefix),
   m_currLevel         (0),
   m_currStep          (0),
-  m_debugExponent     (0.),
+  m_currExponent      (0.),
   m_logEvidenceFactors(0),
   m_logEvidence       (0.),
   m_meanLogLikelihood (0.),
@@ -644,7 +670,7 @@ uqMLSamplingClass<P_V,P_M>::generateSequence(
     m_env.subComm().Bcast((void *) &currExponent, (int) 1, uqRawValue_MPI_DOUBLE, 0, // Yes, 'subComm', important
                           "uqMLSamplingClass<P_V,P_M>::generateSequence()",
                           "failed MPI.Bcast() for currExponent");
-    m_debugExponent = currExponent;
+    m_currExponent = currExponent;
 
     if (currExponent == 1.) {
       if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 0)) {
@@ -739,6 +765,9 @@ uqMLSamplingClass<P_V,P_M>::generateSequence(
                                      *unbalancedLinkControl,          // (possible) output
                                      currOptions,                     // input
                                      *prevChain,                      // input
+                                     prevLogLikelihoodValues,         // input
+                                     prevLogTargetValues,             // input
+                                     prevExponent,                    // input
                                      exchangeStdVec,                  // (possible) input/output
                                      *balancedLinkControl);           // (possible) output
     }
@@ -767,6 +796,9 @@ uqMLSamplingClass<P_V,P_M>::generateSequence(
     //***********************************************************
     m_currStep = 9;
     generateSequence_Step09_all(*prevChain,                        // input
+                                prevLogLikelihoodValues,           // input
+                                prevLogTargetValues,               // input
+                                prevExponent,                      // input
                                 indexOfFirstWeight,                // input
                                 indexOfLastWeight,                 // input
                                 unifiedWeightStdVectorAtProc0Only, // input
@@ -490,6 +490,7 @@ uqMLSamplingClass<P_V,P_M>::generateSequence_Step01_inter0(
   int iRC = UQ_OK_RC;
   struct timeval timevalStep;
   iRC = gettimeofday(&timevalStep, NULL);
+  unsigned long long traceStep = m_env.tracer().start();
   if (iRC) {}; // just to remove compiler warning
 
       if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 0)) {
@@ -516,6 +517,7 @@ uqMLSamplingClass<P_V,P_M>::generateSequence_Step01_inter0(
       }
 
   double stepRunTime = uqMiscGetEllapsedSeconds(&timevalStep);
+  m_env.tracer().stop(UQ_TRACE_ML_STEP_01_ID + 0,traceStep);
   if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 0)) {
     *m_env.subDisplayFile() << "Leaving uqMLSampling<P_V,P_M>::generateSequence_Step()"
                             << ", level " << m_currLevel+LEVEL_REF_ID
@@ -543,6 +545,7 @@ uqMLSamplingClass<P_V,P_M>::generateSequence_Step02_inter0(
   int iRC = UQ_OK_RC;
   struct timeval timevalStep;
   iRC = gettimeofday(&timevalStep, NULL);
+  unsigned long long traceStep = m_env.tracer().start();
   if (iRC) {}; // just to remove compiler warning
 
       if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 0)) {
@@ -654,6 +657,7 @@ uqMLSamplingClass<P_V,P_M>::generateSequence_Step02_inter0(
       }
 
   double stepRunTime = uqMiscGetEllapsedSeconds(&timevalStep);
+  m_env.tracer().stop(UQ_TRACE_ML_STEP_01_ID + 1,traceStep);
   if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 0)) {
     *m_env.subDisplayFile() << "Leaving uqMLSampling<P_V,P_M>::generateSequence_Step()"
                             << ", level " << m_currLevel+LEVEL_REF_ID
@@ -678,6 +682,7 @@ uqMLSamplingClass<P_V,P_M>::generateSequence_Step03_inter0(
   int iRC = UQ_OK_RC;
   struct timeval timevalStep;
   iRC = gettimeofday(&timevalStep, NULL);
+  unsigned long long traceStep = m_env.tracer().start();
   if (iRC) {}; // just to remove compiler warning
 
       if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 0)) {
@@ -960,6 +965,7 @@ uqMLSamplingClass<P_V,P_M>::generateSequence_Step03_inter0(
       }
 
   double stepRunTime = uqMiscGetEllapsedSeconds(&timevalStep);
+  m_env.tracer().stop(UQ_TRACE_ML_STEP_01_ID + 2,traceStep);
   if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 0)) {
     *m_env.subDisplayFile() << "Leaving uqMLSampling<P_V,P_M>::generateSequence_Step()"
                             << ", level " << m_currLevel+LEVEL_REF_ID
@@ -982,6 +988,7 @@ uqMLSamplingClass<P_V,P_M>::generateSequence_Step04_inter0(
   int iRC = UQ_OK_RC;
   struct timeval timevalStep;
   iRC = gettimeofday(&timevalStep, NULL);
+  unsigned long long traceStep = m_env.tracer().start();
   if (iRC) {}; // just to remove compiler warning
 
       if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 0)) {
@@ -1041,6 +1048,7 @@ uqMLSamplingClass<P_V,P_M>::generateSequence_Step04_inter0(
       }
 
   double stepRunTime = uqMiscGetEllapsedSeconds(&timevalStep);
+  m_env.tracer().stop(UQ_TRACE_ML_STEP_01_ID + 3,traceStep);
   if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 0)) {
     *m_env.subDisplayFile() << "Leaving uqMLSampling<P_V,P_M>::generateSequence_Step()"
                             << ", level " << m_currLevel+LEVEL_REF_ID
@@ -1063,6 +1071,7 @@ uqMLSamplingClass<P_V,P_M>::generateSequence_Step05_inter0(
   int iRC = UQ_OK_RC;
   struct timeval timevalStep;
   iRC = gettimeofday(&timevalStep, NULL);
+  unsigned long long traceStep = m_env.tracer().start();
   if (iRC) {}; // just to remove compiler warning
 
       if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 0)) {
@@ -1124,6 +1133,7 @@ uqMLSamplingClass<P_V,P_M>::generateSequence_Step05_inter0(
       }
 
   double stepRunTime = uqMiscGetEllapsedSeconds(&timevalStep);
+  m_env.tracer().stop(UQ_TRACE_ML_STEP_01_ID + 4,traceStep);
   if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 0)) {
     *m_env.subDisplayFile() << "Leaving uqMLSampling<P_V,P_M>::generateSequence_Step()"
                             << ", level " << m_currLevel+LEVEL_REF_ID
@@ -1148,6 +1158,7 @@ uqMLSamplingClass<P_V,P_M>::generateSequence_Step06_all(
   int iRC = UQ_OK_RC;
   struct timeval timevalStep;
   iRC = gettimeofday(&timevalStep, NULL);
+  unsigned long long traceStep = m_env.tracer().start();
   if (iRC) {}; // just to remove compiler warning
 
   useBalancedChains = decideOnBalancedChains_all(currOptions,                     // input
@@ -1157,6 +1168,7 @@ uqMLSamplingClass<P_V,P_M>::generateSequence_Step06_all(
                                                  exchangeStdVec);                 // output
 
   double stepRunTime = uqMiscGetEllapsedSeconds(&timevalStep);
+  m_env.tracer().stop(UQ_TRACE_ML_STEP_01_ID + 5,traceStep);
   if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 0)) {
     *m_env.subDisplayFile() << "Leaving uqMLSampling<P_V,P_M>::generateSequence_Step()"
                             << ", level " << m_currLevel+LEVEL_REF_ID
@@ -1178,12 +1190,16 @@ uqMLSamplingClass<P_V,P_M>::generateSequence_Step07_inter0(
   uqUnbalancedLinkedChainsPerNodeStruct&    unbalancedLinkControl,           // (possible) output
   const uqMLSamplingLevelOptionsClass*      currOptions,                     // input
   const uqSequenceOfVectorsClass<P_V,P_M>&  prevChain,                       // input
+  const uqScalarSequenceClass<double>&      prevLogLikelihoodValues,         // input
+  const uqScalarSequenceClass<double>&      prevLogTargetValues,             // input
+  double                                    prevExponent,                    // input
   std::vector<uqExchangeInfoStruct>&        exchangeStdVec,                  // (possible) input/output
   uqBalancedLinkedChainsPerNodeStruct<P_V>& balancedLinkControl)             // (possible) output
 {
   int iRC = UQ_OK_RC;
   struct timeval timevalStep;
   iRC = gettimeofday(&timevalStep, NULL);
+  unsigned long long traceStep = m_env.tracer().start();
   if (iRC) {}; // just to remove compiler warning
 
       if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 0)) {
@@ -1197,6 +1213,9 @@ uqMLSamplingClass<P_V,P_M>::generateSequence_Step07_inter0(
       if (useBalancedChains) {
         prepareBalLinkedChains_inter0(currOptions,                     // input
                                       prevChain,                       // input
+                                      prevLogLikelihoodValues,         // input
+                                      prevLogTargetValues,             // input
+                                      prevExponent,                    // input
                                       exchangeStdVec,                  // input/output
                                       balancedLinkControl);            // output
       }
@@ -1204,6 +1223,9 @@ uqMLSamplingClass<P_V,P_M>::generateSequence_Step07_inter0(
         prepareUnbLinkedChains_inter0(indexOfFirstWeight,              // input
                                       indexOfLastWeight,               // input
                                       unifiedIndexCountersAtProc0Only, // input
+                                      prevLogLikelihoodValues,         // input
+                                      prevLogTargetValues,             // input
+                                      prevExponent,                    // input
                                       unbalancedLinkControl);          // output
       }
 
@@ -1217,6 +1239,7 @@ uqMLSamplingClass<P_V,P_M>::generateSequence_Step07_inter0(
       }
 
   double stepRunTime = uqMiscGetEllapsedSeconds(&timevalStep);
+  m_env.tracer().stop(UQ_TRACE_ML_STEP_01_ID + 6,traceStep);
   if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 0)) {
     *m_env.subDisplayFile() << "Leaving uqMLSampling<P_V,P_M>::generateSequence_Step()"
                             << ", level " << m_currLevel+LEVEL_REF_ID
@@ -1237,6 +1260,7 @@ uqMLSamplingClass<P_V,P_M>::generateSequence_Step08_all(
   int iRC = UQ_OK_RC;
   struct timeval timevalStep;
   iRC = gettimeofday(&timevalStep, NULL);
+  unsigned long long traceStep = m_env.tracer().start();
   if (iRC) {}; // just to remove compiler warning
 
       if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 0)) {
@@ -1250,6 +1274,7 @@ uqMLSamplingClass<P_V,P_M>::generateSequence_Step08_all(
       currRv.setPdf(currPdf);
 
   double stepRunTime = uqMiscGetEllapsedSeconds(&timevalStep);
+  m_env.tracer().stop(UQ_TRACE_ML_STEP_01_ID + 7,traceStep);
   if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 0)) {
     *m_env.subDisplayFile() << "Leaving uqMLSampling<P_V,P_M>::generateSequence_Step()"
                             << ", level " << m_currLevel+LEVEL_REF_ID
@@ -1265,6 +1290,9 @@ template <class P_V,class P_M>
 void
 uqMLSamplingClass<P_V,P_M>::generateSequence_Step09_all(
   const uqSequenceOfVectorsClass<P_V,P_M>& prevChain,                         // input
+  const uqScalarSequenceClass<double>&     prevLogLikelihoodValues,           // input
+  const uqScalarSequenceClass<double>&     prevLogTargetValues,               // input
+  double                                   prevExponent,                      // input
   unsigned int                             indexOfFirstWeight,                // input
   unsigned int                             indexOfLastWeight,                 // input
   const std::vector<double>&               unifiedWeightStdVectorAtProc0Only, // input
@@ -1278,6 +1306,7 @@ uqMLSamplingClass<P_V,P_M>::generateSequence_Step09_all(
   int iRC = UQ_OK_RC;
   struct timeval timevalStep;
   iRC = gettimeofday(&timevalStep, NULL);
+  unsigned long long traceStep = m_env.tracer().start();
   if (iRC) {}; // just to remove compiler warning
 
     if (currOptions->m_scaleCovMatrix == false) {
@@ -1319,6 +1348,19 @@ uqMLSamplingClass<P_V,P_M>::generateSequence_Step09_all(
       double meanRejectionRate = .5*(currOptions->m_minRejectionRate + currOptions->m_maxRejectionRate);
       bool useMiddlePointLogicForEta = false;
       P_M nowCovMatrix(unifiedCovMatrix);
+
+      // With 'numConcurrentEtas' > 1, each attempt assesses that many candidate etas at once: the
+      // 'inter0Comm' nodes are split into groups, each group generating its trial chains with one
+      // candidate. Each group still generates at least the number of positions that the requested
+      // c.o.v. demands, so every candidate rejection rate is judged as in the serial procedure.
+      unsigned int numConcurrentEtas = 1;
+      if (m_env.inter0Rank() >= 0) { // KAUST
+        numConcurrentEtas = std::min(currOptions->m_numConcurrentEtas,(unsigned int) m_env.inter0Comm().NumProc());
+      }
+      std::vector<double> candidateEtas(numConcurrentEtas,prevEta);
+      std::vector<double> candidateRejectionRates(numConcurrentEtas,0.);
+      double belowRangeEta = 0.; // Largest eta assessed so far with rejection rate below range; '0' if none
+      double aboveRangeEta = 0.; // Smallest eta assessed so far with rejection rate above range; '0' if none
 #if 0 // KAUST, to check
       std::vector<double> unifiedWeightStdVectorAtProc0Only(0);
       weightSequence.getUnifiedContentsAtProc0Only(m_vectorSpace.numOfProcsForStorage() == 1,
@@ -1350,7 +1392,7 @@ uqMLSamplingClass<P_V,P_M>::generateSequence_Step09_all(
         }
 
         if (m_env.inter0Rank() >= 0) { // KAUST
-          if (nowAttempt > 0) {
+          if ((numConcurrentEtas == 1) && (nowAttempt > 0)) {
             if (useMiddlePointLogicForEta == false) {
               if (nowAttempt == 1) {
                 // Ok, keep useMiddlePointLogicForEta = false
@@ -1448,10 +1490,48 @@ uqMLSamplingClass<P_V,P_M>::generateSequence_Step09_all(
                                         << std::endl;
               }
             }
-          } // if (nowAttempt > 0)
+          } // if ((numConcurrentEtas == 1) && (nowAttempt > 0))
+
+          if (numConcurrentEtas > 1) {
+            for (unsigned int j = 0; j < numConcurrentEtas; ++j) {
+              if (nowAttempt == 0) {
+                // Spread candidates around 'prevEta': prevEta, 2*prevEta, prevEta/2, 4*prevEta, prevEta/4, ...
+                if      (j == 0     ) candidateEtas[j] = prevEta;
+                else if (j % 2 == 1 ) candidateEtas[j] = prevEta * std::pow(2.,(double) ((j+1)/2));
+                else                  candidateEtas[j] = prevEta / std::pow(2.,(double) (j/2));
+              }
+              else if ((belowRangeEta > 0.) && (aboveRangeEta > 0.)) {
+                // Same as the middle point logic, but with 'numConcurrentEtas' interior points
+                candidateEtas[j] = belowRangeEta + (aboveRangeEta - belowRangeEta)*((double) (j+1))/((double) (numConcurrentEtas+1));
+              }
+              else if (belowRangeEta > 0.) {
+                candidateEtas[j] = belowRangeEta * std::pow(4.,(double) (j+1));
+              }
+              else {
+                candidateEtas[j] = aboveRangeEta / std::pow(4.,(double) (j+1));
+              }
+            }
+            if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 0)) {
+              *m_env.subDisplayFile() << "In uqMLSampling<P_V,P_M>::generateSequence_Step09_all()"
+                                      << ", level " << m_currLevel+LEVEL_REF_ID
+                                      << ", step "  << m_currStep
+                                      << ": in loop for assessing rejection rate"
+                                      << ", with nowAttempt = " << nowAttempt
+                                      << ", candidate etas (to be tested) =";
+              for (unsigned int j = 0; j < numConcurrentEtas; ++j) {
+                *m_env.subDisplayFile() << " " << candidateEtas[j];
+              }
+              *m_env.subDisplayFile() << std::endl;
+            }
+          } // if (numConcurrentEtas > 1)
         } // if (m_env.inter0Rank() >= 0) // KAUST
 
-        nowCovMatrix *= nowEta;
+        if (numConcurrentEtas > 1) {
+          nowCovMatrix *= candidateEtas[m_env.inter0Rank() % numConcurrentEtas];
+        }
+        else {
+          nowCovMatrix *= nowEta;
+        }
 
         // prudencio 2010-12-09: logic 'originalSubNumSamples += 1' added because of the difference of results between GNU and INTEL compiled codes
         double       doubSubNumSamples     = (1.-meanRejectionRate)/meanRejectionRate/currOptions->m_covRejectionRate/currOptions->m_covRejectionRate; // e.g. 19.99...; or 20.0; or 20.1; or 20.9
@@ -1514,6 +1594,9 @@ uqMLSamplingClass<P_V,P_M>::generateSequence_Step09_all(
           if (useBalancedChains) {
             prepareBalLinkedChains_inter0(currOptions,                        // input
                                           prevChain,                          // input
+                                          prevLogLikelihoodValues,            // input
+                                          prevLogTargetValues,                // input
+                                          prevExponent,                       // input
                                           exchangeStdVec,                     // input/output
                                           nowBalLinkControl);                 // output
           }
@@ -1521,6 +1604,9 @@ uqMLSamplingClass<P_V,P_M>::generateSequence_Step09_all(
             prepareUnbLinkedChains_inter0(indexOfFirstWeight,                 // input
                                           indexOfLastWeight,                  // input
                                           nowUnifiedIndexCountersAtProc0Only, // input
+                                          prevLogLikelihoodValues,            // input
+                                          prevLogTargetValues,                // input
+                                          prevExponent,                       // input
                                           nowUnbLinkControl);                 // output
           }
         } // KAUST
@@ -1608,7 +1694,57 @@ uqMLSamplingClass<P_V,P_M>::generateSequence_Step09_all(
         }
         nowBalLinkControl.balLinkedChains.clear();
 
-        if (m_env.inter0Rank() >= 0) { // KAUST
+        if ((m_env.inter0Rank() >= 0) && // KAUST
+            (numConcurrentEtas > 1  )) {
+          // Several cov matrices are used, so the rejection of each one is assessed among the nodes of its group
+          unsigned int myCandidate = m_env.inter0Rank() % numConcurrentEtas;
+          std::vector<unsigned int> subCounts    (2*numConcurrentEtas,0); // rejections, then positions
+          std::vector<unsigned int> unifiedCounts(2*numConcurrentEtas,0);
+          subCounts[myCandidate]                   = nowRejections;
+          subCounts[numConcurrentEtas+myCandidate] = nowChain.subSequenceSize();
+          m_env.inter0Comm().Allreduce((void *) &subCounts[0], (void *) &unifiedCounts[0], (int) subCounts.size(), uqRawValue_MPI_UNSIGNED, uqRawValue_MPI_SUM,
+                                       "uqMLSamplingClass<P_V,P_M>::generateSequence_Step09_all()",
+                                       "failed MPI.Allreduce() for now rejections per candidate eta");
+
+          // Among the candidates within range, keep the one closest to the mean rejection rate
+          testResult = false;
+          unsigned int chosenCandidate = 0;
+          for (unsigned int j = 0; j < numConcurrentEtas; ++j) {
+            UQ_FATAL_TEST_MACRO(unifiedCounts[numConcurrentEtas+j] == 0,
+                                m_env.worldRank(),
+                                "uqMLSamplingClass<P_V,P_M>::generateSequence_Step09_all()",
+                                "no positions generated for a candidate eta");
+            candidateRejectionRates[j] = ((double) unifiedCounts[j]) / ((double) unifiedCounts[numConcurrentEtas+j]);
+            if (candidateRejectionRates[j] < currOptions->m_minRejectionRate) {
+              if (candidateEtas[j] > belowRangeEta) belowRangeEta = candidateEtas[j];
+            }
+            else if (candidateRejectionRates[j] > currOptions->m_maxRejectionRate) {
+              if ((aboveRangeEta == 0.) || (candidateEtas[j] < aboveRangeEta)) aboveRangeEta = candidateEtas[j];
+            }
+            else if ((testResult == false) ||
+                     (fabs(candidateRejectionRates[j] - meanRejectionRate) < fabs(candidateRejectionRates[chosenCandidate] - meanRejectionRate))) {
+              testResult      = true;
+              chosenCandidate = j;
+            }
+          }
+          nowEta           = candidateEtas[chosenCandidate];
+          nowRejectionRate = candidateRejectionRates[chosenCandidate];
+
+          if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 0)) {
+            *m_env.subDisplayFile() << "In uqMLSampling<P_V,P_M>::generateSequence_Step09_all()"
+                                    << ", level " << m_currLevel+LEVEL_REF_ID
+                                    << ", step "  << m_currStep
+                                    << ": in loop for assessing rejection rate"
+                                    << ", with nowAttempt = " << nowAttempt
+                                    << ", candidate rejection rates =";
+            for (unsigned int j = 0; j < numConcurrentEtas; ++j) {
+              *m_env.subDisplayFile() << " " << candidateRejectionRates[j]
+                                      << " (" << unifiedCounts[numConcurrentEtas+j] << " positions)";
+            }
+            *m_env.subDisplayFile() << std::endl;
+          }
+        }
+        else if (m_env.inter0Rank() >= 0) { // KAUST
           // If only one cov matrix is used, then the rejection should be assessed among all inter0Comm nodes // KAUST3
           unsigned int nowUnifiedRejections = 0;
           m_env.inter0Comm().Allreduce((void *) &nowRejections, (void *) &nowUnifiedRejections, (int) 1, uqRawValue_MPI_UNSIGNED, uqRawValue_MPI_SUM,
@@ -1707,6 +1843,7 @@ uqMLSamplingClass<P_V,P_M>::generateSequence_Step09_all(
     }
 
   double stepRunTime = uqMiscGetEllapsedSeconds(&timevalStep);
+  m_env.tracer().stop(UQ_TRACE_ML_STEP_01_ID + 8,traceStep);
   if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 0)) {
     *m_env.subDisplayFile() << "Leaving uqMLSampling<P_V,P_M>::generateSequence_Step()"
                             << ", level " << m_currLevel+LEVEL_REF_ID
@@ -1738,6 +1875,7 @@ uqMLSamplingClass<P_V,P_M>::generateSequence_Step10_all(
   int iRC = UQ_OK_RC;
   struct timeval timevalStep;
   iRC = gettimeofday(&timevalStep, NULL);
+  unsigned long long traceStep = m_env.tracer().start();
   if (iRC) {}; // just to remove compiler warning
 
       if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 0)) {
@@ -1813,6 +1951,7 @@ uqMLSamplingClass<P_V,P_M>::generateSequence_Step10_all(
       currOptions.m_filteredChainGenerate = savedFilteredChainGenerate; // FIX ME
 
   double stepRunTime = uqMiscGetEllapsedSeconds(&timevalStep);
+  m_env.tracer().stop(UQ_TRACE_ML_STEP_01_ID + 9,traceStep);
   if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 0)) {
     *m_env.subDisplayFile() << "Leaving uqMLSampling<P_V,P_M>::generateSequence_Step()"
                             << ", level " << m_currLevel+LEVEL_REF_ID
@@ -1838,6 +1977,7 @@ uqMLSamplingClass<P_V,P_M>::generateSequence_Step11_inter0(
   int iRC = UQ_OK_RC;
   struct timeval timevalStep;
   iRC = gettimeofday(&timevalStep, NULL);
+  unsigned long long traceStep = m_env.tracer().start();
   if (iRC) {}; // just to remove compiler warning
 
   if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 0)) {
@@ -1982,6 +2122,7 @@ uqMLSamplingClass<P_V,P_M>::generateSequence_Step11_inter0(
                                "failed MPI.Allreduce() for number of rejections");
 
   double stepRunTime = uqMiscGetEllapsedSeconds(&timevalStep);
+  m_env.tracer().stop(UQ_TRACE_ML_STEP_01_ID + 10,traceStep);
   if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 0)) {
     *m_env.subDisplayFile() << "Leaving uqMLSampling<P_V,P_M>::generateSequence_Step()"
                             << ", level " << m_currLevel+LEVEL_REF_ID
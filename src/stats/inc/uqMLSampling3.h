@@ -282,10 +282,13 @@ uqMLSamplingClass<P_V,P_M>::decideOnBalancedChains_all(
 template <class P_V,class P_M>
 void
 uqMLSamplingClass<P_V,P_M>::prepareBalLinkedChains_inter0( // EXTRA FOR LOAD BALANCE
-  const uqMLSamplingLevelOptionsClass*      currOptions,         // input
-  const uqSequenceOfVectorsClass<P_V,P_M>&  prevChain,           // input
-  std::vector<uqExchangeInfoStruct>&        exchangeStdVec,      // input/output
-  uqBalancedLinkedChainsPerNodeStruct<P_V>& balancedLinkControl) // output
+  const uqMLSamplingLevelOptionsClass*      currOptions,             // input
+  const uqSequenceOfVectorsClass<P_V,P_M>&  prevChain,               // input
+  const uqScalarSequenceClass<double>&      prevLogLikelihoodValues, // input
+  const uqScalarSequenceClass<double>&      prevLogTargetValues,     // input
+  double                                    prevExponent,            // input
+  std::vector<uqExchangeInfoStruct>&        exchangeStdVec,          // input/output
+  uqBalancedLinkedChainsPerNodeStruct<P_V>& balancedLinkControl)     // output
 {
   if (m_env.inter0Rank() < 0) return;
 
@@ -409,6 +412,9 @@ uqMLSamplingClass<P_V,P_M>::prepareBalLinkedChains_inter0( // EXTRA FOR LOAD BAL
   // balancedLinkControl.linkedChains at each node
   //////////////////////////////////////////////////////////////////////////
   mpiExchangePositions_inter0(prevChain,
+                              prevLogLikelihoodValues,
+                              prevLogTargetValues,
+                              prevExponent,
                               exchangeStdVec,
                               finalNumChainsPerNode,
                               finalNumPositionsPerNode, // It is already valid at all "management" nodes (not only at node 0) because of the sanity check above
@@ -423,6 +429,9 @@ uqMLSamplingClass<P_V,P_M>::prepareUnbLinkedChains_inter0(
   unsigned int                           indexOfFirstWeight,              // input
   unsigned int                           indexOfLastWeight,               // input
   const std::vector<unsigned int>&       unifiedIndexCountersAtProc0Only, // input
+  const uqScalarSequenceClass<double>&   prevLogLikelihoodValues,         // input
+  const uqScalarSequenceClass<double>&   prevLogTargetValues,             // input
+  double                                 prevExponent,                    // input
   uqUnbalancedLinkedChainsPerNodeStruct& unbalancedLinkControl)           // output
 {
   if (m_env.inter0Rank() < 0) return;
@@ -546,6 +555,12 @@ uqMLSamplingClass<P_V,P_M>::prepareUnbLinkedChains_inter0(
       if (unifiedIndexCountersAtAllProcs[i] < numberOfPositionsToGuaranteeForNode) {
         uqUnbalancedLinkedChainControlStruct auxControl;
         auxControl.initialPositionIndexInPreviousChain = i;
+        getInitialLogValues(prevLogLikelihoodValues,          // input
+                            prevLogTargetValues,              // input
+                            prevExponent,                     // input
+                            i - indexOfFirstWeight,           // input
+                            auxControl.initialLogPrior,       // output
+                            auxControl.initialLogLikelihood); // output
         auxControl.numberOfPositions = unifiedIndexCountersAtAllProcs[i];
         unbalancedLinkControl.unbLinkedChains.push_back(auxControl);
 
@@ -557,6 +572,12 @@ uqMLSamplingClass<P_V,P_M>::prepareUnbLinkedChains_inter0(
       //else { // KAUST4
         uqUnbalancedLinkedChainControlStruct auxControl;
         auxControl.initialPositionIndexInPreviousChain = i;
+        getInitialLogValues(prevLogLikelihoodValues,          // input
+                            prevLogTargetValues,              // input
+                            prevExponent,                     // input
+                            i - indexOfFirstWeight,           // input
+                            auxControl.initialLogPrior,       // output
+                            auxControl.initialLogLikelihood); // output
         auxControl.numberOfPositions = numberOfPositionsToGuaranteeForNode;
         unbalancedLinkControl.unbLinkedChains.push_back(auxControl);
 
@@ -614,6 +635,7 @@ uqMLSamplingClass<P_V,P_M>::generateBalLinkedChains_all( // EXTRA FOR LOAD BALAN
   }
 
   P_V auxInitialPosition(m_vectorSpace.zeroVector());
+  std::vector<double> auxInitialLogValues(2,0.); // ln(prior) and ln(likelihood) at 'auxInitialPosition'
 
   unsigned int chainIdMax = 0;
   if (m_env.inter0Rank() >= 0) {
@@ -674,8 +696,8 @@ uqMLSamplingClass<P_V,P_M>::generateBalLinkedChains_all( // EXTRA FOR LOAD BALAN
 
     // 2013-02-23: print sizes, and expected final size
   }
-  if ((m_debugExponent == 1.) && 
-      (m_currStep      == 10)) {
+  if ((m_currExponent == 1.) && 
+      (m_currStep     == 10)) {
     //m_env.setExceptionalCircumstance(true);
   }
   unsigned int cumulativeNumPositions = 0;
@@ -684,6 +706,8 @@ uqMLSamplingClass<P_V,P_M>::generateBalLinkedChains_all( // EXTRA FOR LOAD BALAN
     if (m_env.inter0Rank() >= 0) {
       // aqui 4
       auxInitialPosition = *(balancedLinkControl.balLinkedChains[chainId].initialPosition); // Round Rock
+      auxInitialLogValues[0] = balancedLinkControl.balLinkedChains[chainId].initialLogPrior;
+      auxInitialLogValues[1] = balancedLinkControl.balLinkedChains[chainId].initialLogLikelihood;
       tmpChainSize = balancedLinkControl.balLinkedChains[chainId].numberOfPositions+1; // IMPORTANT: '+1' in order to discard initial position afterwards
       if ((m_env.subDisplayFile()       ) &&
           (m_env.displayVerbosity() >= 3)) {
@@ -715,6 +739,10 @@ uqMLSamplingClass<P_V,P_M>::generateBalLinkedChains_all( // EXTRA FOR LOAD BALAN
                           "uqMLSamplingClass<P_V,P_M>::generateBalLinkedChains_all()",
                           "failed MPI.Bcast() for tmpChainSize");
 
+    m_env.subComm().Bcast((void *) &auxInitialLogValues[0], (int) auxInitialLogValues.size(), uqRawValue_MPI_DOUBLE, 0, // Yes, 'subComm', important
+                          "uqMLSamplingClass<P_V,P_M>::generateBalLinkedChains_all()",
+                          "failed MPI.Bcast() for auxInitialLogValues");
+
     inputOptions.m_rawChainSize = tmpChainSize;
     uqSequenceOfVectorsClass<P_V,P_M> tmpChain(m_vectorSpace,
                                                0,
@@ -725,9 +753,14 @@ uqMLSamplingClass<P_V,P_M>::generateBalLinkedChains_all( // EXTRA FOR LOAD BALAN
     // KAUST: all nodes should call here
     uqMetropolisHastingsSGClass<P_V,P_M> mcSeqGenerator(inputOptions,
                                                         rv,
-                                                        auxInitialPosition, // KEY new: pass logPrior and logLikelihood
+                                                        auxInitialPosition,
                                                         &unifiedCovMatrix);
 
+    // The target pdf of the current level differs from the one of the previous level
+    // only by the exponent of the likelihood, so the initial position needs no new evaluation
+    mcSeqGenerator.setInitialLogValues(m_currExponent*auxInitialLogValues[1],                           // logLikelihood
+                                       auxInitialLogValues[0] + m_currExponent*auxInitialLogValues[1]); // logTarget
+
     // KAUST: all nodes should call here
     mcSeqGenerator.generateSequence(tmpChain,
                                     &tmpLogLikelihoodValues, // likelihood is IMPORTANT
@@ -851,6 +884,7 @@ uqMLSamplingClass<P_V,P_M>::generateUnbLinkedChains_all(
   }
 
   P_V auxInitialPosition(m_vectorSpace.zeroVector());
+  std::vector<double> auxInitialLogValues(2,0.); // ln(prior) and ln(likelihood) at 'auxInitialPosition'
 
   unsigned int chainIdMax = 0;
   if (m_env.inter0Rank() >= 0) {
@@ -909,8 +943,8 @@ uqMLSamplingClass<P_V,P_M>::generateUnbLinkedChains_all(
                               << std::endl;
     }
   }
-  if ((m_debugExponent == 1.) && 
-      (m_currStep      == 10)) {
+  if ((m_currExponent == 1.) && 
+      (m_currStep     == 10)) {
     //m_env.setExceptionalCircumstance(true);
   }
   unsigned int cumulativeNumPositions = 0;
@@ -919,6 +953,8 @@ uqMLSamplingClass<P_V,P_M>::generateUnbLinkedChains_all(
     if (m_env.inter0Rank() >= 0) {
       unsigned int auxIndex = unbalancedLinkControl.unbLinkedChains[chainId].initialPositionIndexInPreviousChain - indexOfFirstWeight; // KAUST4 // Round Rock
       prevChain.getPositionValues(auxIndex,auxInitialPosition); // Round Rock
+      auxInitialLogValues[0] = unbalancedLinkControl.unbLinkedChains[chainId].initialLogPrior;
+      auxInitialLogValues[1] = unbalancedLinkControl.unbLinkedChains[chainId].initialLogLikelihood;
       tmpChainSize = unbalancedLinkControl.unbLinkedChains[chainId].numberOfPositions+1; // IMPORTANT: '+1' in order to discard initial position afterwards
       if ((m_env.subDisplayFile()       ) &&
           (m_env.displayVerbosity() >= 3)) {
@@ -950,6 +986,10 @@ uqMLSamplingClass<P_V,P_M>::generateUnbLinkedChains_all(
                           "uqMLSamplingClass<P_V,P_M>::generateUnbLinkedChains_all()",
                           "failed MPI.Bcast() for tmpChainSize");
 
+    m_env.subComm().Bcast((void *) &auxInitialLogValues[0], (int) auxInitialLogValues.size(), uqRawValue_MPI_DOUBLE, 0, // Yes, 'subComm', important
+                          "uqMLSamplingClass<P_V,P_M>::generateUnbLinkedChains_all()",
+                          "failed MPI.Bcast() for auxInitialLogValues");
+
     inputOptions.m_rawChainSize = tmpChainSize;
     uqSequenceOfVectorsClass<P_V,P_M> tmpChain(m_vectorSpace,
                                                0,
@@ -960,9 +1000,14 @@ uqMLSamplingClass<P_V,P_M>::generateUnbLinkedChains_all(
     // KAUST: all nodes should call here
     uqMetropolisHastingsSGClass<P_V,P_M> mcSeqGenerator(inputOptions,
                                                         rv,
-                                                        auxInitialPosition, // KEY new: pass logPrior and logLikelihood
+                                                        auxInitialPosition,
                                                         &unifiedCovMatrix);
 
+    // The target pdf of the current level differs from the one of the previous level
+    // only by the exponent of the likelihood, so the initial position needs no new evaluation
+    mcSeqGenerator.setInitialLogValues(m_currExponent*auxInitialLogValues[1],                           // logLikelihood
+                                       auxInitialLogValues[0] + m_currExponent*auxInitialLogValues[1]); // logTarget
+
     // KAUST: all nodes should call here
     mcSeqGenerator.generateSequence(tmpChain,
                                     &tmpLogLikelihoodValues, // likelihood is IMPORTANT
@@ -1761,6 +1806,9 @@ template <class P_V,class P_M>
 void
 uqMLSamplingClass<P_V,P_M>::mpiExchangePositions_inter0( // EXTRA FOR LOAD BALANCE
   const uqSequenceOfVectorsClass<P_V,P_M>&  prevChain,                // input
+  const uqScalarSequenceClass<double>&      prevLogLikelihoodValues,  // input
+  const uqScalarSequenceClass<double>&      prevLogTargetValues,      // input
+  double                                    prevExponent,             // input
   const std::vector<uqExchangeInfoStruct>&  exchangeStdVec,           // input
   const std::vector<unsigned int>&          finalNumChainsPerNode,    // input
   const std::vector<unsigned int>&          finalNumPositionsPerNode, // input
@@ -1875,28 +1923,37 @@ uqMLSamplingClass<P_V,P_M>::mpiExchangePositions_inter0( // EXTRA FOR LOAD BALAN
     //////////////////////////////////////////////////////////////////////////
     // Prepare counters and buffers for gatherv of initial positions
     //////////////////////////////////////////////////////////////////////////
+    // Each initial position travels together with its ln(prior) and ln(likelihood),
+    // so that the linked chains do not need to evaluate the target pdf at it again
     unsigned int dimSize = m_vectorSpace.dimLocal();
+    unsigned int bufSize = dimSize + 2;
     P_V auxInitialPosition(m_vectorSpace.zeroVector());
     std::vector<double> sendbuf(0);
     unsigned int sendcnt = 0;
     if (m_env.inter0Rank() != (int) r) {
-      sendcnt = numberOfInitialPositionsNodeRHasToReceiveFromNode[m_env.inter0Rank()] * dimSize;
+      sendcnt = numberOfInitialPositionsNodeRHasToReceiveFromNode[m_env.inter0Rank()] * bufSize;
       sendbuf.resize(sendcnt);
       for (unsigned int i = 0; i < numberOfInitialPositionsNodeRHasToReceiveFromNode[m_env.inter0Rank()]; ++i) {
         unsigned int auxIndex = indexesOfInitialPositionsNodeRHasToReceiveFromMe[i];
         prevChain.getPositionValues(auxIndex,auxInitialPosition);
         for (unsigned int j = 0; j < dimSize; ++j) {
-          sendbuf[i*dimSize + j] = auxInitialPosition[j];
+          sendbuf[i*bufSize + j] = auxInitialPosition[j];
         }
+        getInitialLogValues(prevLogLikelihoodValues,                 // input
+                            prevLogTargetValues,                     // input
+                            prevExponent,                            // input
+                            auxIndex,                                // input
+                            sendbuf[i*bufSize + dimSize],            // output
+                            sendbuf[i*bufSize + dimSize + 1]);       // output
       }
     }
 
     std::vector<double> recvbuf(0);
     std::vector<int> recvcnts(Np,0); // '0' is already the correct value for recvcnts[r]
     if (m_env.inter0Rank() == (int) r) {
-      recvbuf.resize(totalNumberOfInitialPositionsNodeRHasToReceive * dimSize);
+      recvbuf.resize(totalNumberOfInitialPositionsNodeRHasToReceive * bufSize);
       for (unsigned int nodeId = 0; nodeId < Np; ++nodeId) { // Yes, from '0' on (for 'r', numberOf...ToReceiveFromNode[r] = 0 anyway)
-        recvcnts[nodeId] = numberOfInitialPositionsNodeRHasToReceiveFromNode[nodeId/*m_env.inter0Rank()*/] * dimSize;
+        recvcnts[nodeId] = numberOfInitialPositionsNodeRHasToReceiveFromNode[nodeId/*m_env.inter0Rank()*/] * bufSize;
       }
     }
 
@@ -1940,6 +1997,12 @@ uqMLSamplingClass<P_V,P_M>::mpiExchangePositions_inter0( // EXTRA FOR LOAD BALAN
             (exchangeStdVec[i].originalNodeOfInitialPosition == (int) r)) {
           prevChain.getPositionValues(exchangeStdVec[i].originalIndexOfInitialPosition,auxInitialPosition);
           balancedLinkControl.balLinkedChains[auxIndex].initialPosition = new P_V(auxInitialPosition);
+          getInitialLogValues(prevLogLikelihoodValues,                                              // input
+                              prevLogTargetValues,                                                  // input
+                              prevExponent,                                                         // input
+                              exchangeStdVec[i].originalIndexOfInitialPosition,                     // input
+                              balancedLinkControl.balLinkedChains[auxIndex].initialLogPrior,        // output
+                              balancedLinkControl.balLinkedChains[auxIndex].initialLogLikelihood);  // output
           balancedLinkControl.balLinkedChains[auxIndex].numberOfPositions = exchangeStdVec[i].numberOfPositions;
           auxIndex++;
 	}
@@ -1947,9 +2010,11 @@ uqMLSamplingClass<P_V,P_M>::mpiExchangePositions_inter0( // EXTRA FOR LOAD BALAN
 
       for (unsigned int i = 0; i < totalNumberOfInitialPositionsNodeRHasToReceive; ++i) {
         for (unsigned int j = 0; j < dimSize; ++j) {
-          auxInitialPosition[j] = recvbuf[i*dimSize + j];
+          auxInitialPosition[j] = recvbuf[i*bufSize + j];
         }
-        balancedLinkControl.balLinkedChains[auxIndex].initialPosition = new P_V(auxInitialPosition);
+        balancedLinkControl.balLinkedChains[auxIndex].initialPosition      = new P_V(auxInitialPosition);
+        balancedLinkControl.balLinkedChains[auxIndex].initialLogPrior      = recvbuf[i*bufSize + dimSize];
+        balancedLinkControl.balLinkedChains[auxIndex].initialLogLikelihood = recvbuf[i*bufSize + dimSize + 1];
         balancedLinkControl.balLinkedChains[auxIndex].numberOfPositions = chainLenghtsNodeRHasToInherit[i]; // aqui 3
         auxIndex++;
       }
@@ -1967,4 +2032,23 @@ uqMLSamplingClass<P_V,P_M>::mpiExchangePositions_inter0( // EXTRA FOR LOAD BALAN
 
   return;
 }
+
+template <class P_V,class P_M>
+void
+uqMLSamplingClass<P_V,P_M>::getInitialLogValues(
+  const uqScalarSequenceClass<double>& prevLogLikelihoodValues, // input
+  const uqScalarSequenceClass<double>& prevLogTargetValues,     // input
+  double                               prevExponent,            // input
+  unsigned int                         index,                   // input
+  double&                              logPrior,                // output
+  double&                              logLikelihood) const     // output
+{
+  // At level 0 the stored values are ln(likelihood) and ln(prior) + ln(likelihood).
+  // At the other levels the stored ln(likelihood) is already scaled by 'prevExponent'.
+  logPrior      = prevLogTargetValues[index] - prevLogLikelihoodValues[index];
+  logLikelihood = prevLogLikelihoodValues[index];
+  if (prevExponent != 0.) logLikelihood /= prevExponent;
+
+  return;
+}
 #endif // __UQ_MULTI_LEVEL_SAMPLING3_H__
@@ -52,6 +52,7 @@
 #define UQ_ML_SAMPLING_L_MIN_REJECTION_RATE_ODV                               0.50
 #define UQ_ML_SAMPLING_L_MAX_REJECTION_RATE_ODV                               0.75
 #define UQ_ML_SAMPLING_L_COV_REJECTION_RATE_ODV                               0.25
+#define UQ_ML_SAMPLING_L_NUM_CONCURRENT_ETAS_ODV                              1
 #define UQ_ML_SAMPLING_L_MIN_ACCEPTABLE_ETA_ODV                               0.
 #define UQ_ML_SAMPLING_L_TOTALLY_MUTE_ODV                                     1
 #define UQ_ML_SAMPLING_L_INITIAL_POSITION_DATA_INPUT_FILE_NAME_ODV            UQ_ML_SAMPLING_L_FILENAME_FOR_NO_FILE
@@ -131,6 +132,7 @@ public:
   double                             m_minRejectionRate;
   double                             m_maxRejectionRate;
   double                             m_covRejectionRate;
+  unsigned int                       m_numConcurrentEtas;
   double                             m_minAcceptableEta; // gpmsa
   bool                               m_totallyMute;
   std::string                        m_initialPositionDataInputFileName;
@@ -215,6 +217,7 @@ private:
   std::string                   m_option_minRejectionRate;
   std::string                   m_option_maxRejectionRate;
   std::string                   m_option_covRejectionRate;
+  std::string                   m_option_numConcurrentEtas;
   std::string                   m_option_minAcceptableEta; // gpmsa
   std::string                   m_option_totallyMute;
   std::string                   m_option_initialPosition_dataInputFileName;
@@ -74,6 +74,10 @@ public:
   
   //! Calculates the covariance matrix. See template specialization.
   virtual void                     covMatrix     (const P_V& domainVector1, const P_V& domainVector2, Q_M& imageMatrix) const = 0;
+
+  //! Whether the covariance matrix only depends on the difference between its two arguments.
+  /*! See uqBaseScalarCovarianceFunctionClass::isStationary(). The default is \c false. */
+  virtual bool                     isStationary  ()                                                                       const;
   //@}
   
 protected:
@@ -129,6 +133,13 @@ uqBaseMatrixCovarianceFunctionClass<P_V,P_M,Q_V,Q_M>::basicDomainSet() const
 {
   return m_basicDomainSet;
 }
+// --------------------------------------------------
+template<class P_V, class P_M, class Q_V, class Q_M>
+bool
+uqBaseMatrixCovarianceFunctionClass<P_V,P_M,Q_V,Q_M>::isStationary() const
+{
+  return false;
+}
 
 //*****************************************************
 // Exponential class
@@ -162,6 +173,9 @@ public:
   //@{
   //! Calculates the covariance matrix, given two parameter domains.
   void covMatrix(const P_V& domainVector1, const P_V& domainVector2, Q_M& imageMatrix) const;
+
+  //! The exponential covariance matrix only depends on the distance between its arguments.
+  bool isStationary() const;
   //@}
   
 protected:
@@ -280,6 +294,13 @@ uqExponentialMatrixCovarianceFunctionClass<P_V,P_M,Q_V,Q_M>::covMatrix(const P_V
 
   return;
 }
+// --------------------------------------------------
+template<class P_V, class P_M, class Q_V, class Q_M>
+bool
+uqExponentialMatrixCovarianceFunctionClass<P_V,P_M,Q_V,Q_M>::isStationary() const
+{
+  return true;
+}
 
 //*****************************************************
 // Generic class
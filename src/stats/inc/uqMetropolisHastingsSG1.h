@@ -37,8 +37,10 @@
 #include <uqScalarFunctionSynchronizer.h>
 #include <uqSequenceOfVectors.h>
 #include <uqArrayOfSequences.h>
+#include <uqQuantileSketch.h>
 #include <sys/time.h>
 #include <fstream>
+#include <cstdio>
 #include <boost/math/special_functions.hpp> // for Boost isnan. Note parentheses are important in function call.
 
 //--------------------------------------------------
@@ -102,6 +104,7 @@ struct uqMHRawChainInfoStruct
   unsigned int numOutOfTargetSupport;
   unsigned int numOutOfTargetSupportInDR;
   unsigned int numRejections;
+  unsigned int numScreenedOut;
 
 };
 
@@ -178,6 +181,28 @@ public:
   //! Gets information from the raw chain.
   void         getRawChainInfo    (uqMHRawChainInfoStruct& info) const;
 
+  //! Streaming quantile sketches of the raw chain components, one per component.
+  /*! The sketches are fed while the raw chain is generated, when option 'rawChain_sketchK' is
+   * positive; otherwise the vector is empty. They summarize the chain of this sub-environment only.
+   * uqStatisticalInverseProblemClass samples the sub and unified posterior cdfs from them.*/
+  const std::vector<uqQuantileSketchClass*>& rawChainSketches() const;
+
+  //! Sets a cheap approximation of the target pdf, used for delayed acceptance.
+  /*! Each candidate is first accepted or rejected with the surrogate in place of the target pdf, and
+   * only the candidates that pass this screening have the target pdf evaluated. A second acceptance
+   * test (A. Christen and C. Fox, "Markov chain Monte Carlo using an approximation", Journal of
+   * Computational and Graphical Statistics (2005), 14:795-810) corrects for the surrogate, so the chain
+   * still samples the target pdf exactly. Delayed rejection is skipped while the surrogate is in use.
+   * The surrogate must follow the convention of the target pdf regarding 'lnValue()', and must outlive
+   * the calls to generateSequence(). Takes precedence over option 'da_useGaussianSurrogate'.*/
+  void         setSurrogateTargetPdf(const uqBaseJointPdfClass<P_V,P_M>& surrogatePdf);
+
+  //! Sets the already known ln(likelihood) and ln(target) values at the initial position.
+  /*! The target pdf is then not evaluated at the initial position when the chain is generated. The
+   * values must follow the convention of the target pdf regarding 'lnValue()', and must be the same at
+   * all processors of the sub environment.*/
+  void         setInitialLogValues  (double logLikelihood, double logTarget);
+
    //@}
   
   //! @name I/O methods
@@ -207,6 +232,39 @@ private:
                                    uqScalarSequenceClass<double>*      workingLogLikelihoodValues,
                                    uqScalarSequenceClass<double>*      workingLogTargetValues);
   
+  //! Saves the state of the raw chain generation after its first 'numPositions' positions.
+  /*! The positions (with their log values) and the ids of unique positions go to
+   * '<restartOutput_baseNameForFiles>_sub<subId>_positions.txt': the first checkpoint of a run writes all
+   * of them, and each later one only appends the positions generated since the previous checkpoint, so
+   * the I/O per checkpoint is proportional to the checkpoint period rather than to the chain length.
+   * The file '<restartOutput_baseNameForFiles>_sub<subId>.txt' receives the number of valid positions,
+   * the current position, the adaptive Metropolis state, the current proposal covariance matrix and the
+   * state of the random number generator. It is first written under a temporary name and then renamed,
+   * so a crash during the write leaves the previous checkpoint intact; positions appended after the
+   * last complete checkpoint are ignored on restart.*/
+  void   writeCheckpoint          (unsigned int                               numPositions,
+                                   unsigned int                               uniquePos,
+                                   const uqBaseVectorSequenceClass<P_V,P_M>&  workingChain,
+                                   const uqScalarSequenceClass<double>*       workingLogLikelihoodValues,
+                                   const uqScalarSequenceClass<double>*       workingLogTargetValues,
+                                   const uqMarkovChainPositionDataClass<P_V>& currentPositionData);
+
+  //! Restores the state saved by writeCheckpoint() and returns the number of positions already generated.
+  /*! 'chainSize' may be reduced, if the saved chain had already been stopped by the ESS criterion. The
+   * generation then resumes exactly where the checkpointed run was.*/
+  unsigned int readCheckpoint     (unsigned int&                              chainSize,
+                                   unsigned int&                              uniquePos,
+                                   uqBaseVectorSequenceClass<P_V,P_M>&        workingChain,
+                                   uqScalarSequenceClass<double>*             workingLogLikelihoodValues,
+                                   uqScalarSequenceClass<double>*             workingLogTargetValues,
+                                   uqMarkovChainPositionDataClass<P_V>&       currentPositionData);
+
+  //! Returns the logarithm of the surrogate of the target pdf at 'vecValues', up to a constant.
+  /*! The surrogate is either the one set by setSurrogateTargetPdf() or, if option 'da_useGaussianSurrogate'
+   * is set, the Gaussian approximation of the target pdf given by the adaptive Metropolis mean and
+   * covariance matrix.*/
+  double surrogateLogTarget       (const P_V&                          vecValues) const;
+
   //! This method reads the chain contents.
   void   readFullChain            (const std::string&                  inputFileName,
                                    const std::string&                  inputFileType,
@@ -253,6 +311,10 @@ private:
         P_M                                         m_initialProposalCovMatrix;
         bool                                        m_nullInputProposalCovMatrix;
   const uqScalarFunctionSynchronizerClass<P_V,P_M>* m_targetPdfSynchronizer;
+  const uqBaseJointPdfClass<P_V,P_M>*               m_surrogatePdf;
+        bool                                        m_initialLogValuesAreKnown;
+        double                                      m_initialLogLikelihood;
+        double                                      m_initialLogTarget;
 
         uqBaseTKGroupClass<P_V,P_M>*                m_tk;
         unsigned int                                m_positionIdForDebugging;
@@ -264,8 +326,11 @@ private:
         P_V*                                        m_lastMean;
         P_M*                                        m_lastAdaptedCovMatrix;
         unsigned int                                m_numPositionsNotSubWritten;
+        unsigned int                                m_numCheckpointedPositions;
+        unsigned int                                m_numCheckpointedUniquePositions;
 
         uqMHRawChainInfoStruct                      m_rawChainInfo;
+        std::vector<uqQuantileSketchClass*>         m_rawChainSketches;
 
         uqMhOptionsValuesClass                      m_alternativeOptionsValues;
         uqMetropolisHastingsSGOptionsClass*         m_optionsObj;
@@ -274,6 +339,18 @@ private:
 template<class P_V,class P_M>
 std::ostream& operator<<(std::ostream& os, const uqMetropolisHastingsSGClass<P_V,P_M>& obj);
 
+//! Recursively updates the running mean and covariance matrix of a chain with the positions of 'partialChain'.
+/*! On the first call ('lastChainSize' == 0) the mean and covariance are computed from scratch; on later
+ * calls they are updated one position at a time, 'idOfFirstPositionInSubChain' being the global index of
+ * the first position of 'partialChain'. Shared by adaptive Metropolis and by the mass matrix adaptation
+ * of uqHamiltonianMCSGClass. */
+template<class P_V,class P_M>
+void uqUpdateAdaptedCovMatrix(const uqBaseVectorSequenceClass<P_V,P_M>& partialChain,
+                              unsigned int                              idOfFirstPositionInSubChain,
+                              double&                                   lastChainSize,
+                              P_V&                                      lastMean,
+                              P_M&                                      lastAdaptedCovMatrix);
+
 #include <uqMetropolisHastingsSG2.h>
 
 // Default constructor -----------------------------
@@ -292,6 +369,10 @@ uqMetropolisHastingsSGClass<P_V,P_M>::uqMetropolisHastingsSGClass(
   m_initialProposalCovMatrix  (m_vectorSpace.zeroVector()),
   m_nullInputProposalCovMatrix(inputProposalCovMatrix == NULL),
   m_targetPdfSynchronizer     (new uqScalarFunctionSynchronizerClass<P_V,P_M>(m_targetPdf,m_initialPosition)),
+  m_surrogatePdf              (NULL),
+  m_initialLogValuesAreKnown  (false),
+  m_initialLogLikelihood      (0.),
+  m_initialLogTarget          (0.),
   m_tk                        (NULL),
   m_positionIdForDebugging    (0),
   m_stageIdForDebugging       (0),
@@ -302,6 +383,9 @@ uqMetropolisHastingsSGClass<P_V,P_M>::uqMetropolisHastingsSGClass(
   m_lastMean                  (NULL),
   m_lastAdaptedCovMatrix      (NULL),
   m_numPositionsNotSubWritten (0),
+  m_numCheckpointedPositions  (0),
+  m_numCheckpointedUniquePositions(0),
+  m_rawChainSketches          (0),
 #ifdef QUESO_USES_SEQUENCE_STATISTICAL_OPTIONS
   m_alternativeOptionsValues  (NULL,NULL),
 #else
@@ -370,6 +454,10 @@ uqMetropolisHastingsSGClass<P_V,P_M>::uqMetropolisHastingsSGClass(
   m_initialProposalCovMatrix  (m_vectorSpace.zeroVector()),
   m_nullInputProposalCovMatrix(inputProposalCovMatrix == NULL),
   m_targetPdfSynchronizer     (new uqScalarFunctionSynchronizerClass<P_V,P_M>(m_targetPdf,m_initialPosition)),
+  m_surrogatePdf              (NULL),
+  m_initialLogValuesAreKnown  (false),
+  m_initialLogLikelihood      (0.),
+  m_initialLogTarget          (0.),
   m_tk                        (NULL),
   m_positionIdForDebugging    (0),
   m_stageIdForDebugging       (0),
@@ -379,6 +467,10 @@ uqMetropolisHastingsSGClass<P_V,P_M>::uqMetropolisHastingsSGClass(
   m_lastChainSize             (0),
   m_lastMean                  (NULL),
   m_lastAdaptedCovMatrix      (NULL),
+  m_numPositionsNotSubWritten (0),
+  m_numCheckpointedPositions  (0),
+  m_numCheckpointedUniquePositions(0),
+  m_rawChainSketches          (0),
 #ifdef QUESO_USES_SEQUENCE_STATISTICAL_OPTIONS
   m_alternativeOptionsValues  (NULL,NULL),
 #else
@@ -427,6 +519,10 @@ uqMetropolisHastingsSGClass<P_V,P_M>::~uqMetropolisHastingsSGClass()
   m_positionIdForDebugging = 0;
   m_stageIdForDebugging    = 0;
   m_idsOfUniquePositions.clear();
+  for (unsigned int i = 0; i < m_rawChainSketches.size(); ++i) {
+    delete m_rawChainSketches[i];
+  }
+  m_rawChainSketches.clear();
 
   if (m_tk                   ) delete m_tk;
   if (m_targetPdfSynchronizer) delete m_targetPdfSynchronizer;
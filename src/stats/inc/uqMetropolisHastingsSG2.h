@@ -139,7 +139,7 @@ uqMetropolisHastingsSGClass<P_V,P_M>::generateSequence(
 
     if ((m_numPositionsNotSubWritten                     >  0  ) &&
         (m_optionsObj->m_ov.m_rawChainDataOutputFileName != ".")) {
-      workingChain.subWriteContents(m_optionsObj->m_ov.m_rawChainSize - m_numPositionsNotSubWritten,
+      workingChain.subWriteContents(workingChain.subSequenceSize() - m_numPositionsNotSubWritten,
                                     m_numPositionsNotSubWritten,
                                     m_optionsObj->m_ov.m_rawChainDataOutputFileName,
                                     m_optionsObj->m_ov.m_rawChainDataOutputFileType,
@@ -148,12 +148,12 @@ uqMetropolisHastingsSGClass<P_V,P_M>::generateSequence(
           (m_optionsObj->m_ov.m_totallyMute == false)) {
         *m_env.subDisplayFile() << "In uqMetropolisHastingsSGClass<P_V,P_M>::generateSequence()"
                                 << ": just wrote (per period request) remaining " << m_numPositionsNotSubWritten << " chain positions "
-                                << ", " << m_optionsObj->m_ov.m_rawChainSize - m_numPositionsNotSubWritten << " <= pos <= " << m_optionsObj->m_ov.m_rawChainSize - 1
+                                << ", " << workingChain.subSequenceSize() - m_numPositionsNotSubWritten << " <= pos <= " << workingChain.subSequenceSize() - 1
                                 << std::endl;
       }
 
       if (workingLogLikelihoodValues) {
-        workingLogLikelihoodValues->subWriteContents(m_optionsObj->m_ov.m_rawChainSize - m_numPositionsNotSubWritten,
+        workingLogLikelihoodValues->subWriteContents(workingChain.subSequenceSize() - m_numPositionsNotSubWritten,
                                                      m_numPositionsNotSubWritten,
                                                      m_optionsObj->m_ov.m_rawChainDataOutputFileName + "_likelihood",
                                                      m_optionsObj->m_ov.m_rawChainDataOutputFileType,
@@ -161,7 +161,7 @@ uqMetropolisHastingsSGClass<P_V,P_M>::generateSequence(
       }
 
       if (workingLogTargetValues) {
-        workingLogTargetValues->subWriteContents(m_optionsObj->m_ov.m_rawChainSize - m_numPositionsNotSubWritten,
+        workingLogTargetValues->subWriteContents(workingChain.subSequenceSize() - m_numPositionsNotSubWritten,
                                                  m_numPositionsNotSubWritten,
                                                  m_optionsObj->m_ov.m_rawChainDataOutputFileName + "_target",
                                                  m_optionsObj->m_ov.m_rawChainDataOutputFileType,
@@ -484,6 +484,31 @@ uqMetropolisHastingsSGClass<P_V,P_M>::getRawChainInfo(uqMHRawChainInfoStruct& in
 }
 //--------------------------------------------------
 template <class P_V,class P_M>
+const std::vector<uqQuantileSketchClass*>&
+uqMetropolisHastingsSGClass<P_V,P_M>::rawChainSketches() const
+{
+  return m_rawChainSketches;
+}
+//--------------------------------------------------
+template <class P_V,class P_M>
+void
+uqMetropolisHastingsSGClass<P_V,P_M>::setSurrogateTargetPdf(const uqBaseJointPdfClass<P_V,P_M>& surrogatePdf)
+{
+  m_surrogatePdf = &surrogatePdf;
+  return;
+}
+//--------------------------------------------------
+template <class P_V,class P_M>
+void
+uqMetropolisHastingsSGClass<P_V,P_M>::setInitialLogValues(double logLikelihood, double logTarget)
+{
+  m_initialLogValuesAreKnown = true;
+  m_initialLogLikelihood     = logLikelihood;
+  m_initialLogTarget         = logTarget;
+  return;
+}
+//--------------------------------------------------
+template <class P_V,class P_M>
 void
 uqMetropolisHastingsSGClass<P_V,P_M>::readFullChain(
   const std::string&                  inputFileName,
@@ -522,13 +547,27 @@ uqMetropolisHastingsSGClass<P_V,P_M>::generateFullChain(
   struct timeval timevalDrAlpha;
   struct timeval timevalDR;
   struct timeval timevalAM;
-
-  m_positionIdForDebugging = 0;
-  m_stageIdForDebugging    = 0;
+  struct timeval timevalCheckpoint;
+
+  uqTracerClass&     tracer         = m_env.tracer();
+  unsigned long long traceChain     = 0;
+  unsigned long long traceCandidate = 0;
+  unsigned long long traceTarget    = 0;
+  unsigned long long traceMhAlpha   = 0;
+  unsigned long long traceDrAlpha   = 0;
+  unsigned long long traceDR        = 0;
+  unsigned long long traceAM        = 0;
+
+  m_positionIdForDebugging         = 0;
+  m_stageIdForDebugging            = 0;
+  m_numCheckpointedPositions       = 0;
+  m_numCheckpointedUniquePositions = 0;
 
   m_rawChainInfo.reset();
 
+  traceChain = tracer.start();
   iRC = gettimeofday(&timevalChain, NULL);
+  iRC = gettimeofday(&timevalCheckpoint, NULL);
 
   if ((m_env.subDisplayFile()                   ) &&
       (m_optionsObj->m_ov.m_totallyMute == false)) {
@@ -556,26 +595,31 @@ uqMetropolisHastingsSGClass<P_V,P_M>::generateFullChain(
                       m_env.worldRank(),
                       "uqMetropolisHastingsSGClass<P_V,P_M>::generateFullChain()",
                       "initial position should not be out of target pdf support");
-  if (m_optionsObj->m_ov.m_rawChainMeasureRunTimes) iRC = gettimeofday(&timevalTarget, NULL);
   double logPrior      = 0.;
-  double logLikelihood = 0.;
+  double logLikelihood = m_initialLogLikelihood;
+  double logTarget     = m_initialLogTarget;
+  if (m_initialLogValuesAreKnown == false) {
+    traceTarget = tracer.start();
+    if (m_optionsObj->m_ov.m_rawChainMeasureRunTimes) iRC = gettimeofday(&timevalTarget, NULL);
 #ifdef QUESO_EXPECTS_LN_LIKELIHOOD_INSTEAD_OF_MINUS_2_LN
-  double logTarget =        m_targetPdfSynchronizer->callFunction(&valuesOf1stPosition,NULL,NULL,NULL,NULL,&logPrior,&logLikelihood); // Might demand parallel environment // KEY
+    logTarget =        m_targetPdfSynchronizer->callFunction(&valuesOf1stPosition,NULL,NULL,NULL,NULL,&logPrior,&logLikelihood); // Might demand parallel environment // KEY
 #else
-  double logTarget = -0.5 * m_targetPdfSynchronizer->callFunction(&valuesOf1stPosition,NULL,NULL,NULL,NULL,&logPrior,&logLikelihood); // Might demand parallel environment
+    logTarget = -0.5 * m_targetPdfSynchronizer->callFunction(&valuesOf1stPosition,NULL,NULL,NULL,NULL,&logPrior,&logLikelihood); // Might demand parallel environment
 #endif
-  if (m_optionsObj->m_ov.m_rawChainMeasureRunTimes) m_rawChainInfo.targetRunTime += uqMiscGetEllapsedSeconds(&timevalTarget);
-  m_rawChainInfo.numTargetCalls++;
-  if ((m_env.subDisplayFile()                   ) &&
-      (m_env.displayVerbosity() >= 3            ) &&
-      (m_optionsObj->m_ov.m_totallyMute == false)) {
-    *m_env.subDisplayFile() << "In uqMetropolisHastingsSGClass<P_V,P_M>::generateFullChain()"
-                            << ": just returned from likelihood() for initial chain position"
-                            << ", m_rawChainInfo.numTargetCalls = " << m_rawChainInfo.numTargetCalls
-                            << ", logPrior = "      << logPrior
-                            << ", logLikelihood = " << logLikelihood
-                            << ", logTarget = "     << logTarget
-                            << std::endl;
+    if (m_optionsObj->m_ov.m_rawChainMeasureRunTimes) m_rawChainInfo.targetRunTime += uqMiscGetEllapsedSeconds(&timevalTarget);
+    tracer.stop(UQ_TRACE_MH_TARGET_ID,traceTarget);
+    m_rawChainInfo.numTargetCalls++;
+    if ((m_env.subDisplayFile()                   ) &&
+        (m_env.displayVerbosity() >= 3            ) &&
+        (m_optionsObj->m_ov.m_totallyMute == false)) {
+      *m_env.subDisplayFile() << "In uqMetropolisHastingsSGClass<P_V,P_M>::generateFullChain()"
+                              << ": just returned from likelihood() for initial chain position"
+                              << ", m_rawChainInfo.numTargetCalls = " << m_rawChainInfo.numTargetCalls
+                              << ", logPrior = "      << logPrior
+                              << ", logLikelihood = " << logLikelihood
+                              << ", logTarget = "     << logTarget
+                              << std::endl;
+    }
   }
 
   //*m_env.subDisplayFile() << "AQUI 001" << std::endl;
@@ -602,8 +646,22 @@ uqMetropolisHastingsSGClass<P_V,P_M>::generateFullChain(
     m_alphaQuotients.resize(chainSize,0.);
   }
 
+  for (unsigned int i = 0; i < m_rawChainSketches.size(); ++i) {
+    delete m_rawChainSketches[i];
+  }
+  m_rawChainSketches.clear();
+  if (m_optionsObj->m_ov.m_rawChainSketchK > 0) {
+    m_rawChainSketches.resize(m_vectorSpace.dimLocal(),NULL);
+    for (unsigned int i = 0; i < m_rawChainSketches.size(); ++i) {
+      m_rawChainSketches[i] = new uqQuantileSketchClass(m_optionsObj->m_ov.m_rawChainSketchK);
+    }
+  }
+
   unsigned int uniquePos = 0;
   workingChain.setPositionValues(0,currentPositionData.vecValues());
+  for (unsigned int i = 0; i < m_rawChainSketches.size(); ++i) {
+    m_rawChainSketches[i]->insert(currentPositionData.vecValues()[i]);
+  }
   m_numPositionsNotSubWritten++;
   if ((m_optionsObj->m_ov.m_rawChainDataOutputPeriod           >  0  ) && 
       (((0+1) % m_optionsObj->m_ov.m_rawChainDataOutputPeriod) == 0  ) &&
@@ -649,6 +707,33 @@ uqMetropolisHastingsSGClass<P_V,P_M>::generateFullChain(
   }
   //*m_env.subDisplayFile() << "AQUI 002" << std::endl;
 
+  //****************************************************
+  // Resume from a checkpoint, if requested
+  //****************************************************
+  UQ_FATAL_TEST_MACRO(((m_optionsObj->m_ov.m_restartOutputBaseNameForFiles != ".") ||
+                       (m_optionsObj->m_ov.m_restartInputBaseNameForFiles  != ".")) &&
+                      (m_initialPosition.numOfProcsForStorage() > 1),
+                      m_env.worldRank(),
+                      "uqMetropolisHastingsSGClass<P_V,P_M>::generateFullChain()",
+                      "checkpoint/restart requires chain positions to be stored on one processor");
+  unsigned int firstPositionId = 1;
+  if ((m_optionsObj->m_ov.m_restartInputBaseNameForFiles != ".") &&
+      (m_env.subRank()                                   == 0  )) {
+    firstPositionId = readCheckpoint(chainSize,
+                                     uniquePos,
+                                     workingChain,
+                                     workingLogLikelihoodValues,
+                                     workingLogTargetValues,
+                                     currentPositionData);
+    if ((m_optionsObj->m_ov.m_rawChainDataOutputPeriod   >  0  ) &&
+        (m_optionsObj->m_ov.m_rawChainDataOutputFileName != ".")) {
+      m_numPositionsNotSubWritten = firstPositionId % m_optionsObj->m_ov.m_rawChainDataOutputPeriod;
+    }
+    else {
+      m_numPositionsNotSubWritten = firstPositionId;
+    }
+  }
+
   if ((m_env.subDisplayFile()                   ) &&
       (m_env.displayVerbosity() >= 10           ) &&
       (m_optionsObj->m_ov.m_totallyMute == false)) {
@@ -660,6 +745,8 @@ uqMetropolisHastingsSGClass<P_V,P_M>::generateFullChain(
 
   //m_env.syncPrintDebugMsg("In uqMetropolisHastingsSGClass<P_V,P_M>::generateFullChain(), right before main loop",3,3000000,m_env.fullComm()); // Dangerous to barrier on fullComm ... // KAUST
 
+  unsigned int nextEssCheckSize = m_optionsObj->m_ov.m_rawChainEssCheckPeriod;
+
   //****************************************************
   // Begin chain loop from positionId = 1
   //****************************************************
@@ -683,7 +770,7 @@ uqMetropolisHastingsSGClass<P_V,P_M>::generateFullChain(
       m_rawChainInfo.numRejections++;
     }
   }
-  else for (unsigned int positionId = 1; positionId < workingChain.subSequenceSize(); ++positionId) {
+  else for (unsigned int positionId = firstPositionId; positionId < workingChain.subSequenceSize(); ++positionId) {
     //****************************************************
     // Point 1/6 of logic for new position
     // Loop: initialize variables and print some information
@@ -732,9 +819,11 @@ uqMetropolisHastingsSGClass<P_V,P_M>::generateFullChain(
     // sep2011
     bool keepGeneratingCandidates = true;
     while (keepGeneratingCandidates) {
+      traceCandidate = tracer.start();
       if (m_optionsObj->m_ov.m_rawChainMeasureRunTimes) iRC = gettimeofday(&timevalCandidate, NULL);
       m_tk->rv(0).realizer().realization(tmpVecValues);
       if (m_optionsObj->m_ov.m_rawChainMeasureRunTimes) m_rawChainInfo.candidateRunTime += uqMiscGetEllapsedSeconds(&timevalCandidate);
+      tracer.stop(UQ_TRACE_MH_CANDIDATE_ID,traceCandidate);
 
       outOfTargetSupport = !m_targetPdf.domainSet().contains(tmpVecValues);
 
@@ -772,13 +861,38 @@ uqMetropolisHastingsSGClass<P_V,P_M>::generateFullChain(
                               << std::endl;
     }
 
+    // Delayed acceptance: screen the candidate with the surrogate before paying for the target pdf
+    bool   useSurrogate       = (m_surrogatePdf != NULL) ||
+                                ((m_optionsObj->m_ov.m_daUseGaussianSurrogate                         ) &&
+                                 (m_lastMean                                                   != NULL) &&
+                                 (dynamic_cast<uqScaledCovMatrixTKGroupClass<P_V,P_M>* >(m_tk) != NULL));
+    bool   screenedOut        = false;
+    double currentSurrogate   = 0.;
+    double candidateSurrogate = 0.;
+    if ((useSurrogate       == true ) &&
+        (outOfTargetSupport == false)) {
+      currentSurrogate   = surrogateLogTarget(currentPositionData.vecValues());
+      candidateSurrogate = surrogateLogTarget(tmpVecValues);
+      uqMarkovChainPositionDataClass<P_V> currentSurrogateData  (m_env,currentPositionData.vecValues(),false,0.,currentSurrogate  );
+      uqMarkovChainPositionDataClass<P_V> candidateSurrogateData(m_env,tmpVecValues,                   false,0.,candidateSurrogate);
+      screenedOut = !acceptAlpha(this->alpha(currentSurrogateData,candidateSurrogateData,0,1,NULL));
+    }
+
     if (outOfTargetSupport) {
       m_rawChainInfo.numOutOfTargetSupport++;
+      tracer.count(UQ_TRACE_MH_OUT_OF_SUPPORT_ID,1.);
+      logPrior      = -INFINITY;
+      logLikelihood = -INFINITY;
+      logTarget     = -INFINITY;
+    }
+    else if (screenedOut) {
+      m_rawChainInfo.numScreenedOut++;
       logPrior      = -INFINITY;
       logLikelihood = -INFINITY;
       logTarget     = -INFINITY;
     }
     else {
+      traceTarget = tracer.start();
       if (m_optionsObj->m_ov.m_rawChainMeasureRunTimes) iRC = gettimeofday(&timevalTarget, NULL);
 #ifdef QUESO_EXPECTS_LN_LIKELIHOOD_INSTEAD_OF_MINUS_2_LN
       logTarget =        m_targetPdfSynchronizer->callFunction(&tmpVecValues,NULL,NULL,NULL,NULL,&logPrior,&logLikelihood); // Might demand parallel environment
@@ -786,6 +900,7 @@ uqMetropolisHastingsSGClass<P_V,P_M>::generateFullChain(
       logTarget = -0.5 * m_targetPdfSynchronizer->callFunction(&tmpVecValues,NULL,NULL,NULL,NULL,&logPrior,&logLikelihood); // Might demand parallel environment
 #endif
       if (m_optionsObj->m_ov.m_rawChainMeasureRunTimes) m_rawChainInfo.targetRunTime += uqMiscGetEllapsedSeconds(&timevalTarget);
+      tracer.stop(UQ_TRACE_MH_TARGET_ID,traceTarget);
       m_rawChainInfo.numTargetCalls++;
       if ((m_env.subDisplayFile()                   ) &&
           (m_env.displayVerbosity() >= 3            ) &&
@@ -814,12 +929,31 @@ uqMetropolisHastingsSGClass<P_V,P_M>::generateFullChain(
     }
     bool accept = false;
     double alphaFirstCandidate = 0.;
-    if (outOfTargetSupport) {
+    if (outOfTargetSupport || screenedOut) {
       if (m_optionsObj->m_ov.m_rawChainGenerateExtra) {
         m_alphaQuotients[positionId] = 0.;
       }
     }
+    else if (useSurrogate) {
+      // Second stage of delayed acceptance: correct for the surrogate, keeping the target pdf exact
+      traceMhAlpha = tracer.start();
+      if (m_optionsObj->m_ov.m_rawChainMeasureRunTimes) iRC = gettimeofday(&timevalMhAlpha, NULL);
+      double alphaQuotient = 0.;
+      if ((currentCandidateData.logTarget()                     != -INFINITY) &&
+          ((boost::math::isnan)(currentCandidateData.logTarget()) == false    )) {
+        alphaQuotient = std::exp((currentCandidateData.logTarget() - currentPositionData.logTarget()) -
+                                 (candidateSurrogate               - currentSurrogate               ));
+      }
+      if (m_optionsObj->m_ov.m_rawChainGenerateExtra) {
+        m_alphaQuotients[positionId] = alphaQuotient;
+      }
+      alphaFirstCandidate = std::min(1.,alphaQuotient);
+      if (m_optionsObj->m_ov.m_rawChainMeasureRunTimes) m_rawChainInfo.mhAlphaRunTime += uqMiscGetEllapsedSeconds(&timevalMhAlpha);
+      tracer.stop(UQ_TRACE_MH_ALPHA_ID,traceMhAlpha);
+      accept = acceptAlpha(alphaFirstCandidate);
+    }
     else {
+      traceMhAlpha = tracer.start();
       if (m_optionsObj->m_ov.m_rawChainMeasureRunTimes) iRC = gettimeofday(&timevalMhAlpha, NULL);
       if (m_optionsObj->m_ov.m_rawChainGenerateExtra) {
         alphaFirstCandidate = this->alpha(currentPositionData,currentCandidateData,0,1,&m_alphaQuotients[positionId]);
@@ -828,6 +962,7 @@ uqMetropolisHastingsSGClass<P_V,P_M>::generateFullChain(
         alphaFirstCandidate = this->alpha(currentPositionData,currentCandidateData,0,1,NULL);
       }
       if (m_optionsObj->m_ov.m_rawChainMeasureRunTimes) m_rawChainInfo.mhAlphaRunTime += uqMiscGetEllapsedSeconds(&timevalMhAlpha);
+      tracer.stop(UQ_TRACE_MH_ALPHA_ID,traceMhAlpha);
       if ((m_env.subDisplayFile()                   ) &&
           (m_env.displayVerbosity() >= 10           ) &&
           (m_optionsObj->m_ov.m_totallyMute == false)) {
@@ -874,6 +1009,7 @@ uqMetropolisHastingsSGClass<P_V,P_M>::generateFullChain(
     std::vector<unsigned int> tkStageIds (stageId+2,0);
     if ((accept                                   == false) &&
         (outOfTargetSupport                       == false) && // IMPORTANT
+        (useSurrogate                             == false) && // DR formulas assume a plain first stage
         (m_optionsObj->m_ov.m_drMaxNumExtraStages >  0    )) {
       if ((m_optionsObj->m_ov.m_drDuringAmNonAdaptiveInt  == false     ) &&
           (m_optionsObj->m_ov.m_tkUseLocalHessian         == false     ) &&
@@ -883,6 +1019,7 @@ uqMetropolisHastingsSGClass<P_V,P_M>::generateFullChain(
         // Avoid DR now
       }
       else {
+        traceDR = tracer.start();
         if (m_optionsObj->m_ov.m_rawChainMeasureRunTimes) iRC = gettimeofday(&timevalDR, NULL);
 
         drPositionsData[0] = new uqMarkovChainPositionDataClass<P_V>(currentPositionData );
@@ -916,9 +1053,11 @@ uqMetropolisHastingsSGClass<P_V,P_M>::generateFullChain(
 
           keepGeneratingCandidates = true;
           while (keepGeneratingCandidates) {
+            traceCandidate = tracer.start();
             if (m_optionsObj->m_ov.m_rawChainMeasureRunTimes) iRC = gettimeofday(&timevalCandidate, NULL);
             m_tk->rv(tkStageIds).realizer().realization(tmpVecValues);
             if (m_optionsObj->m_ov.m_rawChainMeasureRunTimes) m_rawChainInfo.candidateRunTime += uqMiscGetEllapsedSeconds(&timevalCandidate);
+            tracer.stop(UQ_TRACE_MH_CANDIDATE_ID,traceCandidate);
 
             outOfTargetSupport = !m_targetPdf.domainSet().contains(tmpVecValues);
 
@@ -947,11 +1086,13 @@ uqMetropolisHastingsSGClass<P_V,P_M>::generateFullChain(
 
           if (outOfTargetSupport) {
             m_rawChainInfo.numOutOfTargetSupportInDR++; // new 2010/May/12
+            tracer.count(UQ_TRACE_MH_OUT_OF_SUPPORT_ID,1.);
             logPrior      = -INFINITY;
             logLikelihood = -INFINITY;
             logTarget     = -INFINITY;
           }
           else {
+            traceTarget = tracer.start();
             if (m_optionsObj->m_ov.m_rawChainMeasureRunTimes) iRC = gettimeofday(&timevalTarget, NULL);
 #ifdef QUESO_EXPECTS_LN_LIKELIHOOD_INSTEAD_OF_MINUS_2_LN
             logTarget =        m_targetPdfSynchronizer->callFunction(&tmpVecValues,NULL,NULL,NULL,NULL,&logPrior,&logLikelihood); // Might demand parallel environment
@@ -959,6 +1100,7 @@ uqMetropolisHastingsSGClass<P_V,P_M>::generateFullChain(
             logTarget = -0.5 * m_targetPdfSynchronizer->callFunction(&tmpVecValues,NULL,NULL,NULL,NULL,&logPrior,&logLikelihood); // Might demand parallel environment
 #endif
             if (m_optionsObj->m_ov.m_rawChainMeasureRunTimes) m_rawChainInfo.targetRunTime += uqMiscGetEllapsedSeconds(&timevalTarget);
+            tracer.stop(UQ_TRACE_MH_TARGET_ID,traceTarget);
             m_rawChainInfo.numTargetCalls++;
             if ((m_env.subDisplayFile()                   ) &&
                 (m_env.displayVerbosity() >= 3            ) &&
@@ -983,9 +1125,11 @@ uqMetropolisHastingsSGClass<P_V,P_M>::generateFullChain(
 
           double alphaDR = 0.;
           if (outOfTargetSupport == false) {
+            traceDrAlpha = tracer.start();
             if (m_optionsObj->m_ov.m_rawChainMeasureRunTimes) iRC = gettimeofday(&timevalDrAlpha, NULL);
             alphaDR = this->alpha(drPositionsData,tkStageIds);
             if (m_optionsObj->m_ov.m_rawChainMeasureRunTimes) m_rawChainInfo.drAlphaRunTime += uqMiscGetEllapsedSeconds(&timevalDrAlpha);
+            tracer.stop(UQ_TRACE_MH_DR_ALPHA_ID,traceDrAlpha);
             accept = acceptAlpha(alphaDR);
           }
 
@@ -1006,6 +1150,7 @@ uqMetropolisHastingsSGClass<P_V,P_M>::generateFullChain(
         } // while
 
         if (m_optionsObj->m_ov.m_rawChainMeasureRunTimes) m_rawChainInfo.drRunTime += uqMiscGetEllapsedSeconds(&timevalDR);
+        tracer.stop(UQ_TRACE_MH_DR_ID,traceDR);
       } // if-else "Avoid DR now"
     } // end of 'delayed rejection' logic
 
@@ -1026,6 +1171,9 @@ uqMetropolisHastingsSGClass<P_V,P_M>::generateFullChain(
       workingChain.setPositionValues(positionId,currentPositionData.vecValues());
       m_rawChainInfo.numRejections++;
     }
+    for (unsigned int i = 0; i < m_rawChainSketches.size(); ++i) {
+      m_rawChainSketches[i]->insert(currentPositionData.vecValues()[i]);
+    }
     m_numPositionsNotSubWritten++;
     if ((m_optionsObj->m_ov.m_rawChainDataOutputPeriod                    >  0  ) && 
         (((positionId+1) % m_optionsObj->m_ov.m_rawChainDataOutputPeriod) == 0  ) &&
@@ -1103,6 +1251,7 @@ uqMetropolisHastingsSGClass<P_V,P_M>::generateFullChain(
     if ((m_optionsObj->m_ov.m_tkUseLocalHessian ==    false) && // IMPORTANT
         (m_optionsObj->m_ov.m_amInitialNonAdaptInterval > 0) &&
         (m_optionsObj->m_ov.m_amAdaptInterval           > 0)) {
+      traceAM = tracer.start();
       if (m_optionsObj->m_ov.m_rawChainMeasureRunTimes) iRC = gettimeofday(&timevalAM, NULL);
 
       // Now might be the moment to adapt
@@ -1288,6 +1437,7 @@ uqMetropolisHastingsSGClass<P_V,P_M>::generateFullChain(
       } // if (partialChain.subSequenceSize() > 0)
 
       if (m_optionsObj->m_ov.m_rawChainMeasureRunTimes) m_rawChainInfo.amRunTime += uqMiscGetEllapsedSeconds(&timevalAM);
+      tracer.stop(UQ_TRACE_MH_AM_ID,traceAM);
     } // End of 'adaptive Metropolis' logic
 
     //****************************************************
@@ -1315,6 +1465,75 @@ uqMetropolisHastingsSGClass<P_V,P_M>::generateFullChain(
       }
     }
 
+    if ((m_optionsObj->m_ov.m_rawChainEssTarget                          >  0.) &&
+        (m_optionsObj->m_ov.m_rawChainEssCheckPeriod                     >  0 ) &&
+        ((positionId+1)                                                  >= nextEssCheckSize) &&
+        ((positionId+1)                                                  <  workingChain.subSequenceSize())) {
+      // Stop as soon as every component has reached the target effective sample size.
+      // Each check recomputes the estimate over the whole chain so far, so the checks get sparser
+      // as the chain grows: at least 'essCheckPeriod' positions apart, and once the chain is long
+      // enough about 1/UQ_MH_SG_RAW_CHAIN_ESS_CHECK_GROWTH_DIVISOR of its size apart. The total
+      // work of all checks is then a constant multiple of one estimate over the final chain.
+      nextEssCheckSize = positionId+1 + m_optionsObj->m_ov.m_rawChainEssCheckPeriod * std::max(1U,(positionId+1)/(UQ_MH_SG_RAW_CHAIN_ESS_CHECK_GROWTH_DIVISOR * m_optionsObj->m_ov.m_rawChainEssCheckPeriod));
+      P_V iactVec(m_vectorSpace.zeroVector());
+      P_V essVec (m_vectorSpace.zeroVector());
+      workingChain.effectiveSampleSize(0,
+                                       positionId+1,
+                                       m_optionsObj->m_ov.m_rawChainEssMethod,
+                                       UQ_IACT_SOKAL_WINDOW_FACTOR,
+                                       iactVec,
+                                       essVec);
+      double minEss = essVec.getMinValue();
+      if ((m_env.subDisplayFile()                   ) &&
+          (m_env.displayVerbosity() >= 2            ) &&
+          (m_optionsObj->m_ov.m_totallyMute == false)) {
+        *m_env.subDisplayFile() << "In uqMetropolisHastingsSGClass<P_V,P_M>::generateFullChain()"
+                                << ", for chain position of id = " << positionId
+                                << ": min ESS = "                  << minEss
+                                << ", target = "                   << m_optionsObj->m_ov.m_rawChainEssTarget
+                                << ", iactVec = "                  << iactVec
+                                << std::endl;
+      }
+      if (minEss >= m_optionsObj->m_ov.m_rawChainEssTarget) {
+        chainSize = positionId+1;
+        workingChain.resizeSequence(chainSize); // Also ends the chain loop
+        if (workingLogLikelihoodValues) workingLogLikelihoodValues->resizeSequence(chainSize);
+        if (workingLogTargetValues    ) workingLogTargetValues->resizeSequence    (chainSize);
+        if (m_optionsObj->m_ov.m_rawChainGenerateExtra) {
+          m_logTargets.resize    (chainSize,0.);
+          m_alphaQuotients.resize(chainSize,0.);
+        }
+        if ((m_env.subDisplayFile()                   ) &&
+            (m_optionsObj->m_ov.m_totallyMute == false)) {
+          *m_env.subDisplayFile() << "In uqMetropolisHastingsSGClass<P_V,P_M>::generateFullChain()"
+                                  << ": ESS target reached, stopping chain with " << chainSize
+                                  << " positions"
+                                  << std::endl;
+        }
+      }
+    }
+
+    if (m_optionsObj->m_ov.m_restartOutputBaseNameForFiles != ".") {
+      bool checkpointNow = false;
+      if ((m_optionsObj->m_ov.m_restartOutputPeriod                     >  0) &&
+          (((positionId+1) % m_optionsObj->m_ov.m_restartOutputPeriod) == 0)) {
+        checkpointNow = true;
+      }
+      if ((m_optionsObj->m_ov.m_restartOutputWallClockPeriod >  0.                                                     ) &&
+          (uqMiscGetEllapsedSeconds(&timevalCheckpoint)      >= m_optionsObj->m_ov.m_restartOutputWallClockPeriod)) {
+        checkpointNow = true;
+      }
+      if (checkpointNow) {
+        writeCheckpoint(positionId+1,
+                        uniquePos,
+                        workingChain,
+                        workingLogLikelihoodValues,
+                        workingLogTargetValues,
+                        currentPositionData);
+        iRC = gettimeofday(&timevalCheckpoint, NULL);
+      }
+    }
+
     if ((m_env.subDisplayFile()                   ) &&
         (m_env.displayVerbosity() >= 10           ) &&
         (m_optionsObj->m_ov.m_totallyMute == false)) {
@@ -1340,10 +1559,25 @@ uqMetropolisHastingsSGClass<P_V,P_M>::generateFullChain(
     if (aux) {}; // just to remove compiler warning
   }
 
+  if ((m_optionsObj->m_ov.m_rawChainEssTarget   >  0.                                     ) &&
+      (m_env.numSubEnvironments()               <  (unsigned int) m_env.fullComm().NumProc()) &&
+      (m_initialPosition.numOfProcsForStorage() == 1                                       )) {
+    // Only subRank 0 knows where the chain has been stopped
+    m_env.subComm().Bcast((void *) &chainSize, (int) 1, uqRawValue_MPI_UNSIGNED, 0, // Yes, 'subComm'
+                          "uqMetropolisHastingsSGClass<P_V,P_M>::generateFullChain()",
+                          "failed MPI.Bcast() for chainSize");
+    if (workingChain.subSequenceSize() != chainSize) {
+      workingChain.resizeSequence(chainSize);
+      if (workingLogLikelihoodValues) workingLogLikelihoodValues->resizeSequence(chainSize);
+      if (workingLogTargetValues    ) workingLogTargetValues->resizeSequence    (chainSize);
+    }
+  }
+
   //****************************************************
   // Print basic information about the chain
   //****************************************************
   m_rawChainInfo.runTime += uqMiscGetEllapsedSeconds(&timevalChain);
+  tracer.stop(UQ_TRACE_MH_CHAIN_ID,traceChain);
   if ((m_env.subDisplayFile()                   ) &&
       (m_optionsObj->m_ov.m_totallyMute == false)) {
     *m_env.subDisplayFile() << "Finished the generation of Markov chain " << workingChain.name()
@@ -1385,6 +1619,7 @@ uqMetropolisHastingsSGClass<P_V,P_M>::generateFullChain(
     *m_env.subDisplayFile() << "\n  Number of DRs = "  << m_rawChainInfo.numDRs << "(num_DRs/chain_size = " << (double) m_rawChainInfo.numDRs/(double) workingChain.subSequenceSize()
                             << ")";
     *m_env.subDisplayFile() << "\n  Out of target support in DR = " << m_rawChainInfo.numOutOfTargetSupportInDR;
+    *m_env.subDisplayFile() << "\n  Screened out by surrogate = "   << m_rawChainInfo.numScreenedOut;
     *m_env.subDisplayFile() << "\n  Rejection percentage = "        << 100. * (double) m_rawChainInfo.numRejections/(double) workingChain.subSequenceSize()
                             << " %";
     *m_env.subDisplayFile() << "\n  Out of target support percentage = " << 100. * (double) m_rawChainInfo.numOutOfTargetSupport/(double) workingChain.subSequenceSize()
@@ -1402,18 +1637,400 @@ uqMetropolisHastingsSGClass<P_V,P_M>::generateFullChain(
 //--------------------------------------------------
 template <class P_V,class P_M>
 void
+uqMetropolisHastingsSGClass<P_V,P_M>::writeCheckpoint(
+  unsigned int                               numPositions,
+  unsigned int                               uniquePos,
+  const uqBaseVectorSequenceClass<P_V,P_M>&  workingChain,
+  const uqScalarSequenceClass<double>*       workingLogLikelihoodValues,
+  const uqScalarSequenceClass<double>*       workingLogTargetValues,
+  const uqMarkovChainPositionDataClass<P_V>& currentPositionData)
+{
+  std::string fileName          = m_optionsObj->m_ov.m_restartOutputBaseNameForFiles + "_sub" + m_env.subIdString() + ".txt";
+  std::string tmpName           = fileName + ".tmp";
+  std::string positionsFileName = m_optionsObj->m_ov.m_restartOutputBaseNameForFiles + "_sub" + m_env.subIdString() + "_positions.txt";
+  int iRC = 0;
+
+  unsigned int dim = m_vectorSpace.dimLocal();
+
+  //****************************************************
+  // Positions: the first checkpoint of a run writes all of them, the next ones append the new ones
+  //****************************************************
+  bool rewritePositions = (m_numCheckpointedPositions == 0);
+  std::string positionsTmpName = positionsFileName + ".tmp";
+  std::ofstream ofsPositions;
+  if (rewritePositions) {
+    ofsPositions.open(positionsTmpName.c_str(), std::ofstream::out | std::ofstream::trunc);
+  }
+  else {
+    ofsPositions.open(positionsFileName.c_str(), std::ofstream::out | std::ofstream::app);
+  }
+  UQ_FATAL_TEST_MACRO(ofsPositions.is_open() == false,
+                      m_env.worldRank(),
+                      "uqMetropolisHastingsSGClass<P_V,P_M>::writeCheckpoint()",
+                      "failed to open checkpoint positions file");
+  ofsPositions.precision(17);
+
+  P_V tmpVec(m_vectorSpace.zeroVector());
+  for (unsigned int i = m_numCheckpointedPositions; i < numPositions; ++i) {
+    workingChain.getPositionValues(i,tmpVec);
+    ofsPositions << "p";
+    for (unsigned int j = 0; j < dim; ++j) {
+      ofsPositions << " " << tmpVec[j];
+    }
+    if (workingLogLikelihoodValues) ofsPositions << " " << (*workingLogLikelihoodValues)[i];
+    if (workingLogTargetValues    ) ofsPositions << " " << (*workingLogTargetValues    )[i];
+    if (m_optionsObj->m_ov.m_rawChainGenerateExtra) {
+      ofsPositions << " " << m_logTargets[i] << " " << m_alphaQuotients[i];
+    }
+    ofsPositions << std::endl;
+  }
+  for (unsigned int i = m_numCheckpointedUniquePositions; i < uniquePos; ++i) {
+    ofsPositions << "u " << m_idsOfUniquePositions[i] << std::endl;
+  }
+  ofsPositions.close();
+  UQ_FATAL_TEST_MACRO(ofsPositions.fail(),
+                      m_env.worldRank(),
+                      "uqMetropolisHastingsSGClass<P_V,P_M>::writeCheckpoint()",
+                      "failed to write checkpoint positions file");
+  if (rewritePositions) {
+    iRC = rename(positionsTmpName.c_str(),positionsFileName.c_str());
+    UQ_FATAL_TEST_MACRO(iRC != 0,
+                        m_env.worldRank(),
+                        "uqMetropolisHastingsSGClass<P_V,P_M>::writeCheckpoint()",
+                        "failed to rename checkpoint positions file");
+  }
+
+  //****************************************************
+  // State: how many positions of the positions file are valid, plus everything needed to resume
+  //****************************************************
+  std::ofstream ofsVar(tmpName.c_str(), std::ofstream::out | std::ofstream::trunc);
+  UQ_FATAL_TEST_MACRO(ofsVar.is_open() == false,
+                      m_env.worldRank(),
+                      "uqMetropolisHastingsSGClass<P_V,P_M>::writeCheckpoint()",
+                      "failed to open checkpoint file");
+  ofsVar.precision(17);
+
+  ofsVar << dim                                       << " "
+         << numPositions                              << " "
+         << workingChain.subSequenceSize()            << " "
+         << uniquePos                                 << " "
+         << (workingLogLikelihoodValues != NULL)      << " "
+         << (workingLogTargetValues     != NULL)      << " "
+         << m_optionsObj->m_ov.m_rawChainGenerateExtra << std::endl;
+
+  // Current position of the chain
+  for (unsigned int j = 0; j < dim; ++j) {
+    ofsVar << currentPositionData.vecValues()[j] << " ";
+  }
+  ofsVar << currentPositionData.outOfTargetSupport() << " "
+         << currentPositionData.logLikelihood()      << " "
+         << currentPositionData.logTarget()          << std::endl;
+
+  // Counters and run times
+  ofsVar << m_rawChainInfo.runTime                   << " "
+         << m_rawChainInfo.candidateRunTime          << " "
+         << m_rawChainInfo.targetRunTime             << " "
+         << m_rawChainInfo.mhAlphaRunTime            << " "
+         << m_rawChainInfo.drAlphaRunTime            << " "
+         << m_rawChainInfo.drRunTime                 << " "
+         << m_rawChainInfo.amRunTime                 << " "
+         << m_rawChainInfo.numTargetCalls            << " "
+         << m_rawChainInfo.numDRs                    << " "
+         << m_rawChainInfo.numOutOfTargetSupport     << " "
+         << m_rawChainInfo.numOutOfTargetSupportInDR << " "
+         << m_rawChainInfo.numRejections             << " "
+         << m_rawChainInfo.numScreenedOut            << std::endl;
+
+  // Adaptive Metropolis state
+  ofsVar << m_lastChainSize << " " << (m_lastMean != NULL);
+  if (m_lastMean) {
+    for (unsigned int i = 0; i < dim; ++i) ofsVar << " " << (*m_lastMean)[i];
+    for (unsigned int i = 0; i < dim; ++i) {
+      for (unsigned int j = 0; j < dim; ++j) ofsVar << " " << (*m_lastAdaptedCovMatrix)(i,j);
+    }
+  }
+  ofsVar << std::endl;
+
+  // Proposal covariance matrix, which adaptive Metropolis may have changed; the DR scales are fixed by the options
+  uqScaledCovMatrixTKGroupClass<P_V,P_M>* scaledTK = dynamic_cast<uqScaledCovMatrixTKGroupClass<P_V,P_M>* >(m_tk);
+  ofsVar << (scaledTK != NULL);
+  if (scaledTK) {
+    const uqGaussianJointPdfClass<P_V,P_M>* tkPdf = dynamic_cast<const uqGaussianJointPdfClass<P_V,P_M>* >(&(scaledTK->rv(0).pdf()));
+    for (unsigned int i = 0; i < dim; ++i) {
+      for (unsigned int j = 0; j < dim; ++j) ofsVar << " " << tkPdf->lawCovMatrix()(i,j);
+    }
+  }
+  ofsVar << std::endl;
+
+  m_env.rngObject()->writeState(ofsVar);
+  ofsVar << "COMPLETE" << std::endl;
+  ofsVar.close();
+  UQ_FATAL_TEST_MACRO(ofsVar.fail(),
+                      m_env.worldRank(),
+                      "uqMetropolisHastingsSGClass<P_V,P_M>::writeCheckpoint()",
+                      "failed to write checkpoint file");
+
+  // Atomically replace the previous checkpoint
+  iRC = rename(tmpName.c_str(),fileName.c_str());
+  UQ_FATAL_TEST_MACRO(iRC != 0,
+                      m_env.worldRank(),
+                      "uqMetropolisHastingsSGClass<P_V,P_M>::writeCheckpoint()",
+                      "failed to rename checkpoint file");
+  m_numCheckpointedPositions       = numPositions;
+  m_numCheckpointedUniquePositions = uniquePos;
+
+  if ((m_env.subDisplayFile()                   ) &&
+      (m_optionsObj->m_ov.m_totallyMute == false)) {
+    *m_env.subDisplayFile() << "In uqMetropolisHastingsSGClass<P_V,P_M>::writeCheckpoint()"
+                            << ": just wrote checkpoint '" << fileName
+                            << "' with " << numPositions << " chain positions"
+                            << std::endl;
+  }
+
+  return;
+}
+//--------------------------------------------------
+template <class P_V,class P_M>
+unsigned int
+uqMetropolisHastingsSGClass<P_V,P_M>::readCheckpoint(
+  unsigned int&                        chainSize,
+  unsigned int&                        uniquePos,
+  uqBaseVectorSequenceClass<P_V,P_M>&  workingChain,
+  uqScalarSequenceClass<double>*       workingLogLikelihoodValues,
+  uqScalarSequenceClass<double>*       workingLogTargetValues,
+  uqMarkovChainPositionDataClass<P_V>& currentPositionData)
+{
+  std::string fileName = m_optionsObj->m_ov.m_restartInputBaseNameForFiles + "_sub" + m_env.subIdString() + ".txt";
+
+  std::ifstream ifsVar(fileName.c_str(), std::ifstream::in);
+  UQ_FATAL_TEST_MACRO(ifsVar.is_open() == false,
+                      m_env.worldRank(),
+                      "uqMetropolisHastingsSGClass<P_V,P_M>::readCheckpoint()",
+                      "failed to open checkpoint file");
+
+  unsigned int dim              = 0;
+  unsigned int numPositions     = 0;
+  unsigned int savedSize        = 0;
+  bool         hasLogLikelihood = false;
+  bool         hasLogTarget     = false;
+  bool         hasExtra         = false;
+  ifsVar >> dim >> numPositions >> savedSize >> uniquePos >> hasLogLikelihood >> hasLogTarget >> hasExtra;
+  UQ_FATAL_TEST_MACRO(dim != m_vectorSpace.dimLocal(),
+                      m_env.worldRank(),
+                      "uqMetropolisHastingsSGClass<P_V,P_M>::readCheckpoint()",
+                      "checkpoint has a different dimension");
+  UQ_FATAL_TEST_MACRO((numPositions == 0) || (numPositions > chainSize) || (uniquePos > numPositions),
+                      m_env.worldRank(),
+                      "uqMetropolisHastingsSGClass<P_V,P_M>::readCheckpoint()",
+                      "checkpoint does not fit the requested chain size");
+
+  if (savedSize < chainSize) {
+    // The checkpointed chain had already been stopped by the ESS criterion
+    chainSize = savedSize;
+    workingChain.resizeSequence(chainSize);
+    if (workingLogLikelihoodValues) workingLogLikelihoodValues->resizeSequence(chainSize);
+    if (workingLogTargetValues    ) workingLogTargetValues->resizeSequence    (chainSize);
+    if (m_optionsObj->m_ov.m_rawChainGenerateExtra) {
+      m_logTargets.resize    (chainSize,0.);
+      m_alphaQuotients.resize(chainSize,0.);
+    }
+  }
+
+  // Positions generated so far; records appended after the last complete checkpoint are ignored
+  std::string positionsFileName = m_optionsObj->m_ov.m_restartInputBaseNameForFiles + "_sub" + m_env.subIdString() + "_positions.txt";
+  std::ifstream ifsPositions(positionsFileName.c_str(), std::ifstream::in);
+  UQ_FATAL_TEST_MACRO(ifsPositions.is_open() == false,
+                      m_env.worldRank(),
+                      "uqMetropolisHastingsSGClass<P_V,P_M>::readCheckpoint()",
+                      "failed to open checkpoint positions file");
+
+  P_V tmpVec(m_vectorSpace.zeroVector());
+  unsigned int numReadPositions       = 0;
+  unsigned int numReadUniquePositions = 0;
+  std::string  tag("");
+  double       tmpValue = 0.;
+  while ((numReadPositions       < numPositions) ||
+         (numReadUniquePositions < uniquePos   )) {
+    ifsPositions >> tag;
+    UQ_FATAL_TEST_MACRO(ifsPositions.fail(),
+                        m_env.worldRank(),
+                        "uqMetropolisHastingsSGClass<P_V,P_M>::readCheckpoint()",
+                        "checkpoint positions file is truncated");
+    if ((tag == "p") && (numReadPositions < numPositions)) {
+      unsigned int i = numReadPositions++;
+      for (unsigned int j = 0; j < dim; ++j) {
+        ifsPositions >> tmpVec[j];
+      }
+      workingChain.setPositionValues(i,tmpVec);
+      if (i > 0) {
+        for (unsigned int j = 0; j < m_rawChainSketches.size(); ++j) {
+          m_rawChainSketches[j]->insert(tmpVec[j]);
+        }
+      }
+      if (hasLogLikelihood) {
+        ifsPositions >> tmpValue;
+        if (workingLogLikelihoodValues) (*workingLogLikelihoodValues)[i] = tmpValue;
+      }
+      if (hasLogTarget) {
+        ifsPositions >> tmpValue;
+        if (workingLogTargetValues) (*workingLogTargetValues)[i] = tmpValue;
+      }
+      if (hasExtra) {
+        double tmpAlpha = 0.;
+        ifsPositions >> tmpValue >> tmpAlpha;
+        if (m_optionsObj->m_ov.m_rawChainGenerateExtra) {
+          m_logTargets    [i] = tmpValue;
+          m_alphaQuotients[i] = tmpAlpha;
+        }
+      }
+    }
+    else if ((tag == "u") && (numReadUniquePositions < uniquePos)) {
+      ifsPositions >> m_idsOfUniquePositions[numReadUniquePositions++];
+    }
+    else {
+      UQ_FATAL_TEST_MACRO(true,
+                          m_env.worldRank(),
+                          "uqMetropolisHastingsSGClass<P_V,P_M>::readCheckpoint()",
+                          "checkpoint positions file does not match the checkpoint");
+    }
+  }
+  UQ_FATAL_TEST_MACRO(ifsPositions.fail(),
+                      m_env.worldRank(),
+                      "uqMetropolisHastingsSGClass<P_V,P_M>::readCheckpoint()",
+                      "checkpoint positions file is corrupted");
+  ifsPositions.close();
+
+  // Current position of the chain
+  bool   outOfTargetSupport = false;
+  double logLikelihood      = 0.;
+  double logTarget          = 0.;
+  for (unsigned int j = 0; j < dim; ++j) {
+    ifsVar >> tmpVec[j];
+  }
+  ifsVar >> outOfTargetSupport >> logLikelihood >> logTarget;
+  currentPositionData.set(tmpVec,outOfTargetSupport,logLikelihood,logTarget);
+
+  // Counters and run times
+  ifsVar >> m_rawChainInfo.runTime
+         >> m_rawChainInfo.candidateRunTime
+         >> m_rawChainInfo.targetRunTime
+         >> m_rawChainInfo.mhAlphaRunTime
+         >> m_rawChainInfo.drAlphaRunTime
+         >> m_rawChainInfo.drRunTime
+         >> m_rawChainInfo.amRunTime
+         >> m_rawChainInfo.numTargetCalls
+         >> m_rawChainInfo.numDRs
+         >> m_rawChainInfo.numOutOfTargetSupport
+         >> m_rawChainInfo.numOutOfTargetSupportInDR
+         >> m_rawChainInfo.numRejections
+         >> m_rawChainInfo.numScreenedOut;
+
+  // Adaptive Metropolis state
+  bool hasLastMean = false;
+  ifsVar >> m_lastChainSize >> hasLastMean;
+  if (hasLastMean) {
+    if (m_lastMean == NULL) {
+      m_lastMean             = m_vectorSpace.newVector();
+      m_lastAdaptedCovMatrix = m_vectorSpace.newMatrix();
+    }
+    for (unsigned int i = 0; i < dim; ++i) ifsVar >> (*m_lastMean)[i];
+    for (unsigned int i = 0; i < dim; ++i) {
+      for (unsigned int j = 0; j < dim; ++j) ifsVar >> (*m_lastAdaptedCovMatrix)(i,j);
+    }
+  }
+
+  // Proposal covariance matrix
+  bool hasTKCovMatrix = false;
+  ifsVar >> hasTKCovMatrix;
+  if (hasTKCovMatrix) {
+    uqScaledCovMatrixTKGroupClass<P_V,P_M>* scaledTK = dynamic_cast<uqScaledCovMatrixTKGroupClass<P_V,P_M>* >(m_tk);
+    UQ_FATAL_TEST_MACRO(scaledTK == NULL,
+                        m_env.worldRank(),
+                        "uqMetropolisHastingsSGClass<P_V,P_M>::readCheckpoint()",
+                        "checkpoint was written with a different transition kernel");
+    P_M* tkCovMatrix = m_vectorSpace.newMatrix();
+    for (unsigned int i = 0; i < dim; ++i) {
+      for (unsigned int j = 0; j < dim; ++j) ifsVar >> (*tkCovMatrix)(i,j);
+    }
+    scaledTK->updateLawCovMatrix(*tkCovMatrix);
+    delete tkCovMatrix;
+  }
+
+  m_env.rngObject()->readState(ifsVar);
+
+  std::string marker("");
+  ifsVar >> marker;
+  UQ_FATAL_TEST_MACRO(ifsVar.fail() || (marker != "COMPLETE"),
+                      m_env.worldRank(),
+                      "uqMetropolisHastingsSGClass<P_V,P_M>::readCheckpoint()",
+                      "checkpoint file is corrupted");
+  ifsVar.close();
+
+  if ((m_env.subDisplayFile()                   ) &&
+      (m_optionsObj->m_ov.m_totallyMute == false)) {
+    *m_env.subDisplayFile() << "In uqMetropolisHastingsSGClass<P_V,P_M>::readCheckpoint()"
+                            << ": resuming chain from checkpoint '" << fileName
+                            << "' with " << numPositions << " chain positions"
+                            << std::endl;
+  }
+
+  return numPositions;
+}
+//--------------------------------------------------
+template <class P_V,class P_M>
+double
+uqMetropolisHastingsSGClass<P_V,P_M>::surrogateLogTarget(const P_V& vecValues) const
+{
+  if (m_surrogatePdf) {
+#ifdef QUESO_EXPECTS_LN_LIKELIHOOD_INSTEAD_OF_MINUS_2_LN
+    return        m_surrogatePdf->lnValue(vecValues,NULL,NULL,NULL,NULL);
+#else
+    return -0.5 * m_surrogatePdf->lnValue(vecValues,NULL,NULL,NULL,NULL);
+#endif
+  }
+
+  // Gaussian approximation: the proposal covariance matrix is 'm_amEta' times the adapted covariance
+  // matrix (plus 'm_amEpsilon' times the identity, if needed), and is positive definite
+  const uqGaussianJointPdfClass<P_V,P_M>* tkPdf = dynamic_cast<const uqGaussianJointPdfClass<P_V,P_M>* >(&(m_tk->rv(0).pdf()));
+  P_V diffVec(vecValues - *m_lastMean);
+  P_V solVec (m_vectorSpace.zeroVector());
+  tkPdf->lawCovMatrix().invertMultiply(diffVec,solVec);
+
+  return -0.5 * m_optionsObj->m_ov.m_amEta * scalarProduct(diffVec,solVec);
+}
+//--------------------------------------------------
+template <class P_V,class P_M>
+void
 uqMetropolisHastingsSGClass<P_V,P_M>::updateAdaptedCovMatrix(
   const uqBaseVectorSequenceClass<P_V,P_M>& partialChain,
   unsigned int                              idOfFirstPositionInSubChain,
   double&                                   lastChainSize,
   P_V&                                      lastMean,
   P_M&                                      lastAdaptedCovMatrix)
+{
+  uqUpdateAdaptedCovMatrix(partialChain,
+                           idOfFirstPositionInSubChain,
+                           lastChainSize,
+                           lastMean,
+                           lastAdaptedCovMatrix);
+
+  return;
+}
+//--------------------------------------------------
+template <class P_V,class P_M>
+void
+uqUpdateAdaptedCovMatrix(
+  const uqBaseVectorSequenceClass<P_V,P_M>& partialChain,
+  unsigned int                              idOfFirstPositionInSubChain,
+  double&                                   lastChainSize,
+  P_V&                                      lastMean,
+  P_M&                                      lastAdaptedCovMatrix)
 {
   double doubleSubChainSize = (double) partialChain.subSequenceSize();
   if (lastChainSize == 0) {
     UQ_FATAL_TEST_MACRO(partialChain.subSequenceSize() < 2,
-                        m_env.worldRank(),
-                        "uqMetropolisHastingsSGClass<P_V,P_M>::updateAdaptedCovMatrix()",
+                        partialChain.vectorSpace().env().worldRank(),
+                        "uqUpdateAdaptedCovMatrix<P_V,P_M>()",
                         "'partialChain.subSequenceSize()' should be >= 2");
 
 #if 1 // prudenci-2012-07-06
@@ -1422,36 +2039,38 @@ uqMetropolisHastingsSGClass<P_V,P_M>::updateAdaptedCovMatrix(
     partialChain.subMeanExtra(0,partialChain.subSequenceSize(),lastMean);
 #endif
 
-    P_V tmpVec(m_vectorSpace.zeroVector());
-    lastAdaptedCovMatrix = -doubleSubChainSize * matrixProduct(lastMean,lastMean);
+    // Rank-one updates in place: no temporary matrices per chain position
+    P_V tmpVec(partialChain.vectorSpace().zeroVector());
+    lastAdaptedCovMatrix.cwSet(0.);
+    lastAdaptedCovMatrix.rankOneUpdate(1.,-doubleSubChainSize,lastMean,lastMean);
     for (unsigned int i = 0; i < partialChain.subSequenceSize(); ++i) {
       partialChain.getPositionValues(i,tmpVec);
-      lastAdaptedCovMatrix += matrixProduct(tmpVec,tmpVec);
+      lastAdaptedCovMatrix.rankOneUpdate(1.,1.,tmpVec,tmpVec);
     }
     lastAdaptedCovMatrix /= (doubleSubChainSize - 1.); // That is why partialChain size must be >= 2
   }
   else {
     UQ_FATAL_TEST_MACRO(partialChain.subSequenceSize() < 1,
-                        m_env.worldRank(),
-                        "uqMetropolisHastingsSGClass<P_V,P_M>::updateAdaptedCovMatrix()",
+                        partialChain.vectorSpace().env().worldRank(),
+                        "uqUpdateAdaptedCovMatrix<P_V,P_M>()",
                         "'partialChain.subSequenceSize()' should be >= 1");
 
     UQ_FATAL_TEST_MACRO(idOfFirstPositionInSubChain < 1,
-                        m_env.worldRank(),
-                        "uqMetropolisHastingsSGClass<P_V,P_M>::updateAdaptedCovMatrix()",
+                        partialChain.vectorSpace().env().worldRank(),
+                        "uqUpdateAdaptedCovMatrix<P_V,P_M>()",
                         "'idOfFirstPositionInSubChain' should be >= 1");
 
-    P_V tmpVec (m_vectorSpace.zeroVector());
-    P_V diffVec(m_vectorSpace.zeroVector());
+    P_V tmpVec (partialChain.vectorSpace().zeroVector());
+    P_V diffVec(partialChain.vectorSpace().zeroVector());
     for (unsigned int i = 0; i < partialChain.subSequenceSize(); ++i) {
       double doubleCurrentId  = (double) (idOfFirstPositionInSubChain+i);
       partialChain.getPositionValues(i,tmpVec);
-      diffVec = tmpVec - lastMean;
+      diffVec.cwSetLinearCombination(1.,tmpVec,-1.,lastMean);
 
       double ratio1         = (1. - 1./doubleCurrentId); // That is why idOfFirstPositionInSubChain must be >= 1
       double ratio2         = (1./(1.+doubleCurrentId));
-      lastAdaptedCovMatrix  = ratio1 * lastAdaptedCovMatrix + ratio2 * matrixProduct(diffVec,diffVec);
-      lastMean             += ratio2 * diffVec;
+      lastAdaptedCovMatrix.rankOneUpdate(ratio1,ratio2,diffVec,diffVec);
+      lastMean.cwSetLinearCombination(1.,lastMean,ratio2,diffVec);
     } 
   }
   lastChainSize += doubleSubChainSize;
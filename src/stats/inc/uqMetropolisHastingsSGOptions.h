@@ -32,6 +32,7 @@
 #include <uqEnvironment.h>
 #include <uqMLSamplingLevelOptions.h>
 #include <uqSequenceStatisticalOptions.h>
+#include <uqMiscellaneous.h>
 
 #undef  UQ_MH_SG_REQUIRES_INVERTED_COV_MATRICES
 #define UQ_NOTHING_JUST_FOR_TEST_OF_SVN_ID 1
@@ -91,6 +92,17 @@
 #define UQ_MH_SG_AM_EPSILON_ODV                                       1.e-5
 #define UQ_MH_SG_ENABLE_BROOKS_GELMAN_CONV_MONITOR                    0
 #define UQ_MH_SG_BROOKS_GELMAN_LAG                                    100
+#define UQ_MH_SG_RAW_CHAIN_ESS_TARGET_ODV                             0.
+#define UQ_MH_SG_RAW_CHAIN_ESS_CHECK_PERIOD_ODV                       1000
+#define UQ_MH_SG_RAW_CHAIN_ESS_METHOD_ODV                             UQ_IACT_GEYER_METHOD
+// After a failed ESS check on n positions, the next one is at least n/this many positions later
+#define UQ_MH_SG_RAW_CHAIN_ESS_CHECK_GROWTH_DIVISOR                   4
+#define UQ_MH_SG_RAW_CHAIN_SKETCH_K_ODV                               0
+#define UQ_MH_SG_RESTART_OUTPUT_PERIOD_ODV                            0
+#define UQ_MH_SG_RESTART_OUTPUT_WALL_CLOCK_PERIOD_ODV                 0.
+#define UQ_MH_SG_RESTART_OUTPUT_BASE_NAME_FOR_FILES_ODV               "."
+#define UQ_MH_SG_RESTART_INPUT_BASE_NAME_FOR_FILES_ODV                "."
+#define UQ_MH_SG_DA_USE_GAUSSIAN_SURROGATE_ODV                        0
 
 /*! \file uqMetropolisHastingsSGOptions.h
     \brief Classes to allow options to be passed to a Metropolis-Hastings algorithm.
@@ -189,6 +201,19 @@ public:
   unsigned int                       m_enableBrooksGelmanConvMonitor;
   unsigned int                       m_BrooksGelmanLag;
 
+  double                             m_rawChainEssTarget;      // if > 0, m_rawChainSize is only an upper bound
+  unsigned int                       m_rawChainEssCheckPeriod; // minimum spacing of the ESS checks, which grows with the chain
+  std::string                        m_rawChainEssMethod;
+
+  unsigned int                       m_rawChainSketchK;        // if > 0, raw chain components are also fed to quantile sketches
+
+  unsigned int                       m_restartOutputPeriod;          // checkpoint every so many chain positions (0 = never); positions are appended incrementally
+  double                             m_restartOutputWallClockPeriod; // checkpoint every so many seconds (0 = never)
+  std::string                        m_restartOutputBaseNameForFiles;
+  std::string                        m_restartInputBaseNameForFiles; // if != ".", the raw chain resumes from this checkpoint
+
+  bool                               m_daUseGaussianSurrogate; // delayed acceptance with the adaptive Metropolis Gaussian approximation
+
 private:
   //! Copies the option values from \c src to \c this.
   void copy(const uqMhOptionsValuesClass& src);
@@ -316,6 +341,15 @@ private:
 
   std::string                   m_option_enableBrooksGelmanConvMonitor;
   std::string                   m_option_BrooksGelmanLag;
+  std::string                   m_option_rawChain_essTarget;
+  std::string                   m_option_rawChain_essCheckPeriod;
+  std::string                   m_option_rawChain_essMethod;
+  std::string                   m_option_rawChain_sketchK;
+  std::string                   m_option_restartOutput_period;
+  std::string                   m_option_restartOutput_wallClockPeriod;
+  std::string                   m_option_restartOutput_baseNameForFiles;
+  std::string                   m_option_restartInput_baseNameForFiles;
+  std::string                   m_option_da_useGaussianSurrogate;
 };
 
 std::ostream& operator<<(std::ostream& os, const uqMetropolisHastingsSGOptionsClass& obj);
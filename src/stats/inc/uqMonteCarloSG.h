@@ -33,6 +33,7 @@
 #include <uqVectorFunction.h>
 #include <uqVectorFunctionSynchronizer.h>
 #include <uqMonteCarloSGOptions.h>
+#include <uqQuantileSketch.h>
 
 /*! 
  * \file uqMonteCarloSG.h
@@ -76,6 +77,12 @@ public:
    * interest (QoI).*/
   void generateSequence(uqBaseVectorSequenceClass<P_V,P_M>& workingPSeq,
                         uqBaseVectorSequenceClass<Q_V,Q_M>& workingQSeq);
+
+  //! Streaming quantile sketches of the QoI components, one per component.
+  /*! The sketches are fed while the QoI sequence is generated, when option 'qseq_sketchK' is
+   * positive; otherwise the vector is empty. They summarize the samples of this sub-environment
+   * only: use uqQuantileSketchClass::unifiedMerge() to combine them over the inter0 communicator.*/
+  const std::vector<uqQuantileSketchClass*>& qoiSketches() const;
   //@}
   
   //! @name I/O methods
@@ -126,6 +133,7 @@ private:
 
   uqMcOptionsValuesClass                                    m_alternativeOptionsValues;
   uqMonteCarloSGOptionsClass*                               m_optionsObj;
+  std::vector<uqQuantileSketchClass*>                       m_qoiSketches;
 };
 
 //! Prints the object \c obj, overloading an operator.
@@ -153,7 +161,8 @@ uqMonteCarloSGClass<P_V,P_M,Q_V,Q_M>::uqMonteCarloSGClass(
 #else
   m_alternativeOptionsValues(),
 #endif
-  m_optionsObj              (NULL)
+  m_optionsObj              (NULL),
+  m_qoiSketches             (0)
 {
   if (m_env.subDisplayFile()) {
     *m_env.subDisplayFile() << "Entering uqMonteCarloSGClass<P_V,P_M,Q_V,Q_M>::constructor()"
@@ -186,6 +195,9 @@ uqMonteCarloSGClass<P_V,P_M,Q_V,Q_M>::uqMonteCarloSGClass(
 template <class P_V,class P_M,class Q_V,class Q_M>
 uqMonteCarloSGClass<P_V,P_M,Q_V,Q_M>::~uqMonteCarloSGClass()
 {
+  for (unsigned int i = 0; i < m_qoiSketches.size(); ++i) {
+    delete m_qoiSketches[i];
+  }
   if (m_optionsObj             ) delete m_optionsObj;
   if (m_qoiFunctionSynchronizer) delete m_qoiFunctionSynchronizer;
 }
@@ -212,6 +224,13 @@ uqMonteCarloSGClass<P_V,P_M,Q_V,Q_M>::generateSequence(
 
   return;
 }
+//---------------------------------------------------
+template <class P_V,class P_M,class Q_V,class Q_M>
+const std::vector<uqQuantileSketchClass*>&
+uqMonteCarloSGClass<P_V,P_M,Q_V,Q_M>::qoiSketches() const
+{
+  return m_qoiSketches;
+}
 // I/O methods---------------------------------------
 template <class P_V,class P_M,class Q_V,class Q_M>
 void
@@ -470,6 +489,17 @@ uqMonteCarloSGClass<P_V,P_M,Q_V,Q_M>::actualGenerateSequence(
   P_V tmpP(m_paramSpace.zeroVector());
   Q_V tmpQ(m_qoiSpace.zeroVector());
 
+  for (unsigned int j = 0; j < m_qoiSketches.size(); ++j) {
+    delete m_qoiSketches[j];
+  }
+  m_qoiSketches.clear();
+  if (m_optionsObj->m_ov.m_qseqSketchK > 0) {
+    m_qoiSketches.resize(tmpQ.sizeLocal(),NULL);
+    for (unsigned int j = 0; j < m_qoiSketches.size(); ++j) {
+      m_qoiSketches[j] = new uqQuantileSketchClass(m_optionsObj->m_ov.m_qseqSketchK);
+    }
+  }
+
   unsigned int actualSeqSize = 0;
   for (unsigned int i = 0; i < requestedSeqSize; ++i) {
     paramRv.realizer().realization(tmpP);
@@ -525,6 +555,9 @@ uqMonteCarloSGClass<P_V,P_M,Q_V,Q_M>::actualGenerateSequence(
 
       workingQSeq.setPositionValues(i,tmpQ);
       m_numQsNotSubWritten++;
+      for (unsigned int j = 0; j < m_qoiSketches.size(); ++j) {
+        m_qoiSketches[j]->insert(tmpQ[j]);
+      }
       if ((m_optionsObj->m_ov.m_qseqDataOutputPeriod           >  0  ) && 
           (((i+1) % m_optionsObj->m_ov.m_qseqDataOutputPeriod) == 0  ) &&
           (m_optionsObj->m_ov.m_qseqDataOutputFileName         != ".")) {
@@ -49,6 +49,7 @@
 #define UQ_MOC_SG_QSEQ_SIZE_ODV                    100
 #define UQ_MOC_SG_QSEQ_DISPLAY_PERIOD_ODV          500
 #define UQ_MOC_SG_QSEQ_MEASURE_RUN_TIMES_ODV       0
+#define UQ_MOC_SG_QSEQ_SKETCH_K_ODV                0
 #define UQ_MOC_SG_QSEQ_DATA_OUTPUT_PERIOD_ODV      0
 #define UQ_MOC_SG_QSEQ_DATA_OUTPUT_FILE_NAME_ODV   UQ_MOC_SG_FILENAME_FOR_NO_FILE
 #define UQ_MOC_SG_QSEQ_DATA_OUTPUT_FILE_TYPE_ODV   UQ_FILE_EXTENSION_FOR_MATLAB_FORMAT
@@ -109,6 +110,7 @@ public:
   unsigned int                       m_qseqSize;
   unsigned int                       m_qseqDisplayPeriod;
   bool                               m_qseqMeasureRunTimes;
+  unsigned int                       m_qseqSketchK;
   unsigned int                       m_qseqDataOutputPeriod;
   std::string                        m_qseqDataOutputFileName;
   std::string                        m_qseqDataOutputFileType;
@@ -201,6 +203,7 @@ private:
   std::string                   m_option_qseq_size;
   std::string                   m_option_qseq_displayPeriod;
   std::string                   m_option_qseq_measureRunTimes;
+  std::string                   m_option_qseq_sketchK;
   std::string                   m_option_qseq_dataOutputPeriod;
   std::string                   m_option_qseq_dataOutputFileName;
   std::string                   m_option_qseq_dataOutputFileType;
@@ -80,6 +80,11 @@ public:
   //@{
   //! Returns the value of the CDF at \c paramValue. See template specialization.  
   virtual double                  value           (T             paramValue          ) const = 0;
+
+  //! Returns the values of the CDF at the non-decreasing \c sortedParamValues. 
+  /*! The default implementation calls value() for each position; sampled CDFs override it with a single sweep over the grid.*/
+  virtual void                    values          (const std::vector<T>& sortedParamValues,
+                                                   std::vector<double>&  cdfValues) const;
   
   //! Returns the position of a given value of CDF. See template specialization.
   virtual T                       inverse         (double        cdfValue            ) const = 0;
@@ -133,6 +138,18 @@ template<class T>
 uqBaseScalarCdfClass<T>::~uqBaseScalarCdfClass()
 {
 }
+// Math methods--------------------------------------
+template<class T>
+void
+uqBaseScalarCdfClass<T>::values(const std::vector<T>& sortedParamValues, std::vector<double>& cdfValues) const
+{
+  cdfValues.resize(sortedParamValues.size(),0.);
+  for (unsigned int j = 0; j < sortedParamValues.size(); ++j) {
+    cdfValues[j] = this->value(sortedParamValues[j]);
+  }
+
+  return;
+}
 // Environment methods ------------------------------
 template <class T>
 const uqBaseEnvironmentClass&
@@ -202,6 +219,10 @@ public:
   //@{
   //! Returns the value of the CDF at \c paramValue. 
   double value           (T                       paramValue) const;
+
+  //! Returns the values of the CDF at the non-decreasing \c sortedParamValues, with one sweep over the grid.
+  void   values          (const std::vector<T>&   sortedParamValues,
+                          std::vector<double>&    cdfValues ) const;
   
   //! Returns the position of a given value of CDF. 
   T      inverse         (double                  cdfValue  ) const;
@@ -311,6 +332,46 @@ uqSampledScalarCdfClass<T>::value(T paramValue) const
 }
 //---------------------------------------------------
 template<class T>
+void
+uqSampledScalarCdfClass<T>::values(const std::vector<T>& sortedParamValues, std::vector<double>& cdfValues) const
+{
+  unsigned int numPoints = sortedParamValues.size();
+  cdfValues.resize(numPoints,0.);
+  if (numPoints == 0) return;
+
+  unsigned int iMax = m_cdfGrid.size();
+  T gridMin = m_cdfGrid[0];
+  T gridMax = m_cdfGrid[iMax-1];
+
+  // The positions are non-decreasing, so the interval id never moves backwards
+  unsigned int intervalId = 0;
+  for (unsigned int j = 0; j < numPoints; ++j) {
+    T paramValue = sortedParamValues[j];
+    UQ_FATAL_TEST_MACRO((j > 0) && (paramValue < sortedParamValues[j-1]),
+                        m_env.worldRank(),
+                        "uqSampledScalarCdfClass<T>::values()",
+                        "positions are not sorted");
+
+    if (paramValue <= gridMin) {
+      cdfValues[j] = 0.;
+    }
+    else if (gridMax <= paramValue) {
+      cdfValues[j] = 1.;
+    }
+    else {
+      while ((intervalId+2 < iMax) && (!(paramValue < m_cdfGrid[intervalId+1]))) {
+        ++intervalId;
+      }
+      double intervalLen = m_cdfGrid[intervalId+1] - m_cdfGrid[intervalId];
+      double ratio = (paramValue - m_cdfGrid[intervalId])/intervalLen;
+      cdfValues[j] = (1.-ratio)*m_cdfValues[intervalId] + ratio*m_cdfValues[intervalId+1];
+    }
+  }
+
+  return;
+}
+//---------------------------------------------------
+template<class T>
 T
 uqSampledScalarCdfClass<T>::inverse(double cdfValue) const
 {
@@ -532,6 +593,10 @@ public:
   //@{
   //! Returns the value of the CDF at \c paramValue.
   double value           (T                       paramValue) const;
+
+  //! Returns the values of the CDF at the non-decreasing \c sortedParamValues.
+  void   values          (const std::vector<T>&   sortedParamValues,
+                          std::vector<double>&    cdfValues ) const;
   
   //! Returns the position of a given value of CDF. 
   T      inverse         (double                  cdfValue  ) const;
@@ -604,6 +669,14 @@ uqStdScalarCdfClass<T>::value(T paramValue) const
 }
 //---------------------------------------------------
 template<class T>
+void
+uqStdScalarCdfClass<T>::values(const std::vector<T>& sortedParamValues, std::vector<double>& cdfValues) const
+{
+  m_sampledCdfGrid->values(sortedParamValues,cdfValues);
+  return;
+}
+//---------------------------------------------------
+template<class T>
 T
 uqStdScalarCdfClass<T>::inverse(double cdfValue) const
 {
@@ -673,16 +746,23 @@ horizontalDistance(const uqBaseScalarCdfClass<T>& cdf1,
   //}
 
   double numEvaluationPoints = 1001.;
+  std::vector<T>      xs((unsigned int) numEvaluationPoints,0.);
+  std::vector<double> cdf1Values(0);
+  for (unsigned int j = 0; j < xs.size(); ++j) {
+    double ratio = ((double) j)/(numEvaluationPoints-1.); // IMPORTANT: Yes, '-1.'
+    xs[j] = (1.-ratio)*x1 + ratio*x2;
+  }
+  cdf1.values(xs,cdf1Values); // One sweep over the grid of cdf1, instead of one search per point
+
   for (double i = 0.; i < numEvaluationPoints; ++i) {
-    double ratio = i/(numEvaluationPoints-1.); // IMPORTANT: Yes, '-1.'
-    double x = (1.-ratio)*x1 + ratio*x2;
-    double y = cdf2.inverse(cdf1.value(x));
+    double x = xs[(unsigned int) i];
+    double y = cdf2.inverse(cdf1Values[(unsigned int) i]);
     double d = fabs(x-y);
     if ((cdf1.env().subDisplayFile()) && (cdf1.env().displayVerbosity() >= 3)) {
       *cdf1.env().subDisplayFile() << "In horizontalDistance"
                                    << ": i = "                  << i
                                    << ", x = "                  << x
-                                   << ", cdf1.value(x) = "      << cdf1.value(x)
+                                   << ", cdf1.value(x) = "      << cdf1Values[(unsigned int) i]
                                    << ", y = "                  << y
                                    << ", d = "                  << d
                                    << ", currentMaxDistance = " << maxDistance
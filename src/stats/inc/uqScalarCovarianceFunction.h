@@ -72,6 +72,11 @@ public:
   
   //! The value of the covariance function. See template specialization.
   virtual       double                 value    (const V& domainVector1, const V& domainVector2) const = 0;
+
+  //! Whether the covariance only depends on the difference between its two arguments.
+  /*! Stationary covariances let random fields on regular grids be sampled by circulant
+   * embedding. The default is the safe answer, \c false. */
+  virtual       bool                   isStationary     ()       const;
   //@}
 
 protected:
@@ -124,6 +129,13 @@ uqBaseScalarCovarianceFunctionClass<V,M>::basicDomainSet() const
 {
   return m_basicDomainSet;
 }
+// --------------------------------------------------
+template<class V, class M>
+bool
+uqBaseScalarCovarianceFunctionClass<V,M>::isStationary() const
+{
+  return false;
+}
 
 //*****************************************************
 // Exponential class
@@ -159,6 +171,9 @@ public:
   /*! The value of the exponential covariance function is: \f$ cov= a exp (-d^2/sigma)\f$, with 
    * \f$ d= \sqrt{(domainVector1 - domainVector1)^2} \f$*/
   double value(const V& domainVector1, const V& domainVector2) const;
+
+  //! The exponential covariance only depends on the distance between its arguments.
+  bool   isStationary() const;
   //@}
   
 protected:
@@ -232,6 +247,13 @@ uqExponentialScalarCovarianceFunctionClass<V,M>::value(const V& domainVector1, c
 
   return result;
 }
+// --------------------------------------------------
+template<class V,class M>
+bool
+uqExponentialScalarCovarianceFunctionClass<V,M>::isStationary() const
+{
+  return true;
+}
 
 //*****************************************************
 // Generic class
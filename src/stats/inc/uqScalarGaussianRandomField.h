@@ -32,6 +32,7 @@
 #include <uqScalarCovarianceFunction.h>
 #include <uqScalarFunction.h>
 #include <uqVectorRV.h>
+#include <uqGaussianRandomFieldSampler.h>
 
 /*! 
  * \file uqScalarGaussianRandomField.h
@@ -84,10 +85,18 @@ class uqScalarGaussianRandomFieldClass
   //! Covariance function; access to protected attribute m_covarianceFunction.
   const uqBaseScalarCovarianceFunctionClass<V,M>& covarianceFunction() const;
   
+  //! Sampler of the last field positions; access to protected attribute m_savedSampler.
+  /*! It tells whether circulant embedding is used (see uqGaussianRandomFieldSamplerClass::usesCirculantEmbedding()).
+   * NULL before the first call to sampleFunction().*/
+  const uqGaussianRandomFieldSamplerClass<V,M>* sampler() const;
+
   //! Function that samples from a Gaussian PDF.
   /*! Given the field positions, this method performs a number of tests, calculates the mean vector,
-   * the covariance matrix and then it samples from a Gaussian random vector as 
-   * many positions as required.*/
+   * factorizes the covariance and then it samples from a Gaussian random vector as
+   * many positions as required. The mean and the factorization are kept for as long as the
+   * positions do not change. Positions on a regular grid, with a stationary covariance function,
+   * are sampled by circulant embedding; other positions use a truncated Karhunen-Loeve expansion
+   * (see uqGaussianRandomFieldSamplerClass).*/
   void                                  sampleFunction(const std::vector<V*>& fieldPositions, V& sampleValues);
   //@}
   
@@ -119,11 +128,8 @@ protected:
   //! Vector of the mean value of the RV.
   V*                                    m_savedRvLawExpVector;
   
-  //! Covariance matrix of the RV.
-  M*                                    m_savedRvLawCovMatrix;
-  
-  //! My RV.
-  uqGaussianVectorRVClass<V,M>*         m_savedRv;
+  //! Sampler of the zero mean part of the RV.
+  uqGaussianRandomFieldSamplerClass<V,M>* m_savedSampler;
 };
 
 // Default constructor -----------------------------
@@ -141,8 +147,7 @@ uqScalarGaussianRandomFieldClass<V,M>::uqScalarGaussianRandomFieldClass(
   m_covarianceFunction (covarianceFunction),
   m_savedRvImageSpace  (NULL),
   m_savedRvLawExpVector(NULL),
-  m_savedRvLawCovMatrix(NULL),
-  m_savedRv            (NULL)
+  m_savedSampler       (NULL)
 {
   m_savedPositions.clear();
 }
@@ -150,6 +155,12 @@ uqScalarGaussianRandomFieldClass<V,M>::uqScalarGaussianRandomFieldClass(
 template <class V, class M>
 uqScalarGaussianRandomFieldClass<V,M>::~uqScalarGaussianRandomFieldClass()
 {
+  delete m_savedSampler;
+  delete m_savedRvLawExpVector;
+  delete m_savedRvImageSpace;
+  for (unsigned int i = 0; i < m_savedPositions.size(); ++i) {
+    delete m_savedPositions[i];
+  }
 }
 // Math methods -------------------------------------
 template <class V, class M>
@@ -174,6 +185,13 @@ uqScalarGaussianRandomFieldClass<V,M>::covarianceFunction() const
 }
 // --------------------------------------------------
 template <class V, class M>
+const uqGaussianRandomFieldSamplerClass<V,M>*
+uqScalarGaussianRandomFieldClass<V,M>::sampler() const
+{
+  return m_savedSampler;
+}
+// --------------------------------------------------
+template <class V, class M>
 void
 uqScalarGaussianRandomFieldClass<V,M>::sampleFunction(const std::vector<V*>& fieldPositions, V& sampleValues)
 {
@@ -190,15 +208,13 @@ uqScalarGaussianRandomFieldClass<V,M>::sampleFunction(const std::vector<V*>& fie
   if ((m_savedPositions.size() == 0   ) &&
       (m_savedRvImageSpace     == NULL) &&
       (m_savedRvLawExpVector   == NULL) &&
-      (m_savedRvLawCovMatrix   == NULL) &&
-      (m_savedRv               == NULL)) {
+      (m_savedSampler          == NULL)) {
     // Ok
   }
   else if ((m_savedPositions.size() != 0   ) &&
            (m_savedRvImageSpace     != NULL) &&
            (m_savedRvLawExpVector   != NULL) &&
-           (m_savedRvLawCovMatrix   != NULL) &&
-           (m_savedRv               != NULL)) {
+           (m_savedSampler          != NULL)) {
     // Ok
   }
   else {
@@ -230,8 +246,7 @@ uqScalarGaussianRandomFieldClass<V,M>::sampleFunction(const std::vector<V*>& fie
   }
 
   if (instantiate) {
-    delete m_savedRv;
-    delete m_savedRvLawCovMatrix;
+    delete m_savedSampler;
     delete m_savedRvLawExpVector;
     delete m_savedRvImageSpace;
     for (unsigned int i = 0; i < m_savedPositions.size(); ++i) {
@@ -254,34 +269,70 @@ uqScalarGaussianRandomFieldClass<V,M>::sampleFunction(const std::vector<V*>& fie
       (*m_savedRvLawExpVector)[i] = m_meanFunction.actualValue(*(fieldPositions[i]),NULL,NULL,NULL,NULL);
     }
 
-    // Set m_savedRvLawCovMatrix
-    m_savedRvLawCovMatrix = new M(m_savedRvImageSpace->zeroVector());
-    for (unsigned int i = 0; i < numberOfPositions; ++i) {
-      for (unsigned int j = 0; j < numberOfPositions; ++j) {
-        (*m_savedRvLawCovMatrix)(i,j) = m_covarianceFunction.value(*(fieldPositions[i]),*(fieldPositions[j]));
-        if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 3)) {
-          *m_env.subDisplayFile() << "In uqScalarGaussianRandomFieldClass<V,M>::sampleFunction()"
-                                  << ": i = " << i
-                                  << ", j = " << j
-                                  << ", *(fieldPositions[i]) = " << *(fieldPositions[i])
-                                  << ", *(fieldPositions[j]) = " << *(fieldPositions[j])
-                                  << ", (*m_savedRvLawCovMatrix)(i,j) = " << (*m_savedRvLawCovMatrix)(i,j)
-                                  << std::endl;
+    // Set m_savedSampler
+    m_savedSampler = new uqGaussianRandomFieldSamplerClass<V,M>(*m_savedRvImageSpace,NULL);
+
+    std::vector<unsigned int> gridCounts (0);
+    std::vector<double>       gridSpacings(0);
+    std::vector<unsigned int> gridIndices(0);
+    bool usesCirculantEmbedding = false;
+    if (m_covarianceFunction.isStationary() &&
+        uqGaussianRandomFieldSamplerClass<V,M>::regularGrid(fieldPositions,gridCounts,gridSpacings,gridIndices)) {
+      // Only the covariances between the grid corner and the lags of the embedding are needed
+      unsigned int cornerPos = 0;
+      while (gridIndices[cornerPos] != 0) ++cornerPos;
+      const V& corner = *(fieldPositions[cornerPos]);
+      V lagPosition(corner);
+
+      std::vector<unsigned int> counts      (0);
+      std::vector<int>          lag         (0);
+      std::vector<double>       embeddedCovs(0);
+      for (unsigned int refinement = 1;
+           (refinement <= UQ_GRF_SAMPLER_MAX_EMBEDDING_REFINEMENT) && !usesCirculantEmbedding;
+           refinement *= 2) {
+        uqGaussianRandomFieldSamplerClass<V,M>::embeddingCounts(gridCounts,refinement,counts);
+        unsigned int numEmbeddingPoints = 1;
+        for (unsigned int d = 0; d < counts.size(); ++d) {
+          numEmbeddingPoints *= counts[d];
         }
+        embeddedCovs.resize(numEmbeddingPoints,0.);
+        for (unsigned int e = 0; e < numEmbeddingPoints; ++e) {
+          uqGaussianRandomFieldSamplerClass<V,M>::embeddingLag(e,counts,lag);
+          for (unsigned int d = 0; d < lag.size(); ++d) {
+            lagPosition[d] = corner[d] + ((double) lag[d])*gridSpacings[d];
+          }
+          embeddedCovs[e] = m_covarianceFunction.value(lagPosition,corner);
+        }
+        usesCirculantEmbedding = m_savedSampler->setCirculantEmbedding(gridCounts,gridIndices,counts,embeddedCovs);
       }
     }
 
-    // Set m_savedRv
-    m_savedRv = new uqGaussianVectorRVClass<V,M>("grf_",
-                                                 *m_savedRvImageSpace,
-                                                 *m_savedRvLawExpVector,
-                                                 *m_savedRvLawCovMatrix);
+    if (!usesCirculantEmbedding) {
+      M covMatrix(m_savedRvImageSpace->zeroVector());
+      for (unsigned int i = 0; i < numberOfPositions; ++i) {
+        for (unsigned int j = i; j < numberOfPositions; ++j) {
+          covMatrix(i,j) = m_covarianceFunction.value(*(fieldPositions[i]),*(fieldPositions[j]));
+          covMatrix(j,i) = covMatrix(i,j);
+          if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 3)) {
+            *m_env.subDisplayFile() << "In uqScalarGaussianRandomFieldClass<V,M>::sampleFunction()"
+                                    << ": i = " << i
+                                    << ", j = " << j
+                                    << ", *(fieldPositions[i]) = " << *(fieldPositions[i])
+                                    << ", *(fieldPositions[j]) = " << *(fieldPositions[j])
+                                    << ", covMatrix(i,j) = "       << covMatrix(i,j)
+                                    << std::endl;
+          }
+        }
+      }
+      m_savedSampler->setKarhunenLoeve(covMatrix);
+    }
 
     if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 3)) {
       *m_env.subDisplayFile() << "In uqScalarGaussianRandomFieldClass<V,M>::sampleFunction()"
-                              << ": just instantiated Gaussian RV"
+                              << ": just set up sampler"
+                              << ", usesCirculantEmbedding = " << m_savedSampler->usesCirculantEmbedding()
+                              << ", numModes = "               << m_savedSampler->numModes()
                               << "\n *m_savedRvLawExpVector = " << *m_savedRvLawExpVector
-                              << "\n *m_savedRvLawCovMatrix = " << *m_savedRvLawCovMatrix
                               << std::endl;
       for (unsigned int i = 0; i < numberOfPositions; ++i) {
         *m_env.subDisplayFile() << " *(m_savedPositions[" << i
@@ -297,7 +348,8 @@ uqScalarGaussianRandomFieldClass<V,M>::sampleFunction(const std::vector<V*>& fie
                             << ": about to realize sample values"
                             << std::endl;
   }
-  m_savedRv->realizer().realization(sampleValues);
+  m_savedSampler->realization(sampleValues);
+  sampleValues += *m_savedRvLawExpVector;
   if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 99)) {
     *m_env.subDisplayFile() << "In uqScalarGaussianRandomFieldClass<V,M>::sampleFunction()"
                             << ": just realized sample values"
@@ -0,0 +1,847 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+// 
+// QUESO - a library to support the Quantification of Uncertainty
+// for Estimation, Simulation and Optimization
+//
+// Copyright (C) 2008,2009,2010,2011,2012,2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor, 
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+// 
+// $Id$
+//
+//--------------------------------------------------------------------------
+
+#ifndef __UQ_SPARSE_GRID_COLLOCATION_H__
+#define __UQ_SPARSE_GRID_COLLOCATION_H__
+
+#include <uqVectorRV.h>
+#include <uqVectorFunction.h>
+#include <uqVectorFunctionSynchronizer.h>
+#include <uqVectorRealizer.h>
+#include <uq1DQuadrature.h>
+#include <uqSparseGridCollocationOptions.h>
+#include <map>
+#include <set>
+
+/*!
+ * \file uqSparseGridCollocation.h
+ * \brief A templated class that implements sparse grid stochastic collocation.
+ *
+ * \class uqSparseGridCollocationClass
+ * \brief A templated class that implements sparse grid stochastic collocation.
+ *
+ * This class computes the mean and the variance of the QoI of a statistical forward problem
+ * with a Smolyak sparse grid, assembled by the combination technique out of tensor products of
+ * one-dimensional quadrature rules: the nested Clenshaw-Curtis rules (with \f$ 1, 3, 5, 9, 17, \ldots \f$
+ * abscissas) when the image set of the parameter RV is a bounded box, and Gauss-Hermite rules
+ * (with \f$ 1, 3, 5, 7, \ldots \f$ abscissas, computed with the Golub-Welsch algorithm when not tabulated)
+ * when the parameter RV is a Gaussian with diagonal covariance matrix. On a box, the QoI is weighted
+ * by the density of the parameter RV at each abscissa, so any density can be used there.\n
+ *
+ * The grid is described by a downward closed set of multi-indices \f$ k \f$, each one contributing the
+ * difference \f$ \Delta_k = \bigotimes_i (Q_{k_i} - Q_{k_i - 1}) \f$ of tensor rules. In isotropic mode
+ * the set holds all \f$ k \f$ with \f$ \sum_i (k_i - 1) \le \f$ 'maxLevel'. In adaptive mode (Gerstner
+ * and Griebel's dimension-adaptive algorithm) the multi-index with the largest contribution is refined
+ * at each step, until the sum of the contributions of the refinement candidates drops below 'tolerance'.
+ * Both modes stop before the number of QoI evaluations exceeds 'maxNumPoints'. The QoI evaluations of
+ * each refinement step are spread over the sub-environments.\n
+ *
+ * After 'solve()', 'surrogateValue()' evaluates the sparse grid (Lagrange) interpolant of the QoI,
+ * which is what 'uqSparseGridVectorRealizerClass' uses to draw cheap QoI realizations. Options
+ * reading is handled by class 'uqSparseGridCollocationOptionsClass'. */
+
+template <class P_V,class P_M,class Q_V,class Q_M>
+class uqSparseGridCollocationClass
+{
+public:
+  //! @name Constructor/Destructor methods
+  //@{
+  //! Constructor.
+  /*! Requirements: the image set of the vector random variable 'paramRv' and the domain set of the
+   * QoI function 'qoiFunction' should belong to vector spaces of equal dimensions. The constructor
+   * reads input options that begin with the string '\<prefix\>sgc_'. */
+  uqSparseGridCollocationClass(const char*                                       prefix,
+                               const uqSgcOptionsValuesClass*                    alternativeOptionsValues,
+                               const uqBaseVectorRVClass      <P_V,P_M>&         paramRv,
+                               const uqBaseVectorFunctionClass<P_V,P_M,Q_V,Q_M>& qoiFunction);
+
+  //! Destructor
+  ~uqSparseGridCollocationClass();
+  //@}
+
+  //! @name Statistical methods
+  //@{
+  //! Builds the sparse grid, evaluating the QoI function at all its abscissas.
+  void         solve          ();
+
+  //! Mean of the QoI, computed by the last call to 'solve()'.
+  const Q_V&   qoiMean        () const;
+
+  //! Variance of the QoI, computed by the last call to 'solve()'.
+  const Q_V&   qoiVariance    () const;
+
+  //! Number of QoI function evaluations performed by the last call to 'solve()'.
+  unsigned int numPoints      () const;
+
+  //! Evaluates the sparse grid interpolant of the QoI at \c paramValues.
+  void         surrogateValue (const P_V& paramValues, Q_V& qoiValues) const;
+  //@}
+
+  //! @name I/O methods
+  //@{
+  //! Prints the number of evaluations and the QoI moments.
+  void         print          (std::ostream& os) const;
+  //@}
+
+private:
+  typedef std::vector<unsigned int> uqSgcMultiIndexType;
+
+  struct uqSgcIndexDataStruct {
+    bool                isActive;
+    double              errorIndicator;
+    std::vector<double> deltas; // [0,q): Q(f rho), [q,2q): Q(f^2 rho), [2q]: Q(rho)
+  };
+
+  //! Computes the abscissas (as ids of unique nodes) and weights of the rule of dimension \c dimId and level \c level.
+  void   buildRule            (unsigned int dimId, unsigned int level);
+
+  //! Whether all backward neighbours of \c index are refined (not active) members of the index set.
+  bool   isAdmissible         (const uqSgcMultiIndexType& index) const;
+
+  //! Collects the grid points of the tensor rules \c indices that have not been evaluated yet.
+  void   collectNewPoints     (const std::vector<uqSgcMultiIndexType>& indices,
+                                     std::vector<uqSgcMultiIndexType>& newPoints) const;
+
+  //! Evaluates the QoI function (and the parameter density) at \c newPoints, in parallel over the sub-environments.
+  void   evaluatePoints       (const std::vector<uqSgcMultiIndexType>& newPoints);
+
+  //! Applies the tensor rule of \c index to the QoI, to its square and to the density.
+  void   tensorQuadrature     (const uqSgcMultiIndexType& index, std::vector<double>& sums) const;
+
+  //! Adds \c index to the set of active multi-indices, computing its contribution.
+  void   addIndex             (const uqSgcMultiIndexType& index);
+
+  const uqBaseEnvironmentClass&                             m_env;
+  const uqBaseVectorRVClass              <P_V,P_M>&         m_paramRv;
+  const uqBaseVectorFunctionClass        <P_V,P_M,Q_V,Q_M>& m_qoiFunction;
+  const uqVectorSpaceClass               <P_V,P_M>&         m_paramSpace;
+  const uqVectorSpaceClass               <Q_V,Q_M>&         m_qoiSpace;
+  const uqVectorFunctionSynchronizerClass<P_V,P_M,Q_V,Q_M>* m_qoiFunctionSynchronizer;
+        unsigned int                                        m_paramDim;
+        unsigned int                                        m_qoiDim;
+
+        bool                                                m_useGaussHermite;
+        std::vector<double>                                 m_paramMins;    // Box:      min values
+        std::vector<double>                                 m_paramMaxs;    // Box:      max values
+        std::vector<double>                                 m_paramMeans;   // Gaussian: means
+        std::vector<double>                                 m_paramStdDevs; // Gaussian: standard deviations
+
+        std::vector<std::vector<double> >                                 m_nodes;       // [dimId][nodeId]
+        std::vector<std::vector<std::vector<unsigned int> > >             m_ruleNodeIds; // [dimId][level][i]
+        std::vector<std::vector<std::vector<double> > >                   m_ruleWeights; // [dimId][level][i]
+
+        std::map<uqSgcMultiIndexType,unsigned int>                        m_pointIds;
+        std::vector<double>                                               m_qoiValues;     // [pointId*m_qoiDim + j]
+        std::vector<double>                                               m_densityValues; // [pointId]
+
+        std::map<uqSgcMultiIndexType,uqSgcIndexDataStruct>                m_indices;
+        std::vector<uqSgcMultiIndexType>                                  m_combinationIndices;
+        std::vector<double>                                               m_combinationCoefs;
+
+        Q_V*                                                m_qoiMean;
+        Q_V*                                                m_qoiVariance;
+
+        uqSgcOptionsValuesClass                             m_alternativeOptionsValues;
+        uqSparseGridCollocationOptionsClass*                m_optionsObj;
+};
+
+//! Prints the object \c obj, overloading an operator.
+template<class P_V,class P_M,class Q_V,class Q_M>
+std::ostream& operator<<(std::ostream& os, const uqSparseGridCollocationClass<P_V,P_M,Q_V,Q_M>& obj);
+
+// Default constructor -----------------------------
+template <class P_V,class P_M,class Q_V,class Q_M>
+uqSparseGridCollocationClass<P_V,P_M,Q_V,Q_M>::uqSparseGridCollocationClass(
+  /*! Prefix                     */ const char*                                       prefix,
+  /*! Options (if no input file) */ const uqSgcOptionsValuesClass*                    alternativeOptionsValues,
+  /*! The parameter RV           */ const uqBaseVectorRVClass      <P_V,P_M>&         paramRv,
+  /*! The QoI function           */ const uqBaseVectorFunctionClass<P_V,P_M,Q_V,Q_M>& qoiFunction)
+  :
+  m_env                     (paramRv.env()),
+  m_paramRv                 (paramRv),
+  m_qoiFunction             (qoiFunction),
+  m_paramSpace              (m_paramRv.imageSet().vectorSpace()),
+  m_qoiSpace                (m_qoiFunction.imageSet().vectorSpace()),
+  m_qoiFunctionSynchronizer (new uqVectorFunctionSynchronizerClass<P_V,P_M,Q_V,Q_M>(m_qoiFunction,m_paramRv.imageSet().vectorSpace().zeroVector(),m_qoiFunction.imageSet().vectorSpace().zeroVector())),
+  m_paramDim                (m_paramSpace.dimLocal()),
+  m_qoiDim                  (m_qoiSpace.dimLocal()),
+  m_useGaussHermite         (false),
+  m_paramMins               (0),
+  m_paramMaxs               (0),
+  m_paramMeans              (0),
+  m_paramStdDevs            (0),
+  m_nodes                   (m_paramDim),
+  m_ruleNodeIds             (m_paramDim),
+  m_ruleWeights             (m_paramDim),
+  m_pointIds                (),
+  m_qoiValues               (0),
+  m_densityValues           (0),
+  m_indices                 (),
+  m_combinationIndices      (0),
+  m_combinationCoefs        (0),
+  m_qoiMean                 (m_qoiSpace.newVector(0.)),
+  m_qoiVariance             (m_qoiSpace.newVector(0.)),
+  m_alternativeOptionsValues(),
+  m_optionsObj              (NULL)
+{
+  if (m_env.subDisplayFile()) {
+    *m_env.subDisplayFile() << "Entering uqSparseGridCollocationClass<P_V,P_M,Q_V,Q_M>::constructor()"
+                            << ": prefix = " << prefix
+                            << ", alternativeOptionsValues = " << alternativeOptionsValues
+                            << ", m_env.optionsInputFileName() = " << m_env.optionsInputFileName()
+                            << std::endl;
+  }
+
+  if (alternativeOptionsValues) m_alternativeOptionsValues = *alternativeOptionsValues;
+  if (m_env.optionsInputFileName() == "") {
+    m_optionsObj = new uqSparseGridCollocationOptionsClass(m_env,prefix,m_alternativeOptionsValues);
+  }
+  else {
+    m_optionsObj = new uqSparseGridCollocationOptionsClass(m_env,prefix);
+    m_optionsObj->scanOptionsValues();
+  }
+
+  UQ_FATAL_TEST_MACRO(paramRv.imageSet().vectorSpace().dimLocal() != qoiFunction.domainSet().vectorSpace().dimLocal(),
+                      m_env.worldRank(),
+                      "uqSparseGridCollocationClass<P_V,P_M,Q_V,Q_M>::constructor()",
+                      "'paramRv' and 'qoiFunction' are related to vector spaces of different dimensions");
+
+  UQ_FATAL_TEST_MACRO(m_paramSpace.zeroVector().numOfProcsForStorage() != 1,
+                      m_env.worldRank(),
+                      "uqSparseGridCollocationClass<P_V,P_M,Q_V,Q_M>::constructor()",
+                      "parallel vectors not supported yet");
+
+  // Choose the one-dimensional rules according to the parameter RV
+  const uqGaussianJointPdfClass<P_V,P_M>* gaussianPdf = dynamic_cast<const uqGaussianJointPdfClass<P_V,P_M>* >(&m_paramRv.pdf());
+  const uqBoxSubsetClass       <P_V,P_M>* imageBox    = dynamic_cast<const uqBoxSubsetClass       <P_V,P_M>* >(&m_paramRv.imageSet());
+  if (gaussianPdf) {
+    m_useGaussHermite = true;
+    m_paramMeans.resize  (m_paramDim,0.);
+    m_paramStdDevs.resize(m_paramDim,0.);
+    for (unsigned int i = 0; i < m_paramDim; ++i) {
+      m_paramMeans[i] = gaussianPdf->lawExpVector()[i];
+      UQ_FATAL_TEST_MACRO((gaussianPdf->lawVarVector()[i] == INFINITY) || (gaussianPdf->lawVarVector()[i] <= 0.),
+                          m_env.worldRank(),
+                          "uqSparseGridCollocationClass<P_V,P_M,Q_V,Q_M>::constructor()",
+                          "only Gaussian parameters with diagonal covariance matrix are supported");
+      m_paramStdDevs[i] = sqrt(gaussianPdf->lawVarVector()[i]);
+    }
+  }
+  else {
+    UQ_FATAL_TEST_MACRO(imageBox == NULL,
+                        m_env.worldRank(),
+                        "uqSparseGridCollocationClass<P_V,P_M,Q_V,Q_M>::constructor()",
+                        "parameter RV should be Gaussian or have a box as image set");
+    m_paramMins.resize(m_paramDim,0.);
+    m_paramMaxs.resize(m_paramDim,0.);
+    for (unsigned int i = 0; i < m_paramDim; ++i) {
+      m_paramMins[i] = imageBox->minValues()[i];
+      m_paramMaxs[i] = imageBox->maxValues()[i];
+      UQ_FATAL_TEST_MACRO((m_paramMins[i] == -INFINITY) || (m_paramMaxs[i] == INFINITY),
+                          m_env.worldRank(),
+                          "uqSparseGridCollocationClass<P_V,P_M,Q_V,Q_M>::constructor()",
+                          "image box of parameter RV should be bounded");
+    }
+  }
+
+  if (m_env.subDisplayFile()) {
+    *m_env.subDisplayFile() << "Leaving uqSparseGridCollocationClass<P_V,P_M,Q_V,Q_M>::constructor()"
+                            << ": m_useGaussHermite = " << m_useGaussHermite
+                            << std::endl;
+  }
+}
+// Destructor ---------------------------------------
+template <class P_V,class P_M,class Q_V,class Q_M>
+uqSparseGridCollocationClass<P_V,P_M,Q_V,Q_M>::~uqSparseGridCollocationClass()
+{
+  if (m_qoiVariance            ) delete m_qoiVariance;
+  if (m_qoiMean                ) delete m_qoiMean;
+  if (m_optionsObj             ) delete m_optionsObj;
+  if (m_qoiFunctionSynchronizer) delete m_qoiFunctionSynchronizer;
+}
+// Statistical methods ------------------------------
+template <class P_V,class P_M,class Q_V,class Q_M>
+void
+uqSparseGridCollocationClass<P_V,P_M,Q_V,Q_M>::solve()
+{
+  struct timeval timevalSolve;
+  int iRC = gettimeofday(&timevalSolve, NULL);
+  if (iRC) {}; // just to remove compiler warning
+
+  m_pointIds.clear();
+  m_qoiValues.clear();
+  m_densityValues.clear();
+  m_indices.clear();
+
+  // Start from the one point grid
+  std::vector<uqSgcMultiIndexType> candidates(1,uqSgcMultiIndexType(m_paramDim,1));
+  std::vector<uqSgcMultiIndexType> newPoints(0);
+  for (unsigned int i = 0; i < m_paramDim; ++i) {
+    this->buildRule(i,1);
+  }
+  this->collectNewPoints(candidates,newPoints);
+  this->evaluatePoints  (newPoints);
+  this->addIndex        (candidates[0]);
+
+  unsigned int numSteps = 0;
+  while (true) {
+    // Select the active multi-index to refine next
+    typename std::map<uqSgcMultiIndexType,uqSgcIndexDataStruct>::iterator selectedIt = m_indices.end();
+    unsigned int selectedLevel    = 0;
+    double       activeIndicators = 0.;
+    for (typename std::map<uqSgcMultiIndexType,uqSgcIndexDataStruct>::iterator it = m_indices.begin(); it != m_indices.end(); ++it) {
+      if (it->second.isActive == false) continue;
+      activeIndicators += it->second.errorIndicator;
+      unsigned int level = 0;
+      for (unsigned int i = 0; i < m_paramDim; ++i) level += it->first[i] - 1;
+      if ((selectedIt == m_indices.end()) ||
+          ( m_optionsObj->m_ov.m_adaptive && (it->second.errorIndicator > selectedIt->second.errorIndicator)) ||
+          (!m_optionsObj->m_ov.m_adaptive && (level                     < selectedLevel                    ))) {
+        selectedIt    = it;
+        selectedLevel = level;
+      }
+    }
+    if (selectedIt == m_indices.end()) break;
+    if (m_optionsObj->m_ov.m_adaptive && (activeIndicators <= m_optionsObj->m_ov.m_tolerance)) break;
+
+    selectedIt->second.isActive = false;
+    numSteps++;
+
+    // Collect the admissible forward neighbours of the selected multi-index
+    candidates.clear();
+    for (unsigned int i = 0; i < m_paramDim; ++i) {
+      uqSgcMultiIndexType candidate(selectedIt->first);
+      candidate[i]++;
+      if (m_optionsObj->m_ov.m_adaptive) {
+        if (candidate[i] - 1 > m_optionsObj->m_ov.m_maxLevel) continue;
+      }
+      else {
+        if (selectedLevel + 1 > m_optionsObj->m_ov.m_maxLevel) continue;
+      }
+      if (m_indices.find(candidate) != m_indices.end()) continue;
+      if (this->isAdmissible(candidate) == false) continue;
+      this->buildRule(i,candidate[i]);
+      candidates.push_back(candidate);
+    }
+    if (candidates.size() == 0) continue;
+
+    this->collectNewPoints(candidates,newPoints);
+    if (m_pointIds.size() + newPoints.size() > m_optionsObj->m_ov.m_maxNumPoints) {
+      if (m_env.subDisplayFile()) {
+        *m_env.subDisplayFile() << "In uqSparseGridCollocationClass<P_V,P_M,Q_V,Q_M>::solve()"
+                                << ": stopping refinement, since " << newPoints.size()
+                                << " more points would exceed maxNumPoints = " << m_optionsObj->m_ov.m_maxNumPoints
+                                << std::endl;
+      }
+      break;
+    }
+    this->evaluatePoints(newPoints);
+    for (unsigned int j = 0; j < candidates.size(); ++j) {
+      this->addIndex(candidates[j]);
+    }
+
+    if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 2)) {
+      *m_env.subDisplayFile() << "In uqSparseGridCollocationClass<P_V,P_M,Q_V,Q_M>::solve()"
+                              << ": step "                   << numSteps
+                              << ", numIndices = "           << m_indices.size()
+                              << ", numPoints = "            << m_pointIds.size()
+                              << ", sum of active errors = " << activeIndicators
+                              << std::endl;
+    }
+  }
+
+  // Moments: sum of the contributions of all multi-indices
+  std::vector<double> sums(2*m_qoiDim+1,0.);
+  for (typename std::map<uqSgcMultiIndexType,uqSgcIndexDataStruct>::const_iterator it = m_indices.begin(); it != m_indices.end(); ++it) {
+    for (unsigned int j = 0; j < sums.size(); ++j) {
+      sums[j] += it->second.deltas[j];
+    }
+  }
+  UQ_FATAL_TEST_MACRO(sums[2*m_qoiDim] <= 0.,
+                      m_env.worldRank(),
+                      "uqSparseGridCollocationClass<P_V,P_M,Q_V,Q_M>::solve()",
+                      "parameter density integrates to a non positive value");
+  for (unsigned int j = 0; j < m_qoiDim; ++j) {
+    double mean = sums[j]/sums[2*m_qoiDim];
+    (*m_qoiMean    )[j] = mean;
+    (*m_qoiVariance)[j] = std::max(sums[m_qoiDim+j]/sums[2*m_qoiDim] - mean*mean,0.);
+  }
+
+  // Combination coefficients of the interpolant: c_k = sum of (-1)^|z| over z in {0,1}^d with k+z in the index set
+  m_combinationIndices.clear();
+  m_combinationCoefs.clear();
+  for (typename std::map<uqSgcMultiIndexType,uqSgcIndexDataStruct>::const_iterator it = m_indices.begin(); it != m_indices.end(); ++it) {
+    std::vector<unsigned int> forwardDims(0);
+    for (unsigned int i = 0; i < m_paramDim; ++i) {
+      uqSgcMultiIndexType neighbour(it->first);
+      neighbour[i]++;
+      if (m_indices.find(neighbour) != m_indices.end()) forwardDims.push_back(i);
+    }
+    double coef = 0.;
+    for (unsigned int mask = 0; mask < (1u << forwardDims.size()); ++mask) {
+      uqSgcMultiIndexType neighbour(it->first);
+      double sign = 1.;
+      for (unsigned int b = 0; b < forwardDims.size(); ++b) {
+        if (mask & (1u << b)) {
+          neighbour[forwardDims[b]]++;
+          sign = -sign;
+        }
+      }
+      if (m_indices.find(neighbour) != m_indices.end()) coef += sign;
+    }
+    if (coef != 0.) {
+      m_combinationIndices.push_back(it->first);
+      m_combinationCoefs.push_back(coef);
+    }
+  }
+
+  if (m_env.subDisplayFile()) {
+    *m_env.subDisplayFile() << "In uqSparseGridCollocationClass<P_V,P_M,Q_V,Q_M>::solve()"
+                            << ": finished after " << numSteps << " refinement steps"
+                            << ", in " << uqMiscGetEllapsedSeconds(&timevalSolve) << " seconds"
+                            << "\n" << *this
+                            << std::endl;
+  }
+
+  return;
+}
+//--------------------------------------------------
+template <class P_V,class P_M,class Q_V,class Q_M>
+const Q_V&
+uqSparseGridCollocationClass<P_V,P_M,Q_V,Q_M>::qoiMean() const
+{
+  return *m_qoiMean;
+}
+//--------------------------------------------------
+template <class P_V,class P_M,class Q_V,class Q_M>
+const Q_V&
+uqSparseGridCollocationClass<P_V,P_M,Q_V,Q_M>::qoiVariance() const
+{
+  return *m_qoiVariance;
+}
+//--------------------------------------------------
+template <class P_V,class P_M,class Q_V,class Q_M>
+unsigned int
+uqSparseGridCollocationClass<P_V,P_M,Q_V,Q_M>::numPoints() const
+{
+  return m_pointIds.size();
+}
+//--------------------------------------------------
+template <class P_V,class P_M,class Q_V,class Q_M>
+void
+uqSparseGridCollocationClass<P_V,P_M,Q_V,Q_M>::surrogateValue(
+  const P_V& paramValues,
+        Q_V& qoiValues) const
+{
+  UQ_FATAL_TEST_MACRO(m_combinationIndices.size() == 0,
+                      m_env.worldRank(),
+                      "uqSparseGridCollocationClass<P_V,P_M,Q_V,Q_M>::surrogateValue()",
+                      "solve() has not been called");
+
+  // Lagrange basis values at 'paramValues', per dimension and level
+  std::vector<std::vector<std::vector<double> > > basisValues(m_paramDim);
+  for (unsigned int i = 0; i < m_paramDim; ++i) {
+    basisValues[i].resize(m_ruleNodeIds[i].size());
+    for (unsigned int level = 1; level < m_ruleNodeIds[i].size(); ++level) {
+      const std::vector<unsigned int>& nodeIds = m_ruleNodeIds[i][level];
+      if (nodeIds.size() == 0) continue;
+      basisValues[i][level].resize(nodeIds.size(),1.);
+      for (unsigned int a = 0; a < nodeIds.size(); ++a) {
+        double xa = m_nodes[i][nodeIds[a]];
+        for (unsigned int b = 0; b < nodeIds.size(); ++b) {
+          if (b == a) continue;
+          double xb = m_nodes[i][nodeIds[b]];
+          basisValues[i][level][a] *= (paramValues[i] - xb)/(xa - xb);
+        }
+      }
+    }
+  }
+
+  std::vector<double> values(m_qoiDim,0.);
+  uqSgcMultiIndexType point(m_paramDim,0);
+  std::vector<unsigned int> counter(m_paramDim,0);
+  for (unsigned int c = 0; c < m_combinationIndices.size(); ++c) {
+    const uqSgcMultiIndexType& index = m_combinationIndices[c];
+    counter.assign(m_paramDim,0);
+    bool finished = false;
+    while (!finished) {
+      double basisProduct = m_combinationCoefs[c];
+      for (unsigned int i = 0; i < m_paramDim; ++i) {
+        point[i]      = m_ruleNodeIds[i][index[i]][counter[i]];
+        basisProduct *= basisValues[i][index[i]][counter[i]];
+      }
+      unsigned int pointId = m_pointIds.find(point)->second;
+      for (unsigned int j = 0; j < m_qoiDim; ++j) {
+        values[j] += basisProduct*m_qoiValues[pointId*m_qoiDim + j];
+      }
+
+      finished = true;
+      for (unsigned int i = 0; i < m_paramDim; ++i) {
+        if (++counter[i] < m_ruleNodeIds[i][index[i]].size()) {
+          finished = false;
+          break;
+        }
+        counter[i] = 0;
+      }
+    }
+  }
+
+  for (unsigned int j = 0; j < m_qoiDim; ++j) {
+    qoiValues[j] = values[j];
+  }
+
+  return;
+}
+// Private methods ----------------------------------
+template <class P_V,class P_M,class Q_V,class Q_M>
+void
+uqSparseGridCollocationClass<P_V,P_M,Q_V,Q_M>::buildRule(
+  unsigned int dimId,
+  unsigned int level)
+{
+  if ((level < m_ruleNodeIds[dimId].size()) && (m_ruleNodeIds[dimId][level].size() > 0)) return;
+  if (level >= m_ruleNodeIds[dimId].size()) {
+    m_ruleNodeIds[dimId].resize(level+1);
+    m_ruleWeights[dimId].resize(level+1);
+  }
+
+  std::vector<double> positions(0);
+  std::vector<double> weights  (0);
+  if (m_useGaussHermite) {
+    // Level 'l' has 2l-1 abscissas, so that the center is shared by all levels
+    uqGaussianHermite1DQuadratureClass quadrature(0.,1.,2*(level-1));
+    positions = quadrature.positions();
+    weights   = quadrature.weights();
+    for (unsigned int a = 0; a < positions.size(); ++a) {
+      positions[a] = m_paramMeans[dimId] + m_paramStdDevs[dimId]*positions[a];
+      weights  [a] /= sqrt(2.*M_PI);
+    }
+  }
+  else {
+    // Level 'l' has 2^(l-1)+1 abscissas (one if l = 1), so that levels are nested
+    unsigned int order = (level == 1) ? 0 : (1u << (level-1));
+    uqClenshawCurtis1DQuadratureClass quadrature(m_paramMins[dimId],m_paramMaxs[dimId],order,false);
+    positions = quadrature.positions();
+    weights   = quadrature.weights();
+  }
+
+  // Identify abscissas shared with other levels, so that the QoI is evaluated only once at each point
+  std::vector<double>& nodes = m_nodes[dimId];
+  m_ruleNodeIds[dimId][level].resize(positions.size(),0);
+  m_ruleWeights[dimId][level] = weights;
+  for (unsigned int a = 0; a < positions.size(); ++a) {
+    double tolerance = 1.e-12*std::max(1.,fabs(positions[a]));
+    unsigned int nodeId = 0;
+    for (nodeId = 0; nodeId < nodes.size(); ++nodeId) {
+      if (fabs(nodes[nodeId] - positions[a]) <= tolerance) break;
+    }
+    if (nodeId == nodes.size()) nodes.push_back(positions[a]);
+    m_ruleNodeIds[dimId][level][a] = nodeId;
+  }
+
+  return;
+}
+//--------------------------------------------------
+template <class P_V,class P_M,class Q_V,class Q_M>
+bool
+uqSparseGridCollocationClass<P_V,P_M,Q_V,Q_M>::isAdmissible(const uqSgcMultiIndexType& index) const
+{
+  for (unsigned int i = 0; i < m_paramDim; ++i) {
+    if (index[i] == 1) continue;
+    uqSgcMultiIndexType backwardNeighbour(index);
+    backwardNeighbour[i]--;
+    typename std::map<uqSgcMultiIndexType,uqSgcIndexDataStruct>::const_iterator it = m_indices.find(backwardNeighbour);
+    if ((it == m_indices.end()) || (it->second.isActive)) return false;
+  }
+
+  return true;
+}
+//--------------------------------------------------
+template <class P_V,class P_M,class Q_V,class Q_M>
+void
+uqSparseGridCollocationClass<P_V,P_M,Q_V,Q_M>::collectNewPoints(
+  const std::vector<uqSgcMultiIndexType>& indices,
+        std::vector<uqSgcMultiIndexType>& newPoints) const
+{
+  std::set<uqSgcMultiIndexType> uniquePoints;
+  uqSgcMultiIndexType point(m_paramDim,0);
+  std::vector<unsigned int> counter(m_paramDim,0);
+  for (unsigned int k = 0; k < indices.size(); ++k) {
+    const uqSgcMultiIndexType& index = indices[k];
+    counter.assign(m_paramDim,0);
+    bool finished = false;
+    while (!finished) {
+      for (unsigned int i = 0; i < m_paramDim; ++i) {
+        point[i] = m_ruleNodeIds[i][index[i]][counter[i]];
+      }
+      if (m_pointIds.find(point) == m_pointIds.end()) uniquePoints.insert(point);
+
+      finished = true;
+      for (unsigned int i = 0; i < m_paramDim; ++i) {
+        if (++counter[i] < m_ruleNodeIds[i][index[i]].size()) {
+          finished = false;
+          break;
+        }
+        counter[i] = 0;
+      }
+    }
+  }
+  newPoints.assign(uniquePoints.begin(),uniquePoints.end());
+
+  return;
+}
+//--------------------------------------------------
+template <class P_V,class P_M,class Q_V,class Q_M>
+void
+uqSparseGridCollocationClass<P_V,P_M,Q_V,Q_M>::evaluatePoints(const std::vector<uqSgcMultiIndexType>& newPoints)
+{
+  // Point 'p' is evaluated by sub-environment 'p % numSubEnvironments'; all other entries stay zero
+  unsigned int numValues = m_qoiDim+1;
+  std::vector<double> localValues(newPoints.size()*numValues,0.);
+  P_V tmpP(m_paramSpace.zeroVector());
+  Q_V tmpQ(m_qoiSpace.zeroVector());
+  for (unsigned int p = 0; p < newPoints.size(); ++p) {
+    if ((p % m_env.numSubEnvironments()) != m_env.subId()) continue;
+    for (unsigned int i = 0; i < m_paramDim; ++i) {
+      tmpP[i] = m_nodes[i][newPoints[p][i]];
+    }
+    m_qoiFunctionSynchronizer->callFunction(&tmpP,NULL,&tmpQ,NULL,NULL,NULL); // Might demand parallel environment
+    for (unsigned int j = 0; j < m_qoiDim; ++j) {
+      localValues[p*numValues + j] = tmpQ[j];
+    }
+    localValues[p*numValues + m_qoiDim] = m_useGaussHermite ? 1. : m_paramRv.pdf().actualValue(tmpP,NULL,NULL,NULL,NULL);
+  }
+
+  // Only processor 0 of each sub-environment holds meaningful values
+  std::vector<double> values(localValues);
+  if (localValues.size() > 0) {
+    if ((m_env.numSubEnvironments() > 1) && (m_env.inter0Rank() >= 0)) {
+      m_env.inter0Comm().Allreduce((void *) &localValues[0], (void *) &values[0], (int) localValues.size(), uqRawValue_MPI_DOUBLE, uqRawValue_MPI_SUM,
+                                   "uqSparseGridCollocationClass<P_V,P_M,Q_V,Q_M>::evaluatePoints()",
+                                   "failed MPI.Allreduce() for qoi values");
+    }
+    m_env.subComm().Bcast((void *) &values[0], (int) values.size(), uqRawValue_MPI_DOUBLE, 0,
+                          "uqSparseGridCollocationClass<P_V,P_M,Q_V,Q_M>::evaluatePoints()",
+                          "failed MPI.Bcast() for qoi values");
+  }
+
+  for (unsigned int p = 0; p < newPoints.size(); ++p) {
+    unsigned int pointId = m_pointIds.size();
+    m_pointIds[newPoints[p]] = pointId;
+    for (unsigned int j = 0; j < m_qoiDim; ++j) {
+      m_qoiValues.push_back(values[p*numValues + j]);
+    }
+    m_densityValues.push_back(values[p*numValues + m_qoiDim]);
+  }
+
+  return;
+}
+//--------------------------------------------------
+template <class P_V,class P_M,class Q_V,class Q_M>
+void
+uqSparseGridCollocationClass<P_V,P_M,Q_V,Q_M>::tensorQuadrature(
+  const uqSgcMultiIndexType& index,
+        std::vector<double>& sums) const
+{
+  sums.assign(2*m_qoiDim+1,0.);
+  uqSgcMultiIndexType point(m_paramDim,0);
+  std::vector<unsigned int> counter(m_paramDim,0);
+  bool finished = false;
+  while (!finished) {
+    double weight = 1.;
+    for (unsigned int i = 0; i < m_paramDim; ++i) {
+      point[i] = m_ruleNodeIds[i][index[i]][counter[i]];
+      weight  *= m_ruleWeights[i][index[i]][counter[i]];
+    }
+    unsigned int pointId = m_pointIds.find(point)->second;
+    weight *= m_densityValues[pointId];
+    for (unsigned int j = 0; j < m_qoiDim; ++j) {
+      double value = m_qoiValues[pointId*m_qoiDim + j];
+      sums[j]          += weight*value;
+      sums[m_qoiDim+j] += weight*value*value;
+    }
+    sums[2*m_qoiDim] += weight;
+
+    finished = true;
+    for (unsigned int i = 0; i < m_paramDim; ++i) {
+      if (++counter[i] < m_ruleNodeIds[i][index[i]].size()) {
+        finished = false;
+        break;
+      }
+      counter[i] = 0;
+    }
+  }
+
+  return;
+}
+//--------------------------------------------------
+template <class P_V,class P_M,class Q_V,class Q_M>
+void
+uqSparseGridCollocationClass<P_V,P_M,Q_V,Q_M>::addIndex(const uqSgcMultiIndexType& index)
+{
+  // Delta_k = sum over z in {0,1}^d of (-1)^|z| Q_{k-z}, where Q_{k-z} = 0 if some k_i - z_i = 0
+  std::vector<unsigned int> backwardDims(0);
+  for (unsigned int i = 0; i < m_paramDim; ++i) {
+    if (index[i] > 1) backwardDims.push_back(i);
+  }
+
+  uqSgcIndexDataStruct data;
+  data.isActive = true;
+  data.deltas.assign(2*m_qoiDim+1,0.);
+  std::vector<double> sums(0);
+  for (unsigned int mask = 0; mask < (1u << backwardDims.size()); ++mask) {
+    uqSgcMultiIndexType neighbour(index);
+    double sign = 1.;
+    for (unsigned int b = 0; b < backwardDims.size(); ++b) {
+      if (mask & (1u << b)) {
+        neighbour[backwardDims[b]]--;
+        sign = -sign;
+      }
+    }
+    this->tensorQuadrature(neighbour,sums);
+    for (unsigned int j = 0; j < sums.size(); ++j) {
+      data.deltas[j] += sign*sums[j];
+    }
+  }
+
+  data.errorIndicator = 0.;
+  for (unsigned int j = 0; j < 2*m_qoiDim; ++j) {
+    data.errorIndicator = std::max(data.errorIndicator,fabs(data.deltas[j]));
+  }
+
+  m_indices[index] = data;
+
+  return;
+}
+// I/O methods --------------------------------------
+template <class P_V,class P_M,class Q_V,class Q_M>
+void
+uqSparseGridCollocationClass<P_V,P_M,Q_V,Q_M>::print(std::ostream& os) const
+{
+  os << "numIndices = "    << m_indices.size()
+     << ", numPoints = "   << m_pointIds.size()
+     << "\nqoiMean = "     << *m_qoiMean
+     << "\nqoiVariance = " << *m_qoiVariance;
+
+  return;
+}
+//--------------------------------------------------
+// Operator declared outside class definition ------
+//--------------------------------------------------
+template<class P_V,class P_M,class Q_V,class Q_M>
+std::ostream& operator<<(std::ostream& os, const uqSparseGridCollocationClass<P_V,P_M,Q_V,Q_M>& obj)
+{
+  obj.print(os);
+
+  return os;
+}
+
+//*****************************************************
+// Sparse grid class [R-nn]
+//*****************************************************
+/*!
+ * \class uqSparseGridVectorRealizerClass
+ * \brief A class for handling sampling from the sparse grid surrogate of a QoI.
+ *
+ * This class draws a realization of the parameter RV and returns the value of the sparse grid
+ * interpolant of the QoI at it, what is much cheaper than evaluating the QoI function itself.*/
+
+template<class P_V, class P_M, class Q_V, class Q_M>
+class uqSparseGridVectorRealizerClass : public uqBaseVectorRealizerClass<Q_V,Q_M> {
+public:
+  //! @name Constructor/Destructor methods
+  //@{
+  //! Constructor
+  /*! Constructs a new object, given a prefix, the sparse grid (already solved), the parameter RV
+   * and the image set of the vector realizer.*/
+  uqSparseGridVectorRealizerClass(const char*                                          prefix,
+                                  const uqSparseGridCollocationClass<P_V,P_M,Q_V,Q_M>& sparseGrid,
+                                  const uqBaseVectorRVClass         <P_V,P_M>&         paramRv,
+                                  const uqVectorSetClass            <Q_V,Q_M>&         unifiedImageSet);
+  //! Destructor
+  ~uqSparseGridVectorRealizerClass();
+  //@}
+
+  //! @name Realization-related methods
+  //@{
+  //! Draws a realization.
+  /*! This function draws a realization of the parameter RV and saves the surrogate QoI value in \c nextValues.*/
+  void realization(Q_V& nextValues) const;
+  //@}
+
+private:
+  using uqBaseVectorRealizerClass<Q_V,Q_M>::m_env;
+  using uqBaseVectorRealizerClass<Q_V,Q_M>::m_prefix;
+  using uqBaseVectorRealizerClass<Q_V,Q_M>::m_unifiedImageSet;
+  using uqBaseVectorRealizerClass<Q_V,Q_M>::m_subPeriod;
+
+  const uqSparseGridCollocationClass<P_V,P_M,Q_V,Q_M>& m_sparseGrid;
+  const uqBaseVectorRVClass         <P_V,P_M>&         m_paramRv;
+};
+// Constructor -------------------------------------
+template<class P_V, class P_M, class Q_V, class Q_M>
+uqSparseGridVectorRealizerClass<P_V,P_M,Q_V,Q_M>::uqSparseGridVectorRealizerClass(
+  const char*                                          prefix,
+  const uqSparseGridCollocationClass<P_V,P_M,Q_V,Q_M>& sparseGrid,
+  const uqBaseVectorRVClass         <P_V,P_M>&         paramRv,
+  const uqVectorSetClass            <Q_V,Q_M>&         unifiedImageSet)
+  :
+  uqBaseVectorRealizerClass<Q_V,Q_M>(((std::string)(prefix)+"sgc").c_str(),unifiedImageSet,std::numeric_limits<unsigned int>::max()),
+  m_sparseGrid(sparseGrid),
+  m_paramRv   (paramRv)
+{
+  if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 5)) {
+    *m_env.subDisplayFile() << "Entering uqSparseGridVectorRealizerClass<P_V,P_M,Q_V,Q_M>::constructor()"
+                            << ": prefix = " << m_prefix
+                            << std::endl;
+  }
+
+  if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 5)) {
+    *m_env.subDisplayFile() << "Leaving uqSparseGridVectorRealizerClass<P_V,P_M,Q_V,Q_M>::constructor()"
+                            << ": prefix = " << m_prefix
+                            << std::endl;
+  }
+}
+// Destructor --------------------------------------
+template<class P_V, class P_M, class Q_V, class Q_M>
+uqSparseGridVectorRealizerClass<P_V,P_M,Q_V,Q_M>::~uqSparseGridVectorRealizerClass()
+{
+}
+// Realization-related methods----------------------
+template<class P_V, class P_M, class Q_V, class Q_M>
+void
+uqSparseGridVectorRealizerClass<P_V,P_M,Q_V,Q_M>::realization(Q_V& nextValues) const
+{
+  P_V paramValues(m_paramRv.imageSet().vectorSpace().zeroVector());
+  m_paramRv.realizer().realization(paramValues);
+  m_sparseGrid.surrogateValue(paramValues,nextValues);
+
+  return;
+}
+
+#endif // __UQ_SPARSE_GRID_COLLOCATION_H__
@@ -0,0 +1,144 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+// 
+// QUESO - a library to support the Quantification of Uncertainty
+// for Estimation, Simulation and Optimization
+//
+// Copyright (C) 2008,2009,2010,2011,2012,2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor, 
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+// 
+// $Id$
+//
+//--------------------------------------------------------------------------
+
+#ifndef __UQ_SGC_OPTIONS_H__
+#define __UQ_SGC_OPTIONS_H__
+
+#include <uqEnvironment.h>
+
+// _ODV = option default value
+#define UQ_SGC_MAX_LEVEL_ODV      5
+#define UQ_SGC_ADAPTIVE_ODV       1
+#define UQ_SGC_TOLERANCE_ODV      1.e-6
+#define UQ_SGC_MAX_NUM_POINTS_ODV 10000
+
+/*! \file uqSparseGridCollocationOptions.h
+    \brief Classes to allow options to be passed to a sparse grid stochastic collocation solver.
+*/
+
+/*! \class uqSgcOptionsValuesClass
+ *  \brief This class provides options for the sparse grid collocation solver if no input file is available.
+ *
+ *  The sparse grid collocation solver expects options for its methods. This class provides default
+ * values for such options if no input file is available. */
+
+class uqSgcOptionsValuesClass
+{
+public:
+  //! @name Constructor/Destructor methods
+  //@{
+  //! Default constructor.
+  /*! Assigns the default suite of options to the sparse grid collocation solver.*/
+  uqSgcOptionsValuesClass            ();
+
+  //! Copy constructor.
+  /*! It assigns the same options values from  \c src to \c this.*/
+  uqSgcOptionsValuesClass            (const uqSgcOptionsValuesClass& src);
+
+  //! Destructor
+  ~uqSgcOptionsValuesClass            ();
+  //@}
+
+  //! @name Set methods
+  //@{
+  //! Assignment operator; it copies \c rhs to \c this.
+  uqSgcOptionsValuesClass& operator= (const uqSgcOptionsValuesClass& rhs);
+  //@}
+
+  unsigned int m_maxLevel;     // Isotropic: total level; adaptive: level per dimension
+  bool         m_adaptive;
+  double       m_tolerance;
+  unsigned int m_maxNumPoints;
+
+private:
+  //! Copies the option values from \c src to \c this.
+  void copy(const uqSgcOptionsValuesClass& src);
+};
+
+// --------------------------------------------------
+// --------------------------------------------------
+// --------------------------------------------------
+
+/*! \class uqSparseGridCollocationOptionsClass
+ *  \brief This class reads the options for the sparse grid collocation solver from an input file.
+ *
+ * The sparse grid collocation solver expects options for its methods. This class reads the
+ * options for the solver from an input file provided by the user. The class expects the
+ * prefix '\<prefix\>_sgc_'. For instance, if 'prefix' is 'foo_775_fp_', then the constructor
+ * will read all options that begin with 'foo_775_fp_sgc_'. */
+
+class uqSparseGridCollocationOptionsClass
+{
+public:
+
+  //! @name Constructor/Destructor methods
+  //@{
+  //! Constructor: reads options from the input file.
+  uqSparseGridCollocationOptionsClass(const uqBaseEnvironmentClass& env, const char* prefix);
+
+  //! Constructor: with alternative option values.
+  /*! In this constructor, the input options are given by \c alternativeOptionsValues, thus, they
+   * are not read from an input file.*/
+  uqSparseGridCollocationOptionsClass(const uqBaseEnvironmentClass& env, const char* prefix, const uqSgcOptionsValuesClass& alternativeOptionsValues);
+
+  //! Destructor
+  ~uqSparseGridCollocationOptionsClass();
+  //@}
+
+  //! @name I/O methods
+  //@{
+  //! It scans the option values from the options input file.
+  void scanOptionsValues();
+
+  //!  It prints the option values.
+  void print            (std::ostream& os) const;
+  //@}
+
+  uqSgcOptionsValuesClass m_ov;
+  std::string             m_prefix;
+
+private:
+  //! Defines the options for the sparse grid collocation solver as the default options.
+  void   defineMyOptions  (po::options_description& optionsDesc) const;
+
+  //! Gets the sparse grid collocation options.
+  void   getMyOptionValues(po::options_description& optionsDesc);
+
+  const uqBaseEnvironmentClass& m_env;
+  po::options_description*      m_optionsDesc;
+
+  std::string                   m_option_help;
+  std::string                   m_option_maxLevel;
+  std::string                   m_option_adaptive;
+  std::string                   m_option_tolerance;
+  std::string                   m_option_maxNumPoints;
+};
+
+//! Prints the object \c obj, overloading an operator.
+std::ostream& operator<<(std::ostream& os, const uqSparseGridCollocationOptionsClass& obj);
+#endif // __UQ_SGC_OPTIONS_H__
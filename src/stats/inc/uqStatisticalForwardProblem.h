@@ -32,6 +32,7 @@
 #include <uqStatisticalForwardProblemOptions.h>
 #include <uqVectorFunction.h>
 #include <uqMonteCarloSG.h>
+#include <uqSparseGridCollocation.h>
 #include <uqVectorRV.h>
 #include <uqSequenceOfVectors.h>
 
@@ -63,8 +64,8 @@
 <item> the QoI RV, another instance of class 'uqBaseVectorRVClass<P_V,P_M>'.
 </list>   
   * The QoI RV stores the solution according to the Bayesian approach. The solution of a SPF 
-  * is computed by calling 'solveWithMonteCarlo()'. More operations, with different methods, 
-  * will be available in the future.\n
+  * is computed by calling 'solveWithMonteCarlo()' or, for smooth QoIs of moderately many
+  * parameters, 'solveWithSparseGrid()'.\n
   *
   * The solution process might demand extra objects to be passed through the chosen solution 
   * operation interface. This distinction is important: this class separates 'what the problem 
@@ -119,12 +120,22 @@ public:
 </list>*/
 //<item> computes the CDFs of the components of 'm_qoiRv' as instances of 'uqSampledVectorCdfClass<Q_V,Q_M>'
   void                                   solveWithMonteCarlo(const uqMcOptionsValuesClass* alternativeOptionsValues); // dakota
+
+  //! Solves the problem through sparse grid stochastic collocation.
+  /*! This operation checks the member flag 'm_computeSolution' just like 'solveWithMonteCarlo()'. If it
+   * is 'true', the operation instantiates 'uqSparseGridCollocationClass<P_V,P_M,Q_V,Q_M>', builds the
+   * sparse grid (which computes the mean and the variance of the QoI, see 'getSparseGrid()') and sets the
+   * realizer of 'm_qoiRv' to the sparse grid surrogate of the QoI function. No chains are generated.*/
+  void                                   solveWithSparseGrid(const uqSgcOptionsValuesClass* alternativeOptionsValues);
+
+  //! Returns the sparse grid computed by 'solveWithSparseGrid()'; access to private attribute m_sparseGrid.
+  const uqSparseGridCollocationClass<P_V,P_M,Q_V,Q_M>& getSparseGrid() const;
   
   //! Returns the QoI RV; access to private attribute m_qoiRv.
   const uqGenericVectorRVClass<Q_V,Q_M>& qoiRv              () const;
 
   //! Returns the parameter chain; access to private attribute m_paramChain.
-  const uqBaseVectorSequenceClass<Q_V,Q_M>& getParamChain   () const;
+  const uqBaseVectorSequenceClass<P_V,P_M>& getParamChain   () const;
   
 #ifdef QUESO_COMPUTES_EXTRA_POST_PROCESSING_STATISTICS
   
@@ -153,11 +164,14 @@ private:
   const uqBaseVectorFunctionClass<P_V,P_M,Q_V,Q_M>& m_qoiFunction;
         uqGenericVectorRVClass   <Q_V,Q_M>&         m_qoiRv; // FIX ME: Maybe not always generic ?
 
-        uqBaseVectorSequenceClass<Q_V,Q_M>*         m_paramChain;
+        uqBaseVectorSequenceClass<P_V,P_M>*         m_paramChain;
         uqBaseVectorSequenceClass<Q_V,Q_M>*         m_qoiChain;
         uqMonteCarloSGClass      <P_V,P_M,Q_V,Q_M>* m_mcSeqGenerator;
+        uqSparseGridCollocationClass<P_V,P_M,Q_V,Q_M>* m_sparseGrid;
 
         uqBaseVectorRealizerClass<Q_V,Q_M>*         m_solutionRealizer;
+        uqBaseVectorCdfClass     <Q_V,Q_M>*         m_subSolutionCdf;
+        uqBaseVectorCdfClass     <Q_V,Q_M>*         m_unifiedSolutionCdf;
  
         uqBaseJointPdfClass      <Q_V,Q_M>*         m_solutionPdf;
 
@@ -172,11 +186,9 @@ private:
         uqBaseVectorMdfClass     <Q_V,Q_M>*         m_subSolutionMdf;
         uqArrayOfOneDGridsClass  <Q_V,Q_M>*         m_subCdfGrids;
         uqArrayOfOneDTablesClass <Q_V,Q_M>*         m_subCdfValues;
-        uqBaseVectorCdfClass     <Q_V,Q_M>*         m_subSolutionCdf;
 
         uqArrayOfOneDGridsClass  <Q_V,Q_M>*         m_unifiedCdfGrids;
         uqArrayOfOneDTablesClass <Q_V,Q_M>*         m_unifiedCdfValues;
-        uqBaseVectorCdfClass     <Q_V,Q_M>*         m_unifiedSolutionCdf;
 #endif
 };
 //! Prints the object \c obj, overloading an operator.
@@ -199,7 +211,10 @@ uqStatisticalForwardProblemClass<P_V,P_M,Q_V,Q_M>::uqStatisticalForwardProblemCl
   m_paramChain              (NULL),
   m_qoiChain                (NULL),
   m_mcSeqGenerator          (NULL),
+  m_sparseGrid              (NULL),
   m_solutionRealizer        (NULL),
+  m_subSolutionCdf          (NULL),
+  m_unifiedSolutionCdf      (NULL),
 #ifdef UQ_ALSO_COMPUTE_MDFS_WITHOUT_KDE
   m_subMdfGrids             (NULL),
   m_subMdfValues            (NULL),
@@ -208,10 +223,8 @@ uqStatisticalForwardProblemClass<P_V,P_M,Q_V,Q_M>::uqStatisticalForwardProblemCl
   m_subSolutionMdf          (NULL),
   m_subCdfGrids             (NULL),
   m_subCdfValues            (NULL),
-  m_subSolutionCdf          (NULL),
   m_unifiedCdfGrids         (NULL),
   m_unifiedCdfValues        (NULL),
-  m_unifiedSolutionCdf      (NULL),
 #endif
   m_solutionPdf             (NULL),
   m_alternativeOptionsValues(),
@@ -257,12 +270,12 @@ uqStatisticalForwardProblemClass<P_V,P_M,Q_V,Q_M>::~uqStatisticalForwardProblemC
 {
   if (m_solutionPdf       ) delete m_solutionPdf;
 
-#ifdef QUESO_COMPUTES_EXTRA_POST_PROCESSING_STATISTICS
   if (m_unifiedSolutionCdf) delete m_unifiedSolutionCdf;
+  if (m_subSolutionCdf    ) delete m_subSolutionCdf;
+#ifdef QUESO_COMPUTES_EXTRA_POST_PROCESSING_STATISTICS
   if (m_unifiedCdfValues  ) delete m_unifiedCdfValues;
   if (m_unifiedCdfGrids   ) delete m_unifiedCdfGrids;
 
-  if (m_subSolutionCdf    ) delete m_subSolutionCdf;
   if (m_subCdfValues      ) delete m_subCdfValues;
   if (m_subCdfGrids       ) delete m_subCdfGrids;
 
@@ -274,6 +287,8 @@ uqStatisticalForwardProblemClass<P_V,P_M,Q_V,Q_M>::~uqStatisticalForwardProblemC
 #endif
   if (m_solutionRealizer  ) delete m_solutionRealizer;
 
+  if (m_sparseGrid        ) delete m_sparseGrid;
+
   if (m_mcSeqGenerator    ) delete m_mcSeqGenerator;
 
   if (m_qoiChain) {
@@ -321,12 +336,14 @@ uqStatisticalForwardProblemClass<P_V,P_M,Q_V,Q_M>::solveWithMonteCarlo(
 
   if (m_solutionPdf       ) delete m_solutionPdf;
 
-#ifdef QUESO_COMPUTES_EXTRA_POST_PROCESSING_STATISTICS
   if (m_unifiedSolutionCdf) delete m_unifiedSolutionCdf;
+  if (m_subSolutionCdf    ) delete m_subSolutionCdf;
+  m_unifiedSolutionCdf = NULL;
+  m_subSolutionCdf     = NULL;
+#ifdef QUESO_COMPUTES_EXTRA_POST_PROCESSING_STATISTICS
   if (m_unifiedCdfValues  ) delete m_unifiedCdfValues;
   if (m_unifiedCdfGrids   ) delete m_unifiedCdfGrids;
 
-  if (m_subSolutionCdf    ) delete m_subSolutionCdf;
   if (m_subCdfValues      ) delete m_subCdfValues;
   if (m_subCdfGrids       ) delete m_subCdfGrids;
 
@@ -381,42 +398,72 @@ uqStatisticalForwardProblemClass<P_V,P_M,Q_V,Q_M>::solveWithMonteCarlo(
   m_qoiRv.setMdf(*m_subSolutionMdf);
 #endif
 
-  // Compute output cdf: uniform sampling approach
-#ifdef QUESO_COMPUTES_EXTRA_POST_PROCESSING_STATISTICS
-  std::string subCoreName_qoiCdf(m_optionsObj->m_prefix+    "QoiCdf_");
-  std::string uniCoreName_qoiCdf(m_optionsObj->m_prefix+"unifQoiCdf_");
-  if (m_env.numSubEnvironments() == 1) subCoreName_qoiCdf = uniCoreName_qoiCdf;
-
+  // Compute output cdf: from the quantile sketches of the qoi sequence, if the Monte Carlo generator
+  // fed them; otherwise, if extra statistics are enabled, by uniformly sampling the sorted sequence
   std::string subCoreName_solutionCdf(m_optionsObj->m_prefix+    "Qoi");
   std::string uniCoreName_solutionCdf(m_optionsObj->m_prefix+"unifQoi");
   if (m_env.numSubEnvironments() == 1) subCoreName_solutionCdf = uniCoreName_solutionCdf;
 
-  m_subCdfGrids  = new uqArrayOfOneDGridsClass <Q_V,Q_M>(subCoreName_qoiCdf.c_str(),m_qoiRv.imageSet().vectorSpace());
-  m_subCdfValues = new uqArrayOfOneDTablesClass<Q_V,Q_M>(subCoreName_qoiCdf.c_str(),m_qoiRv.imageSet().vectorSpace());
-  m_qoiChain->subUniformlySampledCdf(numEvaluationPointsVec, // input
-                                     *m_subCdfGrids,         // output
-                                     *m_subCdfValues);       // output
-
-  m_subSolutionCdf = new uqSampledVectorCdfClass<Q_V,Q_M>(subCoreName_solutionCdf.c_str(),
-                                                          *m_subCdfGrids,
-                                                          *m_subCdfValues);
-  m_qoiRv.setSubCdf(*m_subSolutionCdf);
+  const std::vector<uqQuantileSketchClass*>& qoiSketches = m_mcSeqGenerator->qoiSketches();
+  if (qoiSketches.size() > 0) {
+    m_subSolutionCdf = new uqSampledVectorCdfClass<Q_V,Q_M>(subCoreName_solutionCdf.c_str(),
+                                                            m_qoiRv.imageSet().vectorSpace(),
+                                                            qoiSketches,
+                                                            numEvaluationPointsVec);
+    m_qoiRv.setSubCdf(*m_subSolutionCdf);
 
-  // Compute unified cdf if necessary
-  if (m_env.numSubEnvironments() == 1) {
-    m_qoiRv.setUnifiedCdf(*m_subSolutionCdf);
+    if (m_env.numSubEnvironments() == 1) {
+      m_qoiRv.setUnifiedCdf(*m_subSolutionCdf);
+    }
+    else {
+      std::vector<uqQuantileSketchClass*> unifiedSketches(qoiSketches.size(),NULL);
+      for (unsigned int i = 0; i < unifiedSketches.size(); ++i) {
+        unifiedSketches[i] = new uqQuantileSketchClass(*qoiSketches[i]);
+        if (m_env.inter0Rank() >= 0) unifiedSketches[i]->unifiedMerge(m_env.inter0Comm());
+      }
+      m_unifiedSolutionCdf = new uqSampledVectorCdfClass<Q_V,Q_M>(uniCoreName_solutionCdf.c_str(),
+                                                                  m_qoiRv.imageSet().vectorSpace(),
+                                                                  unifiedSketches,
+                                                                  numEvaluationPointsVec);
+      for (unsigned int i = 0; i < unifiedSketches.size(); ++i) {
+        delete unifiedSketches[i];
+      }
+      m_qoiRv.setUnifiedCdf(*m_unifiedSolutionCdf);
+    }
   }
+#ifdef QUESO_COMPUTES_EXTRA_POST_PROCESSING_STATISTICS
   else {
-    m_unifiedCdfGrids  = new uqArrayOfOneDGridsClass <Q_V,Q_M>(uniCoreName_qoiCdf.c_str(),m_qoiRv.imageSet().vectorSpace());
-    m_unifiedCdfValues = new uqArrayOfOneDTablesClass<Q_V,Q_M>(uniCoreName_qoiCdf.c_str(),m_qoiRv.imageSet().vectorSpace());
-    m_qoiChain->unifiedUniformlySampledCdf(numEvaluationPointsVec, // input
-                                           *m_unifiedCdfGrids,     // output
-                                           *m_unifiedCdfValues);   // output
-
-    m_unifiedSolutionCdf = new uqSampledVectorCdfClass<Q_V,Q_M>(uniCoreName_solutionCdf.c_str(),
-                                                                *m_unifiedCdfGrids,
-                                                                *m_unifiedCdfValues);
-    m_qoiRv.setUnifiedCdf(*m_unifiedSolutionCdf);
+    std::string subCoreName_qoiCdf(m_optionsObj->m_prefix+    "QoiCdf_");
+    std::string uniCoreName_qoiCdf(m_optionsObj->m_prefix+"unifQoiCdf_");
+    if (m_env.numSubEnvironments() == 1) subCoreName_qoiCdf = uniCoreName_qoiCdf;
+
+    m_subCdfGrids  = new uqArrayOfOneDGridsClass <Q_V,Q_M>(subCoreName_qoiCdf.c_str(),m_qoiRv.imageSet().vectorSpace());
+    m_subCdfValues = new uqArrayOfOneDTablesClass<Q_V,Q_M>(subCoreName_qoiCdf.c_str(),m_qoiRv.imageSet().vectorSpace());
+    m_qoiChain->subUniformlySampledCdf(numEvaluationPointsVec, // input
+                                       *m_subCdfGrids,         // output
+                                       *m_subCdfValues);       // output
+
+    m_subSolutionCdf = new uqSampledVectorCdfClass<Q_V,Q_M>(subCoreName_solutionCdf.c_str(),
+                                                            *m_subCdfGrids,
+                                                            *m_subCdfValues);
+    m_qoiRv.setSubCdf(*m_subSolutionCdf);
+
+    // Compute unified cdf if necessary
+    if (m_env.numSubEnvironments() == 1) {
+      m_qoiRv.setUnifiedCdf(*m_subSolutionCdf);
+    }
+    else {
+      m_unifiedCdfGrids  = new uqArrayOfOneDGridsClass <Q_V,Q_M>(uniCoreName_qoiCdf.c_str(),m_qoiRv.imageSet().vectorSpace());
+      m_unifiedCdfValues = new uqArrayOfOneDTablesClass<Q_V,Q_M>(uniCoreName_qoiCdf.c_str(),m_qoiRv.imageSet().vectorSpace());
+      m_qoiChain->unifiedUniformlySampledCdf(numEvaluationPointsVec, // input
+                                             *m_unifiedCdfGrids,     // output
+                                             *m_unifiedCdfValues);   // output
+
+      m_unifiedSolutionCdf = new uqSampledVectorCdfClass<Q_V,Q_M>(uniCoreName_solutionCdf.c_str(),
+                                                                  *m_unifiedCdfGrids,
+                                                                  *m_unifiedCdfValues);
+      m_qoiRv.setUnifiedCdf(*m_unifiedSolutionCdf);
+    }
   }
 #endif
   // Compute (just unified one) covariance matrix, if requested
@@ -523,6 +570,70 @@ uqStatisticalForwardProblemClass<P_V,P_M,Q_V,Q_M>::solveWithMonteCarlo(
 }
 //--------------------------------------------------
 template <class P_V,class P_M,class Q_V,class Q_M>
+void
+uqStatisticalForwardProblemClass<P_V,P_M,Q_V,Q_M>::solveWithSparseGrid(
+  const uqSgcOptionsValuesClass* alternativeOptionsValues)
+{
+  m_env.fullComm().Barrier();
+  m_env.fullComm().syncPrintDebugMsg("Entering uqStatisticalForwardProblemClass<P_V,P_M>::solveWithSparseGrid()",1,3000000);
+
+  if (m_optionsObj->m_ov.m_computeSolution == false) {
+    if ((m_env.subDisplayFile())) {
+      *m_env.subDisplayFile() << "In uqStatisticalForwardProblemClass<P_V,P_M,Q_V,Q_M>::solveWithSparseGrid()"
+                              << ": avoiding solution, as requested by user"
+                              << std::endl;
+    }
+    return;
+  }
+  if ((m_env.subDisplayFile())) {
+    *m_env.subDisplayFile() << "In uqStatisticalForwardProblemClass<P_V,P_M,Q_V,Q_M>::solveWithSparseGrid()"
+                            << ": computing solution, as requested by user"
+                            << std::endl;
+  }
+
+  if (m_solutionRealizer) delete m_solutionRealizer;
+  if (m_sparseGrid      ) delete m_sparseGrid;
+
+  m_sparseGrid = new uqSparseGridCollocationClass<P_V,P_M,Q_V,Q_M>(m_optionsObj->m_prefix.c_str(),
+                                                                   alternativeOptionsValues,
+                                                                   m_paramRv,
+                                                                   m_qoiFunction);
+  m_sparseGrid->solve();
+  m_solutionRealizer = new uqSparseGridVectorRealizerClass<P_V,P_M,Q_V,Q_M>((m_optionsObj->m_prefix+"Qoi").c_str(),
+                                                                            *m_sparseGrid,
+                                                                            m_paramRv,
+                                                                            m_qoiRv.imageSet());
+  m_qoiRv.setRealizer(*m_solutionRealizer);
+
+  if (m_env.subDisplayFile()) {
+    *m_env.subDisplayFile() << "In uqStatisticalForwardProblemClass<P_V,P_M,Q_V,Q_M>::solveWithSparseGrid()"
+                            << ", prefix = "        << m_optionsObj->m_prefix
+                            << ": qoi mean = "      << m_sparseGrid->qoiMean()
+                            << ", qoi variance = "  << m_sparseGrid->qoiVariance()
+                            << ", using "           << m_sparseGrid->numPoints()
+                            << " qoi evaluations"
+                            << std::endl;
+  }
+
+  m_env.fullComm().syncPrintDebugMsg("Leaving uqStatisticalForwardProblemClass<P_V,P_M>::solveWithSparseGrid()",1,3000000);
+  m_env.fullComm().Barrier();
+
+  return;
+}
+//--------------------------------------------------
+template <class P_V,class P_M,class Q_V,class Q_M>
+const uqSparseGridCollocationClass<P_V,P_M,Q_V,Q_M>&
+uqStatisticalForwardProblemClass<P_V,P_M,Q_V,Q_M>::getSparseGrid() const
+{
+  UQ_FATAL_TEST_MACRO(m_sparseGrid == NULL,
+                      m_env.worldRank(),
+                      "uqStatisticalForwardProblemClass<P_V,P_M,Q_V,Q_M>::getSparseGrid()",
+                      "m_sparseGrid is NULL");
+
+  return *m_sparseGrid;
+}
+//--------------------------------------------------
+template <class P_V,class P_M,class Q_V,class Q_M>
 const uqGenericVectorRVClass<Q_V,Q_M>& 
 uqStatisticalForwardProblemClass<P_V,P_M,Q_V,Q_M>::qoiRv() const
 {
@@ -552,7 +663,7 @@ uqStatisticalForwardProblemClass<P_V,P_M,Q_V,Q_M>::qoiRv_unifiedCdf() const
 #endif
 //--------------------------------------------------
 template <class P_V,class P_M,class Q_V,class Q_M>
-  const uqBaseVectorSequenceClass<Q_V,Q_M>&
+  const uqBaseVectorSequenceClass<P_V,P_M>&
   uqStatisticalForwardProblemClass<P_V,P_M,Q_V,Q_M>::getParamChain() const
 {
 
@@ -31,9 +31,11 @@
 
 #include <uqStatisticalInverseProblemOptions.h>
 #include <uqMetropolisHastingsSG1.h>
+#include <uqHamiltonianMCSG.h>
 #include <uqMLSampling1.h>
 #include <uqInstantiateIntersection.h>
 #include <uqVectorRV.h>
+#include <uqVectorCdf.h>
 #include <uqScalarFunction.h>
 //#include <grvy.h>
 
@@ -116,12 +118,29 @@ public:
 <item> sets the pdf of 'm_postRv' equal to an instance of 'uqBayesianJointPdfClass<P_V,P_M>',
 <item> instantiates 'uqSequenceOfVectorsClass<P_V,P_M>' (the chain),
 <item> instantiates 'uqMetropolisHastingsSGClass<P_V,P_M>' (the Metropolis-Hastings algorithm),
-<item> populates the chain with the Metropolis-Hastings algorithm, and
-<item> sets the realizer of 'm_postRv' with the contents of the chain.
+<item> populates the chain with the Metropolis-Hastings algorithm,
+<item> sets the realizer of 'm_postRv' with the contents of the chain, and
+<item> if the Metropolis-Hastings option 'rawChain_sketchK' is positive, sets the sub and unified cdfs of
+'m_postRv' from the quantile sketches of the raw chain.
 </list> */
   void solveWithBayesMetropolisHastings(const uqMhOptionsValuesClass* alternativeOptionsValues, // dakota
 					const P_V&                    initialValues,
 					const P_M*                    initialProposalCovMatrix);
+
+  //! Sets a cheap approximation of the likelihood function, for delayed acceptance Metropolis-Hastings.
+  /*! In solveWithBayesMetropolisHastings(), candidates are first screened with the posterior built from
+   * the prior pdf and 'surrogateLikelihoodFunction', and the likelihood function is only evaluated for
+   * the candidates that pass (see uqMetropolisHastingsSGClass::setSurrogateTargetPdf()). The surrogate
+   * must follow the same convention as the likelihood function and must outlive the solution.*/
+  void setSurrogateLikelihoodFunction  (const uqBaseScalarFunctionClass<P_V,P_M>& surrogateLikelihoodFunction);
+
+  //! Solves the problem through Bayes formula and a gradient based (MALA, HMC or NUTS) algorithm.
+  /*! Same as solveWithBayesMetropolisHastings(), but the chain is populated by
+   * 'uqHamiltonianMCSGClass<P_V,P_M>', which requires the prior pdf and the likelihood function to
+   * return gradients through lnValue(). If 'initialInverseMassMatrix' is NULL, the identity is used. */
+  void solveWithBayesHamiltonianMC     (const uqHmcOptionsValuesClass* alternativeOptionsValues,
+                                        const P_V&                     initialValues,
+                                        const P_M*                     initialInverseMassMatrix);
   
   //! Solves with Bayes Multi-Level (ML) sampling.
   void                             solveWithBayesMLSampling        ();
@@ -154,15 +173,19 @@ private:
 
   const uqBaseVectorRVClass        <P_V,P_M>&   m_priorRv;
   const uqBaseScalarFunctionClass  <P_V,P_M>&   m_likelihoodFunction;
+  const uqBaseScalarFunctionClass  <P_V,P_M>*   m_surrogateLikelihoodFunction;
         uqGenericVectorRVClass     <P_V,P_M>&   m_postRv;
 
         uqVectorSetClass           <P_V,P_M>*   m_solutionDomain;
         uqBaseJointPdfClass        <P_V,P_M>*   m_solutionPdf;
+        uqBaseJointPdfClass        <P_V,P_M>*   m_surrogatePdf;
         uqBaseVectorMdfClass       <P_V,P_M>*   m_subSolutionMdf;
         uqBaseVectorCdfClass       <P_V,P_M>*   m_subSolutionCdf;
+        uqBaseVectorCdfClass       <P_V,P_M>*   m_unifiedSolutionCdf;
         uqBaseVectorRealizerClass  <P_V,P_M>*   m_solutionRealizer;
 
         uqMetropolisHastingsSGClass<P_V,P_M>*   m_mhSeqGenerator;
+        uqHamiltonianMCSGClass     <P_V,P_M>*   m_hmcSeqGenerator;
         uqMLSamplingClass          <P_V,P_M>*   m_mlSampler;
         uqBaseVectorSequenceClass  <P_V,P_M>*   m_chain;
         uqScalarSequenceClass      <double>*    m_logLikelihoodValues;
@@ -192,13 +215,17 @@ uqStatisticalInverseProblemClass<P_V,P_M>::uqStatisticalInverseProblemClass(
   m_env                     (priorRv.env()),
   m_priorRv                 (priorRv),
   m_likelihoodFunction      (likelihoodFunction),
+  m_surrogateLikelihoodFunction(NULL),
   m_postRv                  (postRv),
   m_solutionDomain          (NULL),
   m_solutionPdf             (NULL),
+  m_surrogatePdf            (NULL),
   m_subSolutionMdf          (NULL),
   m_subSolutionCdf          (NULL),
+  m_unifiedSolutionCdf      (NULL),
   m_solutionRealizer        (NULL),
   m_mhSeqGenerator          (NULL),
+  m_hmcSeqGenerator         (NULL),
   m_mlSampler               (NULL),
   m_chain                   (NULL),
   m_logLikelihoodValues     (NULL),
@@ -266,9 +293,12 @@ uqStatisticalInverseProblemClass<P_V,P_M>::~uqStatisticalInverseProblemClass()
   }
   if (m_mlSampler       ) delete m_mlSampler;
   if (m_mhSeqGenerator  ) delete m_mhSeqGenerator;
+  if (m_hmcSeqGenerator ) delete m_hmcSeqGenerator;
   if (m_solutionRealizer) delete m_solutionRealizer;
+  if (m_unifiedSolutionCdf) delete m_unifiedSolutionCdf;
   if (m_subSolutionCdf  ) delete m_subSolutionCdf;
   if (m_subSolutionMdf  ) delete m_subSolutionMdf;
+  if (m_surrogatePdf    ) delete m_surrogatePdf;
   if (m_solutionPdf     ) delete m_solutionPdf;
   if (m_solutionDomain  ) delete m_solutionDomain;
   if (m_optionsObj      ) delete m_optionsObj;
@@ -276,6 +306,14 @@ uqStatisticalInverseProblemClass<P_V,P_M>::~uqStatisticalInverseProblemClass()
 // Statistical methods -----------------------------
 template <class P_V,class P_M>
 void
+uqStatisticalInverseProblemClass<P_V,P_M>::setSurrogateLikelihoodFunction(const uqBaseScalarFunctionClass<P_V,P_M>& surrogateLikelihoodFunction)
+{
+  m_surrogateLikelihoodFunction = &surrogateLikelihoodFunction;
+  return;
+}
+//--------------------------------------------------
+template <class P_V,class P_M>
+void
 uqStatisticalInverseProblemClass<P_V,P_M>::solveWithBayesMetropolisHastings(
   const uqMhOptionsValuesClass* alternativeOptionsValues, // dakota
   const P_V&                    initialValues,
@@ -319,11 +357,16 @@ uqStatisticalInverseProblemClass<P_V,P_M>::solveWithBayesMetropolisHastings(
 
   if (m_mlSampler       ) delete m_mlSampler;
   if (m_mhSeqGenerator  ) delete m_mhSeqGenerator;
+  if (m_hmcSeqGenerator ) delete m_hmcSeqGenerator;
+  m_hmcSeqGenerator = NULL;
   if (m_solutionRealizer) delete m_solutionRealizer;
+  if (m_unifiedSolutionCdf) delete m_unifiedSolutionCdf;
   if (m_subSolutionCdf  ) delete m_subSolutionCdf;
   if (m_subSolutionMdf  ) delete m_subSolutionMdf;
   if (m_solutionPdf     ) delete m_solutionPdf;
   if (m_solutionDomain  ) delete m_solutionDomain;
+  m_unifiedSolutionCdf = NULL;
+  m_subSolutionCdf     = NULL;
 
   P_V numEvaluationPointsVec(m_priorRv.imageSet().vectorSpace().zeroVector());
   numEvaluationPointsVec.cwSet(250.);
@@ -349,6 +392,17 @@ uqStatisticalInverseProblemClass<P_V,P_M>::solveWithBayesMetropolisHastings(
                                                               initialValues,
                                                               initialProposalCovMatrix);
 
+  if (m_surrogatePdf) delete m_surrogatePdf;
+  m_surrogatePdf = NULL;
+  if (m_surrogateLikelihoodFunction) {
+    m_surrogatePdf = new uqBayesianJointPdfClass<P_V,P_M>((m_optionsObj->m_prefix+"surrogate_").c_str(),
+                                                          m_priorRv.pdf(),
+                                                          *m_surrogateLikelihoodFunction,
+                                                          1.,
+                                                          *m_solutionDomain);
+    m_mhSeqGenerator->setSurrogateTargetPdf(*m_surrogatePdf);
+  }
+
   m_mhSeqGenerator->generateSequence(*m_chain,
                                      NULL, //m_logLikelihoodValues,
                                      NULL);//m_logTargetValues);
@@ -358,6 +412,39 @@ uqStatisticalInverseProblemClass<P_V,P_M>::solveWithBayesMetropolisHastings(
 
   m_postRv.setRealizer(*m_solutionRealizer);
 
+  // Compute output cdf: from the quantile sketches of the raw chain, if the sequence generator fed them
+  const std::vector<uqQuantileSketchClass*>& rawChainSketches = m_mhSeqGenerator->rawChainSketches();
+  if (rawChainSketches.size() > 0) {
+    std::string subCoreName_solutionCdf(m_optionsObj->m_prefix+    "Cdf_");
+    std::string uniCoreName_solutionCdf(m_optionsObj->m_prefix+"unifCdf_");
+    if (m_env.numSubEnvironments() == 1) subCoreName_solutionCdf = uniCoreName_solutionCdf;
+
+    m_subSolutionCdf = new uqSampledVectorCdfClass<P_V,P_M>(subCoreName_solutionCdf.c_str(),
+                                                            m_postRv.imageSet().vectorSpace(),
+                                                            rawChainSketches,
+                                                            numEvaluationPointsVec);
+    m_postRv.setSubCdf(*m_subSolutionCdf);
+
+    if (m_env.numSubEnvironments() == 1) {
+      m_postRv.setUnifiedCdf(*m_subSolutionCdf);
+    }
+    else {
+      std::vector<uqQuantileSketchClass*> unifiedSketches(rawChainSketches.size(),NULL);
+      for (unsigned int i = 0; i < unifiedSketches.size(); ++i) {
+        unifiedSketches[i] = new uqQuantileSketchClass(*rawChainSketches[i]);
+        if (m_env.inter0Rank() >= 0) unifiedSketches[i]->unifiedMerge(m_env.inter0Comm());
+      }
+      m_unifiedSolutionCdf = new uqSampledVectorCdfClass<P_V,P_M>(uniCoreName_solutionCdf.c_str(),
+                                                                  m_postRv.imageSet().vectorSpace(),
+                                                                  unifiedSketches,
+                                                                  numEvaluationPointsVec);
+      for (unsigned int i = 0; i < unifiedSketches.size(); ++i) {
+        delete unifiedSketches[i];
+      }
+      m_postRv.setUnifiedCdf(*m_unifiedSolutionCdf);
+    }
+  }
+
   m_env.fullComm().syncPrintDebugMsg("In uqStatisticalInverseProblemClass<P_V,P_M>::solveWithBayesMetropolisHastings(), code place 1",3,3000000);
   //m_env.fullComm().Barrier();
 
@@ -421,6 +508,90 @@ uqStatisticalInverseProblemClass<P_V,P_M>::solveWithBayesMetropolisHastings(
 //--------------------------------------------------
 template <class P_V,class P_M>
 void
+uqStatisticalInverseProblemClass<P_V,P_M>::solveWithBayesHamiltonianMC(
+  const uqHmcOptionsValuesClass* alternativeOptionsValues,
+  const P_V&                     initialValues,
+  const P_M*                     initialInverseMassMatrix)
+{
+  m_env.fullComm().Barrier();
+  m_env.fullComm().syncPrintDebugMsg("Entering uqStatisticalInverseProblemClass<P_V,P_M>::solveWithBayesHamiltonianMC()",1,3000000);
+
+  if (m_optionsObj->m_ov.m_computeSolution == false) {
+    if ((m_env.subDisplayFile())) {
+      *m_env.subDisplayFile() << "In uqStatisticalInverseProblemClass<P_V,P_M>::solveWithBayesHamiltonianMC()"
+                              << ": avoiding solution, as requested by user"
+                              << std::endl;
+    }
+    return;
+  }
+  if ((m_env.subDisplayFile())) {
+    *m_env.subDisplayFile() << "In uqStatisticalInverseProblemClass<P_V,P_M>::solveWithBayesHamiltonianMC()"
+                            << ": computing solution, as requested by user"
+                            << std::endl;
+  }
+
+  UQ_FATAL_TEST_MACRO(m_priorRv.imageSet().vectorSpace().dimLocal() != initialValues.sizeLocal(),
+                      m_env.worldRank(),
+                      "uqStatisticalInverseProblemClass<P_V,P_M>::solveWithBayesHamiltonianMC()",
+                      "'m_priorRv' and 'initialValues' should have equal dimensions");
+
+  if (m_mlSampler       ) delete m_mlSampler;
+  if (m_mhSeqGenerator  ) delete m_mhSeqGenerator;
+  if (m_hmcSeqGenerator ) delete m_hmcSeqGenerator;
+  if (m_solutionRealizer) delete m_solutionRealizer;
+  if (m_unifiedSolutionCdf) delete m_unifiedSolutionCdf;
+  if (m_subSolutionCdf  ) delete m_subSolutionCdf;
+  if (m_subSolutionMdf  ) delete m_subSolutionMdf;
+  if (m_solutionPdf     ) delete m_solutionPdf;
+  if (m_solutionDomain  ) delete m_solutionDomain;
+  m_mlSampler      = NULL;
+  m_mhSeqGenerator = NULL;
+  m_unifiedSolutionCdf = NULL;
+  m_subSolutionCdf     = NULL;
+  m_subSolutionMdf     = NULL;
+
+  // Compute output pdf up to a multiplicative constant: Bayesian approach
+  m_solutionDomain = uqInstantiateIntersection(m_priorRv.pdf().domainSet(),m_likelihoodFunction.domainSet());
+
+  m_solutionPdf = new uqBayesianJointPdfClass<P_V,P_M>(m_optionsObj->m_prefix.c_str(),
+                                                       m_priorRv.pdf(),
+                                                       m_likelihoodFunction,
+                                                       1.,
+                                                       *m_solutionDomain);
+
+  m_postRv.setPdf(*m_solutionPdf);
+
+  // Compute output realizer: gradient based Markov chain approach
+  m_chain               = new uqSequenceOfVectorsClass<P_V,P_M>(m_postRv.imageSet().vectorSpace(),0,m_optionsObj->m_prefix+"chain");
+  m_logLikelihoodValues = new uqScalarSequenceClass<double>    (m_env,0,m_optionsObj->m_prefix+"logLike"  );
+  m_logTargetValues     = new uqScalarSequenceClass<double>    (m_env,0,m_optionsObj->m_prefix+"logTarget");
+  m_hmcSeqGenerator = new uqHamiltonianMCSGClass<P_V,P_M>(m_optionsObj->m_prefix.c_str(),
+                                                          alternativeOptionsValues,
+                                                          m_postRv,
+                                                          initialValues,
+                                                          initialInverseMassMatrix);
+
+  m_hmcSeqGenerator->generateSequence(*m_chain,
+                                      m_logLikelihoodValues,
+                                      m_logTargetValues);
+
+  m_solutionRealizer = new uqSequentialVectorRealizerClass<P_V,P_M>(m_optionsObj->m_prefix.c_str(),
+                                                                    *m_chain);
+
+  m_postRv.setRealizer(*m_solutionRealizer);
+
+  if (m_env.subDisplayFile()) {
+    *m_env.subDisplayFile() << std::endl;
+  }
+
+  m_env.fullComm().syncPrintDebugMsg("Leaving uqStatisticalInverseProblemClass<P_V,P_M>::solveWithBayesHamiltonianMC()",1,3000000);
+  m_env.fullComm().Barrier();
+
+  return;
+}
+//--------------------------------------------------
+template <class P_V,class P_M>
+void
 uqStatisticalInverseProblemClass<P_V,P_M>::solveWithBayesMLSampling()
 {
   m_env.fullComm().Barrier();
@@ -442,11 +613,16 @@ uqStatisticalInverseProblemClass<P_V,P_M>::solveWithBayesMLSampling()
 
   if (m_mlSampler       ) delete m_mlSampler;
   if (m_mhSeqGenerator  ) delete m_mhSeqGenerator;
+  if (m_hmcSeqGenerator ) delete m_hmcSeqGenerator;
+  m_hmcSeqGenerator = NULL;
   if (m_solutionRealizer) delete m_solutionRealizer;
+  if (m_unifiedSolutionCdf) delete m_unifiedSolutionCdf;
   if (m_subSolutionCdf  ) delete m_subSolutionCdf;
   if (m_subSolutionMdf  ) delete m_subSolutionMdf;
   if (m_solutionPdf     ) delete m_solutionPdf;
   if (m_solutionDomain  ) delete m_solutionDomain;
+  m_unifiedSolutionCdf = NULL;
+  m_subSolutionCdf     = NULL;
 
   P_V numEvaluationPointsVec(m_priorRv.imageSet().vectorSpace().zeroVector());
   numEvaluationPointsVec.cwSet(250.);
@@ -783,6 +783,11 @@ uqHessianCovMatricesTKGroupClass<V,M>::setPreComputingPosition(const V& position
                                                      &logPrior,
                                                      &logLikelihood);
     if (logTarget) {}; // just to remove compiler warning
+#ifdef QUESO_EXPECTS_LN_LIKELIHOOD_INSTEAD_OF_MINUS_2_LN
+    // Derivatives are those of ln(target): the Newton step below is written for -ln(target)
+    *tmpGrad    *= -1.;
+    *tmpHessian *= -1.;
+#endif
 
     // IMPORTANT: covariance matrix = (Hessian)^{-1} !!!
     V unitVector(m_vectorSpace->zeroVector());
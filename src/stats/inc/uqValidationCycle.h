@@ -57,7 +57,7 @@ public:
   uqValidationCycleClass(const uqBaseEnvironmentClass&      env,
                          const char*                        prefix,
                          const uqVectorSpaceClass<P_V,P_M>& paramSpace,
-                         const uqVectorSpaceClass<P_V,P_M>& qoiSpace);
+                         const uqVectorSpaceClass<Q_V,Q_M>& qoiSpace);
  
   //! Destructor.
   ~uqValidationCycleClass();
@@ -170,7 +170,7 @@ uqValidationCycleClass<P_V,P_M,Q_V,Q_M>::uqValidationCycleClass(
   const uqBaseEnvironmentClass&      env,
   const char*                        prefix,
   const uqVectorSpaceClass<P_V,P_M>& paramSpace,
-  const uqVectorSpaceClass<P_V,P_M>& qoiSpace)
+  const uqVectorSpaceClass<Q_V,Q_M>& qoiSpace)
   :
   m_env                     (env),
   m_prefix                  ((std::string)(prefix) + "cycle_"),
@@ -32,6 +32,7 @@
 #include <uqArrayOfOneDGrids.h>
 #include <uqArrayOfOneDTables.h>
 #include <uqScalarCdf.h>
+#include <uqQuantileSketch.h>
 #include <uqEnvironment.h>
 #include <math.h>
 
@@ -401,7 +402,9 @@ uqGaussianVectorCdfClass<V,M>::commonConstructor()
  * \brief A class for handling sampled vector CDFs.
  *
  * This class implements a sampled vector cumulative distribution function (CDF), given 
- * the grid points where it will be sampled and it returns its values.*/
+ * the grid points where it will be sampled and it returns its values. The grids and values
+ * may also be computed from streaming quantile sketches, one per component, in which case
+ * the object owns them.*/
 
 template<class V, class M>
 class uqSampledVectorCdfClass : public uqBaseVectorCdfClass<V,M> {
@@ -414,6 +417,15 @@ public:
   uqSampledVectorCdfClass(const char*                          prefix,
                           const uqArrayOfOneDGridsClass <V,M>& oneDGrids,
                           const uqArrayOfOneDTablesClass<V,M>& cdfValues);
+
+  //! Constructor from quantile sketches.
+  /*! The CDF of component \c i is sampled at \c numEvaluationPointsVec[i] uniformly spaced
+   * points, exactly as uqSequenceOfVectorsClass<V,M>::subUniformlySampledCdf() does with the
+   * full sequence, but from the sketch \c sketches[i], without storing the sequence. */
+  uqSampledVectorCdfClass(const char*                                prefix,
+                          const uqVectorSpaceClass<V,M>&             rowSpace,
+                          const std::vector<uqQuantileSketchClass*>& sketches,
+                          const V&                                   numEvaluationPointsVec);
   //! Destructor
   ~uqSampledVectorCdfClass();
   //@}
@@ -445,6 +457,8 @@ protected:
   using uqBaseVectorCdfClass<V,M>::m_pdfSupport;
 
   uqDistArrayClass<uqSampledScalarCdfClass<double>*> m_cdfs;
+  uqArrayOfOneDGridsClass <V,M>*                     m_sketchCdfGrids;
+  uqArrayOfOneDTablesClass<V,M>*                     m_sketchCdfValues;
 };
 // Default constructor -----------------------------
 template<class V,class M>
@@ -454,7 +468,9 @@ uqSampledVectorCdfClass<V,M>::uqSampledVectorCdfClass(
   const uqArrayOfOneDTablesClass<V,M>& cdfValues)
   :
   uqBaseVectorCdfClass<V,M>(prefix,oneDGrids.rowSpace()),
-  m_cdfs(m_pdfSupport.vectorSpace().map(),1)
+  m_cdfs(m_pdfSupport.vectorSpace().map(),1),
+  m_sketchCdfGrids (NULL),
+  m_sketchCdfValues(NULL)
 {
   if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 5)) {
     *m_env.subDisplayFile() << "Entering uqSampledVectorCdfClass<V,M>::constructor()"
@@ -477,6 +493,59 @@ uqSampledVectorCdfClass<V,M>::uqSampledVectorCdfClass(
                            << std::endl;
   }
 }
+// Constructor -------------------------------------
+template<class V,class M>
+uqSampledVectorCdfClass<V,M>::uqSampledVectorCdfClass(
+  const char*                                prefix,
+  const uqVectorSpaceClass<V,M>&             rowSpace,
+  const std::vector<uqQuantileSketchClass*>& sketches,
+  const V&                                   numEvaluationPointsVec)
+  :
+  uqBaseVectorCdfClass<V,M>(prefix,rowSpace),
+  m_cdfs(m_pdfSupport.vectorSpace().map(),1),
+  m_sketchCdfGrids (new uqArrayOfOneDGridsClass <V,M>(prefix,rowSpace)),
+  m_sketchCdfValues(new uqArrayOfOneDTablesClass<V,M>(prefix,rowSpace))
+{
+  if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 5)) {
+    *m_env.subDisplayFile() << "Entering uqSampledVectorCdfClass<V,M>::constructor(sketches)"
+                           << ": prefix = " << m_prefix
+                           << std::endl;
+  }
+
+  UQ_FATAL_TEST_MACRO(sketches.size() != (unsigned int) m_cdfs.MyLength(),
+                      m_env.worldRank(),
+                      "uqSampledVectorCdfClass<V,M>::constructor(sketches)",
+                      "number of sketches is different from the number of components");
+
+  V minDomainValues(rowSpace.zeroVector());
+  V maxDomainValues(rowSpace.zeroVector());
+  for (unsigned int i = 0; i < sketches.size(); ++i) {
+    std::vector<double> aCdf(0);
+    sketches[i]->uniformlySampledCdf((unsigned int) numEvaluationPointsVec[i],
+                                     minDomainValues[i],
+                                     maxDomainValues[i],
+                                     aCdf);
+    m_sketchCdfValues->setOneDTable(i,aCdf);
+  }
+  m_sketchCdfGrids->setUniformGrids(numEvaluationPointsVec,
+                                    minDomainValues,
+                                    maxDomainValues);
+
+  char strI[65];
+  for (unsigned int i = 0; i < (unsigned int) m_cdfs.MyLength(); ++i) {
+    sprintf(strI,"%u_",i);
+    m_cdfs(i,0) = new uqSampledScalarCdfClass<double>(m_env,
+                                                      ((std::string)(m_prefix)+strI).c_str(),
+                                                      m_sketchCdfGrids->grid(i),
+                                                      m_sketchCdfValues->oneDTable(i));
+  }
+
+  if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 5)) {
+    *m_env.subDisplayFile() << "Leaving uqSampledVectorCdfClass<V,M>::constructor(sketches)"
+                           << ": prefix = " << m_prefix
+                           << std::endl;
+  }
+}
 // Destructor ---------------------------------------
 template<class V,class M>
 uqSampledVectorCdfClass<V,M>::~uqSampledVectorCdfClass()
@@ -484,6 +553,8 @@ uqSampledVectorCdfClass<V,M>::~uqSampledVectorCdfClass()
   for (unsigned int i = 0; i < (unsigned int) m_cdfs.MyLength(); ++i) {
     if (m_cdfs(i,0)) delete m_cdfs(i,0);
   }
+  if (m_sketchCdfValues) delete m_sketchCdfValues;
+  if (m_sketchCdfGrids ) delete m_sketchCdfGrids;
 }
 // Math methods--------------------------------------
 template<class V, class M>
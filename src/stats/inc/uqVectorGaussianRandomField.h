@@ -32,6 +32,7 @@
 #include <uqMatrixCovarianceFunction.h>
 #include <uqVectorFunction.h>
 #include <uqVectorRV.h>
+#include <uqGaussianRandomFieldSampler.h>
 /*! 
  * \file uqVectorGaussianRandomField.h
  * \brief A class for handling Gaussian random fields (GRF).
@@ -83,10 +84,18 @@ class uqVectorGaussianRandomFieldClass
   //! Covariance function; access to protected attribute m_covarianceFunction.
   const uqBaseMatrixCovarianceFunctionClass<P_V,P_M,Q_V,Q_M>& covarianceFunction() const;
   
+  //! Sampler of the last field positions; access to protected attribute m_savedSampler.
+  /*! It tells whether circulant embedding is used (see uqGaussianRandomFieldSamplerClass::usesCirculantEmbedding()).
+   * NULL before the first call to sampleFunction().*/
+  const uqGaussianRandomFieldSamplerClass<Q_V,Q_M>* sampler() const;
+
   //! Function that samples from a Gaussian PDF.
   /*! Given the field positions, this method performs a number of tests, calculates the mean vector,
-   * the covariance matrix and then it samples from a Gaussian random vector as 
-   * many positions as required.*/
+   * factorizes the covariance and then it samples from a Gaussian random vector as
+   * many positions as required. The mean and the factorization are kept for as long as the
+   * positions do not change. Positions on a regular grid, with a stationary covariance function,
+   * are sampled by circulant embedding; other positions use a truncated Karhunen-Loeve expansion
+   * (see uqGaussianRandomFieldSamplerClass).*/
   void                                              sampleFunction(const std::vector<P_V*>& fieldPositions, Q_V& sampleValues);
   //@}
 protected:
@@ -120,11 +129,8 @@ protected:
   //! Vector of the mean value of the RV.
   Q_V*                                              m_savedRvLawExpVector;
   
-  //! Covariance matrix of the RV.
-  Q_M*                                              m_savedRvLawCovMatrix;
-  
-  //! My RV.
-  uqGaussianVectorRVClass<Q_V,Q_M>*                 m_savedRv;
+  //! Sampler of the zero mean part of the RV.
+  uqGaussianRandomFieldSamplerClass<Q_V,Q_M>*       m_savedSampler;
 };
 
 // Default constructor -----------------------------
@@ -144,8 +150,7 @@ uqVectorGaussianRandomFieldClass<P_V,P_M,Q_V,Q_M>::uqVectorGaussianRandomFieldCl
   m_covarianceFunction (covarianceFunction),
   m_savedRvImageSpace  (NULL),
   m_savedRvLawExpVector(NULL),
-  m_savedRvLawCovMatrix(NULL),
-  m_savedRv            (NULL)
+  m_savedSampler       (NULL)
 {
   m_savedPositions.clear();
 }
@@ -153,6 +158,12 @@ uqVectorGaussianRandomFieldClass<P_V,P_M,Q_V,Q_M>::uqVectorGaussianRandomFieldCl
 template <class P_V, class P_M, class Q_V, class Q_M>
 uqVectorGaussianRandomFieldClass<P_V,P_M,Q_V,Q_M>::~uqVectorGaussianRandomFieldClass()
 {
+  delete m_savedSampler;
+  delete m_savedRvLawExpVector;
+  delete m_savedRvImageSpace;
+  for (unsigned int i = 0; i < m_savedPositions.size(); ++i) {
+    delete m_savedPositions[i];
+  }
 }
 // Math methods -------------------------------------
 template <class P_V, class P_M, class Q_V, class Q_M>
@@ -177,6 +188,13 @@ uqVectorGaussianRandomFieldClass<P_V,P_M,Q_V,Q_M>::covarianceFunction() const
 }
 // --------------------------------------------------
 template <class P_V, class P_M, class Q_V, class Q_M>
+const uqGaussianRandomFieldSamplerClass<Q_V,Q_M>*
+uqVectorGaussianRandomFieldClass<P_V,P_M,Q_V,Q_M>::sampler() const
+{
+  return m_savedSampler;
+}
+// --------------------------------------------------
+template <class P_V, class P_M, class Q_V, class Q_M>
 void
 uqVectorGaussianRandomFieldClass<P_V,P_M,Q_V,Q_M>::sampleFunction(const std::vector<P_V*>& fieldPositions, Q_V& sampleValues)
 {
@@ -200,15 +218,13 @@ uqVectorGaussianRandomFieldClass<P_V,P_M,Q_V,Q_M>::sampleFunction(const std::vec
   if ((m_savedPositions.size() == 0   ) &&
       (m_savedRvImageSpace     == NULL) &&
       (m_savedRvLawExpVector   == NULL) &&
-      (m_savedRvLawCovMatrix   == NULL) &&
-      (m_savedRv               == NULL)) {
+      (m_savedSampler          == NULL)) {
     // Ok
   }
   else if ((m_savedPositions.size() != 0   ) &&
            (m_savedRvImageSpace     != NULL) &&
            (m_savedRvLawExpVector   != NULL) &&
-           (m_savedRvLawCovMatrix   != NULL) &&
-           (m_savedRv               != NULL)) {
+           (m_savedSampler          != NULL)) {
     // Ok
   }
   else {
@@ -247,8 +263,7 @@ uqVectorGaussianRandomFieldClass<P_V,P_M,Q_V,Q_M>::sampleFunction(const std::vec
   }
 
   if (instantiate) {
-    delete m_savedRv;
-    delete m_savedRvLawCovMatrix;
+    delete m_savedSampler;
     delete m_savedRvLawExpVector;
     delete m_savedRvImageSpace;
     for (unsigned int i = 0; i < m_savedPositions.size(); ++i) {
@@ -275,72 +290,115 @@ uqVectorGaussianRandomFieldClass<P_V,P_M,Q_V,Q_M>::sampleFunction(const std::vec
       }
     }
 
-    // Set m_savedRvLawCovMatrix
+    // Set m_savedSampler
+    m_savedSampler = new uqGaussianRandomFieldSamplerClass<Q_V,Q_M>(*m_savedRvImageSpace,&(m_imageSetPerIndex.vectorSpace()));
+
     Q_M tmpMat(m_imageSetPerIndex.vectorSpace().zeroVector());
-    m_savedRvLawCovMatrix = new Q_M(m_savedRvImageSpace->zeroVector());
-    if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 3)) {
-      *m_env.subDisplayFile() << "In uqVectorGaussianRandomFieldClass<P_V,P_M,Q_V,Q_M>::sampleFunction()"
-                              << ": m_savedRvLawCovMatrix order = " << m_savedRvLawCovMatrix->numCols()
-                              << ", numberOfPositions = "           << numberOfPositions
-                              << ", tmpMat order = "                << tmpMat.numCols()
-                              << ", numberOfImageValuesPerIndex = " << numberOfImageValuesPerIndex
-                              << std::endl;
+    std::vector<unsigned int> gridCounts (0);
+    std::vector<double>       gridSpacings(0);
+    std::vector<unsigned int> gridIndices(0);
+    bool usesCirculantEmbedding = false;
+    if (m_covarianceFunction.isStationary() &&
+        uqGaussianRandomFieldSamplerClass<Q_V,Q_M>::regularGrid(fieldPositions,gridCounts,gridSpacings,gridIndices)) {
+      // Only the covariances between the grid corner and the lags of the embedding are needed
+      unsigned int cornerPos = 0;
+      while (gridIndices[cornerPos] != 0) ++cornerPos;
+      const P_V& corner = *(fieldPositions[cornerPos]);
+      P_V lagPosition(corner);
+
+      unsigned int blockSq = numberOfImageValuesPerIndex*numberOfImageValuesPerIndex;
+      std::vector<unsigned int> counts      (0);
+      std::vector<int>          lag         (0);
+      std::vector<double>       embeddedCovs(0);
+      for (unsigned int refinement = 1;
+           (refinement <= UQ_GRF_SAMPLER_MAX_EMBEDDING_REFINEMENT) && !usesCirculantEmbedding;
+           refinement *= 2) {
+        uqGaussianRandomFieldSamplerClass<Q_V,Q_M>::embeddingCounts(gridCounts,refinement,counts);
+        unsigned int numEmbeddingPoints = 1;
+        for (unsigned int d = 0; d < counts.size(); ++d) {
+          numEmbeddingPoints *= counts[d];
+        }
+        embeddedCovs.resize(numEmbeddingPoints*blockSq,0.);
+        for (unsigned int e = 0; e < numEmbeddingPoints; ++e) {
+          uqGaussianRandomFieldSamplerClass<Q_V,Q_M>::embeddingLag(e,counts,lag);
+          for (unsigned int d = 0; d < lag.size(); ++d) {
+            lagPosition[d] = corner[d] + ((double) lag[d])*gridSpacings[d];
+          }
+          m_covarianceFunction.covMatrix(lagPosition,corner,tmpMat);
+          for (unsigned int k1 = 0; k1 < numberOfImageValuesPerIndex; ++k1) {
+            for (unsigned int k2 = 0; k2 < numberOfImageValuesPerIndex; ++k2) {
+              embeddedCovs[e*blockSq + k1*numberOfImageValuesPerIndex + k2] = tmpMat(k1,k2);
+            }
+          }
+        }
+        usesCirculantEmbedding = m_savedSampler->setCirculantEmbedding(gridCounts,gridIndices,counts,embeddedCovs);
+      }
     }
-    for (unsigned int i = 0; i < numberOfPositions; ++i) {
-      for (unsigned int j = 0; j < numberOfPositions; ++j) {
-        m_covarianceFunction.covMatrix(*(fieldPositions[i]),*(fieldPositions[j]),tmpMat);
+
+    if (!usesCirculantEmbedding) {
+      // The covariance matrix is symmetric, so each pair of positions is visited once
+      Q_M covMatrix(m_savedRvImageSpace->zeroVector());
+      if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 3)) {
+        *m_env.subDisplayFile() << "In uqVectorGaussianRandomFieldClass<P_V,P_M,Q_V,Q_M>::sampleFunction()"
+                                << ": covMatrix order = "             << covMatrix.numCols()
+                                << ", numberOfPositions = "           << numberOfPositions
+                                << ", tmpMat order = "                << tmpMat.numCols()
+                                << ", numberOfImageValuesPerIndex = " << numberOfImageValuesPerIndex
+                                << std::endl;
+      }
+      for (unsigned int i = 0; i < numberOfPositions; ++i) {
+        for (unsigned int j = i; j < numberOfPositions; ++j) {
+          m_covarianceFunction.covMatrix(*(fieldPositions[i]),*(fieldPositions[j]),tmpMat);
 #if 1
-        Q_M testMat(tmpMat);
-        if (testMat.chol() != 0) {
-          *m_env.subDisplayFile() << "In uqVectorGaussianRandomFieldClass<P_V,P_M,Q_V,Q_M>::sampleFunction()"
-                                  << ": i = " << i
-                                  << ", j = " << j
-                                  << ", *(fieldPositions[i]) = " << *(fieldPositions[i])
-                                  << ", *(fieldPositions[j]) = " << *(fieldPositions[j])
-                                  << ", tmpMat = "               << tmpMat
-                                  << ", testMat = "              << testMat
-                                  << ", tmpMat is not positive definite"
-                                  << std::endl;
-          UQ_FATAL_TEST_MACRO(true,
-                              m_env.fullRank(),
-                              "uqVectorGaussianRandomFieldClass<P_V,P_M,Q_V,Q_M>::sampleFunction()",
-                              "tmpMat is not positive definite");
-        }
+          Q_M testMat(tmpMat);
+          if (testMat.chol() != 0) {
+            *m_env.subDisplayFile() << "In uqVectorGaussianRandomFieldClass<P_V,P_M,Q_V,Q_M>::sampleFunction()"
+                                    << ": i = " << i
+                                    << ", j = " << j
+                                    << ", *(fieldPositions[i]) = " << *(fieldPositions[i])
+                                    << ", *(fieldPositions[j]) = " << *(fieldPositions[j])
+                                    << ", tmpMat = "               << tmpMat
+                                    << ", testMat = "              << testMat
+                                    << ", tmpMat is not positive definite"
+                                    << std::endl;
+            UQ_FATAL_TEST_MACRO(true,
+                                m_env.fullRank(),
+                                "uqVectorGaussianRandomFieldClass<P_V,P_M,Q_V,Q_M>::sampleFunction()",
+                                "tmpMat is not positive definite");
+          }
 #endif
-        for (unsigned int k1 = 0; k1 < numberOfImageValuesPerIndex; ++k1) {
-          for (unsigned int k2 = 0; k2 < numberOfImageValuesPerIndex; ++k2) {
-            unsigned int tmpI = i*numberOfImageValuesPerIndex + k1;
-            unsigned int tmpJ = j*numberOfImageValuesPerIndex + k2;
-            (*m_savedRvLawCovMatrix)(tmpI,tmpJ) = tmpMat(k1,k2);
-            if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 3)) {
-              *m_env.subDisplayFile() << "In uqVectorGaussianRandomFieldClass<P_V,P_M,Q_V,Q_M>::sampleFunction()"
-                                      << ": i = " << i
-                                      << ", j = " << j
-                                      << ", k1 = " << k1
-                                      << ", k2 = " << k2
-                                      << ", tmpI = " << tmpI
-                                      << ", tmpJ = " << tmpJ
-                                      << ", *(fieldPositions[i]) = " << *(fieldPositions[i])
-                                      << ", *(fieldPositions[j]) = " << *(fieldPositions[j])
-                                      << ", (*m_savedRvLawCovMatrix)(tmpI,tmpJ) = " << (*m_savedRvLawCovMatrix)(tmpI,tmpJ)
-                                      << std::endl;
+          for (unsigned int k1 = 0; k1 < numberOfImageValuesPerIndex; ++k1) {
+            for (unsigned int k2 = 0; k2 < numberOfImageValuesPerIndex; ++k2) {
+              unsigned int tmpI = i*numberOfImageValuesPerIndex + k1;
+              unsigned int tmpJ = j*numberOfImageValuesPerIndex + k2;
+              covMatrix(tmpI,tmpJ) = tmpMat(k1,k2);
+              covMatrix(tmpJ,tmpI) = tmpMat(k1,k2);
+              if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 3)) {
+                *m_env.subDisplayFile() << "In uqVectorGaussianRandomFieldClass<P_V,P_M,Q_V,Q_M>::sampleFunction()"
+                                        << ": i = " << i
+                                        << ", j = " << j
+                                        << ", k1 = " << k1
+                                        << ", k2 = " << k2
+                                        << ", tmpI = " << tmpI
+                                        << ", tmpJ = " << tmpJ
+                                        << ", *(fieldPositions[i]) = " << *(fieldPositions[i])
+                                        << ", *(fieldPositions[j]) = " << *(fieldPositions[j])
+                                        << ", covMatrix(tmpI,tmpJ) = " << covMatrix(tmpI,tmpJ)
+                                        << std::endl;
+              }
             }
           }
         }
       }
+      m_savedSampler->setKarhunenLoeve(covMatrix);
     }
 
-    // Set m_savedRv
-    m_savedRv = new uqGaussianVectorRVClass<Q_V,Q_M>("grf_",
-                                                     *m_savedRvImageSpace,
-                                                     *m_savedRvLawExpVector,
-                                                     *m_savedRvLawCovMatrix);
-
     if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 3)) {
       *m_env.subDisplayFile() << "In uqVectorGaussianRandomFieldClass<P_V,P_M,Q_V,Q_M>::sampleFunction()"
-                              << ": just instantiated Gaussian RV"
+                              << ": just set up sampler"
+                              << ", usesCirculantEmbedding = " << m_savedSampler->usesCirculantEmbedding()
+                              << ", numModes = "               << m_savedSampler->numModes()
                               << "\n *m_savedRvLawExpVector = " << *m_savedRvLawExpVector
-                              << "\n *m_savedRvLawCovMatrix = " << *m_savedRvLawCovMatrix
                               << std::endl;
       for (unsigned int i = 0; i < numberOfPositions; ++i) {
         *m_env.subDisplayFile() << " *(m_savedPositions[" << i
@@ -356,7 +414,8 @@ uqVectorGaussianRandomFieldClass<P_V,P_M,Q_V,Q_M>::sampleFunction(const std::vec
                             << ": about to realize sample values"
                             << std::endl;
   }
-  m_savedRv->realizer().realization(sampleValues);
+  m_savedSampler->realization(sampleValues);
+  sampleValues += *m_savedRvLawExpVector;
   if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 3)) {
     *m_env.subDisplayFile() << "In uqVectorGaussianRandomFieldClass<P_V,P_M,Q_V,Q_M>::sampleFunction()"
                             << ": just realized sample values"
@@ -388,16 +388,22 @@ void
 uqGaussianVectorRealizerClass<V,M>::realization(V& nextValues) const
 {
   V iidGaussianVector(m_unifiedImageSet.vectorSpace().zeroVector());
+  V workVector       (iidGaussianVector);
 
   bool outOfSupport = true;
   do {
     iidGaussianVector.cwSetGaussian(0.0, 1.0);
 
+    // nextValues = mean + L*iid (or mean + U*(Ssqrt*(Vt*iid))), without temporary vectors
     if (m_lowerCholLawCovMatrix) {
-      nextValues = (*m_unifiedLawExpVector) + (*m_lowerCholLawCovMatrix)*iidGaussianVector;
+      m_lowerCholLawCovMatrix->multiply(iidGaussianVector,nextValues);
+      nextValues += (*m_unifiedLawExpVector);
     }
     else if (m_matU && m_vecSsqrt && m_matVt) {
-      nextValues = (*m_unifiedLawExpVector) + (*m_matU)*( (*m_vecSsqrt) * ((*m_matVt)*iidGaussianVector) );
+      m_matVt->multiply(iidGaussianVector,workVector);
+      workVector *= (*m_vecSsqrt);
+      m_matU->multiply(workVector,nextValues);
+      nextValues += (*m_unifiedLawExpVector);
     }
     else {
       UQ_FATAL_TEST_MACRO(true,
@@ -1176,16 +1182,22 @@ void
 uqLogNormalVectorRealizerClass<V,M>::realization(V& nextValues) const
 {
   V iidGaussianVector(m_unifiedImageSet.vectorSpace().zeroVector());
+  V workVector       (iidGaussianVector);
 
   bool outOfSupport = true;
   do {
     iidGaussianVector.cwSetGaussian(0.0, 1.0);
 
+    // nextValues = mean + L*iid (or mean + U*(Ssqrt*(Vt*iid))), without temporary vectors
     if (m_lowerCholLawCovMatrix) {
-      nextValues = (*m_unifiedLawExpVector) + (*m_lowerCholLawCovMatrix)*iidGaussianVector;
+      m_lowerCholLawCovMatrix->multiply(iidGaussianVector,nextValues);
+      nextValues += (*m_unifiedLawExpVector);
     }
     else if (m_matU && m_vecSsqrt && m_matVt) {
-      nextValues = (*m_unifiedLawExpVector) + (*m_matU)*( (*m_vecSsqrt) * ((*m_matVt)*iidGaussianVector) );
+      m_matVt->multiply(iidGaussianVector,workVector);
+      workVector *= (*m_vecSsqrt);
+      m_matU->multiply(workVector,nextValues);
+      nextValues += (*m_unifiedLawExpVector);
     }
     else {
       UQ_FATAL_TEST_MACRO(true,
@@ -0,0 +1,120 @@
+#!/usr/bin/perl
+#
+#------------------------------------------------------------------------------
+# Timing comparison tool for QUESO benchmark results.
+#
+# Both files hold '<name> <numReps> <seconds> <secondsPerRep>' lines, as
+# written by queso_bench and run_bench.sh. A kernel fails when its time per
+# repetition exceeds the baseline one by more than the relative tolerance.
+#------------------------------------------------------------------------------
+
+use warnings;
+
+my $DEFAULT_TOL = 0.25;
+
+if (@ARGV >= 2) {
+    $file1 = shift @ARGV;
+    $file2 = shift @ARGV;
+} else {
+    print "\nUsage: bench_compare.pl [results] [baseline] <relative tolerance>\n\n";
+    exit 0;
+}
+
+if (@ARGV == 1) {
+    $TOL = shift @ARGV;
+} else {
+    $TOL = $DEFAULT_TOL;
+}
+
+#------------------------------------------
+# Parsing routine
+# -> returns number of processes and a hash
+#    name -> seconds per repetition
+#------------------------------------------
+
+sub parse_bench_output {
+
+    my ($infile) = @_;		# INPUT: filename to parse
+
+    my %times  = ();
+    my $nprocs = 0;
+
+    open(my $IN1, "<$infile") || die "Cannot open $infile\n";
+
+    while (my $line = <$IN1>)
+    {
+	if($line =~ m/^#\s*nprocs\s+(\d+)/) {
+	    $nprocs = $1;
+	}
+	elsif($line =~ m/^#/) {
+	    next;
+	}
+	elsif($line =~ m/^(\S+)\s+(\d+)\s+(\S+)\s+(\S+)/) {
+	    $times{$1} = $4;
+	}
+    }
+
+    close $IN1;
+
+    return ($nprocs,\%times);
+}
+
+my ($nprocs1,$times1_ref) = parse_bench_output ( $file1 );
+my ($nprocs2,$times2_ref) = parse_bench_output ( $file2 );
+
+my %times1 = %$times1_ref;
+my %times2 = %$times2_ref;
+
+my $num_times = keys %times1;
+
+print "\nQUESO: Comparing $num_times timings using a relative tolerance of: $TOL\n";
+print " --> ($file1 <-> $file2)\n";
+
+if ($num_times <= 0) {
+    print "Error: No timing data available in $file1 (or format changed)\n";
+    print "\nFAILED\n";
+    exit -1;
+}
+
+# Timings are only comparable for the same process count.
+
+if ($nprocs1 != $nprocs2) {
+    print "Error: # of processes do not agree ($nprocs1,$nprocs2)\n";
+    print "\nFAILED\n";
+    exit -1;
+}
+
+my $success=1;
+
+foreach my $name (sort keys %times1) {
+
+    if (!exists $times2{$name}) {
+	print " --> New         $name -> $times1{$name} s (no baseline)\n";
+	next;
+    }
+
+    my $ratio = ($times2{$name} > 0) ? $times1{$name}/$times2{$name} : 1;
+    my $line  = sprintf("%-45s %12.5e s vs %12.5e s -> [ratio = %.3f]",
+			$name,$times1{$name},$times2{$name},$ratio);
+
+    if ($ratio <= 1 + $TOL) {
+	print " --> Within tol. $line\n";
+    } else {
+	print " --> Slower      $line\n";
+	$success=0;
+    }
+}
+
+foreach my $name (sort keys %times2) {
+    if (!exists $times1{$name}) {
+	print " --> Missing     $name (in baseline only)\n";
+    }
+}
+
+if ($success == 1) {
+    print " --> PASSED\n";
+    exit 0;
+} else {
+    print " --> FAILED\n";
+    exit -1;
+}
@@ -0,0 +1,57 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+// 
+// QUESO - a library to support the Quantification of Uncertainty
+// for Estimation, Simulation and Optimization
+//
+// Copyright (C) 2008,2009,2010,2011,2012,2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor, 
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+// 
+// $Id:$
+//
+//--------------------------------------------------------------------------
+
+#ifndef __BENCH_KERNELS_H__
+#define __BENCH_KERNELS_H__
+
+#include <uqEnvironment.h>
+#include <string>
+#include <vector>
+
+// One timed measurement: 'numReps' executions of a kernel took 'seconds'
+struct benchResult_DataType
+{
+  std::string  name;
+  unsigned int numReps;
+  double       seconds;
+};
+
+// Microbenchmarks of the library hot paths. The number of repetitions of
+// every kernel is multiplied by 'repsScale'. Calling a benchmark several
+// times with the same 'results' keeps the fastest trial of each entry.
+void benchGslMatrixKernels    (const uqFullEnvironmentClass& env, unsigned int repsScale, std::vector<benchResult_DataType>& results);
+void benchGaussianJointPdf    (const uqFullEnvironmentClass& env, unsigned int repsScale, std::vector<benchResult_DataType>& results);
+void benchMetropolisHastings  (const uqFullEnvironmentClass& env, unsigned int repsScale, std::vector<benchResult_DataType>& results);
+void benchSequenceOfVectors   (const uqFullEnvironmentClass& env, unsigned int repsScale, std::vector<benchResult_DataType>& results);
+void benchMLResampling        (const uqFullEnvironmentClass& env, unsigned int repsScale, std::vector<benchResult_DataType>& results);
+
+// Prints results in the 'name numReps seconds secondsPerRep' format read by
+// bench_compare.pl; the slowest process of the full communicator is reported
+void benchWriteResults        (const uqFullEnvironmentClass& env, const std::vector<benchResult_DataType>& results, std::ostream& os);
+
+#endif
@@ -0,0 +1,116 @@
+#!/bin/bash
+#----------------------------------------------------------
+# Performance benchmarks for QUESO
+#
+# 1. Microbenchmarks of the library kernels (queso_bench).
+# 2. End-to-end timings of the regression examples.
+# 3. Optional comparison against a stored baseline.
+#
+# Environment variables:
+#   MPIEXEC         launcher prefix, e.g. "mpirun -np 4"
+#                   (empty: run serially)
+#   REPS_SCALE      multiplies the repetitions of every microbenchmark
+#   BENCH_TRIALS    trials per microbenchmark, the fastest is kept (default: 3)
+#   BENCH_RESULTS   results file (default: bench_results.txt)
+#   BENCH_BASELINE  baseline file (default: $srcdir/bench_baseline.txt,
+#                   empty: no comparison)
+#   BENCH_TOLERANCE relative slowdown allowed per entry (default: 0.25)
+#   GPMSA_EXE       optional GPMSA executable, e.g. gpmsaTower's tower_gsl,
+#   GPMSA_ARGS      its command line arguments,
+#   GPMSA_DIR       and the directory it must run from (default: scratch)
+#----------------------------------------------------------
+
+COMMONDIR="$srcdir/../common"
+SRCDIR=`cd $srcdir && pwd`
+RUNDIR=`pwd`
+
+RESULTS="${BENCH_RESULTS:-bench_results.txt}"
+BASELINE="${BENCH_BASELINE-$SRCDIR/bench_baseline.txt}"
+TOLERANCE="${BENCH_TOLERANCE:-0.25}"
+SCALE="${REPS_SCALE:-1}"
+TRIALS="${BENCH_TRIALS:-3}"
+
+. $COMMONDIR/verify.sh
+
+case "$RESULTS" in
+    /*) ;;
+    *)  RESULTS="$RUNDIR/$RESULTS" ;;
+esac
+
+#------------------------------------------------------------------------------
+# Runs one end-to-end scenario, in its own scratch directory unless
+# SCENARIO_DIR is set, and appends its wall clock time to the results file.
+#
+# Usage: run_scenario <name> <executable> <arguments...>
+#------------------------------------------------------------------------------
+
+function run_scenario {
+    local name=$1
+    local exe=$2
+    shift 2
+
+    verify_file_exists $exe
+
+    if [ -n "$SCENARIO_DIR" ];then
+	cd $SCENARIO_DIR
+    else
+	rm -rf $RUNDIR/bench_$name
+	mkdir -p $RUNDIR/bench_$name
+	cd $RUNDIR/bench_$name
+    fi
+
+    local t0=`date +%s.%N`
+    $MPIEXEC $exe "$@" >& /dev/null
+    local status=$?
+    local t1=`date +%s.%N`
+
+    cd $RUNDIR
+
+    if [ $status -ne 0 ];then
+	message_fail "Scenario $name returned $status"
+    fi
+
+    echo "e2e.$name 1 $t0 $t1" | awk '{ s = $4 - $3; printf "%s %d %g %g\n", $1, $2, s, s }' >> $RESULTS
+}
+
+#----------------
+# Microbenchmarks
+#----------------
+
+verify_file_exists ./queso_bench
+verify_file_exists $SRCDIR/bench.inp
+
+rm -rf ./outputData
+
+$MPIEXEC ./queso_bench $SRCDIR/bench.inp $RESULTS $SCALE $TRIALS >& /dev/null || \
+    message_fail "queso_bench failed"
+
+#------------------------
+# End-to-end scenarios
+#------------------------
+
+run_scenario t02_sip_sfp $RUNDIR/../t02_sip_sfp/SipSfpExample_gsl $SRCDIR/../t02_sip_sfp/example.inp
+run_scenario t03_sequence $RUNDIR/../t03_sequence/SequenceExample_gsl $SRCDIR/../t03_sequence/example.inp
+run_scenario t04_bimodal $RUNDIR/../t04_bimodal/BimodalExample_gsl $SRCDIR/../t04_bimodal/example_1chain.inp
+
+if [ -n "$GPMSA_EXE" ];then
+    SCENARIO_DIR=$GPMSA_DIR run_scenario gpmsa $GPMSA_EXE $GPMSA_ARGS
+fi
+
+cat $RESULTS
+
+#----------------------
+# Baseline comparison
+#----------------------
+
+if [ -z "$BASELINE" ];then
+    echo " "
+    echo "Baseline comparison disabled."
+elif [ -e "$BASELINE" ];then
+    $SRCDIR/bench_compare.pl $RESULTS $BASELINE $TOLERANCE || \
+	message_fail "Benchmarks slower than $BASELINE"
+    message_passed "Benchmarks (baseline $BASELINE)"
+else
+    echo " "
+    echo "No baseline found at $BASELINE; run 'make bench-baseline' to store one."
+fi
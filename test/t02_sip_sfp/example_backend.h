@@ -0,0 +1,48 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+// 
+// QUESO - a library to support the Quantification of Uncertainty
+// for Estimation, Simulation and Optimization
+//
+// Copyright (C) 2008,2009,2010,2011,2012,2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor, 
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+// 
+// $Id$
+//
+//--------------------------------------------------------------------------
+
+#ifndef __EX_BACKEND_H__
+#define __EX_BACKEND_H__
+
+// Vector and matrix classes used by this example: the GSL ones by default,
+// or the fixed dimension ones when QUESO_EXAMPLE_FIXED_BACKEND is defined.
+#ifdef QUESO_EXAMPLE_FIXED_BACKEND
+#include <uqFixedVectorSpace.h>
+typedef uqFixedVectorClass<2> exParamVectorClass;
+typedef uqFixedMatrixClass<2> exParamMatrixClass;
+typedef uqFixedVectorClass<1> exQoiVectorClass;
+typedef uqFixedMatrixClass<1> exQoiMatrixClass;
+#else
+#include <uqGslMatrix.h>
+typedef uqGslVectorClass exParamVectorClass;
+typedef uqGslMatrixClass exParamMatrixClass;
+typedef uqGslVectorClass exQoiVectorClass;
+typedef uqGslMatrixClass exQoiMatrixClass;
+#endif
+
+#endif
@@ -28,7 +28,7 @@
 #ifndef __EX_QOI_H__
 #define __EX_QOI_H__
 
-#include <uqGslMatrix.h>
+#include <example_backend.h>
 #include <uqDistArray.h>
 
 struct
@@ -40,12 +40,12 @@ qoiRoutine_DataType
 
 void
 qoiRoutine(
-  const uqGslVectorClass&                    paramValues,
-  const uqGslVectorClass*                    paramDirection,
-  const void*                                functionDataPtr,
-        uqGslVectorClass&                    qoiValues,
-        uqDistArrayClass<uqGslVectorClass*>* gradVectors,
-        uqDistArrayClass<uqGslMatrixClass*>* hessianMatrices,
-        uqDistArrayClass<uqGslVectorClass*>* hessianEffects);
+  const exParamVectorClass&                    paramValues,
+  const exParamVectorClass*                    paramDirection,
+  const void*                                  functionDataPtr,
+        exQoiVectorClass&                      qoiValues,
+        uqDistArrayClass<exParamVectorClass*>* gradVectors,
+        uqDistArrayClass<exParamMatrixClass*>* hessianMatrices,
+        uqDistArrayClass<exParamVectorClass*>* hessianEffects);
 
 #endif
@@ -0,0 +1,62 @@
+#!/bin/bash
+#----------------------------------------------------------
+# PECOS Regression tests for QUESO
+# 
+# 1. Fixed-dimension backend against the GSL backend:
+#    both builds of the example must give the same output
+#
+#----------------------------------------------------------
+
+COMMONDIR="$srcdir/../common"
+
+#----------------
+# Initialization
+#----------------
+
+RUNDIR=`pwd`
+
+. $COMMONDIR/verify.sh
+
+#------------------------------------------------------------------------------
+#------------------------------------------------------------------------------
+#
+# Regresion Test #1: fixed-dimension backend against the GSL backend
+
+SOLDIR="outputData"
+EXE_GSL="./SequenceExample_gsl"
+EXE_FIXED="./SequenceExample_fixed"
+INFILE="$srcdir/example.inp"
+TESTNAME='Test 3 (sequence example, fixed backend)'
+
+verify_file_exists $EXE_GSL
+verify_file_exists $EXE_FIXED
+verify_file_exists $INFILE
+
+# Run both builds; the example prints its sequence statistics
+
+rm -rf ./$SOLDIR
+mkdir -p ./$SOLDIR
+
+./$EXE_GSL   $INFILE > $SOLDIR/stdout_gsl   2> /dev/null
+./$EXE_FIXED $INFILE > $SOLDIR/stdout_fixed 2> /dev/null
+
+# Verify results
+
+grep "Vec = \|Mat = " $SOLDIR/stdout_gsl   > $SOLDIR/nada0
+grep "Vec = \|Mat = " $SOLDIR/stdout_fixed > $SOLDIR/nada1
+
+igot=0
+if [ ! -s $SOLDIR/nada0 ];then
+    igot=1
+fi
+diff $SOLDIR/nada0 $SOLDIR/nada1
+let igot="$igot + $?"
+
+if [ $igot -eq 0 ];then
+    message_passed "$TESTNAME"
+else
+  message_fail "$TESTNAME failed verification"
+fi
+
+#------------------------------------------------------------------------------
+#------------------------------------------------------------------------------
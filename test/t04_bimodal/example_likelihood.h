@@ -28,21 +28,21 @@
 #ifndef __EX_LIKELIHOOD_H__
 #define __EX_LIKELIHOOD_H__
 
-#include <uqGslMatrix.h>
+#include <example_backend.h>
 
 struct
 likelihoodRoutine_DataType
 {
-  const uqGslVectorClass* meanVector;
-  const uqGslMatrixClass* covMatrix;
+  const exParamVectorClass* meanVector;
+  const exParamMatrixClass* covMatrix;
 };
 
 double likelihoodRoutine(
-  const uqGslVectorClass& paramValues,
-  const uqGslVectorClass* paramDirection,
-  const void*             functionDataPtr,
-  uqGslVectorClass*       gradVector,
-  uqGslMatrixClass*       hessianMatrix,
-  uqGslVectorClass*       hessianEffect);
+  const exParamVectorClass& paramValues,
+  const exParamVectorClass* paramDirection,
+  const void*               functionDataPtr,
+  exParamVectorClass*       gradVector,
+  exParamMatrixClass*       hessianMatrix,
+  exParamVectorClass*       hessianEffect);
 
 #endif
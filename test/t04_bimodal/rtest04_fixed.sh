@@ -0,0 +1,75 @@
+#!/bin/bash
+#----------------------------------------------------------
+# PECOS Regression tests for QUESO
+# 
+# 1. Fixed-dimension backend against the GSL backend:
+#    both builds of the example must give the same output
+#
+#----------------------------------------------------------
+
+TOLERANCE="1e-8"	                   # solution diff tolerance (absolute)
+SAVELOG=0		                   # Log model output?
+COMMONDIR="$srcdir/../common"
+
+#----------------
+# Initialization
+#----------------
+
+RUNDIR=`pwd`
+
+. $COMMONDIR/verify.sh
+
+#------------------------------------------------------------------------------
+#------------------------------------------------------------------------------
+#
+# Regresion Test #1: fixed-dimension backend against the GSL backend
+
+SOLDIR="outputData"
+GSLDIR="outputData_gsl"
+EXE_GSL="./BimodalExample_gsl"
+EXE_FIXED="./BimodalExample_fixed"
+INFILE="$srcdir/example_1chain.inp"
+TESTNAME='Test 4 (bimodal example, fixed backend)'
+
+verify_file_exists $EXE_GSL
+verify_file_exists $EXE_FIXED
+verify_file_exists $INFILE
+
+# Run the GSL build, keep its output aside, then run the fixed build
+
+rm -rf ./$SOLDIR ./$GSLDIR
+
+if [ $SAVELOG -eq 1 ];then
+    ./$EXE_GSL $INFILE
+else
+    ./$EXE_GSL $INFILE >& /dev/null
+fi
+mv ./$SOLDIR ./$GSLDIR
+
+if [ $SAVELOG -eq 1 ];then
+    ./$EXE_FIXED $INFILE
+else
+    ./$EXE_FIXED $INFILE >& /dev/null
+fi
+
+# Verify results
+
+igot=0
+
+for file in rawChain_ml.m ; do
+
+    verify_file_exists $SOLDIR/$file
+    verify_file_exists $GSLDIR/$file
+    $COMMONDIR/compare.pl $SOLDIR/$file $GSLDIR/$file $TOLERANCE
+    let igot="$igot + $?"
+
+done
+
+if [ $igot -eq 0 ];then
+    message_passed "$TESTNAME"
+else
+  message_fail "$TESTNAME failed verification"
+fi
+
+#------------------------------------------------------------------------------
+#------------------------------------------------------------------------------